@@ -0,0 +1,111 @@
+/*************************************************************************
+	> File Name: algorithm_bench.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 06:49:02 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_ALGORITHM_BENCH_H__
+#define LEPTSTL_ALGORITHM_BENCH_H__
+
+/* 算法的性能测试，对应 test/algorithm_performance_test.h 中的 sort 与 binary_search
+ * 算法没有容器，结果中的 container 一栏记为实现所在的名字空间*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "../leptSTL/algorithm.h"
+#include "lept_bench.h"
+
+namespace leptstl
+{
+    namespace bench
+    {
+        namespace algorithm_bench
+        {
+            /* 固定种子的随机数组，保证每次运行的输入相同
+             * 测试函数会被反复调用（调整迭代次数、预热、每一轮），生成过的数组缓存起来，不重复生成*/
+            inline const std::vector<int>& random_ints(size_t n, unsigned seed, bool sorted = false)
+            {
+                static std::map<std::pair<size_t, unsigned>, std::vector<int>> cache;
+                std::vector<int>& v = cache[std::make_pair(n, seed)];
+                if (v.size() != n)
+                {
+                    v.resize(n);
+                    srand(seed);
+                    for (size_t i = 0; i < n; ++i)
+                        v[i] = rand();
+                    if (sorted)
+                        std::sort(v.begin(), v.end());
+                }
+                return v;
+            }
+
+            /* 每次迭代前恢复成同一个乱序数组，只对排序计时*/
+            template <typename Sort>
+                void sort_bench(state& st, Sort sort)
+                {
+                    st.pause_timing();
+                    const std::vector<int>& input = random_ints(static_cast<size_t>(st.arg()), 1);
+                    std::vector<int> v(input.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        st.pause_timing();
+                        std::copy(input.begin(), input.end(), v.begin());
+                        st.resume_timing();
+                        sort(v.data(), v.data() + v.size());
+                        do_not_optimize(v.data());
+                        clobber_memory();
+                    }
+                }
+
+            /* 每次迭代是一次查找，查找的值取自预先生成的随机序列*/
+            template <typename Search>
+                void binary_search_bench(state& st, Search search)
+                {
+                    st.pause_timing();
+                    const std::vector<int>& v = random_ints(static_cast<size_t>(st.arg()), 2, true);
+                    const std::vector<int>& keys = random_ints(4096, 3);
+                    size_t hits = 0;
+                    st.resume_timing();
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        bool found = search(v.data(), v.data() + v.size(), keys[i & 4095]);
+                        do_not_optimize(found);
+                        hits += found;
+                    }
+                    do_not_optimize(hits);
+                }
+
+            LEPTSTL_BENCH_(std_sort, "std", "sort", 1000, 100000, 1000000)
+            {
+                sort_bench(st, [](int* first, int* last) { std::sort(first, last); });
+            }
+
+            LEPTSTL_BENCH_(leptstl_sort, "leptstl", "sort", 1000, 100000, 1000000)
+            {
+                sort_bench(st, [](int* first, int* last) { leptstl::sort(first, last); });
+            }
+
+            LEPTSTL_BENCH_(std_binary_search, "std", "binary_search", 1000, 100000, 10000000)
+            {
+                binary_search_bench(st, [](const int* first, const int* last, int key)
+                                    { return std::binary_search(first, last, key); });
+            }
+
+            LEPTSTL_BENCH_(leptstl_binary_search, "leptstl", "binary_search", 1000, 100000, 10000000)
+            {
+                binary_search_bench(st, [](const int* first, const int* last, int key)
+                                    { return leptstl::binary_search(first, last, key); });
+            }
+
+        }   /* namespace algorithm_bench */
+
+    }   /* namespace bench */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_ALGORITHM_BENCH_H__ */
@@ -0,0 +1,63 @@
+/*************************************************************************
+	> File Name: alloc_counter.cpp
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 11:52:03 AM EDT
+ ************************************************************************/
+
+/* 替换全局的 operator new / delete，内存仍来自 malloc / free，只多一次计数
+ * 测试都是单线程的，但计数用 relaxed 原子操作，多线程的测试也不会出错*/
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "alloc_counter.h"
+
+namespace
+{
+    std::atomic<uint64_t> allocation_count(0);
+    std::atomic<uint64_t> allocation_bytes(0);
+
+    void* counted_malloc(size_t n)
+    {
+        allocation_count.fetch_add(1, std::memory_order_relaxed);
+        allocation_bytes.fetch_add(n, std::memory_order_relaxed);
+        return std::malloc(n == 0 ? 1 : n);
+    }
+
+    void* counted_new(size_t n)
+    {
+        void* p = counted_malloc(n);
+        while (p == nullptr)
+        {
+            std::new_handler handler = std::get_new_handler();
+            if (handler == nullptr)
+                throw std::bad_alloc();
+            handler();
+            p = std::malloc(n == 0 ? 1 : n);
+        }
+        return p;
+    }
+}
+
+namespace leptstl
+{
+    namespace bench
+    {
+        uint64_t heap_allocations() { return allocation_count.load(std::memory_order_relaxed); }
+        uint64_t heap_bytes()       { return allocation_bytes.load(std::memory_order_relaxed); }
+    }
+}
+
+void* operator new(size_t n)                                  { return counted_new(n); }
+void* operator new[](size_t n)                                { return counted_new(n); }
+void* operator new(size_t n, const std::nothrow_t&) noexcept   { return counted_malloc(n); }
+void* operator new[](size_t n, const std::nothrow_t&) noexcept { return counted_malloc(n); }
+
+void operator delete(void* p) noexcept                          { std::free(p); }
+void operator delete[](void* p) noexcept                        { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept   { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept                  { std::free(p); }
+void operator delete[](void* p, size_t) noexcept                { std::free(p); }
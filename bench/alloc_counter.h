@@ -0,0 +1,29 @@
+/*************************************************************************
+	> File Name: alloc_counter.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 11:47:20 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_ALLOC_COUNTER_H__
+#define LEPTSTL_ALLOC_COUNTER_H__
+
+/* 性能测试程序替换了全局的 operator new / delete（见 alloc_counter.cpp），统计堆分配的次数与字节数
+ * std 容器与 leptstl 容器都经过 operator new，两边的每次操作分配次数可以直接比较
+ * 计数只在分配时加一，不影响被测代码的行为；leptstl 按元素类型的详细统计见 leptSTL/alloc_stats.h*/
+
+#include <cstdint>
+
+namespace leptstl
+{
+    namespace bench
+    {
+        /* 到目前为止的分配次数与字节数*/
+        uint64_t heap_allocations();
+        uint64_t heap_bytes();
+
+    }   /* namespace bench */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_ALLOC_COUNTER_H__ */
@@ -0,0 +1,127 @@
+/*************************************************************************
+	> File Name: bench_compare.cpp
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 08:16:30 AM EDT
+ ************************************************************************/
+
+/* 用法：leptstl_bench_compare 基准文件 新文件 [--threshold=百分比]
+ * 按名称配对比较两次 leptstl_bench 的结果（JSON 或 CSV），逐项输出耗时中位数与分配次数的变化
+ * 判为退化的条件：中位数变慢超过阈值（默认5%），并且新的中位数高于基准的 p95，即超出基准自身的波动范围；
+ * 或者每次操作的分配次数增加超过阈值
+ * 存在退化时返回1，参数或文件错误时返回2，否则返回0，可以直接用作构建中的检查步骤
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "lept_bench.h"
+#include "bench_report.h"
+
+namespace
+{
+    using leptstl::bench::result;
+
+    std::string format_change(double base, double now)
+    {
+        char buf[32];
+        if (base <= 0)
+            return "-";
+        std::snprintf(buf, sizeof(buf), "%+.1f%%", (now - base) / base * 100);
+        return buf;
+    }
+
+    std::string format_allocs(double base, double now)
+    {
+        char buf[64];
+        std::snprintf(buf, sizeof(buf), "%.3g -> %.3g", base, now);
+        return buf;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace leptstl::bench;
+
+    std::vector<std::string> paths;
+    double threshold = 5.0;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strncmp(argv[i], "--threshold=", 12) == 0)
+            threshold = std::atof(argv[i] + 12);
+        else
+            paths.push_back(argv[i]);
+    }
+    if (paths.size() != 2)
+    {
+        std::cerr << "usage: " << argv[0] << " base.{json,csv} new.{json,csv} [--threshold=percent]\n";
+        return 2;
+    }
+
+    std::vector<result> base, now;
+    if (!read_results(paths[0], base) || !read_results(paths[1], now))
+    {
+        std::cerr << "cannot read " << (base.empty() ? paths[0] : paths[1]) << "\n";
+        return 2;
+    }
+
+    std::map<std::string, const result*> base_by_name;
+    for (size_t i = 0; i < base.size(); ++i)
+        base_by_name[base[i].name] = &base[i];
+
+    const double t = threshold / 100.0;
+    size_t regressions = 0, improvements = 0;
+    std::cout << std::left << std::setw(56) << "benchmark" << std::right
+              << std::setw(13) << "base" << std::setw(13) << "new" << std::setw(10) << "change"
+              << std::setw(22) << "allocs/op" << "  status\n";
+    std::cout << std::string(124, '-') << "\n";
+    for (size_t i = 0; i < now.size(); ++i)
+    {
+        const result& n = now[i];
+        std::map<std::string, const result*>::iterator it = base_by_name.find(n.name);
+        std::cout << std::left << std::setw(56) << n.name << std::right;
+        if (it == base_by_name.end())
+        {
+            std::cout << std::setw(13) << "-" << std::setw(13) << format_time(n.median_ns)
+                      << std::setw(10) << "-" << std::setw(22) << format_allocs(0, n.allocations)
+                      << "  new\n";
+            continue;
+        }
+        const result& b = *it->second;
+        base_by_name.erase(it);
+        const bool slower = n.median_ns > b.median_ns * (1 + t) && n.median_ns > b.p95_ns;
+        const bool faster = n.median_ns < b.median_ns * (1 - t) && n.p95_ns < b.median_ns;
+        const bool more_allocs = n.allocations > b.allocations * (1 + t) + 1e-9;
+        const char* status = "ok";
+        if (slower || more_allocs)
+        {
+            status = slower ? "REGRESSION" : "REGRESSION (allocs)";
+            ++regressions;
+        }
+        else if (faster)
+        {
+            status = "improved";
+            ++improvements;
+        }
+        std::cout << std::setw(13) << format_time(b.median_ns) << std::setw(13) << format_time(n.median_ns)
+                  << std::setw(10) << format_change(b.median_ns, n.median_ns)
+                  << std::setw(22) << format_allocs(b.allocations, n.allocations)
+                  << "  " << status << "\n";
+    }
+    for (std::map<std::string, const result*>::iterator it = base_by_name.begin(); it != base_by_name.end(); ++it)
+    {
+        std::cout << std::left << std::setw(56) << it->first << std::right
+                  << std::setw(13) << format_time(it->second->median_ns) << std::setw(13) << "-"
+                  << std::setw(10) << "-" << std::setw(22) << "-" << "  missing\n";
+    }
+    std::cout << std::string(124, '-') << "\n"
+              << regressions << " regression(s), " << improvements << " improvement(s), threshold "
+              << threshold << "%\n";
+    return regressions > 0 ? 1 : 0;
+}
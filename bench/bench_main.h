@@ -0,0 +1,158 @@
+/*************************************************************************
+	> File Name: bench_main.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 09:02:47 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_BENCH_MAIN_H__
+#define LEPTSTL_BENCH_MAIN_H__
+
+/* 各个性能测试程序共用的 main：解析命令行参数，运行注册表中的测试，按需写出 JSON / CSV
+ * 用法：程序名 [--filter=子串] [--repetitions=N] [--min_time=毫秒] [--warmup=毫秒]
+ *              [--json=文件] [--csv=文件] [--perf] [--list]
+ * 控制台总是输出表格，--json / --csv 另外把结果写入文件，可用 leptstl_bench_compare 比较两次的结果
+ * --list 只列出匹配 filter 的测试名称，不运行
+ * --perf 用 perf_event_open 读取硬件计数器，表格末尾追加每次操作的周期数、IPC 与缓存、分支缺失；
+ * 计数器打不开时（容器中常见）在 stderr 给出原因并照常运行，对应的列与字段为 - 或 -1
+ * 每个结果都带有每次操作的堆分配次数与字节数，来自 alloc_counter.cpp 替换的 operator new
+ * 以 -DLEPTSTL_ALLOC_STATS=ON 构建时，运行结束后另外输出 leptstl 分配器按元素类型的统计，
+ * --alloc_stats=文件 把这份统计写成 JSON*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "../leptSTL/alloc_stats.h"
+#include "alloc_counter.h"
+#include "lept_bench.h"
+#include "bench_report.h"
+
+namespace leptstl
+{
+    namespace bench
+    {
+        /* 形如 --name=value 的参数，匹配时返回 value，否则返回 nullptr*/
+        inline const char* flag_value(const char* arg, const char* name)
+        {
+            const size_t len = std::strlen(name);
+            if (std::strncmp(arg, "--", 2) != 0 || std::strncmp(arg + 2, name, len) != 0 || arg[2 + len] != '=')
+                return nullptr;
+            return arg + 3 + len;
+        }
+
+        inline bool write_report(const std::string& path, const std::vector<result>& results,
+                                 const options& opt, bool json)
+        {
+            std::ofstream out(path.c_str());
+            if (json)
+                write_json(out, results, opt);
+            else
+                write_csv(out, results);
+            if (!out)
+            {
+                std::cerr << "cannot write " << path << "\n";
+                return false;
+            }
+            return true;
+        }
+
+        /* opt 是该程序的默认设置，命令行参数在其上修改*/
+        inline int bench_main(int argc, char* argv[], options opt)
+        {
+            std::string json_path, csv_path, alloc_stats_path;
+            bool list = false, perf = false;
+            for (int i = 1; i < argc; ++i)
+            {
+                const char* v = nullptr;
+                if ((v = flag_value(argv[i], "filter")) != nullptr)
+                    opt.filter = v;
+                else if ((v = flag_value(argv[i], "repetitions")) != nullptr)
+                    opt.repetitions = std::max(1, std::atoi(v));
+                else if ((v = flag_value(argv[i], "min_time")) != nullptr)
+                    opt.min_time_ms = std::atof(v);
+                else if ((v = flag_value(argv[i], "warmup")) != nullptr)
+                    opt.warmup_ms = std::atof(v);
+                else if ((v = flag_value(argv[i], "json")) != nullptr)
+                    json_path = v;
+                else if ((v = flag_value(argv[i], "csv")) != nullptr)
+                    csv_path = v;
+                else if ((v = flag_value(argv[i], "alloc_stats")) != nullptr)
+                    alloc_stats_path = v;
+                else if (std::strcmp(argv[i], "--list") == 0)
+                    list = true;
+                else if (std::strcmp(argv[i], "--perf") == 0)
+                    perf = true;
+                else
+                {
+                    std::cerr << "usage: " << argv[0]
+                              << " [--filter=substr] [--repetitions=N] [--min_time=ms] [--warmup=ms]"
+                              << " [--json=file] [--csv=file] [--alloc_stats=file] [--perf] [--list]\n";
+                    return 1;
+                }
+            }
+            if (list)
+            {
+                const std::vector<benchmark>& all = registry::instance()->benchmarks();
+                for (size_t i = 0; i < all.size(); ++i)
+                {
+                    const std::vector<int64_t>& args = all[i].args;
+                    for (size_t k = 0; k < std::max<size_t>(args.size(), 1); ++k)
+                    {
+                        const std::string name = args.empty() ? all[i].name
+                                                              : all[i].name + "/" + std::to_string(args[k]);
+                        if (opt.filter.empty() || name.find(opt.filter) != std::string::npos)
+                            std::cout << name << "\n";
+                    }
+                }
+                return 0;
+            }
+            current_alloc_probe().count = heap_allocations;
+            current_alloc_probe().bytes = heap_bytes;
+            perf_counters counters;
+            if (perf)
+            {
+                std::string error;
+                if (counters.open(error))
+                {
+                    current_perf_counters() = &counters;
+                    for (int k = 0; k < perf_event_count; ++k)
+                        if (!counters.available(k))
+                            std::cerr << "perf counter " << perf_event_name(k) << " unavailable\n";
+                }
+                else
+                    std::cerr << "perf counters unavailable: " << error << "\n";
+            }
+            const std::vector<result> results = run_all(opt, std::cout);
+            current_perf_counters() = nullptr;
+            if (alloc_stats::enabled())
+            {
+                std::cout << "\nleptstl allocator statistics:\n";
+                alloc_stats::dump(std::cout);
+            }
+            if (!alloc_stats_path.empty())
+            {
+                std::ofstream out(alloc_stats_path.c_str());
+                alloc_stats::dump_json(out);
+                out << "\n";
+                if (!out)
+                {
+                    std::cerr << "cannot write " << alloc_stats_path << "\n";
+                    return 1;
+                }
+            }
+            if (!json_path.empty() && !write_report(json_path, results, opt, true))
+                return 1;
+            if (!csv_path.empty() && !write_report(csv_path, results, opt, false))
+                return 1;
+            return 0;
+        }
+
+    }   /* namespace bench */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_BENCH_MAIN_H__ */
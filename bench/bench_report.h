@@ -0,0 +1,367 @@
+/*************************************************************************
+	> File Name: bench_report.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 07:41:55 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_BENCH_REPORT_H__
+#define LEPTSTL_BENCH_REPORT_H__
+
+/* 此头文件把性能测试的结果写成 JSON 或 CSV，并能把这两种文件读回来，供 leptstl_bench_compare 比较
+ * 每个结果的字段：name container operation n iterations repetitions ns_per_op p95_ns mean_ns stddev_ns
+ *                min_ns ticks_per_op allocations_per_op bytes_per_op
+ *                cycles_per_op instructions_per_op l1d_misses_per_op llc_misses_per_op branch_misses_per_op gb_per_s
+ * 其中 ns_per_op 是每次操作耗时的中位数；cycles_per_op 起的五个是硬件计数器，没有 --perf 或计数器不可用时为-1；
+ * gb_per_s 是处理字节流的测试的吞吐量，其他测试为0；JSON 的 benchmarks 数组中每个元素是一个不嵌套的对象
+ */
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "lept_bench.h"
+
+namespace leptstl
+{
+    namespace bench
+    {
+        /* 字段名，CSV 的表头与 JSON 的键相同*/
+        static const char* const report_fields[] = {
+            "name", "container", "operation", "n", "iterations", "repetitions",
+            "ns_per_op", "p95_ns", "mean_ns", "stddev_ns", "min_ns",
+            "ticks_per_op", "allocations_per_op", "bytes_per_op",
+            "cycles_per_op", "instructions_per_op", "l1d_misses_per_op", "llc_misses_per_op",
+            "branch_misses_per_op", "gb_per_s"
+        };
+        static const size_t report_field_count = sizeof(report_fields) / sizeof(report_fields[0]);
+
+        /* 结果的各字段转为字符串，前三个是字符串字段*/
+        inline std::vector<std::string> result_fields(const result& r)
+        {
+            std::vector<std::string> f;
+            char buf[64];
+            f.push_back(r.name);
+            f.push_back(r.container);
+            f.push_back(r.operation);
+            f.push_back(std::to_string(r.arg));
+            f.push_back(std::to_string(r.iterations));
+            f.push_back(std::to_string(r.repetitions));
+            const double values[] = { r.median_ns, r.p95_ns, r.mean_ns, r.stddev_ns, r.min_ns,
+                                      r.ticks, r.allocations, r.bytes,
+                                      r.perf[perf_cycles], r.perf[perf_instructions], r.perf[perf_l1d_misses],
+                                      r.perf[perf_llc_misses], r.perf[perf_branch_misses], r.gb_per_s };
+            for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i)
+            {
+                std::snprintf(buf, sizeof(buf), "%.6g", values[i]);
+                f.push_back(buf);
+            }
+            return f;
+        }
+
+        inline std::string json_escape(const std::string& s)
+        {
+            std::string out;
+            for (size_t i = 0; i < s.size(); ++i)
+            {
+                const char c = s[i];
+                if (c == '"' || c == '\\')
+                {
+                    out += '\\';
+                    out += c;
+                }
+                else if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    char buf[8];
+                    std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+                    out += buf;
+                }
+                else
+                {
+                    out += c;
+                }
+            }
+            return out;
+        }
+
+        /* 含逗号、引号或换行的字段加引号，引号写两次*/
+        inline std::string csv_escape(const std::string& s)
+        {
+            if (s.find_first_of(",\"\n") == std::string::npos)
+                return s;
+            std::string out = "\"";
+            for (size_t i = 0; i < s.size(); ++i)
+            {
+                if (s[i] == '"')
+                    out += '"';
+                out += s[i];
+            }
+            return out + "\"";
+        }
+
+        /**********************************************************************/
+        /* 写出*/
+
+        inline void write_json(std::ostream& os, const std::vector<result>& results, const options& opt)
+        {
+            char date[32];
+            const time_t now = time(nullptr);
+            strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+            os << "{\n  \"context\": {\"date\": \"" << date << "\", \"compiler\": \""
+#if defined(__VERSION__)
+               << json_escape(__VERSION__)
+#endif
+               << "\", \"repetitions\": " << opt.repetitions
+               << ", \"min_time_ms\": " << opt.min_time_ms << "},\n  \"benchmarks\": [\n";
+            for (size_t i = 0; i < results.size(); ++i)
+            {
+                const std::vector<std::string> f = result_fields(results[i]);
+                os << "    {";
+                for (size_t k = 0; k < f.size(); ++k)
+                {
+                    os << (k ? ", " : "") << "\"" << report_fields[k] << "\": ";
+                    if (k < 3)
+                        os << "\"" << json_escape(f[k]) << "\"";
+                    else
+                        os << f[k];
+                }
+                os << (i + 1 < results.size() ? "},\n" : "}\n");
+            }
+            os << "  ]\n}\n";
+        }
+
+        inline void write_csv(std::ostream& os, const std::vector<result>& results)
+        {
+            for (size_t k = 0; k < report_field_count; ++k)
+                os << (k ? "," : "") << report_fields[k];
+            os << "\n";
+            for (size_t i = 0; i < results.size(); ++i)
+            {
+                const std::vector<std::string> f = result_fields(results[i]);
+                for (size_t k = 0; k < f.size(); ++k)
+                    os << (k ? "," : "") << csv_escape(f[k]);
+                os << "\n";
+            }
+        }
+
+        /**********************************************************************/
+        /* 读回*/
+
+        /* 按字段名填入结果，不认识的字段忽略*/
+        inline void set_field(result& r, const std::string& key, const std::string& value)
+        {
+            const double v = std::atof(value.c_str());
+            if (key == "name")                    r.name = value;
+            else if (key == "container")          r.container = value;
+            else if (key == "operation")          r.operation = value;
+            else if (key == "n")                  r.arg = std::atoll(value.c_str());
+            else if (key == "iterations")         r.iterations = static_cast<size_t>(v);
+            else if (key == "repetitions")        r.repetitions = static_cast<size_t>(v);
+            else if (key == "ns_per_op")          r.median_ns = v;
+            else if (key == "p95_ns")             r.p95_ns = v;
+            else if (key == "mean_ns")            r.mean_ns = v;
+            else if (key == "stddev_ns")          r.stddev_ns = v;
+            else if (key == "min_ns")             r.min_ns = v;
+            else if (key == "ticks_per_op")       r.ticks = v;
+            else if (key == "allocations_per_op") r.allocations = v;
+            else if (key == "bytes_per_op")       r.bytes = v;
+            else if (key == "cycles_per_op")        r.perf[perf_cycles] = v;
+            else if (key == "instructions_per_op")  r.perf[perf_instructions] = v;
+            else if (key == "l1d_misses_per_op")    r.perf[perf_l1d_misses] = v;
+            else if (key == "llc_misses_per_op")    r.perf[perf_llc_misses] = v;
+            else if (key == "branch_misses_per_op") r.perf[perf_branch_misses] = v;
+            else if (key == "gb_per_s")             r.gb_per_s = v;
+        }
+
+        inline result empty_result()
+        {
+            result r;
+            r.arg = 0;
+            r.iterations = r.repetitions = 0;
+            r.median_ns = r.p95_ns = r.mean_ns = r.stddev_ns = r.min_ns = r.ticks = 0;
+            r.allocations = r.bytes = r.gb_per_s = 0;
+            for (int k = 0; k < perf_event_count; ++k)
+                r.perf[k] = -1;
+            return r;
+        }
+
+        /* 只解析 write_json 写出的结构：在 "benchmarks" 数组中逐个读取不嵌套的对象*/
+        class json_reader
+        {
+            public:
+                explicit json_reader(const std::string& text) : s_(text), pos_(0) {}
+
+                bool read(std::vector<result>& out)
+                {
+                    pos_ = s_.find("\"benchmarks\"");
+                    if (pos_ == std::string::npos)
+                        return false;
+                    pos_ = s_.find('[', pos_);
+                    if (pos_ == std::string::npos)
+                        return false;
+                    ++pos_;
+                    while (true)
+                    {
+                        skip_space();
+                        if (peek() == ']')
+                            return true;
+                        if (peek() == ',')
+                        {
+                            ++pos_;
+                            continue;
+                        }
+                        if (peek() != '{')
+                            return false;
+                        ++pos_;
+                        result r = empty_result();
+                        while (true)
+                        {
+                            skip_space();
+                            if (peek() == '}')
+                            {
+                                ++pos_;
+                                break;
+                            }
+                            if (peek() == ',')
+                            {
+                                ++pos_;
+                                continue;
+                            }
+                            std::string key, value;
+                            if (!read_string(key))
+                                return false;
+                            skip_space();
+                            if (peek() != ':')
+                                return false;
+                            ++pos_;
+                            skip_space();
+                            if (peek() == '"')
+                            {
+                                if (!read_string(value))
+                                    return false;
+                            }
+                            else
+                            {
+                                while (pos_ < s_.size() && s_[pos_] != ',' && s_[pos_] != '}'
+                                       && !std::isspace(static_cast<unsigned char>(s_[pos_])))
+                                    value += s_[pos_++];
+                            }
+                            set_field(r, key, value);
+                        }
+                        out.push_back(r);
+                    }
+                }
+
+            private:
+                char peek() const { return pos_ < s_.size() ? s_[pos_] : '\0'; }
+
+                void skip_space()
+                {
+                    while (pos_ < s_.size() && std::isspace(static_cast<unsigned char>(s_[pos_])))
+                        ++pos_;
+                }
+
+                bool read_string(std::string& out)
+                {
+                    if (peek() != '"')
+                        return false;
+                    ++pos_;
+                    while (pos_ < s_.size() && s_[pos_] != '"')
+                    {
+                        if (s_[pos_] == '\\' && pos_ + 1 < s_.size())
+                        {
+                            ++pos_;
+                            if (s_[pos_] == 'u' && pos_ + 4 < s_.size())
+                            {
+                                out += static_cast<char>(std::strtol(s_.substr(pos_ + 1, 4).c_str(), nullptr, 16));
+                                pos_ += 5;
+                                continue;
+                            }
+                        }
+                        out += s_[pos_++];
+                    }
+                    if (pos_ >= s_.size())
+                        return false;
+                    ++pos_;
+                    return true;
+                }
+
+            private:
+                const std::string& s_;
+                size_t             pos_;
+        };
+
+        /* 拆分一行 CSV，支持加引号的字段*/
+        inline std::vector<std::string> split_csv_line(const std::string& line)
+        {
+            std::vector<std::string> fields(1);
+            bool quoted = false;
+            for (size_t i = 0; i < line.size(); ++i)
+            {
+                const char c = line[i];
+                if (quoted)
+                {
+                    if (c == '"' && i + 1 < line.size() && line[i + 1] == '"')
+                        fields.back() += line[++i];
+                    else if (c == '"')
+                        quoted = false;
+                    else
+                        fields.back() += c;
+                }
+                else if (c == '"')
+                    quoted = true;
+                else if (c == ',')
+                    fields.push_back(std::string());
+                else if (c != '\r')
+                    fields.back() += c;
+            }
+            return fields;
+        }
+
+        inline bool read_csv(const std::string& text, std::vector<result>& out)
+        {
+            std::istringstream is(text);
+            std::string line;
+            if (!std::getline(is, line))
+                return false;
+            const std::vector<std::string> header = split_csv_line(line);
+            while (std::getline(is, line))
+            {
+                if (line.empty())
+                    continue;
+                const std::vector<std::string> f = split_csv_line(line);
+                result r = empty_result();
+                for (size_t k = 0; k < f.size() && k < header.size(); ++k)
+                    set_field(r, header[k], f[k]);
+                out.push_back(r);
+            }
+            return true;
+        }
+
+        /* 读取 write_json 或 write_csv 写出的文件，按首个非空白字符判断格式*/
+        inline bool read_results(const std::string& path, std::vector<result>& out)
+        {
+            std::ifstream in(path.c_str());
+            if (!in)
+                return false;
+            std::stringstream ss;
+            ss << in.rdbuf();
+            const std::string text = ss.str();
+            size_t first = 0;
+            while (first < text.size() && std::isspace(static_cast<unsigned char>(text[first])))
+                ++first;
+            if (first < text.size() && text[first] == '{')
+                return json_reader(text).read(out);
+            return read_csv(text, out);
+        }
+
+    }   /* namespace bench */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_BENCH_REPORT_H__ */
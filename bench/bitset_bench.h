@@ -0,0 +1,177 @@
+/*************************************************************************
+	> File Name: bitset_bench.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Wed 21 Oct 2026 03:05:26 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_BITSET_BENCH_H__
+#define LEPTSTL_BITSET_BENCH_H__
+
+/* 位容器的性能测试，原先是 test/dynamic_bitset_test.h 中的性能表格
+ * 比较 std::vector<bool>、leptstl::vector<bool> 与 dynamic_bitset，参数是位数，最大 10^9 位（每个容器约 125MB）
+ * fill：新建容器，逐字写入约 1/16 置位的随机字（vector<bool> 只能逐位写）；count：统计置位数；
+ * scan：依次找出所有置位的位置（vector<bool> 用 find，dynamic_bitset 用 find_next），均按每一位报告*/
+
+#include <algorithm>
+#include <vector>
+
+#include "../leptSTL/algo.h"
+#include "../leptSTL/dynamic_bitset.h"
+#include "../leptSTL/vector.h"
+#include "container_bench.h"
+
+namespace leptstl
+{
+    namespace bench
+    {
+        namespace container_bench
+        {
+            /* 约 1/16 的位被置位的随机字*/
+            inline leptstl::bit_word sparse_word(uint64_t& x)
+            {
+                leptstl::bit_word w = ~leptstl::bit_word(0);
+                for (int k = 0; k < 4; ++k)
+                {
+                    x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+                    w &= x;
+                }
+                return w;
+            }
+
+            template <typename Bits>
+                void bits_fill(Bits& v, size_t bits)
+                {
+                    uint64_t x = 88172645463325252ull;
+                    v.resize(bits);
+                    for (size_t i = 0; i < bits; i += leptstl::bit_word_bits)
+                    {
+                        const leptstl::bit_word w = sparse_word(x);
+                        for (size_t j = 0; j < leptstl::bit_word_bits && i + j < bits; ++j)
+                            v[i + j] = (w >> j) & 1;
+                    }
+                }
+            inline void bits_fill(leptstl::dynamic_bitset& b, size_t bits)
+            {
+                uint64_t x = 88172645463325252ull;
+                for (size_t i = 0; i < bits; i += leptstl::bit_word_bits)
+                    b.append(sparse_word(x));
+                b.resize(bits);
+            }
+
+            inline size_t bits_count(const std::vector<bool>& v) { return std::count(v.begin(), v.end(), true); }
+            inline size_t bits_count(const leptstl::vector<bool>& v) { return leptstl::count(v.begin(), v.end(), true); }
+            inline size_t bits_count(const leptstl::dynamic_bitset& b) { return b.count(); }
+
+            inline size_t bits_scan(const std::vector<bool>& v)
+            {
+                size_t sum = 0;
+                for (auto it = std::find(v.begin(), v.end(), true); it != v.end(); it = std::find(it + 1, v.end(), true))
+                    sum += it - v.begin();
+                return sum;
+            }
+            inline size_t bits_scan(const leptstl::vector<bool>& v)
+            {
+                size_t sum = 0;
+                for (auto it = leptstl::find(v.begin(), v.end(), true); it != v.end(); it = leptstl::find(it + 1, v.end(), true))
+                    sum += it - v.begin();
+                return sum;
+            }
+            inline size_t bits_scan(const leptstl::dynamic_bitset& b)
+            {
+                size_t sum = 0;
+                for (size_t i = b.find_first(); i != leptstl::dynamic_bitset::npos; i = b.find_next(i))
+                    sum += i;
+                return sum;
+            }
+
+            /* 只读测试的位容器，与 prebuilt 共用同一个缓存位置*/
+            template <typename Bits>
+                const Bits& bits_prebuilt(size_t bits)
+                {
+                    static const char tag = 0;
+                    prebuilt_slot& slot = current_prebuilt();
+                    if (slot.tag != &tag || slot.n != bits)
+                    {
+                        slot.object.reset();
+                        slot.tag = nullptr;
+                        Bits* v = new Bits();
+                        slot.object = std::shared_ptr<void>(v);
+                        bits_fill(*v, bits);
+                        slot.tag = &tag;
+                        slot.n = bits;
+                    }
+                    return *static_cast<const Bits*>(slot.object.get());
+                }
+
+            template <typename Bits>
+                void bits_fill_bench(state& st)
+                {
+                    const size_t bits = static_cast<size_t>(st.arg());
+                    st.pause_timing();
+                    current_prebuilt().object.reset();
+                    current_prebuilt().tag = nullptr;
+                    st.resume_timing();
+                    st.set_items(bits);
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        Bits v;
+                        bits_fill(v, bits);
+                        do_not_optimize(v);
+                    }
+                }
+
+            template <typename Bits>
+                void bits_count_bench(state& st)
+                {
+                    st.pause_timing();
+                    const Bits& v = bits_prebuilt<Bits>(static_cast<size_t>(st.arg()));
+                    st.resume_timing();
+                    st.set_items(static_cast<size_t>(st.arg()));
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                        do_not_optimize(bits_count(v));
+                }
+
+            template <typename Bits>
+                void bits_scan_bench(state& st)
+                {
+                    st.pause_timing();
+                    const Bits& v = bits_prebuilt<Bits>(static_cast<size_t>(st.arg()));
+                    st.resume_timing();
+                    st.set_items(static_cast<size_t>(st.arg()));
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                        do_not_optimize(bits_scan(v));
+                }
+
+#define LEPTSTL_BITS_SIZES 1000000, 1000000000
+
+            LEPTSTL_BENCH_(std_vector_bool_fill, "std::vector<bool>", "fill", LEPTSTL_BITS_SIZES)
+            { bits_fill_bench<std::vector<bool>>(st); }
+            LEPTSTL_BENCH_(vector_bool_fill, "leptstl::vector<bool>", "fill", LEPTSTL_BITS_SIZES)
+            { bits_fill_bench<leptstl::vector<bool>>(st); }
+            LEPTSTL_BENCH_(dynamic_bitset_fill, "leptstl::dynamic_bitset", "fill", LEPTSTL_BITS_SIZES)
+            { bits_fill_bench<leptstl::dynamic_bitset>(st); }
+
+            LEPTSTL_BENCH_(std_vector_bool_count, "std::vector<bool>", "count", LEPTSTL_BITS_SIZES)
+            { bits_count_bench<std::vector<bool>>(st); }
+            LEPTSTL_BENCH_(vector_bool_count, "leptstl::vector<bool>", "count", LEPTSTL_BITS_SIZES)
+            { bits_count_bench<leptstl::vector<bool>>(st); }
+            LEPTSTL_BENCH_(dynamic_bitset_count, "leptstl::dynamic_bitset", "count", LEPTSTL_BITS_SIZES)
+            { bits_count_bench<leptstl::dynamic_bitset>(st); }
+
+            LEPTSTL_BENCH_(std_vector_bool_scan, "std::vector<bool>", "scan", LEPTSTL_BITS_SIZES)
+            { bits_scan_bench<std::vector<bool>>(st); }
+            LEPTSTL_BENCH_(vector_bool_scan, "leptstl::vector<bool>", "scan", LEPTSTL_BITS_SIZES)
+            { bits_scan_bench<leptstl::vector<bool>>(st); }
+            LEPTSTL_BENCH_(dynamic_bitset_scan, "leptstl::dynamic_bitset", "scan", LEPTSTL_BITS_SIZES)
+            { bits_scan_bench<leptstl::dynamic_bitset>(st); }
+
+#undef LEPTSTL_BITS_SIZES
+
+        }   /* namespace container_bench */
+
+    }   /* namespace bench */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_BITSET_BENCH_H__ */
@@ -0,0 +1,144 @@
+/*************************************************************************
+	> File Name: buffer_bench.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Wed 21 Oct 2026 04:12:37 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_BUFFER_BENCH_H__
+#define LEPTSTL_BUFFER_BENCH_H__
+
+/* 有界队列、小容量容器与可搬迁元素的性能测试，原先是 test/circular_buffer_test.h、test/small_vector_test.h
+ * 与 test/vector_test.h 中的性能表格
+ * bounded_fifo：窗口 1024 个元素，满后每次 push_back 伴随一次 pop_front，每 1024 次顺序遍历求和，
+ * 参数是 push_back 的次数，按每次 push_back 报告
+ * create_fill：新建容器、填入 k 个 int、遍历求和再销毁，参数是 k，按每个容器报告
+ * push_back_string：连续 push_back n 个字符串，比较 std::vector、逐个移动的 leptstl::vector 与
+ * 按可平凡搬迁处理、扩容时整块复制的 leptstl::vector，按每个元素报告*/
+
+#include <vector>
+
+#include "../leptSTL/circular_buffer.h"
+#include "../leptSTL/deque.h"
+#include "../leptSTL/leptstring.h"
+#include "../leptSTL/small_vector.h"
+#include "../leptSTL/vector.h"
+#include "container_bench.h"
+
+namespace leptstl
+{
+    namespace bench
+    {
+        namespace container_bench
+        {
+            /* make 返回一个空的窗口容器*/
+            template <typename Con, typename Make>
+                void bounded_fifo_bench(state& st, Make make)
+                {
+                    const size_t n = static_cast<size_t>(st.arg());
+                    const size_t window = 1024;
+                    st.set_items(n);
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        Con c = make(window);
+                        size_t sum = 0;
+                        for (size_t k = 0; k < n; ++k)
+                        {
+                            if (c.size() == window)
+                                c.pop_front();
+                            c.push_back(static_cast<int>(k));
+                            if ((k & 1023) == 0)
+                                for (size_t j = 0; j < c.size(); ++j)
+                                    sum += c[j];
+                        }
+                        do_not_optimize(sum);
+                    }
+                }
+
+#define LEPTSTL_FIFO_SIZES 100000, 10000000
+
+            LEPTSTL_BENCH_(deque_bounded_fifo, "leptstl::deque<int>", "bounded_fifo", LEPTSTL_FIFO_SIZES)
+            {
+                bounded_fifo_bench<leptstl::deque<int>>(st, [](size_t) { return leptstl::deque<int>(); });
+            }
+            LEPTSTL_BENCH_(circular_buffer_bounded_fifo, "leptstl::circular_buffer<int>", "bounded_fifo",
+                           LEPTSTL_FIFO_SIZES)
+            {
+                bounded_fifo_bench<leptstl::circular_buffer<int>>(st, [](size_t window) {
+                    return leptstl::circular_buffer<int>(window);
+                });
+            }
+
+#undef LEPTSTL_FIFO_SIZES
+
+            template <typename Con>
+                void create_fill_bench(state& st)
+                {
+                    const size_t k = static_cast<size_t>(st.arg());
+                    size_t sum = 0;
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        Con c;
+                        for (size_t j = 0; j < k; ++j)
+                            c.push_back(static_cast<int>(i + j));
+                        for (size_t j = 0; j < c.size(); ++j)
+                            sum += c[j];
+                        do_not_optimize(c);
+                    }
+                    do_not_optimize(sum);
+                }
+
+#define LEPTSTL_SMALL_SIZES 2, 6, 12
+
+            LEPTSTL_BENCH_(std_vector_create_fill, "std::vector<int>", "create_fill", LEPTSTL_SMALL_SIZES)
+            { create_fill_bench<std::vector<int>>(st); }
+            LEPTSTL_BENCH_(vector_create_fill, "leptstl::vector<int>", "create_fill", LEPTSTL_SMALL_SIZES)
+            { create_fill_bench<leptstl::vector<int>>(st); }
+            LEPTSTL_BENCH_(small_vector_create_fill, "leptstl::small_vector<int, 8>", "create_fill",
+                           LEPTSTL_SMALL_SIZES)
+            { create_fill_bench<leptstl::small_vector<int, 8>>(st); }
+
+#undef LEPTSTL_SMALL_SIZES
+
+            /* 包一层但不特化 is_trivially_relocatable，扩容时逐个移动构造再析构，作为对照组*/
+            struct moved_string
+            {
+                leptstl::string s;
+                moved_string(const char* p) :s(p) {}
+            };
+
+            template <typename Vec, typename Str>
+                void push_back_string_bench(state& st)
+                {
+                    const size_t n = static_cast<size_t>(st.arg());
+                    st.set_items(n);
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        Vec v;
+                        for (size_t k = 0; k < n; ++k)
+                            v.push_back(Str("leptstl relocation"));
+                        do_not_optimize(v);
+                    }
+                }
+
+#define LEPTSTL_STRING_SIZES 10000, 1000000
+
+            LEPTSTL_BENCH_(std_vector_push_back_string, "std::vector<leptstl::string>", "push_back_string",
+                           LEPTSTL_STRING_SIZES)
+            { push_back_string_bench<std::vector<leptstl::string>, leptstl::string>(st); }
+            LEPTSTL_BENCH_(vector_push_back_string_moved, "leptstl::vector<moved_string>", "push_back_string",
+                           LEPTSTL_STRING_SIZES)
+            { push_back_string_bench<leptstl::vector<moved_string>, const char*>(st); }
+            LEPTSTL_BENCH_(vector_push_back_string, "leptstl::vector<leptstl::string>", "push_back_string",
+                           LEPTSTL_STRING_SIZES)
+            { push_back_string_bench<leptstl::vector<leptstl::string>, leptstl::string>(st); }
+
+#undef LEPTSTL_STRING_SIZES
+
+        }   /* namespace container_bench */
+
+    }   /* namespace bench */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_BUFFER_BENCH_H__ */
@@ -0,0 +1,194 @@
+/*************************************************************************
+	> File Name: concurrent_bench.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Wed 21 Oct 2026 04:40:18 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_CONCURRENT_BENCH_H__
+#define LEPTSTL_CONCURRENT_BENCH_H__
+
+/* 并发容器的性能测试，原先是 test/lockfree_queue_test.h 与 test/concurrent_unordered_set_test.h 中的性能表格
+ * queue：参数是生产者线程数，生产者共写入 2^17 个时间戳，一个消费者读出，与互斥锁保护的 deque 比较，
+ * 按每个元素报告；消费者算出的平均延迟写到 stderr
+ * mixed：参数是线程数，先建好 50000 个键的集合，各线程共执行 2^17 次随机操作，
+ * 10% 或 50% 为插入与删除，其余为查找，与一把互斥锁保护的 unordered_set 比较，按每次操作报告
+ * 每次迭代都新建线程，计时包括线程的创建与回收*/
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../leptSTL/concurrent_unordered_set.h"
+#include "../leptSTL/deque.h"
+#include "../leptSTL/lockfree_queue.h"
+#include "../leptSTL/unordered_set.h"
+#include "container_bench.h"
+
+namespace leptstl
+{
+    namespace bench
+    {
+        namespace container_bench
+        {
+            /* 用互斥锁保护的 deque，作为对照组*/
+            template <typename T>
+                class locked_deque
+                {
+                    public:
+                        explicit locked_deque(size_t) {}
+                        bool try_push(const T& v)
+                        {
+                            std::lock_guard<std::mutex> lk(m_);
+                            d_.push_back(v);
+                            return true;
+                        }
+                        bool try_pop(T& out)
+                        {
+                            std::lock_guard<std::mutex> lk(m_);
+                            if (d_.empty())
+                                return false;
+                            out = d_.front();
+                            d_.pop_front();
+                            return true;
+                        }
+                    private:
+                        std::mutex         m_;
+                        leptstl::deque<T>  d_;
+                };
+
+            template <typename Queue>
+                void queue_bench(state& st, const char* name)
+                {
+                    const size_t producers = static_cast<size_t>(st.arg());
+                    const size_t per_producer = (size_t(1) << 17) / producers;
+                    const size_t total = producers * per_producer;
+                    uint64_t latency = 0;
+                    st.set_items(total);
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        Queue q(1024);
+                        std::vector<std::thread> threads;
+                        for (size_t p = 0; p < producers; ++p)
+                        {
+                            threads.emplace_back([&q, per_producer]() {
+                                for (size_t k = 0; k < per_producer; ++k)
+                                    while (!q.try_push(now_ns()))
+                                        std::this_thread::yield();
+                            });
+                        }
+                        uint64_t v;
+                        for (size_t n = 0; n < total; )
+                        {
+                            if (q.try_pop(v))
+                            {
+                                latency += now_ns() - v;
+                                ++n;
+                            }
+                            else
+                                std::this_thread::yield();
+                        }
+                        for (size_t t = 0; t < threads.size(); ++t)
+                            threads[t].join();
+                    }
+                    if (first_note(name, st.arg()))
+                        std::cerr << name << "/" << st.arg() << ": mean latency "
+                                  << latency / (total * st.iterations()) << "ns\n";
+                }
+
+            LEPTSTL_BENCH_(queue_spsc, "leptstl::spsc_queue<uint64_t>", "queue", 1)
+            { queue_bench<leptstl::spsc_queue<uint64_t>>(st, "queue_spsc"); }
+            LEPTSTL_BENCH_(queue_mpmc, "leptstl::mpmc_queue<uint64_t>", "queue", 1, 2, 4)
+            { queue_bench<leptstl::mpmc_queue<uint64_t>>(st, "queue_mpmc"); }
+            LEPTSTL_BENCH_(queue_locked_deque, "mutex + leptstl::deque<uint64_t>", "queue", 1, 2, 4)
+            { queue_bench<locked_deque<uint64_t>>(st, "queue_locked_deque"); }
+
+            /* 用一把互斥锁保护的 unordered_set，作为对照组*/
+            class locked_unordered_set
+            {
+                public:
+                    bool insert(int v)
+                    {
+                        std::lock_guard<std::mutex> lk(m_);
+                        return s_.insert(v).second;
+                    }
+                    size_t erase(int v)
+                    {
+                        std::lock_guard<std::mutex> lk(m_);
+                        return s_.erase(v);
+                    }
+                    bool contains(int v)
+                    {
+                        std::lock_guard<std::mutex> lk(m_);
+                        return s_.find(v) != s_.end();
+                    }
+                private:
+                    std::mutex                     m_;
+                    leptstl::unordered_set<int>    s_;
+            };
+
+            template <typename Set>
+                void mixed_bench(state& st, unsigned write_percent)
+                {
+                    const size_t threads = static_cast<size_t>(st.arg());
+                    const size_t ops = (size_t(1) << 17) / threads;
+                    st.set_items(ops * threads);
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        st.pause_timing();
+                        Set s;
+                        for (int k = 0; k < 100000; k += 2)
+                            s.insert(k);
+                        st.resume_timing();
+                        std::vector<std::thread> pool;
+                        for (size_t t = 0; t < threads; ++t)
+                        {
+                            pool.emplace_back([&s, t, ops, write_percent]() {
+                                unsigned x = static_cast<unsigned>(t * 7919 + 1);
+                                size_t hit = 0;
+                                for (size_t k = 0; k < ops; ++k)
+                                {
+                                    x = x * 1103515245u + 12345u;
+                                    const int key = static_cast<int>((x >> 8) % 100000);
+                                    const unsigned dice = (x >> 4) % 100;
+                                    if (dice < write_percent / 2)
+                                        s.insert(key);
+                                    else if (dice < write_percent)
+                                        s.erase(key);
+                                    else
+                                        hit += s.contains(key);
+                                }
+                                do_not_optimize(hit);
+                            });
+                        }
+                        for (size_t t = 0; t < pool.size(); ++t)
+                            pool[t].join();
+                        st.pause_timing();
+                    }
+                    st.resume_timing();
+                }
+
+#define LEPTSTL_THREAD_COUNTS 1, 2, 4
+
+            LEPTSTL_BENCH_(locked_set_mixed10, "mutex + leptstl::unordered_set<int>", "mixed_10%_write",
+                           LEPTSTL_THREAD_COUNTS)
+            { mixed_bench<locked_unordered_set>(st, 10); }
+            LEPTSTL_BENCH_(concurrent_set_mixed10, "leptstl::concurrent_unordered_set<int>", "mixed_10%_write",
+                           LEPTSTL_THREAD_COUNTS)
+            { mixed_bench<leptstl::concurrent_unordered_set<int>>(st, 10); }
+            LEPTSTL_BENCH_(locked_set_mixed50, "mutex + leptstl::unordered_set<int>", "mixed_50%_write",
+                           LEPTSTL_THREAD_COUNTS)
+            { mixed_bench<locked_unordered_set>(st, 50); }
+            LEPTSTL_BENCH_(concurrent_set_mixed50, "leptstl::concurrent_unordered_set<int>", "mixed_50%_write",
+                           LEPTSTL_THREAD_COUNTS)
+            { mixed_bench<leptstl::concurrent_unordered_set<int>>(st, 50); }
+
+#undef LEPTSTL_THREAD_COUNTS
+
+        }   /* namespace container_bench */
+
+    }   /* namespace bench */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_CONCURRENT_BENCH_H__ */
@@ -0,0 +1,78 @@
+/*************************************************************************
+	> File Name: container_bench.cpp
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 10:25:10 AM EDT
+ ************************************************************************/
+
+/* 容器与 std 对应容器的性能测试程序，参数见 bench_main.h
+ * 完整运行需要较长时间，日常可以用 --filter 只运行关心的部分，例如 --filter=vector<int>::push_back
+ * 规模从 10 到 10^8：int 的 vector/deque 的 push_back 与遍历、字符串的 append 与 find 到 10^8，
+ * 其余 int 测试到 10^7，pod64 与 string 元素到 10^6，控制在几 GB 内存以内
+ * 另有固定关键字表的查找（static_perfect_set 与 unordered_set、有序数组的比较），见 keyword_bench.h，
+ * 与带概率过滤器的 unordered_set 的查找，见 filter_bench.h；
+ * 针对拉链法构造冲突键时 unordered_set 与 cuckoo_unordered_set 的最坏查找延迟，见 cuckoo_bench.h
+ * 有序容器（btree、flat_map）、实体模拟（hive、slot_map）与大块内存和文件（vector 追加、读入缓冲区、mmap_vector）
+ * 的测试用 LEPTSTL_BENCH_ 静态注册，见 ordered_bench.h、entity_bench.h 与 storage_bench.h；
+ * hashtable 的大桶数组使用默认分配器与 hugepage_allocator 时的查找，见 hugepage_bench.h；
+ * 10^9 位的 vector<bool> 与 dynamic_bitset 的填充、计数与扫描，见 bitset_bench.h；
+ * circular_buffer 的有界队列、small_vector 的小容器与 vector<string> 的扩容，见 buffer_bench.h；
+ * 无锁队列与分片加锁的 concurrent_unordered_set 的多线程吞吐，见 concurrent_bench.h*/
+
+#include "bench_main.h"
+#include "bitset_bench.h"
+#include "buffer_bench.h"
+#include "concurrent_bench.h"
+#include "cuckoo_bench.h"
+#include "entity_bench.h"
+#include "filter_bench.h"
+#include "hugepage_bench.h"
+#include "keyword_bench.h"
+#include "ordered_bench.h"
+#include "sequence_bench.h"
+#include "storage_bench.h"
+#include "string_bench.h"
+#include "unordered_bench.h"
+
+namespace
+{
+    using namespace leptstl::bench::container_bench;
+
+    void register_all()
+    {
+        const std::vector<int64_t> none;
+        const std::vector<int64_t> ints{ 10, 1000, 100000, 10000000 };
+        const std::vector<int64_t> objects{ 10, 1000, 100000, 1000000 };
+        const std::vector<int64_t> edit{ 1000, 100000 };
+
+        register_sequences<int>(ints, std::vector<int64_t>{ 100000000 }, edit);
+        register_sequences<pod64>(objects, none, edit);
+        register_sequences<leptstl::string>(objects, none, edit);
+
+        register_strings(std::vector<int64_t>{ 10, 1000, 100000, 10000000 }, std::vector<int64_t>{ 100000000 });
+
+        register_unordered<int>(ints);
+        register_unordered<pod64>(objects);
+        register_unordered<leptstl::string>(objects);
+
+        /* 查找前先经过 bloom_filter / cuckoo_filter*/
+        register_filters(std::vector<int64_t>{ 1000, 100000, 10000000 });
+
+        /* 正常的键与冲突的键下的查找*/
+        register_cuckoo(std::vector<int64_t>{ 1000, 10000, 30000 });
+
+        /* 固定关键字表的查找，参数是命中的百分比*/
+        register_keywords(std::vector<int64_t>{ 100, 50, 0 });
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    register_all();
+    /* 测试数量多，默认的轮数与每轮时间比 leptstl_bench 少，输入已缓存，不预热*/
+    leptstl::bench::options opt;
+    opt.warmup_ms = 0;
+    opt.min_time_ms = 10;
+    opt.repetitions = 10;
+    return leptstl::bench::bench_main(argc, argv, opt);
+}
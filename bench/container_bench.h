@@ -0,0 +1,297 @@
+/*************************************************************************
+	> File Name: container_bench.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 09:18:05 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_CONTAINER_BENCH_H__
+#define LEPTSTL_CONTAINER_BENCH_H__
+
+/* 容器性能测试共用的部分：元素类型、输入数据与预先建好的容器
+ * 每个测试都成对注册，先 std 后 leptstl，名称形如 std::vector<int>::push_back/1000，输出中两者相邻
+ * 元素类型：int、64 字节的 POD（pod64）与 leptstl::string，std 与 leptstl 的容器使用同一种元素
+ * 一次迭代处理 n 个元素的测试都调用 set_items，结果是每个元素（每次操作）的耗时*/
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "../leptSTL/filtered_unordered_set.h"
+#include "../leptSTL/leptstring.h"
+#include "../leptSTL/unordered_set.h"
+#include "lept_bench.h"
+
+namespace leptstl
+{
+    namespace bench
+    {
+        namespace container_bench
+        {
+            /* 64 字节的平凡类型，拷贝的代价明显高于 int*/
+            struct pod64
+            {
+                uint64_t v[8];
+            };
+
+            inline bool operator==(const pod64& lhs, const pod64& rhs)
+            {
+                for (int i = 0; i < 8; ++i)
+                    if (lhs.v[i] != rhs.v[i])
+                        return false;
+                return true;
+            }
+            inline bool operator!=(const pod64& lhs, const pod64& rhs) { return !(lhs == rhs); }
+            inline bool operator<(const pod64& lhs, const pod64& rhs)
+            {
+                for (int i = 0; i < 8; ++i)
+                    if (lhs.v[i] != rhs.v[i])
+                        return lhs.v[i] < rhs.v[i];
+                return false;
+            }
+
+            /* 测试名称中的元素类型*/
+            template <typename V> const char* type_name();
+            template <> inline const char* type_name<int>()              { return "int"; }
+            template <> inline const char* type_name<pod64>()            { return "pod64"; }
+            template <> inline const char* type_name<leptstl::string>()  { return "string"; }
+
+            /* 第 i 个元素，i 经过乘奇数打散（模 2^32 下是双射），不同的 i 得到不同的值*/
+            inline uint32_t scramble(size_t i) { return static_cast<uint32_t>(i) * 2654435761u; }
+
+            template <typename V> V make_value(size_t i);
+            template <> inline int make_value<int>(size_t i)
+            {
+                return static_cast<int>(scramble(i));
+            }
+            template <> inline pod64 make_value<pod64>(size_t i)
+            {
+                pod64 p;
+                for (int k = 0; k < 8; ++k)
+                    p.v[k] = static_cast<uint64_t>(scramble(i)) * (k + 1);
+                return p;
+            }
+            /* 24 个字符，超过常见的短字符串优化长度*/
+            template <> inline leptstl::string make_value<leptstl::string>(size_t i)
+            {
+                char buf[32];
+                std::snprintf(buf, sizeof(buf), "key-%08x-%011zu", scramble(i), i);
+                return leptstl::string(buf);
+            }
+
+            /* 从元素中取出一个数，遍历时累加，防止访问被优化掉*/
+            inline size_t touch(int v)                    { return static_cast<size_t>(v); }
+            inline size_t touch(const pod64& v)           { return static_cast<size_t>(v.v[7]); }
+            inline size_t touch(const leptstl::string& v) { return static_cast<unsigned char>(v[v.size() - 1]); }
+
+            /* std 与 leptstl 的无序容器使用同一个散列函数，比较的只是表的实现*/
+            template <typename V> struct value_hash;
+            template <> struct value_hash<int>
+            {
+                size_t operator()(int v) const noexcept
+                {
+                    uint64_t x = static_cast<uint32_t>(v) * 0x9E3779B97F4A7C15ull;
+                    return static_cast<size_t>(x ^ (x >> 32));
+                }
+            };
+            template <> struct value_hash<pod64>
+            {
+                size_t operator()(const pod64& p) const noexcept
+                {
+                    uint64_t h = 0;
+                    for (int k = 0; k < 8; ++k)
+                        h = (h ^ p.v[k]) * 0x100000001B3ull;
+                    return static_cast<size_t>(h ^ (h >> 29));
+                }
+            };
+            template <> struct value_hash<leptstl::string>
+            {
+                size_t operator()(const leptstl::string& s) const noexcept
+                {
+                    uint64_t h = 14695981039346656037ull;
+                    for (size_t k = 0; k < s.size(); ++k)
+                        h = (h ^ static_cast<unsigned char>(s[k])) * 1099511628211ull;
+                    return static_cast<size_t>(h);
+                }
+            };
+
+            /* 前 n 个元素，每种类型只缓存最近一次的长度，测试函数被反复调用时不重复生成
+             * 10^8 个元素的输入很大，不按长度全部缓存*/
+            template <typename V>
+                const std::vector<V>& values(size_t n)
+                {
+                    static std::vector<V> cache;
+                    if (cache.size() != n)
+                    {
+                        std::vector<V>().swap(cache);
+                        cache.reserve(n);
+                        for (size_t i = 0; i < n; ++i)
+                            cache.push_back(make_value<V>(i));
+                    }
+                    return cache;
+                }
+
+            /* 不在 values(n) 中的元素，用于查找失败的测试*/
+            template <typename V>
+                const std::vector<V>& missing_values()
+                {
+                    static std::vector<V> cache;
+                    if (cache.empty())
+                        for (size_t i = 0; i < 1024; ++i)
+                            cache.push_back(make_value<V>(0x80000000u + i));
+                    return cache;
+                }
+
+            /* 1024 个 [0, n) 中的伪随机下标，用于随机访问与查找*/
+            inline const std::vector<size_t>& random_indices(size_t n)
+            {
+                static std::vector<size_t> cache;
+                static size_t cached_n = 0;
+                if (cached_n != n || cache.empty())
+                {
+                    cache.clear();
+                    uint32_t x = 2463534242u;
+                    for (size_t i = 0; i < 1024; ++i)
+                    {
+                        x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+                        cache.push_back(x % n);
+                    }
+                    cached_n = n;
+                }
+                return cache;
+            }
+
+            /* 用 values(n) 填充容器，序列容器依次 push_back，无序容器依次插入*/
+            template <typename Con, typename V>
+                void fill(Con& c, const std::vector<V>& vals)
+                {
+                    for (size_t i = 0; i < vals.size(); ++i)
+                        c.push_back(vals[i]);
+                }
+
+            template <typename V, typename H, typename E>
+                void fill(std::unordered_set<V, H, E>& c, const std::vector<V>& vals)
+                {
+                    for (size_t i = 0; i < vals.size(); ++i)
+                        c.insert(vals[i]);
+                }
+            template <typename V, typename H, typename E>
+                void fill(leptstl::unordered_set<V, H, E>& c, const std::vector<V>& vals)
+                {
+                    for (size_t i = 0; i < vals.size(); ++i)
+                        c.insert(vals[i]);
+                }
+
+            template <typename V, typename H, typename E, typename F>
+                void fill(leptstl::filtered_unordered_set<V, H, E, F>& c, const std::vector<V>& vals)
+                {
+                    for (size_t i = 0; i < vals.size(); ++i)
+                        c.insert(vals[i]);
+                }
+
+            /* 多重集合中每个值约出现 4 次：共 n 个元素，取自 vals 的前 (n + 3) / 4 个*/
+            template <typename Con, typename V>
+                void fill_duplicates(Con& c, const std::vector<V>& vals)
+                {
+                    const size_t distinct = (vals.size() + 3) / 4;
+                    for (size_t i = 0; i < vals.size(); ++i)
+                        c.insert(vals[i % distinct]);
+                }
+            template <typename V, typename H, typename E>
+                void fill(std::unordered_multiset<V, H, E>& c, const std::vector<V>& vals)
+                {
+                    fill_duplicates(c, vals);
+                }
+            template <typename V, typename H, typename E>
+                void fill(leptstl::unordered_multiset<V, H, E>& c, const std::vector<V>& vals)
+                {
+                    fill_duplicates(c, vals);
+                }
+
+            /* 只读测试（遍历、查找、拷贝的源）使用的容器，建好后缓存
+             * 全局只保留一个，换成别的容器类型或长度时先释放旧的，限制大规模测试的内存占用*/
+            struct prebuilt_slot
+            {
+                const void*           tag;
+                size_t                n;
+                std::shared_ptr<void> object;
+            };
+
+            inline prebuilt_slot& current_prebuilt()
+            {
+                static prebuilt_slot slot = { nullptr, 0, std::shared_ptr<void>() };
+                return slot;
+            }
+
+            template <typename Con>
+                const Con& prebuilt(size_t n)
+                {
+                    static const char tag = 0;
+                    prebuilt_slot& slot = current_prebuilt();
+                    if (slot.tag != &tag || slot.n != n)
+                    {
+                        slot.object.reset();
+                        slot.tag = nullptr;
+                        Con* c = new Con();
+                        slot.object = std::shared_ptr<void>(c);
+                        fill(*c, values<typename Con::value_type>(n));
+                        slot.tag = &tag;
+                        slot.n = n;
+                    }
+                    return *static_cast<const Con*>(slot.object.get());
+                }
+
+            /* 从 /proc 下的文件中读取 key 对应的 kB 数，如 VmHWM 与 AnonHugePages，读不到（非 Linux）时返回0*/
+            inline size_t proc_kb(const char* file, const char* key)
+            {
+                std::ifstream in(file);
+                std::string line;
+                const size_t len = std::strlen(key);
+                while (std::getline(in, line))
+                    if (line.compare(0, len, key) == 0)
+                        return static_cast<size_t>(std::strtoull(line.c_str() + len + 1, nullptr, 10));
+                return 0;
+            }
+
+            /* 向 clear_refs 写入5会把 VmHWM 重置为当前的常驻内存*/
+            inline void reset_peak_rss()
+            {
+                std::ofstream out("/proc/self/clear_refs");
+                out << "5";
+            }
+
+            /* 结果表格只有时间与分配次数，常驻内存之类的附加数据写到 stderr，每个测试与参数只写一次*/
+            inline bool first_note(const std::string& name, int64_t arg)
+            {
+                static std::vector<std::pair<std::string, int64_t>> noted;
+                const std::pair<std::string, int64_t> key(name, arg);
+                if (std::find(noted.begin(), noted.end(), key) != noted.end())
+                    return false;
+                noted.push_back(key);
+                return true;
+            }
+
+            /* 成对注册：impl 为 std 与 leptstl，container 形如 vector，名称形如 std::vector<int>::push_back*/
+            inline void add_pair(const std::string& container, const std::string& type, const std::string& op,
+                                 bench_function std_fun, bench_function lept_fun, const std::vector<int64_t>& args)
+            {
+                const std::string label = container + (type.empty() ? "" : "<" + type + ">");
+                registry::instance()->add("std::" + label + "::" + op, "std::" + label, op, std_fun, args);
+                registry::instance()->add("leptstl::" + label + "::" + op, "leptstl::" + label, op, lept_fun, args);
+            }
+
+        }   /* namespace container_bench */
+
+    }   /* namespace bench */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_CONTAINER_BENCH_H__ */
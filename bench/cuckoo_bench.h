@@ -0,0 +1,147 @@
+/*************************************************************************
+	> File Name: cuckoo_bench.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 10:15:32 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_CUCKOO_BENCH_H__
+#define LEPTSTL_CUCKOO_BENCH_H__
+
+/* 最坏情况的查找延迟：unordered_set（拉链法）与 cuckoo_unordered_set，键分为两组
+ *   random：values<int>(n)，正常情况
+ *   adversarial：针对 hashtable 构造的键，leptstl::hash<int> 是恒等函数，hashtable 的桶号是 hash % 桶数，
+ *   先 reserve(n) 使桶数固定为素数 P，键取 P 的倍数，全部落在同一个桶里，链长为 n
+ * find_hit 随机查找已有的键，find_miss 查找同样是 P 的倍数但不存在的键，后者要走完整条链，即最坏情况
+ * cuckoo_unordered_set 用带种子的混合函数选桶，两组键的查找时间应当相同
+ * 开启 LEPTSTL_MIXED_INTEGER_HASH 时这些键不再冲突，adversarial 退化为普通的键
+ * 构造 adversarial 的 unordered_set 需要 O(n^2) 的比较（插入时检查重复），规模到 3 * 10^4 为止*/
+
+#include "../leptSTL/cuckoo_unordered_set.h"
+#include "../leptSTL/unordered_set.h"
+#include "container_bench.h"
+
+namespace leptstl
+{
+    namespace bench
+    {
+        namespace container_bench
+        {
+            /* reserve(n) 之后 leptstl::unordered_set 的桶数*/
+            inline size_t adversarial_modulus(size_t n)
+            {
+                leptstl::unordered_set<int> s;
+                s.reserve(n);
+                return s.bucket_count();
+            }
+
+            /* n 个键，adversarial 时是 P 的倍数；n 不超过 3 * 10^4 时 (n + 1024) * P 不会溢出 int*/
+            template <bool Adversarial>
+                const std::vector<int>& lookup_keys(size_t n)
+                {
+                    static std::vector<int> cache;
+                    if (cache.size() != n)
+                    {
+                        std::vector<int>().swap(cache);
+                        const size_t p = adversarial_modulus(n);
+                        for (size_t i = 0; i < n; ++i)
+                            cache.push_back(Adversarial ? static_cast<int>((i + 1) * p) : make_value<int>(i));
+                    }
+                    return cache;
+                }
+
+            /* 1024 个不存在的键，adversarial 时同样落在那个桶里*/
+            template <bool Adversarial>
+                const std::vector<int>& lookup_missing_keys(size_t n)
+                {
+                    static std::vector<int> cache;
+                    static size_t cached_n = 0;
+                    if (cached_n != n)
+                    {
+                        cache.clear();
+                        const size_t p = adversarial_modulus(n);
+                        for (size_t i = 0; i < 1024; ++i)
+                            cache.push_back(Adversarial ? static_cast<int>((n + 1 + i) * p) : missing_values<int>()[i]);
+                        cached_n = n;
+                    }
+                    return cache;
+                }
+
+            template <typename Con, bool Adversarial>
+                const Con& lookup_set(size_t n)
+                {
+                    static Con* c = nullptr;
+                    static size_t cached_n = 0;
+                    if (c == nullptr || cached_n != n)
+                    {
+                        delete c;
+                        c = nullptr;
+                        c = new Con();
+                        c->reserve(n);
+                        const std::vector<int>& keys = lookup_keys<Adversarial>(n);
+                        for (size_t i = 0; i < keys.size(); ++i)
+                            c->insert(keys[i]);
+                        cached_n = n;
+                    }
+                    return *c;
+                }
+
+            template <typename Con, bool Adversarial>
+                void lookup_hit_bench(state& st)
+                {
+                    const size_t n = static_cast<size_t>(st.arg());
+                    const Con& c = lookup_set<Con, Adversarial>(n);
+                    const std::vector<int>& keys = lookup_keys<Adversarial>(n);
+                    const std::vector<size_t>& idx = random_indices(n);
+                    st.set_items(idx.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        size_t found = 0;
+                        for (size_t k = 0; k < idx.size(); ++k)
+                            found += c.find(keys[idx[k]]) != c.end();
+                        do_not_optimize(found);
+                    }
+                }
+
+            template <typename Con, bool Adversarial>
+                void lookup_miss_bench(state& st)
+                {
+                    const size_t n = static_cast<size_t>(st.arg());
+                    const Con& c = lookup_set<Con, Adversarial>(n);
+                    const std::vector<int>& miss = lookup_missing_keys<Adversarial>(n);
+                    st.set_items(miss.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        size_t found = 0;
+                        for (size_t k = 0; k < miss.size(); ++k)
+                            found += c.find(miss[k]) != c.end();
+                        do_not_optimize(found);
+                    }
+                }
+
+            template <typename Con, bool Adversarial>
+                void register_lookup(const std::string& container, const std::vector<int64_t>& sizes)
+                {
+                    const std::string label = container + (Adversarial ? "<int,adversarial>" : "<int,random>");
+                    registry* r = registry::instance();
+                    r->add(label + "::find_hit", label, "find_hit", lookup_hit_bench<Con, Adversarial>, sizes);
+                    r->add(label + "::find_miss", label, "find_miss", lookup_miss_bench<Con, Adversarial>, sizes);
+                }
+
+            inline void register_cuckoo(const std::vector<int64_t>& sizes)
+            {
+                typedef leptstl::unordered_set<int>        chained;
+                typedef leptstl::cuckoo_unordered_set<int> cuckoo;
+                register_lookup<chained, false>("leptstl::unordered_set", sizes);
+                register_lookup<chained, true>("leptstl::unordered_set", sizes);
+                register_lookup<cuckoo, false>("leptstl::cuckoo_unordered_set", sizes);
+                register_lookup<cuckoo, true>("leptstl::cuckoo_unordered_set", sizes);
+            }
+
+        }   /* namespace container_bench */
+
+    }   /* namespace bench */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_CUCKOO_BENCH_H__ */
@@ -0,0 +1,282 @@
+/*************************************************************************
+	> File Name: entity_bench.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Wed 21 Oct 2026 09:48:05 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_ENTITY_BENCH_H__
+#define LEPTSTL_ENTITY_BENCH_H__
+
+/* 实体模拟的性能测试，原先是 test/hive_test.h 与 test/slot_map_test.h 中的性能表格
+ * frame：n 个实体，每帧更新全部实体，生命耗尽的删除并补充同样多的新实体，比较 list（遍历时删除）、
+ * vector（erase-remove）与 hive（遍历时删除，新实体填进空槽），按每个实体每帧报告
+ * 句柄：自增 id 作为键的 unordered_map 与 slot_map，insert 建表，lookup 在删掉一半后用全部句柄查找，
+ * iterate 遍历剩下的实体，按每次操作报告*/
+
+#include <vector>
+
+#include "../leptSTL/algo.h"
+#include "../leptSTL/hive.h"
+#include "../leptSTL/list.h"
+#include "../leptSTL/slot_map.h"
+#include "../leptSTL/unordered_map.h"
+#include "../leptSTL/vector.h"
+#include "container_bench.h"
+
+namespace leptstl
+{
+    namespace bench
+    {
+        namespace container_bench
+        {
+            /* 模拟中的实体：位置、速度与剩余的生命*/
+            struct entity
+            {
+                float x, y, vx, vy;
+                int   hp;
+            };
+
+            inline entity spawn(uint32_t& seed)
+            {
+                seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;
+                entity e = { 0.0f, 0.0f, static_cast<float>(seed & 0xff), static_cast<float>(seed >> 24),
+                             static_cast<int>(1 + seed % 200) };
+                return e;
+            }
+
+            inline void step(entity& e)
+            {
+                e.x += e.vx * 0.01f;
+                e.y += e.vy * 0.01f;
+                --e.hp;
+            }
+
+            template <typename Con>
+                void add_entity(Con& c, const entity& e) { c.push_back(e); }
+            inline void add_entity(leptstl::hive<entity>& c, const entity& e) { c.insert(e); }
+
+            /* list 与 hive：遍历时原地删除，再补充新实体*/
+            template <typename Con>
+                void frame(Con& c, uint32_t& seed)
+                {
+                    size_t dead = 0;
+                    for (auto it = c.begin(); it != c.end();)
+                    {
+                        step(*it);
+                        if (it->hp == 0)
+                        {
+                            it = c.erase(it);
+                            ++dead;
+                        }
+                        else
+                        {
+                            ++it;
+                        }
+                    }
+                    for (; dead > 0; --dead)
+                        add_entity(c, spawn(seed));
+                }
+
+            /* vector：先全部更新，再 erase-remove，再补充*/
+            inline void frame(leptstl::vector<entity>& c, uint32_t& seed)
+            {
+                for (auto& e : c)
+                    step(e);
+                const size_t old_size = c.size();
+                c.erase(leptstl::remove_if(c.begin(), c.end(), [](const entity& e) { return e.hp == 0; }), c.end());
+                for (size_t dead = old_size - c.size(); dead > 0; --dead)
+                    c.push_back(spawn(seed));
+            }
+
+            /* 容器在测试函数的多次调用间保留，每次迭代推进一帧，进入稳定的删除与补充状态*/
+            template <typename Con>
+                void frame_bench(state& st)
+                {
+                    const size_t n = static_cast<size_t>(st.arg());
+                    static Con* c = nullptr;
+                    static size_t cached_n = 0;
+                    static uint32_t seed = 2463534242u;
+                    if (c == nullptr || cached_n != n)
+                    {
+                        delete c;
+                        c = nullptr;
+                        c = new Con();
+                        seed = 2463534242u;
+                        for (size_t i = 0; i < n; ++i)
+                            add_entity(*c, spawn(seed));
+                        cached_n = n;
+                    }
+                    st.set_items(n);
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        frame(*c, seed);
+                        do_not_optimize(*c);
+                    }
+                }
+
+#define LEPTSTL_ENTITY_SIZES 10000, 100000, 1000000
+
+            LEPTSTL_BENCH_(list_entity_frame, "leptstl::list<entity>", "frame", LEPTSTL_ENTITY_SIZES)
+            { frame_bench<leptstl::list<entity>>(st); }
+            LEPTSTL_BENCH_(vector_entity_frame, "leptstl::vector<entity>", "frame", LEPTSTL_ENTITY_SIZES)
+            { frame_bench<leptstl::vector<entity>>(st); }
+            LEPTSTL_BENCH_(hive_entity_frame, "leptstl::hive<entity>", "frame", LEPTSTL_ENTITY_SIZES)
+            { frame_bench<leptstl::hive<entity>>(st); }
+
+#undef LEPTSTL_ENTITY_SIZES
+
+            /* 自增 id 作为键的 unordered_map，接口与 slot_map 一致：insert 返回句柄，find 返回指针*/
+            class id_map
+            {
+                public:
+                    uint64_t insert(const entity& e)
+                    {
+                        m_.emplace(++next_, e);
+                        return next_;
+                    }
+                    void erase(uint64_t id) { m_.erase(id); }
+                    entity* find(uint64_t id)
+                    {
+                        auto it = m_.find(id);
+                        return it == m_.end() ? nullptr : &it->second;
+                    }
+                    template <typename Fun>
+                        void for_each(Fun f)
+                        {
+                            for (auto& kv : m_)
+                                f(kv.second);
+                        }
+
+                private:
+                    leptstl::unordered_map<uint64_t, entity> m_;
+                    uint64_t next_ = 0;
+            };
+
+            class slot_map_adapter
+            {
+                public:
+                    uint64_t insert(const entity& e) { return m_.insert(e); }
+                    void     erase(uint64_t id)      { m_.erase(id); }
+                    entity*  find(uint64_t id)       { return m_.find(id); }
+                    template <typename Fun>
+                        void for_each(Fun f)
+                        {
+                            for (auto& e : m_)
+                                f(e);
+                        }
+
+                private:
+                    leptstl::slot_map<entity> m_;
+            };
+
+            template <typename Map>
+                void handle_fill(Map& m, std::vector<uint64_t>& ids, size_t n)
+                {
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        const entity e = { 0.0f, 0.0f, 1.0f, static_cast<float>(i & 7), 1 };
+                        ids.push_back(m.insert(e));
+                    }
+                }
+
+            /* 建表后随机删除一半，其余的句柄查找时一半已失效*/
+            template <typename Map>
+                Map& handle_prebuilt(size_t n, const std::vector<uint64_t>*& ids)
+                {
+                    static Map* m = nullptr;
+                    static std::vector<uint64_t> all;
+                    static size_t cached_n = 0;
+                    if (m == nullptr || cached_n != n)
+                    {
+                        delete m;
+                        m = nullptr;
+                        m = new Map();
+                        all.clear();
+                        handle_fill(*m, all, n);
+                        uint32_t x = 2463534242u;
+                        for (size_t i = 0; i < n / 2; ++i)
+                        {
+                            x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+                            m->erase(all[x % n]);
+                        }
+                        cached_n = n;
+                    }
+                    ids = &all;
+                    return *m;
+                }
+
+            template <typename Map>
+                void handle_insert_bench(state& st)
+                {
+                    const size_t n = static_cast<size_t>(st.arg());
+                    st.set_items(n);
+                    std::vector<uint64_t> ids;
+                    ids.reserve(n);
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        Map m;
+                        ids.clear();
+                        handle_fill(m, ids, n);
+                        do_not_optimize(ids.data());
+                    }
+                }
+
+            template <typename Map>
+                void handle_lookup_bench(state& st)
+                {
+                    const std::vector<uint64_t>* ids = nullptr;
+                    Map& m = handle_prebuilt<Map>(static_cast<size_t>(st.arg()), ids);
+                    const std::vector<size_t>& idx = random_indices(ids->size());
+                    st.set_items(idx.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        float sum = 0.0f;
+                        for (size_t k = 0; k < idx.size(); ++k)
+                        {
+                            const entity* e = m.find((*ids)[idx[k]]);
+                            if (e != nullptr)
+                                sum += e->x;
+                        }
+                        do_not_optimize(sum);
+                    }
+                }
+
+            template <typename Map>
+                void handle_iterate_bench(state& st)
+                {
+                    const size_t n = static_cast<size_t>(st.arg());
+                    const std::vector<uint64_t>* ids = nullptr;
+                    Map& m = handle_prebuilt<Map>(n, ids);
+                    st.set_items(n - n / 2);
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        m.for_each([](entity& e) { e.x += e.vx; e.y += e.vy; });
+                        clobber_memory();
+                    }
+                }
+
+#define LEPTSTL_HANDLE_SIZES 1000, 100000, 1000000
+
+            LEPTSTL_BENCH_(id_map_insert, "leptstl::unordered_map<id,entity>", "insert", LEPTSTL_HANDLE_SIZES)
+            { handle_insert_bench<id_map>(st); }
+            LEPTSTL_BENCH_(slot_map_insert, "leptstl::slot_map<entity>", "insert", LEPTSTL_HANDLE_SIZES)
+            { handle_insert_bench<slot_map_adapter>(st); }
+            LEPTSTL_BENCH_(id_map_lookup, "leptstl::unordered_map<id,entity>", "lookup", LEPTSTL_HANDLE_SIZES)
+            { handle_lookup_bench<id_map>(st); }
+            LEPTSTL_BENCH_(slot_map_lookup, "leptstl::slot_map<entity>", "lookup", LEPTSTL_HANDLE_SIZES)
+            { handle_lookup_bench<slot_map_adapter>(st); }
+            LEPTSTL_BENCH_(id_map_iterate, "leptstl::unordered_map<id,entity>", "iterate", LEPTSTL_HANDLE_SIZES)
+            { handle_iterate_bench<id_map>(st); }
+            LEPTSTL_BENCH_(slot_map_iterate, "leptstl::slot_map<entity>", "iterate", LEPTSTL_HANDLE_SIZES)
+            { handle_iterate_bench<slot_map_adapter>(st); }
+
+#undef LEPTSTL_HANDLE_SIZES
+
+        }   /* namespace container_bench */
+
+    }   /* namespace bench */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_ENTITY_BENCH_H__ */
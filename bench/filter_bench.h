@@ -0,0 +1,91 @@
+/*************************************************************************
+	> File Name: filter_bench.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 07:41:06 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_FILTER_BENCH_H__
+#define LEPTSTL_FILTER_BENCH_H__
+
+/* 概率过滤器作为预过滤的查找：unordered_set 与 filtered_unordered_set（bloom_filter / cuckoo_filter）
+ * 的 find_miss 与 find_hit，以及过滤器本身的 may_contain；查找失败时过滤器省去桶与节点的访问，
+ * 元素数远大于缓存（10^7）时差别最大，查找命中时过滤器只是额外开销*/
+
+#include "../leptSTL/bloom_filter.h"
+#include "../leptSTL/cuckoo_filter.h"
+#include "../leptSTL/filtered_unordered_set.h"
+#include "container_bench.h"
+#include "unordered_bench.h"
+
+namespace leptstl
+{
+    namespace bench
+    {
+        namespace container_bench
+        {
+            template <typename Filter>
+                const Filter& prebuilt_filter(size_t n)
+                {
+                    static Filter* f = nullptr;
+                    static size_t cached_n = 0;
+                    if (f == nullptr || cached_n != n)
+                    {
+                        delete f;
+                        f = nullptr;
+                        f = new Filter(n);
+                        const std::vector<int>& vals = values<int>(n);
+                        for (size_t i = 0; i < vals.size(); ++i)
+                            f->insert(vals[i]);
+                        cached_n = n;
+                    }
+                    return *f;
+                }
+
+            /* 过滤器本身对不存在的键的判断*/
+            template <typename Filter>
+                void filter_may_contain_miss_bench(state& st)
+                {
+                    const Filter& f = prebuilt_filter<Filter>(static_cast<size_t>(st.arg()));
+                    const std::vector<int>& miss = missing_values<int>();
+                    st.set_items(miss.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        size_t positive = 0;
+                        for (size_t k = 0; k < miss.size(); ++k)
+                            positive += f.may_contain(miss[k]);
+                        do_not_optimize(positive);
+                    }
+                }
+
+            inline void register_filters(const std::vector<int64_t>& sizes)
+            {
+                typedef value_hash<int> H;
+                typedef leptstl::bloom_filter<int, H>                                             bloom;
+                typedef leptstl::cuckoo_filter<int, H>                                            cuckoo;
+                typedef leptstl::filtered_unordered_set<int, H, leptstl::equal_to<int>, bloom>    with_bloom;
+                typedef leptstl::filtered_unordered_set<int, H, leptstl::equal_to<int>, cuckoo>   with_cuckoo;
+
+                /* 不带过滤器的 leptstl::unordered_set<int>::find_miss 与 find_hit 已在 unordered_bench.h 中注册*/
+                registry* r = registry::instance();
+                r->add("leptstl::filtered_unordered_set<int,bloom>::find_miss",
+                       "leptstl::filtered_unordered_set<int,bloom>", "find_miss", set_find_miss_bench<with_bloom>, sizes);
+                r->add("leptstl::filtered_unordered_set<int,cuckoo>::find_miss",
+                       "leptstl::filtered_unordered_set<int,cuckoo>", "find_miss", set_find_miss_bench<with_cuckoo>, sizes);
+                r->add("leptstl::filtered_unordered_set<int,bloom>::find_hit",
+                       "leptstl::filtered_unordered_set<int,bloom>", "find_hit", set_find_hit_bench<with_bloom>, sizes);
+                r->add("leptstl::filtered_unordered_set<int,cuckoo>::find_hit",
+                       "leptstl::filtered_unordered_set<int,cuckoo>", "find_hit", set_find_hit_bench<with_cuckoo>, sizes);
+                r->add("leptstl::bloom_filter<int>::may_contain_miss", "leptstl::bloom_filter<int>", "may_contain_miss",
+                       filter_may_contain_miss_bench<bloom>, sizes);
+                r->add("leptstl::cuckoo_filter<int>::may_contain_miss", "leptstl::cuckoo_filter<int>", "may_contain_miss",
+                       filter_may_contain_miss_bench<cuckoo>, sizes);
+            }
+
+        }   /* namespace container_bench */
+
+    }   /* namespace bench */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_FILTER_BENCH_H__ */
@@ -0,0 +1,103 @@
+/*************************************************************************
+	> File Name: hash_bench.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 03:12:38 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_HASH_BENCH_H__
+#define LEPTSTL_HASH_BENCH_H__
+
+/* 哈希函数的吞吐量：逐字节的 FNV-1a（bitwise_hash）、wyhash 式的 hash_bytes 与 std::hash<std::string>
+ * 参数是输入的字节数，结果按每次哈希报告，另外给出 GB/s
+ * 哈希的分布质量见 test/hash_test.h*/
+
+#include <string>
+#include <vector>
+
+#include "../leptSTL/functional.h"
+#include "lept_bench.h"
+
+namespace leptstl
+{
+    namespace bench
+    {
+        namespace hash_bench
+        {
+            /* 固定内容的输入，最长 1MB*/
+            inline const std::string& input()
+            {
+                static std::string s;
+                if (s.empty())
+                {
+                    uint64_t x = 0x9e3779b97f4a7c15ull;
+                    s.resize(1 << 20);
+                    for (size_t i = 0; i < s.size(); ++i)
+                    {
+                        x ^= x << 13;
+                        x ^= x >> 7;
+                        x ^= x << 17;
+                        s[i] = static_cast<char>(x);
+                    }
+                }
+                return s;
+            }
+
+            /* 每次迭代哈希同一段输入；经过 do_not_optimize 的指针让编译器不能把哈希提到循环外*/
+            template <typename Hash>
+                void hash_bench(state& st, Hash hash)
+                {
+                    const size_t n = static_cast<size_t>(st.arg());
+                    const char* data = input().data();
+                    st.set_bytes(n);
+                    size_t h = 0;
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        const char* p = data;
+                        do_not_optimize(p);
+                        h ^= hash(p, n);
+                    }
+                    do_not_optimize(h);
+                }
+
+#define LEPTSTL_HASH_BENCH_SIZES 4, 8, 16, 32, 64, 256, 1024, 4096, 65536, 1048576
+
+            LEPTSTL_BENCH_(fnv1a_hash, "leptstl", "bitwise_hash", LEPTSTL_HASH_BENCH_SIZES)
+            {
+                hash_bench(st, [](const char* p, size_t n)
+                           { return leptstl::bitwise_hash(reinterpret_cast<const unsigned char*>(p), n); });
+            }
+
+            LEPTSTL_BENCH_(leptstl_hash_bytes, "leptstl", "hash_bytes", LEPTSTL_HASH_BENCH_SIZES)
+            {
+                hash_bench(st, [](const char* p, size_t n)
+                           { return static_cast<size_t>(leptstl::hash_bytes(p, n)); });
+            }
+
+            /* std::hash<std::string> 需要一个 string 对象，预先建好各个长度的字符串，只对哈希计时*/
+            LEPTSTL_BENCH_(std_string_hash, "std", "hash<string>", LEPTSTL_HASH_BENCH_SIZES)
+            {
+                st.pause_timing();
+                const std::string s = input().substr(0, static_cast<size_t>(st.arg()));
+                st.set_bytes(s.size());
+                st.resume_timing();
+                std::hash<std::string> hash;
+                size_t h = 0;
+                for (size_t i = 0; i < st.iterations(); ++i)
+                {
+                    const std::string* p = &s;
+                    do_not_optimize(p);
+                    h ^= hash(*p);
+                }
+                do_not_optimize(h);
+            }
+
+#undef LEPTSTL_HASH_BENCH_SIZES
+
+        }   /* namespace hash_bench */
+
+    }   /* namespace bench */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_HASH_BENCH_H__ */
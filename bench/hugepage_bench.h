@@ -0,0 +1,116 @@
+/*************************************************************************
+	> File Name: hugepage_bench.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Wed 21 Oct 2026 02:17:40 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_HUGEPAGE_BENCH_H__
+#define LEPTSTL_HUGEPAGE_BENCH_H__
+
+/* 大页分配器的性能测试，原先是 test/hugepage_allocator_test.h 中的性能表格
+ * hashtable 的桶数组分别用默认分配器与 hugepage_allocator 分配，参数是桶数，
+ * 11000 万个桶（取质数后约 940MB）时桶数组远大于 TLB 能覆盖的范围
+ * 表中有 桶数 / 32 个随机键，每次迭代随机查找 65536 次，一半命中，按每次查找报告
+ * 查找的键足够多，所在的页远超 TLB 的容量，重复迭代不会让页表项留在 TLB 中
+ * 建表后的 AnonHugePages 写到 stderr，没有预留 hugetlb 页时测到的是透明大页*/
+
+#include <vector>
+
+#include "../leptSTL/hashtable.h"
+#include "../leptSTL/hugepage_allocator.h"
+#include "../leptSTL/vector.h"
+#include "container_bench.h"
+
+namespace leptstl
+{
+    namespace bench
+    {
+        namespace container_bench
+        {
+            template <typename BucketAlloc>
+                struct hugepage_table
+                {
+                    typedef leptstl::hashtable<int, leptstl::hash<int>, leptstl::equal_to<int>, BucketAlloc> table;
+
+                    table            ht;
+                    std::vector<int> probes;    /* 命中与不命中的键交替*/
+
+                    explicit hugepage_table(size_t buckets) :ht(buckets)
+                    {
+                        const size_t keys = buckets / 32;
+                        uint32_t x = 2463534242u, z = 88675123u;
+                        for (size_t i = 0; i < keys; ++i)
+                        {
+                            x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+                            ht.insert_unique(static_cast<int>(x >> 1));
+                            if (probes.size() < 65536 && i % (keys / 32768 + 1) == 0)
+                            {
+                                z ^= z << 13; z ^= z >> 17; z ^= z << 5;
+                                probes.push_back(static_cast<int>(x >> 1));
+                                probes.push_back(static_cast<int>(z >> 1));
+                            }
+                        }
+                    }
+                };
+
+            /* 表很大，与 prebuilt 共用同一个缓存位置，换成另一种分配器时先释放旧表*/
+            template <typename BucketAlloc>
+                const hugepage_table<BucketAlloc>& hugepage_prebuilt(size_t buckets)
+                {
+                    static const char tag = 0;
+                    prebuilt_slot& slot = current_prebuilt();
+                    if (slot.tag != &tag || slot.n != buckets)
+                    {
+                        slot.object.reset();
+                        slot.tag = nullptr;
+                        slot.object = std::shared_ptr<void>(new hugepage_table<BucketAlloc>(buckets));
+                        slot.tag = &tag;
+                        slot.n = buckets;
+                    }
+                    return *static_cast<const hugepage_table<BucketAlloc>*>(slot.object.get());
+                }
+
+            template <typename BucketAlloc>
+                void hugepage_find_bench(state& st, const char* name)
+                {
+                    st.pause_timing();
+                    const hugepage_table<BucketAlloc>& t = hugepage_prebuilt<BucketAlloc>(static_cast<size_t>(st.arg()));
+                    if (first_note(name, st.arg()))
+                        std::cerr << name << "/" << st.arg() << ": AnonHugePages "
+                                  << proc_kb("/proc/self/smaps_rollup", "AnonHugePages:") / 1024 << "MB\n";
+                    st.resume_timing();
+                    st.set_items(t.probes.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        size_t hit = 0;
+                        for (size_t k = 0; k < t.probes.size(); ++k)
+                            hit += t.ht.find(t.probes[k]) != t.ht.end();
+                        do_not_optimize(hit);
+                    }
+                }
+
+#define LEPTSTL_HUGEPAGE_BUCKETS 1000000, 110000000
+
+            LEPTSTL_BENCH_(hashtable_default_buckets_find, "leptstl::hashtable<int>", "find",
+                           LEPTSTL_HUGEPAGE_BUCKETS)
+            {
+                hugepage_find_bench<leptstl::vector_default_allocator<leptstl::hashtable_node<int>*>::type>(
+                        st, "hashtable_default_buckets_find");
+            }
+            LEPTSTL_BENCH_(hashtable_hugepage_buckets_find, "leptstl::hashtable<int, hugepage buckets>", "find",
+                           LEPTSTL_HUGEPAGE_BUCKETS)
+            {
+                hugepage_find_bench<leptstl::hugepage_allocator<leptstl::hashtable_node<int>*>>(
+                        st, "hashtable_hugepage_buckets_find");
+            }
+
+#undef LEPTSTL_HUGEPAGE_BUCKETS
+
+        }   /* namespace container_bench */
+
+    }   /* namespace bench */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_HUGEPAGE_BENCH_H__ */
@@ -0,0 +1,165 @@
+/*************************************************************************
+	> File Name: keyword_bench.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 05:20:14 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_KEYWORD_BENCH_H__
+#define LEPTSTL_KEYWORD_BENCH_H__
+
+/* 固定关键字表的查找：static_perfect_set、unordered_set<leptstl::string> 与有序数组 + binary_search
+ * 两个关键字表：9 个 HTTP 方法与 48 个配置项名称；参数是命中的百分比，
+ * 未命中的查询是与某个关键字只差一个字符的近似串（末尾加字符、改大小写、去掉末尾字符），
+ * 每次迭代查找 1024 个查询，按每次查找报告*/
+
+#include <map>
+
+#include "../leptSTL/algo.h"
+#include "../leptSTL/leptstring.h"
+#include "../leptSTL/static_perfect_set.h"
+#include "../leptSTL/unordered_set.h"
+#include "../leptSTL/vector.h"
+#include "container_bench.h"
+
+namespace leptstl
+{
+    namespace bench
+    {
+        namespace container_bench
+        {
+            struct http_methods
+            {
+                static const char* name() { return "http_methods"; }
+                static const static_perfect_set<9>& perfect_set()
+                {
+                    static constexpr static_perfect_set<9> s = make_static_perfect_set(
+                        "GET", "HEAD", "POST", "PUT", "DELETE", "CONNECT", "OPTIONS", "TRACE", "PATCH");
+                    return s;
+                }
+            };
+
+            struct config_keys
+            {
+                static const char* name() { return "config_keys"; }
+                static const static_perfect_set<48>& perfect_set()
+                {
+                    static constexpr static_perfect_set<48> s = make_static_perfect_set(
+                        "listen", "server_name", "root", "index", "access_log", "error_log", "log_level",
+                        "worker_processes", "worker_connections", "keepalive_timeout", "keepalive_requests",
+                        "client_max_body_size", "client_body_timeout", "client_header_timeout", "send_timeout",
+                        "sendfile", "tcp_nopush", "tcp_nodelay", "gzip", "gzip_types", "gzip_min_length",
+                        "gzip_comp_level", "proxy_pass", "proxy_set_header", "proxy_read_timeout",
+                        "proxy_connect_timeout", "proxy_buffering", "proxy_buffer_size", "ssl_certificate",
+                        "ssl_certificate_key", "ssl_protocols", "ssl_ciphers", "ssl_session_cache",
+                        "ssl_session_timeout", "location", "return", "rewrite", "try_files", "alias", "autoindex",
+                        "default_type", "include", "charset", "expires", "add_header", "limit_rate",
+                        "resolver", "upstream");
+                    return s;
+                }
+            };
+
+            /* 1024 个查询，hit_percent% 是关键字本身，其余是近似串*/
+            template <typename Keys>
+                const std::vector<leptstl::string>& keyword_queries(int hit_percent)
+                {
+                    static std::map<int, std::vector<leptstl::string>> cache;
+                    std::vector<leptstl::string>& q = cache[hit_percent];
+                    if (q.empty())
+                    {
+                        const auto& keys = Keys::perfect_set();
+                        for (size_t i = 0; i < 1024; ++i)
+                        {
+                            const uint32_t r = scramble(i);
+                            const size_t k = r % keys.size();
+                            leptstl::string s(keys.key(k), keys.key_size(k));
+                            if ((r >> 16) % 100 >= static_cast<uint32_t>(hit_percent))
+                            {
+                                switch ((r >> 8) % 3)
+                                {
+                                    case 0: s.push_back('s'); break;
+                                    case 1: s[0] = static_cast<char>(s[0] ^ 0x20); break;
+                                    default: s.pop_back(); break;
+                                }
+                            }
+                            q.push_back(s);
+                        }
+                    }
+                    return q;
+                }
+
+            template <typename Keys, typename Lookup>
+                void keyword_bench(state& st, Lookup contains)
+                {
+                    const std::vector<leptstl::string>& q = keyword_queries<Keys>(static_cast<int>(st.arg()));
+                    st.set_items(q.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        size_t found = 0;
+                        for (size_t k = 0; k < q.size(); ++k)
+                            found += contains(q[k]);
+                        do_not_optimize(found);
+                    }
+                }
+
+            template <typename Keys>
+                void perfect_set_find_bench(state& st)
+                {
+                    const auto& set = Keys::perfect_set();
+                    keyword_bench<Keys>(st, [&set](const leptstl::string& s) { return set.contains(s); });
+                }
+
+            template <typename Keys>
+                void unordered_set_find_bench(state& st)
+                {
+                    static leptstl::unordered_set<leptstl::string> set;
+                    if (set.empty())
+                    {
+                        const auto& keys = Keys::perfect_set();
+                        for (size_t i = 0; i < keys.size(); ++i)
+                            set.insert(leptstl::string(keys.key(i), keys.key_size(i)));
+                    }
+                    keyword_bench<Keys>(st, [](const leptstl::string& s) { return set.find(s) != set.end(); });
+                }
+
+            template <typename Keys>
+                void sorted_array_find_bench(state& st)
+                {
+                    static leptstl::vector<leptstl::string> sorted;
+                    if (sorted.empty())
+                    {
+                        const auto& keys = Keys::perfect_set();
+                        for (size_t i = 0; i < keys.size(); ++i)
+                            sorted.push_back(leptstl::string(keys.key(i), keys.key_size(i)));
+                        leptstl::sort(sorted.begin(), sorted.end());
+                    }
+                    keyword_bench<Keys>(st, [](const leptstl::string& s)
+                                        { return leptstl::binary_search(sorted.begin(), sorted.end(), s); });
+                }
+
+            template <typename Keys>
+                void register_keyword_set(const std::vector<int64_t>& hit_percents)
+                {
+                    const std::string label = std::string("<") + Keys::name() + ">";
+                    registry* r = registry::instance();
+                    r->add("leptstl::static_perfect_set" + label + "::find", "leptstl::static_perfect_set" + label,
+                           "find", perfect_set_find_bench<Keys>, hit_percents);
+                    r->add("leptstl::unordered_set" + label + "::find", "leptstl::unordered_set" + label,
+                           "find", unordered_set_find_bench<Keys>, hit_percents);
+                    r->add("leptstl::sorted_array" + label + "::binary_search", "leptstl::sorted_array" + label,
+                           "binary_search", sorted_array_find_bench<Keys>, hit_percents);
+                }
+
+            inline void register_keywords(const std::vector<int64_t>& hit_percents)
+            {
+                register_keyword_set<http_methods>(hit_percents);
+                register_keyword_set<config_keys>(hit_percents);
+            }
+
+        }   /* namespace container_bench */
+
+    }   /* namespace bench */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_KEYWORD_BENCH_H__ */
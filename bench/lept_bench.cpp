@@ -0,0 +1,17 @@
+/*************************************************************************
+	> File Name: lept_bench.cpp
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 07:03:26 AM EDT
+ ************************************************************************/
+
+/* 算法与哈希函数的性能测试程序，参数见 bench_main.h，容器的测试在 leptstl_container_bench 中*/
+
+#include "bench_main.h"
+#include "algorithm_bench.h"
+#include "hash_bench.h"
+
+int main(int argc, char* argv[])
+{
+    return leptstl::bench::bench_main(argc, argv, leptstl::bench::options());
+}
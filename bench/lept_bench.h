@@ -0,0 +1,532 @@
+/*************************************************************************
+	> File Name: lept_bench.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 06:20:47 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_BENCH_H__
+#define LEPTSTL_BENCH_H__
+
+/* 此头文件是一个简单的性能测试框架，用来代替 test 目录下基于 clock() 的 FUN_TEST 宏
+ * clock() 统计的是进程的 CPU 时间，分辨率只有毫秒，且每个测试只运行一次，亚毫秒级的退化看不出来
+ * 这里使用 steady_clock 计时（x86 上同时记录 rdtsc），每个测试先预热，再自动调整每轮的迭代次数，
+ * 使每轮运行至少 min_time_ms 毫秒，重复 repetitions 轮后报告每次迭代耗时的中位数、p95、均值与标准差
+ * 一次迭代包含多个操作时（例如 push_back n 个元素），调用 st.set_items(n)，结果改为按每个操作报告
+ * 处理字节流的测试（例如哈希）可以调用 st.set_bytes(n) 给出每次迭代处理的字节数，结果另外报告 GB/s
+ *
+ * 使用方法：
+ *   LEPTSTL_BENCH_(vector_push_back, "leptstl::vector<int>", "push_back", 1000, 100000)
+ *   {
+ *       for (size_t i = 0; i < st.iterations(); ++i)
+ *       {
+ *           leptstl::vector<int> v;
+ *           for (int64_t k = 0; k < st.arg(); ++k)
+ *               v.push_back(static_cast<int>(k));
+ *           leptstl::bench::do_not_optimize(v.data());
+ *       }
+ *   }
+ * 宏的第二、三个参数是容器与操作的名称，之后是 st.arg() 的取值，每个取值作为一个单独的测试；
+ * 迭代中不需要计时的准备工作放在 st.pause_timing() 与 st.resume_timing() 之间
+ * 设置了 current_perf_counters() 时（bench_main 的 --perf），同样只在计时的部分读取硬件计数器，按每个操作报告
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <initializer_list>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "perf_counters.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define LEPTSTL_BENCH_HAS_RDTSC 1
+#else
+#define LEPTSTL_BENCH_HAS_RDTSC 0
+#endif
+
+namespace leptstl
+{
+    namespace bench
+    {
+        /* 计时相关*/
+        inline uint64_t now_ns()
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        /* 时间戳计数器，不支持时返回0*/
+        inline uint64_t now_ticks()
+        {
+#if LEPTSTL_BENCH_HAS_RDTSC
+            return __rdtsc();
+#else
+            return 0;
+#endif
+        }
+
+        /* 优化屏障：让编译器认为 value 被读取（或修改），从而不能删掉计算它的代码*/
+        template <typename T>
+            inline void do_not_optimize(const T& value)
+            {
+                asm volatile("" : : "r,m"(value) : "memory");
+            }
+
+        template <typename T>
+            inline void do_not_optimize(T& value)
+            {
+#if defined(__clang__)
+                asm volatile("" : "+r,m"(value) : : "memory");
+#else
+                /* GCC 对 "+m,r" 这样带多个候选的读写约束可能让输入与输出选中不同的位置，
+                 * 循环中的指针因此被读成别处的值，这里只用内存约束*/
+                asm volatile("" : "+m"(value) : : "memory");
+#endif
+            }
+
+        /* 让编译器认为所有内存都可能被读写，迫使之前的写操作真正发生*/
+        inline void clobber_memory()
+        {
+            asm volatile("" : : : "memory");
+        }
+
+        /**********************************************************************/
+        /* 内存分配计数的来源，两个函数分别返回到目前为止的分配次数与字节数
+         * 为空时不统计；与计时一样只统计未暂停的部分，准备工作中的分配不计入*/
+        struct alloc_probe
+        {
+            uint64_t (*count)();
+            uint64_t (*bytes)();
+        };
+
+        inline alloc_probe& current_alloc_probe()
+        {
+            static alloc_probe probe = { nullptr, nullptr };
+            return probe;
+        }
+
+        /* 传给测试函数的状态：本轮的迭代次数、参数以及计时*/
+        class state
+        {
+            public:
+                state(size_t iterations, int64_t arg)
+                    :iterations_(iterations), arg_(arg), items_(1), bytes_processed_(0), paused_(false),
+                    start_ns_(0), start_ticks_(0), elapsed_ns_(0), elapsed_ticks_(0),
+                    probe_(current_alloc_probe()), start_allocs_(0), start_bytes_(0), allocs_(0), bytes_(0),
+                    perf_(current_perf_counters())
+                {
+                    for (int k = 0; k < perf_event_count; ++k)
+                        perf_start_[k] = perf_total_[k] = 0;
+                }
+
+                size_t  iterations() const noexcept { return iterations_; }
+                int64_t arg()        const noexcept { return arg_; }
+
+                /* 每次迭代包含的操作数，例如一次迭代 push_back n 个元素时设为 n，结果按单个操作报告*/
+                void    set_items(size_t n) noexcept { items_ = n == 0 ? 1 : n; }
+                size_t  items()      const noexcept { return items_; }
+
+                /* 每次迭代处理的字节数，设置后结果中报告吞吐量*/
+                void    set_bytes(size_t n) noexcept { bytes_processed_ = n; }
+                size_t  bytes()      const noexcept { return bytes_processed_; }
+
+                /* 暂停与恢复计时，用于每次迭代前的准备工作*/
+                void pause_timing()
+                {
+                    if (paused_)
+                        return;
+                    elapsed_ticks_ += now_ticks() - start_ticks_;
+                    elapsed_ns_ += now_ns() - start_ns_;
+                    if (probe_.count)
+                        allocs_ += probe_.count() - start_allocs_;
+                    if (probe_.bytes)
+                        bytes_ += probe_.bytes() - start_bytes_;
+                    if (perf_)
+                    {
+                        double now[perf_event_count];
+                        perf_->read(now);
+                        for (int k = 0; k < perf_event_count; ++k)
+                            perf_total_[k] += now[k] - perf_start_[k];
+                    }
+                    paused_ = true;
+                }
+                void resume_timing()
+                {
+                    if (!paused_)
+                        return;
+                    paused_ = false;
+                    start_allocs_ = probe_.count ? probe_.count() : 0;
+                    start_bytes_ = probe_.bytes ? probe_.bytes() : 0;
+                    if (perf_)
+                        perf_->read(perf_start_);
+                    start_ns_ = now_ns();
+                    start_ticks_ = now_ticks();
+                }
+
+                uint64_t elapsed_ns()    const noexcept { return elapsed_ns_; }
+                uint64_t elapsed_ticks() const noexcept { return elapsed_ticks_; }
+                uint64_t allocations()   const noexcept { return allocs_; }
+                uint64_t alloc_bytes()   const noexcept { return bytes_; }
+                /* 计时部分的硬件计数器总数，kind 为 perf_event_kind，未启用时为0*/
+                double   perf_count(int kind) const noexcept { return perf_total_[kind]; }
+
+            private:
+                friend class runner;
+
+                void start()
+                {
+                    paused_ = true;
+                    resume_timing();
+                }
+                void stop()
+                {
+                    pause_timing();
+                }
+
+            private:
+                size_t   iterations_;
+                int64_t  arg_;
+                size_t   items_;
+                size_t   bytes_processed_;
+                bool     paused_;
+                uint64_t start_ns_;
+                uint64_t start_ticks_;
+                uint64_t elapsed_ns_;
+                uint64_t elapsed_ticks_;
+                alloc_probe probe_;
+                uint64_t start_allocs_;
+                uint64_t start_bytes_;
+                uint64_t allocs_;
+                uint64_t bytes_;
+                perf_counters* perf_;
+                double   perf_start_[perf_event_count];
+                double   perf_total_[perf_event_count];
+        };
+
+        typedef void (*bench_function)(state&);
+
+        /* 一个注册的测试及其全部参数*/
+        struct benchmark
+        {
+            std::string          name;
+            std::string          container;  /* 被测的容器或实现，如 leptstl::vector<int>*/
+            std::string          operation;  /* 被测的操作，如 push_back*/
+            bench_function       fun;
+            std::vector<int64_t> args;
+        };
+
+        /* 一个测试在某个参数下的统计结果，时间单位都是每次操作的纳秒数（每次迭代的时间除以 state::items()）*/
+        struct result
+        {
+            std::string name;       /* 名称，带参数时为 name/arg*/
+            std::string container;
+            std::string operation;
+            int64_t     arg;
+            size_t      iterations; /* 每轮的迭代次数*/
+            size_t      repetitions;
+            double      median_ns;
+            double      p95_ns;
+            double      mean_ns;
+            double      stddev_ns;
+            double      min_ns;
+            double      ticks;      /* 每次操作 rdtsc 计数的中位数，不支持时为0*/
+            double      allocations;/* 每次操作的内存分配次数与字节数，没有 alloc_probe 时为0*/
+            double      bytes;
+            double      perf[perf_event_count]; /* 每次操作的硬件计数器值，下标为 perf_event_kind，不可用时为-1*/
+            double      gb_per_s;   /* 按中位数计算的吞吐量，没有调用 st.set_bytes() 时为0*/
+        };
+
+        /* 运行参数*/
+        struct options
+        {
+            double      warmup_ms;
+            double      min_time_ms;    /* 每轮至少运行的时间*/
+            size_t      repetitions;
+            size_t      max_iterations;
+            std::string filter;         /* 只运行名称中包含此字符串的测试*/
+
+            options()
+                :warmup_ms(50), min_time_ms(20), repetitions(20), max_iterations(1000000000)
+            {
+            }
+        };
+
+        /**********************************************************************/
+        /* 注册表，LEPTSTL_BENCH_ 定义的测试在静态初始化时加入*/
+        class registry
+        {
+            public:
+                static registry* instance()
+                {
+                    static registry r;
+                    return &r;
+                }
+
+                bool add(const std::string& name, const std::string& container, const std::string& operation,
+                         bench_function fun, std::initializer_list<int64_t> args)
+                {
+                    return add(name, container, operation, fun, std::vector<int64_t>(args.begin(), args.end()));
+                }
+                bool add(const std::string& name, const std::string& container, const std::string& operation,
+                         bench_function fun, const std::vector<int64_t>& args)
+                {
+                    benchmark b;
+                    b.name = name;
+                    b.container = container;
+                    b.operation = operation;
+                    b.fun = fun;
+                    b.args = args;
+                    benchmarks_.push_back(b);
+                    return true;
+                }
+
+                const std::vector<benchmark>& benchmarks() const { return benchmarks_; }
+
+            private:
+                std::vector<benchmark> benchmarks_;
+        };
+
+        /**********************************************************************/
+        /* 按 options 运行测试并统计*/
+        class runner
+        {
+            public:
+                explicit runner(const options& opt) : opt_(opt) {}
+
+                result run(const benchmark& b, int64_t arg) const
+                {
+                    /* 第一次调用可能在建立输入数据的缓存，不计入迭代次数的估计*/
+                    run_once(b, arg, 1);
+                    /* 自动调整迭代次数：从1开始放大，直到一轮的时间不少于 min_time_ms*/
+                    const double min_ns = opt_.min_time_ms * 1e6;
+                    size_t iters = 1;
+                    double elapsed = run_once(b, arg, iters).ns;
+                    while (elapsed < min_ns && iters < opt_.max_iterations)
+                    {
+                        double scale = elapsed > 0 ? min_ns * 1.4 / elapsed : 10.0;
+                        scale = std::min(10.0, std::max(2.0, scale));
+                        iters = std::min(opt_.max_iterations, static_cast<size_t>(iters * scale + 0.5));
+                        elapsed = run_once(b, arg, iters).ns;
+                    }
+                    /* 预热：确定迭代次数的过程本身也算预热，不够时再补足*/
+                    const uint64_t warm_end = now_ns() + static_cast<uint64_t>(opt_.warmup_ms * 1e6);
+                    while (now_ns() < warm_end)
+                        run_once(b, arg, iters);
+
+                    uint64_t alloc_count = 0, alloc_bytes = 0;
+                    double perf[perf_event_count] = {};
+                    double bytes_per_op = 0;
+                    std::vector<double> samples, ticks;
+                    double ops = 0;
+                    for (size_t r = 0; r < opt_.repetitions; ++r)
+                    {
+                        const sample t = run_once(b, arg, iters);
+                        alloc_count += t.allocations;
+                        alloc_bytes += t.bytes;
+                        for (int k = 0; k < perf_event_count; ++k)
+                            perf[k] += t.perf[k];
+                        samples.push_back(t.ns / t.ops);
+                        ticks.push_back(t.ticks / t.ops);
+                        ops += t.ops;
+                        bytes_per_op = t.processed / t.ops;
+                    }
+
+                    result res;
+                    res.name = b.args.empty() ? b.name : b.name + "/" + std::to_string(arg);
+                    res.container = b.container;
+                    res.operation = b.operation;
+                    res.arg = arg;
+                    res.iterations = iters;
+                    res.repetitions = samples.size();
+                    std::sort(samples.begin(), samples.end());
+                    std::sort(ticks.begin(), ticks.end());
+                    res.median_ns = percentile(samples, 50);
+                    res.p95_ns = percentile(samples, 95);
+                    res.min_ns = samples.front();
+                    double sum = 0, sq = 0;
+                    for (size_t i = 0; i < samples.size(); ++i)
+                        sum += samples[i];
+                    res.mean_ns = sum / samples.size();
+                    for (size_t i = 0; i < samples.size(); ++i)
+                        sq += (samples[i] - res.mean_ns) * (samples[i] - res.mean_ns);
+                    res.stddev_ns = samples.size() > 1 ? std::sqrt(sq / (samples.size() - 1)) : 0;
+                    res.ticks = percentile(ticks, 50);
+                    res.allocations = alloc_count / ops;
+                    res.bytes = alloc_bytes / ops;
+                    const perf_counters* counters = current_perf_counters();
+                    for (int k = 0; k < perf_event_count; ++k)
+                        res.perf[k] = counters && counters->available(k) ? perf[k] / ops : -1;
+                    res.gb_per_s = res.median_ns > 0 ? bytes_per_op / res.median_ns : 0;
+                    return res;
+                }
+
+                /* 线性插值的百分位数，samples 须已排序*/
+                static double percentile(const std::vector<double>& samples, double p)
+                {
+                    if (samples.empty())
+                        return 0;
+                    const double pos = (samples.size() - 1) * p / 100.0;
+                    const size_t lo = static_cast<size_t>(pos);
+                    const size_t hi = std::min(lo + 1, samples.size() - 1);
+                    return samples[lo] + (samples[hi] - samples[lo]) * (pos - lo);
+                }
+
+            private:
+                /* 一轮的纳秒数、rdtsc 计数、操作数、分配次数、字节数、硬件计数器总数与处理的字节数*/
+                struct sample
+                {
+                    double   ns;
+                    double   ticks;
+                    double   ops;
+                    uint64_t allocations;
+                    uint64_t bytes;
+                    double   perf[perf_event_count];
+                    double   processed;
+                };
+
+                sample run_once(const benchmark& b, int64_t arg, size_t iters) const
+                {
+                    state st(iters, arg);
+                    st.start();
+                    b.fun(st);
+                    st.stop();
+                    sample t = { static_cast<double>(st.elapsed_ns()), static_cast<double>(st.elapsed_ticks()),
+                                 static_cast<double>(iters) * st.items(), st.allocations(), st.alloc_bytes(), {},
+                                 static_cast<double>(iters) * st.bytes() };
+                    for (int k = 0; k < perf_event_count; ++k)
+                        t.perf[k] = st.perf_count(k);
+                    return t;
+                }
+
+            private:
+                options opt_;
+        };
+
+        /**********************************************************************/
+        /* 输出*/
+
+        /* 按数量级选择时间单位*/
+        inline std::string format_time(double ns)
+        {
+            char buf[32];
+            if (ns < 1e3)
+                std::snprintf(buf, sizeof(buf), "%.2f ns", ns);
+            else if (ns < 1e6)
+                std::snprintf(buf, sizeof(buf), "%.2f us", ns / 1e3);
+            else if (ns < 1e9)
+                std::snprintf(buf, sizeof(buf), "%.2f ms", ns / 1e6);
+            else
+                std::snprintf(buf, sizeof(buf), "%.2f s", ns / 1e9);
+            return buf;
+        }
+
+        /* 启用了硬件计数器时，在末尾追加每次操作的周期数、IPC、L1d 与末级缓存缺失、分支预测失败*/
+        inline bool perf_columns()
+        {
+            return current_perf_counters() != nullptr;
+        }
+
+        inline void print_header(std::ostream& os)
+        {
+            os << std::left << std::setw(56) << "benchmark" << std::right
+               << std::setw(12) << "iterations"
+               << std::setw(13) << "median"
+               << std::setw(13) << "p95"
+               << std::setw(13) << "mean"
+               << std::setw(9)  << "stddev"
+               << std::setw(13) << "ticks"
+               << std::setw(11) << "allocs";
+            if (perf_columns())
+                os << std::setw(11) << "cycles" << std::setw(7) << "IPC" << std::setw(10) << "L1d-miss"
+                   << std::setw(10) << "LLC-miss" << std::setw(10) << "br-miss";
+            os << "\n" << std::string(perf_columns() ? 188 : 140, '-') << "\n";
+        }
+
+        inline void print_result(std::ostream& os, const result& r)
+        {
+            char cv[16], ticks[32], allocs[32];
+            std::snprintf(cv, sizeof(cv), "%.1f%%", r.mean_ns > 0 ? r.stddev_ns / r.mean_ns * 100 : 0.0);
+            std::snprintf(ticks, sizeof(ticks), "%.0f", r.ticks);
+            std::snprintf(allocs, sizeof(allocs), "%.3g", r.allocations);
+            os << std::left << std::setw(56) << r.name << std::right
+               << std::setw(12) << r.iterations
+               << std::setw(13) << format_time(r.median_ns)
+               << std::setw(13) << format_time(r.p95_ns)
+               << std::setw(13) << format_time(r.mean_ns)
+               << std::setw(9)  << cv
+               << std::setw(13) << ticks
+               << std::setw(11) << allocs;
+            if (perf_columns())
+            {
+                char cycles[32], ipc[16], l1d[32], llc[32], br[32];
+                std::snprintf(cycles, sizeof(cycles), r.perf[perf_cycles] < 0 ? "-" : "%.3g", r.perf[perf_cycles]);
+                if (r.perf[perf_cycles] > 0 && r.perf[perf_instructions] >= 0)
+                    std::snprintf(ipc, sizeof(ipc), "%.2f", r.perf[perf_instructions] / r.perf[perf_cycles]);
+                else
+                    std::snprintf(ipc, sizeof(ipc), "-");
+                std::snprintf(l1d, sizeof(l1d), r.perf[perf_l1d_misses] < 0 ? "-" : "%.3g", r.perf[perf_l1d_misses]);
+                std::snprintf(llc, sizeof(llc), r.perf[perf_llc_misses] < 0 ? "-" : "%.3g", r.perf[perf_llc_misses]);
+                std::snprintf(br, sizeof(br), r.perf[perf_branch_misses] < 0 ? "-" : "%.3g", r.perf[perf_branch_misses]);
+                os << std::setw(11) << cycles << std::setw(7) << ipc << std::setw(10) << l1d
+                   << std::setw(10) << llc << std::setw(10) << br;
+            }
+            if (r.gb_per_s > 0)
+            {
+                char gbps[32];
+                std::snprintf(gbps, sizeof(gbps), "  %.2f GB/s", r.gb_per_s);
+                os << gbps;
+            }
+            os << "\n";
+        }
+
+        /* 运行注册表中所有匹配 filter 的测试，返回全部结果*/
+        inline std::vector<result> run_all(const options& opt, std::ostream& os)
+        {
+            runner run(opt);
+            std::vector<result> results;
+            print_header(os);
+            const std::vector<benchmark>& all = registry::instance()->benchmarks();
+            for (size_t i = 0; i < all.size(); ++i)
+            {
+                const benchmark& b = all[i];
+                std::vector<int64_t> args = b.args;
+                if (args.empty())
+                    args.push_back(0);
+                for (size_t k = 0; k < args.size(); ++k)
+                {
+                    const std::string name = b.args.empty() ? b.name : b.name + "/" + std::to_string(args[k]);
+                    if (!opt.filter.empty() && name.find(opt.filter) == std::string::npos)
+                        continue;
+                    results.push_back(run.run(b, args[k]));
+                    print_result(os, results.back());
+                    os.flush();
+                }
+            }
+            return results;
+        }
+
+        /**********************************************************************/
+        /* 测试函数名替换为 bench_name_BENCH*/
+#define BENCH_NAME(bench_name) bench_name##_BENCH
+
+        /* 定义并注册一个测试，container 与 operation 是写入结果文件的标签，其余参数为 st.arg() 的各个取值*/
+#define LEPTSTL_BENCH_(bench_name, container, operation, ...)                       \
+        void BENCH_NAME(bench_name)(leptstl::bench::state& st);                     \
+        static const bool bench_name##_registered_ =                                \
+            leptstl::bench::registry::instance()->add(#bench_name, container,       \
+                    operation, BENCH_NAME(bench_name), { __VA_ARGS__ });            \
+        void BENCH_NAME(bench_name)(leptstl::bench::state& st)
+
+    }   /* namespace bench */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_BENCH_H__ */
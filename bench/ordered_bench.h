@@ -0,0 +1,288 @@
+/*************************************************************************
+	> File Name: ordered_bench.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Wed 21 Oct 2026 09:12:40 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_ORDERED_BENCH_H__
+#define LEPTSTL_ORDERED_BENCH_H__
+
+/* 有序容器的性能测试，原先是 test/btree_test.h 与 test/flat_map_test.h 中的性能表格
+ * btree_set / btree_map 与 std::set / std::map：insert 每次迭代插入 n 个随机键建一棵新树，按每个元素报告；
+ * find 随机查找 1024 个已有的键，iterate 顺序遍历，分别按每次查找、每个元素报告
+ * 只读查找表：std::map、unordered_map 与 flat_map 从同一批乱序的键值对建表（build，flat_map 用区间插入），
+ * find 查找 1024 个键，一半不存在
+ * flat_set 的建表：逐个插入与分两次区间插入*/
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include "../leptSTL/btree_map.h"
+#include "../leptSTL/btree_set.h"
+#include "../leptSTL/flat_map.h"
+#include "../leptSTL/flat_set.h"
+#include "../leptSTL/unordered_map.h"
+#include "container_bench.h"
+
+namespace leptstl
+{
+    namespace bench
+    {
+        namespace container_bench
+        {
+            /* 集合插入键，映射的值取键的下标*/
+            template <typename Set>
+                void ordered_fill(Set& s, const std::vector<int>& keys, lept_false_type)
+                {
+                    for (size_t i = 0; i < keys.size(); ++i)
+                        s.insert(keys[i]);
+                }
+
+            template <typename Map>
+                void ordered_fill(Map& m, const std::vector<int>& keys, lept_true_type)
+                {
+                    for (size_t i = 0; i < keys.size(); ++i)
+                        m[keys[i]] = static_cast<int>(i);
+                }
+
+            /* 建好的容器，只缓存最近一次的长度*/
+            template <typename Con, bool IsMap>
+                const Con& ordered_prebuilt(size_t n)
+                {
+                    static Con* c = nullptr;
+                    static size_t cached_n = 0;
+                    if (c == nullptr || cached_n != n)
+                    {
+                        delete c;
+                        c = nullptr;
+                        c = new Con();
+                        ordered_fill(*c, values<int>(n), lept_bool_constant<IsMap>());
+                        cached_n = n;
+                    }
+                    return *c;
+                }
+
+            template <typename Con, bool IsMap>
+                void ordered_insert_bench(state& st)
+                {
+                    const std::vector<int>& keys = values<int>(static_cast<size_t>(st.arg()));
+                    st.set_items(keys.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        Con c;
+                        ordered_fill(c, keys, lept_bool_constant<IsMap>());
+                        do_not_optimize(c);
+                    }
+                }
+
+            template <typename Con, bool IsMap>
+                void ordered_find_bench(state& st)
+                {
+                    const size_t n = static_cast<size_t>(st.arg());
+                    const Con& c = ordered_prebuilt<Con, IsMap>(n);
+                    const std::vector<int>& keys = values<int>(n);
+                    const std::vector<size_t>& idx = random_indices(n);
+                    st.set_items(idx.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        size_t found = 0;
+                        for (size_t k = 0; k < idx.size(); ++k)
+                            found += c.find(keys[idx[k]]) != c.end();
+                        do_not_optimize(found);
+                    }
+                }
+
+            inline size_t ordered_touch(int v) { return static_cast<size_t>(v); }
+            template <typename K, typename V>
+                size_t ordered_touch(const std::pair<const K, V>& kv) { return static_cast<size_t>(kv.second); }
+            template <typename K, typename V>
+                size_t ordered_touch(const leptstl::pair<const K, V>& kv) { return static_cast<size_t>(kv.second); }
+
+            template <typename Con, bool IsMap>
+                void ordered_iterate_bench(state& st)
+                {
+                    const Con& c = ordered_prebuilt<Con, IsMap>(static_cast<size_t>(st.arg()));
+                    st.set_items(c.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        size_t sum = 0;
+                        for (typename Con::const_iterator it = c.begin(); it != c.end(); ++it)
+                            sum += ordered_touch(*it);
+                        do_not_optimize(sum);
+                    }
+                }
+
+#define LEPTSTL_ORDERED_SIZES 1000, 100000, 1000000
+
+            LEPTSTL_BENCH_(std_set_insert, "std::set<int>", "insert", LEPTSTL_ORDERED_SIZES)
+            { ordered_insert_bench<std::set<int>, false>(st); }
+            LEPTSTL_BENCH_(btree_set_insert, "leptstl::btree_set<int>", "insert", LEPTSTL_ORDERED_SIZES)
+            { ordered_insert_bench<leptstl::btree_set<int>, false>(st); }
+            LEPTSTL_BENCH_(std_set_find, "std::set<int>", "find", LEPTSTL_ORDERED_SIZES)
+            { ordered_find_bench<std::set<int>, false>(st); }
+            LEPTSTL_BENCH_(btree_set_find, "leptstl::btree_set<int>", "find", LEPTSTL_ORDERED_SIZES)
+            { ordered_find_bench<leptstl::btree_set<int>, false>(st); }
+            LEPTSTL_BENCH_(std_set_iterate, "std::set<int>", "iterate", LEPTSTL_ORDERED_SIZES)
+            { ordered_iterate_bench<std::set<int>, false>(st); }
+            LEPTSTL_BENCH_(btree_set_iterate, "leptstl::btree_set<int>", "iterate", LEPTSTL_ORDERED_SIZES)
+            { ordered_iterate_bench<leptstl::btree_set<int>, false>(st); }
+
+            LEPTSTL_BENCH_(std_map_insert, "std::map<int,int>", "insert", LEPTSTL_ORDERED_SIZES)
+            { ordered_insert_bench<std::map<int, int>, true>(st); }
+            LEPTSTL_BENCH_(btree_map_insert, "leptstl::btree_map<int,int>", "insert", LEPTSTL_ORDERED_SIZES)
+            { ordered_insert_bench<leptstl::btree_map<int, int>, true>(st); }
+            LEPTSTL_BENCH_(std_map_find, "std::map<int,int>", "find", LEPTSTL_ORDERED_SIZES)
+            { ordered_find_bench<std::map<int, int>, true>(st); }
+            LEPTSTL_BENCH_(btree_map_find, "leptstl::btree_map<int,int>", "find", LEPTSTL_ORDERED_SIZES)
+            { ordered_find_bench<leptstl::btree_map<int, int>, true>(st); }
+            LEPTSTL_BENCH_(std_map_iterate, "std::map<int,int>", "iterate", LEPTSTL_ORDERED_SIZES)
+            { ordered_iterate_bench<std::map<int, int>, true>(st); }
+            LEPTSTL_BENCH_(btree_map_iterate, "leptstl::btree_map<int,int>", "iterate", LEPTSTL_ORDERED_SIZES)
+            { ordered_iterate_bench<leptstl::btree_map<int, int>, true>(st); }
+
+#undef LEPTSTL_ORDERED_SIZES
+
+            /* 查找表的内容：n 个偶数键，顺序打乱，查找的键取自 [0, 2n)，约一半不存在*/
+            inline const std::vector<leptstl::pair<int, int>>& table_items(size_t n)
+            {
+                static std::vector<leptstl::pair<int, int>> cache;
+                if (cache.size() != n)
+                {
+                    cache.clear();
+                    for (size_t i = 0; i < n; ++i)
+                        cache.push_back(leptstl::make_pair(static_cast<int>(i * 2), make_value<int>(i)));
+                    uint32_t x = 2463534242u;
+                    for (size_t i = n; i > 1; --i)
+                    {
+                        x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+                        leptstl::swap(cache[i - 1], cache[x % i]);
+                    }
+                }
+                return cache;
+            }
+
+            template <typename Map>
+                void table_build(Map& m, const std::vector<leptstl::pair<int, int>>& items)
+                {
+                    for (size_t i = 0; i < items.size(); ++i)
+                        m.emplace(items[i].first, items[i].second);
+                }
+            inline void table_build(leptstl::flat_map<int, int>& m, const std::vector<leptstl::pair<int, int>>& items)
+            {
+                m.insert(items.begin(), items.end());
+            }
+
+            template <typename Map>
+                void table_build_bench(state& st)
+                {
+                    const std::vector<leptstl::pair<int, int>>& items = table_items(static_cast<size_t>(st.arg()));
+                    st.set_items(items.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        Map m;
+                        table_build(m, items);
+                        do_not_optimize(m);
+                    }
+                }
+
+            template <typename Map>
+                void table_find_bench(state& st)
+                {
+                    const size_t n = static_cast<size_t>(st.arg());
+                    const std::vector<leptstl::pair<int, int>>& items = table_items(n);
+                    st.pause_timing();
+                    Map m;
+                    table_build(m, items);
+                    const std::vector<size_t>& idx = random_indices(n * 2);
+                    st.resume_timing();
+                    st.set_items(idx.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        size_t sum = 0;
+                        for (size_t k = 0; k < idx.size(); ++k)
+                        {
+                            auto it = m.find(static_cast<int>(idx[k]));
+                            if (it != m.end())
+                                sum += (*it).second;
+                        }
+                        do_not_optimize(sum);
+                    }
+                }
+
+            template <typename Map>
+                void table_iterate_bench(state& st)
+                {
+                    const std::vector<leptstl::pair<int, int>>& items = table_items(static_cast<size_t>(st.arg()));
+                    st.pause_timing();
+                    Map m;
+                    table_build(m, items);
+                    st.resume_timing();
+                    st.set_items(items.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        size_t sum = 0;
+                        for (auto it = m.begin(); it != m.end(); ++it)
+                            sum += (*it).second;
+                        do_not_optimize(sum);
+                    }
+                }
+
+#define LEPTSTL_TABLE_SIZES 64, 4096, 100000
+
+            LEPTSTL_BENCH_(std_map_table_build, "std::map<int,int>", "table_build", LEPTSTL_TABLE_SIZES)
+            { table_build_bench<std::map<int, int>>(st); }
+            LEPTSTL_BENCH_(unordered_map_table_build, "leptstl::unordered_map<int,int>", "table_build", LEPTSTL_TABLE_SIZES)
+            { table_build_bench<leptstl::unordered_map<int, int>>(st); }
+            LEPTSTL_BENCH_(flat_map_table_build, "leptstl::flat_map<int,int>", "table_build", LEPTSTL_TABLE_SIZES)
+            { table_build_bench<leptstl::flat_map<int, int>>(st); }
+            LEPTSTL_BENCH_(std_map_table_find, "std::map<int,int>", "table_find", LEPTSTL_TABLE_SIZES)
+            { table_find_bench<std::map<int, int>>(st); }
+            LEPTSTL_BENCH_(unordered_map_table_find, "leptstl::unordered_map<int,int>", "table_find", LEPTSTL_TABLE_SIZES)
+            { table_find_bench<leptstl::unordered_map<int, int>>(st); }
+            LEPTSTL_BENCH_(flat_map_table_find, "leptstl::flat_map<int,int>", "table_find", LEPTSTL_TABLE_SIZES)
+            { table_find_bench<leptstl::flat_map<int, int>>(st); }
+            LEPTSTL_BENCH_(std_map_table_iterate, "std::map<int,int>", "table_iterate", LEPTSTL_TABLE_SIZES)
+            { table_iterate_bench<std::map<int, int>>(st); }
+            LEPTSTL_BENCH_(unordered_map_table_iterate, "leptstl::unordered_map<int,int>", "table_iterate", LEPTSTL_TABLE_SIZES)
+            { table_iterate_bench<leptstl::unordered_map<int, int>>(st); }
+            LEPTSTL_BENCH_(flat_map_table_iterate, "leptstl::flat_map<int,int>", "table_iterate", LEPTSTL_TABLE_SIZES)
+            { table_iterate_bench<leptstl::flat_map<int, int>>(st); }
+
+#undef LEPTSTL_TABLE_SIZES
+
+            /* flat_set 逐个插入，每次插入都要搬动其后的元素*/
+            LEPTSTL_BENCH_(flat_set_insert, "leptstl::flat_set<int>", "insert", 1000, 10000, 100000)
+            {
+                const std::vector<int>& keys = values<int>(static_cast<size_t>(st.arg()));
+                st.set_items(keys.size());
+                for (size_t i = 0; i < st.iterations(); ++i)
+                {
+                    leptstl::flat_set<int> s;
+                    ordered_fill(s, keys, lept_false_type());
+                    do_not_optimize(s);
+                }
+            }
+
+            /* 分两次区间插入：第二次要与已有的有序元素归并*/
+            LEPTSTL_BENCH_(flat_set_insert_range, "leptstl::flat_set<int>", "insert_range", 1000, 10000, 100000)
+            {
+                const std::vector<int>& keys = values<int>(static_cast<size_t>(st.arg()));
+                st.set_items(keys.size());
+                for (size_t i = 0; i < st.iterations(); ++i)
+                {
+                    leptstl::flat_set<int> s;
+                    s.insert(keys.begin(), keys.begin() + keys.size() / 2);
+                    s.insert(keys.begin() + keys.size() / 2, keys.end());
+                    do_not_optimize(s);
+                }
+            }
+
+        }   /* namespace container_bench */
+
+    }   /* namespace bench */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_ORDERED_BENCH_H__ */
@@ -0,0 +1,165 @@
+/*************************************************************************
+	> File Name: perf_counters.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 02:08:15 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_PERF_COUNTERS_H__
+#define LEPTSTL_PERF_COUNTERS_H__
+
+/* 此头文件通过 Linux 的 perf_event_open 读取硬件计数器：周期数、指令数、L1 数据缓存读缺失、末级缓存缺失、分支预测失败
+ * 只统计本线程的用户态（exclude_kernel），perf_event_paranoid <= 2 时普通用户即可使用
+ * 每个计数器单独打开，打不开的（虚拟机或容器中常见）标记为不可用，其余照常工作；
+ * 计数器多于硬件寄存器时内核会分时复用，读数按 time_enabled / time_running 放大
+ * 非 Linux 平台上所有计数器都不可用*/
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace leptstl
+{
+    namespace bench
+    {
+        enum perf_event_kind
+        {
+            perf_cycles,
+            perf_instructions,
+            perf_l1d_misses,
+            perf_llc_misses,
+            perf_branch_misses,
+            perf_event_count
+        };
+
+        inline const char* perf_event_name(int kind)
+        {
+            static const char* const names[perf_event_count] = {
+                "cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses"
+            };
+            return names[kind];
+        }
+
+        class perf_counters
+        {
+            public:
+                perf_counters()
+                {
+                    for (int k = 0; k < perf_event_count; ++k)
+                        fds_[k] = -1;
+                }
+
+                ~perf_counters() { close(); }
+
+                perf_counters(const perf_counters&) = delete;
+                perf_counters& operator=(const perf_counters&) = delete;
+
+                /* 打开全部计数器，至少一个可用时返回 true；都不可用时 error 给出第一个失败的原因*/
+                bool open(std::string& error)
+                {
+                    close();
+#if defined(__linux__)
+                    static const uint32_t types[perf_event_count] = {
+                        PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE,
+                        PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE
+                    };
+                    static const uint64_t configs[perf_event_count] = {
+                        PERF_COUNT_HW_CPU_CYCLES,
+                        PERF_COUNT_HW_INSTRUCTIONS,
+                        PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                            | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+                        PERF_COUNT_HW_CACHE_MISSES,
+                        PERF_COUNT_HW_BRANCH_MISSES
+                    };
+                    bool any = false;
+                    for (int k = 0; k < perf_event_count; ++k)
+                    {
+                        perf_event_attr attr;
+                        std::memset(&attr, 0, sizeof(attr));
+                        attr.size = sizeof(attr);
+                        attr.type = types[k];
+                        attr.config = configs[k];
+                        attr.exclude_kernel = 1;
+                        attr.exclude_hv = 1;
+                        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+                        fds_[k] = static_cast<int>(::syscall(__NR_perf_event_open, &attr, 0, -1, -1,
+                                                             PERF_FLAG_FD_CLOEXEC));
+                        if (fds_[k] >= 0)
+                            any = true;
+                        else if (error.empty())
+                            error = std::string(perf_event_name(k)) + ": " + describe(errno);
+                    }
+                    if (any)
+                        error.clear();
+                    return any;
+#else
+                    error = "perf_event_open is only available on Linux";
+                    return false;
+#endif
+                }
+
+                void close()
+                {
+                    for (int k = 0; k < perf_event_count; ++k)
+                    {
+#if defined(__linux__)
+                        if (fds_[k] >= 0)
+                            ::close(fds_[k]);
+#endif
+                        fds_[k] = -1;
+                    }
+                }
+
+                bool available(int kind) const noexcept { return fds_[kind] >= 0; }
+
+                /* 各计数器到目前为止的计数（已按复用比例放大），不可用的为0*/
+                void read(double out[perf_event_count]) const noexcept
+                {
+                    for (int k = 0; k < perf_event_count; ++k)
+                    {
+                        out[k] = 0;
+#if defined(__linux__)
+                        uint64_t v[3];
+                        if (fds_[k] < 0 || ::read(fds_[k], v, sizeof(v)) != static_cast<ssize_t>(sizeof(v)))
+                            continue;
+                        out[k] = v[2] == 0 ? 0.0 : static_cast<double>(v[0]) * v[1] / v[2];
+#endif
+                    }
+                }
+
+            private:
+                static std::string describe(int err)
+                {
+                    std::string reason = std::strerror(err);
+                    if (err == EACCES || err == EPERM)
+                        reason += " (check /proc/sys/kernel/perf_event_paranoid or the container's seccomp profile)";
+                    else if (err == ENOENT || err == EOPNOTSUPP || err == ENODEV)
+                        reason += " (event not supported by this CPU or hypervisor)";
+                    else if (err == ENOSYS)
+                        reason += " (perf_event_open not available in this kernel)";
+                    return reason;
+                }
+
+            private:
+                int fds_[perf_event_count];
+        };
+
+        /* 当前使用的计数器，为空时不统计；由 bench_main 在 --perf 时设置*/
+        inline perf_counters*& current_perf_counters()
+        {
+            static perf_counters* counters = nullptr;
+            return counters;
+        }
+
+    }   /* namespace bench */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_PERF_COUNTERS_H__ */
@@ -0,0 +1,266 @@
+/*************************************************************************
+	> File Name: sequence_bench.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 09:37:44 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_SEQUENCE_BENCH_H__
+#define LEPTSTL_SEQUENCE_BENCH_H__
+
+/* vector、deque、list 与 std 对应容器的性能测试
+ * push_back / push_front / copy / iterate / pop_back / clear / resize / sort 按每个元素报告，
+ * insert_middle / erase_middle 在中间位置连续操作 100 次，random_access 随机读取 1024 次，都按每次操作报告*/
+
+#include <deque>
+#include <list>
+#include <vector>
+
+#include "../leptSTL/deque.h"
+#include "../leptSTL/list.h"
+#include "../leptSTL/vector.h"
+#include "container_bench.h"
+
+namespace leptstl
+{
+    namespace bench
+    {
+        namespace container_bench
+        {
+            template <typename Con>
+                void push_back_bench(state& st)
+                {
+                    typedef typename Con::value_type V;
+                    const std::vector<V>& vals = values<V>(static_cast<size_t>(st.arg()));
+                    st.set_items(vals.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        Con c;
+                        for (size_t k = 0; k < vals.size(); ++k)
+                            c.push_back(vals[k]);
+                        do_not_optimize(c);
+                    }
+                }
+
+            template <typename Con>
+                void push_front_bench(state& st)
+                {
+                    typedef typename Con::value_type V;
+                    const std::vector<V>& vals = values<V>(static_cast<size_t>(st.arg()));
+                    st.set_items(vals.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        Con c;
+                        for (size_t k = 0; k < vals.size(); ++k)
+                            c.push_front(vals[k]);
+                        do_not_optimize(c);
+                    }
+                }
+
+            template <typename Con>
+                void iterate_bench(state& st)
+                {
+                    const Con& c = prebuilt<Con>(static_cast<size_t>(st.arg()));
+                    st.set_items(c.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        size_t sum = 0;
+                        for (typename Con::const_iterator it = c.begin(); it != c.end(); ++it)
+                            sum += touch(*it);
+                        do_not_optimize(sum);
+                    }
+                }
+
+            template <typename Con>
+                void copy_bench(state& st)
+                {
+                    const Con& src = prebuilt<Con>(static_cast<size_t>(st.arg()));
+                    st.set_items(src.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        Con c(src);
+                        do_not_optimize(c);
+                    }
+                }
+
+            template <typename Con>
+                typename Con::iterator middle(Con& c)
+                {
+                    typename Con::iterator it = c.begin();
+                    for (size_t k = c.size() / 2; k > 0; --k)
+                        ++it;
+                    return it;
+                }
+
+            /* 拷贝与定位中间位置不计时；list 在同一位置连续插入，不重复走到中间*/
+            template <typename Con>
+                void insert_middle_bench(state& st)
+                {
+                    typedef typename Con::value_type V;
+                    const Con& src = prebuilt<Con>(static_cast<size_t>(st.arg()));
+                    const std::vector<V>& extra = missing_values<V>();
+                    st.set_items(100);
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        st.pause_timing();
+                        Con c(src);
+                        typename Con::iterator it = middle(c);
+                        st.resume_timing();
+                        for (size_t k = 0; k < 100; ++k)
+                            it = c.insert(it, extra[k]);
+                        do_not_optimize(c);
+                    }
+                }
+
+            template <typename Con>
+                void erase_middle_bench(state& st)
+                {
+                    const Con& src = prebuilt<Con>(static_cast<size_t>(st.arg()));
+                    st.set_items(100);
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        st.pause_timing();
+                        Con c(src);
+                        typename Con::iterator it = middle(c);
+                        st.resume_timing();
+                        for (size_t k = 0; k < 100; ++k)
+                            it = c.erase(it);
+                        do_not_optimize(c);
+                    }
+                }
+
+            template <typename Con>
+                void random_access_bench(state& st)
+                {
+                    const Con& c = prebuilt<Con>(static_cast<size_t>(st.arg()));
+                    const std::vector<size_t>& idx = random_indices(c.size());
+                    st.set_items(idx.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        size_t sum = 0;
+                        for (size_t k = 0; k < idx.size(); ++k)
+                            sum += touch(c[idx[k]]);
+                        do_not_optimize(sum);
+                    }
+                }
+
+            template <typename Con>
+                void pop_back_bench(state& st)
+                {
+                    const Con& src = prebuilt<Con>(static_cast<size_t>(st.arg()));
+                    st.set_items(src.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        st.pause_timing();
+                        Con c(src);
+                        st.resume_timing();
+                        while (!c.empty())
+                            c.pop_back();
+                        do_not_optimize(c);
+                    }
+                }
+
+            template <typename Con>
+                void clear_bench(state& st)
+                {
+                    const Con& src = prebuilt<Con>(static_cast<size_t>(st.arg()));
+                    st.set_items(src.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        st.pause_timing();
+                        Con c(src);
+                        st.resume_timing();
+                        c.clear();
+                        do_not_optimize(c);
+                    }
+                }
+
+            template <typename Con>
+                void resize_bench(state& st)
+                {
+                    const size_t n = static_cast<size_t>(st.arg());
+                    st.set_items(n);
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        Con c;
+                        c.resize(n);
+                        do_not_optimize(c);
+                    }
+                }
+
+            template <typename Con>
+                void sort_bench(state& st)
+                {
+                    const Con& src = prebuilt<Con>(static_cast<size_t>(st.arg()));
+                    st.set_items(src.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        st.pause_timing();
+                        Con c(src);
+                        st.resume_timing();
+                        c.sort();
+                        do_not_optimize(c);
+                    }
+                }
+
+            inline std::vector<int64_t> up_to(const std::vector<int64_t>& sizes, int64_t limit)
+            {
+                std::vector<int64_t> out;
+                for (size_t i = 0; i < sizes.size(); ++i)
+                    if (sizes[i] <= limit)
+                        out.push_back(sizes[i]);
+                return out;
+            }
+
+            /* small 是普通的规模，large 另加给 push_back 与 iterate，
+             * edit 用于中间插入与删除（删除 100 个元素要求 n >= 200，不在这里检查）*/
+            template <typename V>
+                void register_sequences(const std::vector<int64_t>& small, const std::vector<int64_t>& large,
+                                        const std::vector<int64_t>& edit)
+                {
+                    const std::string t = type_name<V>();
+                    typedef std::vector<V>   sv;  typedef leptstl::vector<V> lv;
+                    typedef std::deque<V>    sd;  typedef leptstl::deque<V>  ld;
+                    typedef std::list<V>     sl;  typedef leptstl::list<V>   ll;
+                    std::vector<int64_t> grow(small);
+                    grow.insert(grow.end(), large.begin(), large.end());
+
+                    add_pair("vector", t, "push_back",     push_back_bench<sv>,     push_back_bench<lv>,     grow);
+                    add_pair("vector", t, "iterate",       iterate_bench<sv>,       iterate_bench<lv>,       grow);
+                    add_pair("vector", t, "copy",          copy_bench<sv>,          copy_bench<lv>,          small);
+                    add_pair("vector", t, "random_access", random_access_bench<sv>, random_access_bench<lv>, small);
+                    add_pair("vector", t, "insert_middle", insert_middle_bench<sv>, insert_middle_bench<lv>, edit);
+                    add_pair("vector", t, "erase_middle",  erase_middle_bench<sv>,  erase_middle_bench<lv>,  edit);
+                    add_pair("vector", t, "pop_back",      pop_back_bench<sv>,      pop_back_bench<lv>,      small);
+                    add_pair("vector", t, "clear",         clear_bench<sv>,         clear_bench<lv>,         small);
+                    add_pair("vector", t, "resize",        resize_bench<sv>,        resize_bench<lv>,        small);
+
+                    add_pair("deque", t, "push_back",     push_back_bench<sd>,     push_back_bench<ld>,     grow);
+                    add_pair("deque", t, "push_front",    push_front_bench<sd>,    push_front_bench<ld>,    small);
+                    add_pair("deque", t, "iterate",       iterate_bench<sd>,       iterate_bench<ld>,       grow);
+                    add_pair("deque", t, "copy",          copy_bench<sd>,          copy_bench<ld>,          small);
+                    add_pair("deque", t, "random_access", random_access_bench<sd>, random_access_bench<ld>, small);
+                    add_pair("deque", t, "insert_middle", insert_middle_bench<sd>, insert_middle_bench<ld>, edit);
+                    add_pair("deque", t, "erase_middle",  erase_middle_bench<sd>,  erase_middle_bench<ld>,  edit);
+                    add_pair("deque", t, "pop_back",      pop_back_bench<sd>,      pop_back_bench<ld>,      small);
+                    add_pair("deque", t, "clear",         clear_bench<sd>,         clear_bench<ld>,         small);
+                    add_pair("deque", t, "resize",        resize_bench<sd>,        resize_bench<ld>,        small);
+
+                    add_pair("list", t, "push_back",     push_back_bench<sl>,     push_back_bench<ll>,     small);
+                    add_pair("list", t, "push_front",    push_front_bench<sl>,    push_front_bench<ll>,    small);
+                    add_pair("list", t, "iterate",       iterate_bench<sl>,       iterate_bench<ll>,       small);
+                    add_pair("list", t, "copy",          copy_bench<sl>,          copy_bench<ll>,          small);
+                    add_pair("list", t, "insert_middle", insert_middle_bench<sl>, insert_middle_bench<ll>, edit);
+                    add_pair("list", t, "erase_middle",  erase_middle_bench<sl>,  erase_middle_bench<ll>,  edit);
+                    add_pair("list", t, "pop_back",      pop_back_bench<sl>,      pop_back_bench<ll>,      small);
+                    add_pair("list", t, "clear",         clear_bench<sl>,         clear_bench<ll>,         small);
+                    add_pair("list", t, "sort",          sort_bench<sl>,          sort_bench<ll>,          up_to(small, 1000000));
+                }
+
+        }   /* namespace container_bench */
+
+    }   /* namespace bench */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_SEQUENCE_BENCH_H__ */
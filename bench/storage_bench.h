@@ -0,0 +1,302 @@
+/*************************************************************************
+	> File Name: storage_bench.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Wed 21 Oct 2026 10:31:52 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_STORAGE_BENCH_H__
+#define LEPTSTL_STORAGE_BENCH_H__
+
+/* 大块内存与文件的性能测试，原先是 test/vector_test.h、test/string_test.h 与 test/mmap_vector_test.h 中的性能表格
+ * append：连续 push_back n 个 uint32_t，std::vector 扩容时复制，leptstl::vector 用 realloc / mremap 原地扩容，
+ * 按每个元素报告；新增的峰值常驻内存（VmHWM）写到 stderr
+ * read：新建缓冲区扩到 n 字节，再用 memcpy 代替 read() 填满，比较 resize、resize_default_init 与
+ * resize_and_overwrite，按字节报告吞吐
+ * records：n 条定长记录写入 mmap_vector、打开文件、在映射上随机 lower_bound，
+ * 对照组是把整个文件 read() 进 vector 再查找*/
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../leptSTL/algo.h"
+#include "../leptSTL/leptstring.h"
+#include "../leptSTL/mmap_vector.h"
+#include "../leptSTL/vector.h"
+#include "container_bench.h"
+
+namespace leptstl
+{
+    namespace bench
+    {
+        namespace container_bench
+        {
+            template <typename Vec>
+                void append_bench(state& st, const char* name)
+                {
+                    const size_t n = static_cast<size_t>(st.arg());
+                    if (first_note(name, st.arg()))
+                    {
+                        st.pause_timing();
+                        reset_peak_rss();
+                        const size_t base = proc_kb("/proc/self/status", "VmRSS:");
+                        {
+                            Vec v;
+                            for (size_t k = 0; k < n; ++k)
+                                v.push_back(static_cast<uint32_t>(k));
+                            do_not_optimize(v);
+                        }
+                        const size_t peak = proc_kb("/proc/self/status", "VmHWM:");
+                        if (peak != 0)
+                            std::cerr << name << "/" << n << ": peak RSS +" << (peak - base) / 1024 << "MB\n";
+                        st.resume_timing();
+                    }
+                    st.set_items(n);
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        Vec v;
+                        for (size_t k = 0; k < n; ++k)
+                            v.push_back(static_cast<uint32_t>(k));
+                        do_not_optimize(v);
+                    }
+                }
+
+            LEPTSTL_BENCH_(std_vector_append, "std::vector<uint32_t>", "append", 1000000, 100000000)
+            { append_bench<std::vector<uint32_t>>(st, "std_vector_append"); }
+            LEPTSTL_BENCH_(leptstl_vector_append, "leptstl::vector<uint32_t>", "append", 1000000, 100000000)
+            { append_bench<leptstl::vector<uint32_t>>(st, "leptstl_vector_append"); }
+
+            inline const char* read_source()
+            {
+                static const std::vector<char> src(static_cast<size_t>(128) << 20, 'x');
+                return src.data();
+            }
+
+            /* 每次迭代新建一个缓冲区，grow 把它扩到 n 字节并填满*/
+            template <typename Buf, typename Grow>
+                void read_bench(state& st, Grow grow)
+                {
+                    const size_t n = static_cast<size_t>(st.arg());
+                    const char* src = read_source();
+                    st.set_bytes(n);
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        Buf buf;
+                        grow(buf, src, n);
+                        do_not_optimize(buf[n / 2]);
+                    }
+                }
+
+#define LEPTSTL_READ_SIZES (1 << 20), (16 << 20), (128 << 20)
+
+            LEPTSTL_BENCH_(vector_read_resize, "leptstl::vector<char>", "read_resize", LEPTSTL_READ_SIZES)
+            {
+                read_bench<leptstl::vector<char>>(st, [](leptstl::vector<char>& v, const char* p, size_t n) {
+                    v.resize(n);
+                    std::memcpy(v.data(), p, n);
+                });
+            }
+            LEPTSTL_BENCH_(vector_read_default_init, "leptstl::vector<char>", "read_default_init", LEPTSTL_READ_SIZES)
+            {
+                read_bench<leptstl::vector<char>>(st, [](leptstl::vector<char>& v, const char* p, size_t n) {
+                    v.resize_default_init(n);
+                    std::memcpy(v.data(), p, n);
+                });
+            }
+            LEPTSTL_BENCH_(vector_read_and_overwrite, "leptstl::vector<char>", "read_and_overwrite", LEPTSTL_READ_SIZES)
+            {
+                read_bench<leptstl::vector<char>>(st, [](leptstl::vector<char>& v, const char* p, size_t n) {
+                    v.resize_and_overwrite(n, [p](char* buf, size_t len) {
+                        std::memcpy(buf, p, len);
+                        return len;
+                    });
+                });
+            }
+            LEPTSTL_BENCH_(std_string_read_resize, "std::string", "read_resize", LEPTSTL_READ_SIZES)
+            {
+                read_bench<std::string>(st, [](std::string& s, const char* p, size_t n) {
+                    s.resize(n);
+                    std::memcpy(&s[0], p, n);
+                });
+            }
+            LEPTSTL_BENCH_(string_read_resize, "leptstl::string", "read_resize", LEPTSTL_READ_SIZES)
+            {
+                read_bench<leptstl::string>(st, [](leptstl::string& s, const char* p, size_t n) {
+                    s.resize(n);
+                    std::memcpy(&s[0], p, n);
+                });
+            }
+            LEPTSTL_BENCH_(string_read_and_overwrite, "leptstl::string", "read_and_overwrite", LEPTSTL_READ_SIZES)
+            {
+                read_bench<leptstl::string>(st, [](leptstl::string& s, const char* p, size_t n) {
+                    s.resize_and_overwrite(n, [p](char* buf, size_t len) {
+                        std::memcpy(buf, p, len);
+                        return len;
+                    });
+                });
+            }
+
+#undef LEPTSTL_READ_SIZES
+
+            /* 定长记录，按 key 排序*/
+            struct record
+            {
+                uint64_t key;
+                uint64_t value;
+                bool operator<(const record& rhs) const { return key < rhs.key; }
+            };
+
+            /* 测试用的临时文件，程序结束时删除*/
+            struct temp_file
+            {
+                std::string path;
+                explicit temp_file(const char* name)
+                    :path(std::string("/tmp/leptstl_bench_") + name + "_" + std::to_string(::getpid()) + ".bin") {}
+                ~temp_file() { ::unlink(path.c_str()); }
+            };
+
+            inline const std::string& records_path()
+            {
+                static temp_file file("records");
+                return file.path;
+            }
+
+            inline void write_records(size_t n)
+            {
+                leptstl::mmap_vector<record> w(records_path(), leptstl::mmap_mode::truncate);
+                for (size_t i = 0; i < n; ++i)
+                {
+                    const record r = { static_cast<uint64_t>(i) * 3, static_cast<uint64_t>(i) };
+                    w.push_back(r);
+                }
+                w.flush();
+            }
+
+            /* 文件中已有 n 条记录*/
+            inline void prepare_records(size_t n)
+            {
+                static size_t written = 0;
+                if (written != n)
+                {
+                    write_records(n);
+                    written = n;
+                }
+            }
+
+            inline void read_records(leptstl::vector<record>& v)
+            {
+                struct stat sb;
+                const int fd = ::open(records_path().c_str(), O_RDONLY);
+                if (fd < 0 || ::fstat(fd, &sb) != 0)
+                {
+                    if (fd >= 0)
+                        ::close(fd);
+                    return;
+                }
+                v.resize_default_init(static_cast<size_t>(sb.st_size) / sizeof(record));
+                char* p = reinterpret_cast<char*>(v.data());
+                size_t left = v.size() * sizeof(record);
+                while (left > 0)
+                {
+                    const ssize_t r = ::read(fd, p, left);
+                    if (r <= 0)
+                        break;
+                    p += r;
+                    left -= static_cast<size_t>(r);
+                }
+                ::close(fd);
+            }
+
+            /* 1024 次随机 lower_bound，键取自 [0, 3n)，约三分之一命中*/
+            template <typename Con>
+                uint64_t records_lookup(const Con& c, const std::vector<size_t>& idx)
+                {
+                    uint64_t sum = 0;
+                    for (size_t k = 0; k < idx.size(); ++k)
+                    {
+                        const record key = { static_cast<uint64_t>(idx[k]), 0 };
+                        auto it = leptstl::lower_bound(c.begin(), c.end(), key);
+                        if (it != c.end() && it->key == key.key)
+                            sum += it->value;
+                    }
+                    return sum;
+                }
+
+#define LEPTSTL_RECORD_SIZES 100000, 10000000
+
+            LEPTSTL_BENCH_(mmap_vector_write, "leptstl::mmap_vector<record>", "write", LEPTSTL_RECORD_SIZES)
+            {
+                const size_t n = static_cast<size_t>(st.arg());
+                st.set_items(n);
+                for (size_t i = 0; i < st.iterations(); ++i)
+                    write_records(n);
+            }
+
+            LEPTSTL_BENCH_(mmap_vector_open, "leptstl::mmap_vector<record>", "open", LEPTSTL_RECORD_SIZES)
+            {
+                st.pause_timing();
+                prepare_records(static_cast<size_t>(st.arg()));
+                st.resume_timing();
+                for (size_t i = 0; i < st.iterations(); ++i)
+                {
+                    leptstl::mmap_vector<record> m(records_path(), leptstl::mmap_mode::read_only);
+                    do_not_optimize(m.size());
+                }
+            }
+
+            LEPTSTL_BENCH_(vector_read_records, "leptstl::vector<record>", "open", LEPTSTL_RECORD_SIZES)
+            {
+                const size_t n = static_cast<size_t>(st.arg());
+                st.pause_timing();
+                prepare_records(n);
+                st.resume_timing();
+                st.set_bytes(n * sizeof(record));
+                for (size_t i = 0; i < st.iterations(); ++i)
+                {
+                    leptstl::vector<record> v;
+                    read_records(v);
+                    do_not_optimize(v);
+                }
+            }
+
+            LEPTSTL_BENCH_(mmap_vector_find, "leptstl::mmap_vector<record>", "find", LEPTSTL_RECORD_SIZES)
+            {
+                const size_t n = static_cast<size_t>(st.arg());
+                st.pause_timing();
+                prepare_records(n);
+                leptstl::mmap_vector<record> m(records_path(), leptstl::mmap_mode::read_only);
+                const std::vector<size_t>& idx = random_indices(n * 3);
+                st.resume_timing();
+                st.set_items(idx.size());
+                for (size_t i = 0; i < st.iterations(); ++i)
+                    do_not_optimize(records_lookup(m, idx));
+            }
+
+            LEPTSTL_BENCH_(vector_records_find, "leptstl::vector<record>", "find", LEPTSTL_RECORD_SIZES)
+            {
+                const size_t n = static_cast<size_t>(st.arg());
+                st.pause_timing();
+                prepare_records(n);
+                leptstl::vector<record> v;
+                read_records(v);
+                const std::vector<size_t>& idx = random_indices(n * 3);
+                st.resume_timing();
+                st.set_items(idx.size());
+                for (size_t i = 0; i < st.iterations(); ++i)
+                    do_not_optimize(records_lookup(v, idx));
+            }
+
+#undef LEPTSTL_RECORD_SIZES
+
+        }   /* namespace container_bench */
+
+    }   /* namespace bench */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_STORAGE_BENCH_H__ */
@@ -0,0 +1,133 @@
+/*************************************************************************
+	> File Name: string_bench.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 09:58:21 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_STRING_BENCH_H__
+#define LEPTSTL_STRING_BENCH_H__
+
+/* std::string 与 leptstl::string 的性能测试，n 是字符数，结果按每个字符报告
+ * append 每次追加 16 个字符，find 查找一个不存在的子串（扫描整个字符串），
+ * compare 比较两个只有最后一个字符不同的字符串*/
+
+#include <string>
+
+#include "../leptSTL/leptstring.h"
+#include "container_bench.h"
+
+namespace leptstl
+{
+    namespace bench
+    {
+        namespace container_bench
+        {
+            inline char text_char(size_t i) { return static_cast<char>('a' + (i * 7) % 26); }
+
+            /* 长度为 n 的文本，每个 Str 类型只缓存最近一次的长度*/
+            template <typename Str>
+                const Str& text(size_t n)
+                {
+                    static Str cache;
+                    static bool cached = false;
+                    if (!cached || cache.size() != n)
+                    {
+                        Str().swap(cache);
+                        cache.reserve(n);
+                        for (size_t i = 0; i < n; ++i)
+                            cache.push_back(text_char(i));
+                        cached = true;
+                    }
+                    return cache;
+                }
+
+            template <typename Str>
+                void string_push_back_bench(state& st)
+                {
+                    const size_t n = static_cast<size_t>(st.arg());
+                    st.set_items(n);
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        Str s;
+                        for (size_t k = 0; k < n; ++k)
+                            s.push_back(text_char(k));
+                        do_not_optimize(s);
+                    }
+                }
+
+            template <typename Str>
+                void string_append_bench(state& st)
+                {
+                    const size_t n = static_cast<size_t>(st.arg());
+                    const char chunk[] = "0123456789abcdef";
+                    st.set_items(n);
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        Str s;
+                        for (size_t k = 0; k < n; k += 16)
+                            s.append(chunk, n - k < 16 ? n - k : 16);
+                        do_not_optimize(s);
+                    }
+                }
+
+            template <typename Str>
+                void string_find_bench(state& st)
+                {
+                    const Str& s = text<Str>(static_cast<size_t>(st.arg()));
+                    st.set_items(s.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        size_t pos = s.find("needle");
+                        do_not_optimize(pos);
+                    }
+                }
+
+            template <typename Str>
+                void string_compare_bench(state& st)
+                {
+                    st.pause_timing();
+                    const Str& a = text<Str>(static_cast<size_t>(st.arg()));
+                    Str b(a);
+                    b[b.size() - 1] = '#';
+                    st.set_items(a.size());
+                    st.resume_timing();
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        int r = a.compare(b);
+                        do_not_optimize(r);
+                    }
+                }
+
+            template <typename Str>
+                void string_copy_bench(state& st)
+                {
+                    const Str& src = text<Str>(static_cast<size_t>(st.arg()));
+                    st.set_items(src.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        Str s(src);
+                        do_not_optimize(s);
+                    }
+                }
+
+            inline void register_strings(const std::vector<int64_t>& sizes, const std::vector<int64_t>& large)
+            {
+                typedef std::string ss;
+                typedef leptstl::string ls;
+                std::vector<int64_t> all(sizes);
+                all.insert(all.end(), large.begin(), large.end());
+                add_pair("string", "", "push_back", string_push_back_bench<ss>, string_push_back_bench<ls>, sizes);
+                add_pair("string", "", "append",    string_append_bench<ss>,    string_append_bench<ls>,    all);
+                add_pair("string", "", "find",      string_find_bench<ss>,      string_find_bench<ls>,      all);
+                add_pair("string", "", "compare",   string_compare_bench<ss>,   string_compare_bench<ls>,   sizes);
+                add_pair("string", "", "copy",      string_copy_bench<ss>,      string_copy_bench<ls>,      sizes);
+            }
+
+        }   /* namespace container_bench */
+
+    }   /* namespace bench */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_STRING_BENCH_H__ */
@@ -0,0 +1,199 @@
+/*************************************************************************
+	> File Name: unordered_bench.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 10:12:39 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_UNORDERED_BENCH_H__
+#define LEPTSTL_UNORDERED_BENCH_H__
+
+/* unordered_set / unordered_multiset 与 std 对应容器的性能测试，两边使用同一个散列函数 value_hash
+ * insert / erase / iterate 按每个元素报告，find_hit / find_miss / count 各查找 1024 次，按每次查找报告
+ * 多重集合中每个值约出现 4 次
+ * unordered_map 的 counter 对 n 个键依次 ++m[key]，不同的键约 n / 8 个，按每个键报告，
+ * 原先是 test/unordered_map_test.h 中的性能表格*/
+
+#include <unordered_map>
+#include <unordered_set>
+
+#include "../leptSTL/functional.h"
+#include "../leptSTL/unordered_map.h"
+#include "../leptSTL/unordered_set.h"
+#include "container_bench.h"
+
+namespace leptstl
+{
+    namespace bench
+    {
+        namespace container_bench
+        {
+            template <typename Con>
+                void set_insert_bench(state& st)
+                {
+                    typedef typename Con::value_type V;
+                    const std::vector<V>& vals = values<V>(static_cast<size_t>(st.arg()));
+                    st.set_items(vals.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        Con c;
+                        fill(c, vals);
+                        do_not_optimize(c);
+                    }
+                }
+
+            template <typename Con>
+                void set_find_hit_bench(state& st)
+                {
+                    typedef typename Con::value_type V;
+                    const Con& c = prebuilt<Con>(static_cast<size_t>(st.arg()));
+                    const std::vector<V>& vals = values<V>(static_cast<size_t>(st.arg()));
+                    const std::vector<size_t>& idx = random_indices(vals.size());
+                    st.set_items(idx.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        size_t found = 0;
+                        for (size_t k = 0; k < idx.size(); ++k)
+                            found += c.find(vals[idx[k]]) != c.end();
+                        do_not_optimize(found);
+                    }
+                }
+
+            template <typename Con>
+                void set_find_miss_bench(state& st)
+                {
+                    typedef typename Con::value_type V;
+                    const Con& c = prebuilt<Con>(static_cast<size_t>(st.arg()));
+                    const std::vector<V>& miss = missing_values<V>();
+                    st.set_items(miss.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        size_t found = 0;
+                        for (size_t k = 0; k < miss.size(); ++k)
+                            found += c.find(miss[k]) != c.end();
+                        do_not_optimize(found);
+                    }
+                }
+
+            /* 拷贝不计时，按插入顺序逐个删除*/
+            template <typename Con>
+                void set_erase_bench(state& st)
+                {
+                    typedef typename Con::value_type V;
+                    const Con& src = prebuilt<Con>(static_cast<size_t>(st.arg()));
+                    const std::vector<V>& vals = values<V>(static_cast<size_t>(st.arg()));
+                    st.set_items(vals.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        st.pause_timing();
+                        Con c(src);
+                        st.resume_timing();
+                        for (size_t k = 0; k < vals.size(); ++k)
+                            c.erase(vals[k]);
+                        do_not_optimize(c);
+                    }
+                }
+
+            template <typename Con>
+                void set_iterate_bench(state& st)
+                {
+                    const Con& c = prebuilt<Con>(static_cast<size_t>(st.arg()));
+                    st.set_items(c.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        size_t sum = 0;
+                        for (typename Con::const_iterator it = c.begin(); it != c.end(); ++it)
+                            sum += touch(*it);
+                        do_not_optimize(sum);
+                    }
+                }
+
+            template <typename Con>
+                void multiset_count_bench(state& st)
+                {
+                    typedef typename Con::value_type V;
+                    const Con& c = prebuilt<Con>(static_cast<size_t>(st.arg()));
+                    const std::vector<V>& vals = values<V>(static_cast<size_t>(st.arg()));
+                    const std::vector<size_t>& idx = random_indices((vals.size() + 3) / 4);
+                    st.set_items(idx.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        size_t total = 0;
+                        for (size_t k = 0; k < idx.size(); ++k)
+                            total += c.count(vals[idx[k]]);
+                        do_not_optimize(total);
+                    }
+                }
+
+            template <typename V>
+                void register_unordered(const std::vector<int64_t>& sizes)
+                {
+                    const std::string t = type_name<V>();
+                    typedef std::unordered_set<V, value_hash<V>, std::equal_to<V>>              ss;
+                    typedef leptstl::unordered_set<V, value_hash<V>, leptstl::equal_to<V>>      ls;
+                    typedef std::unordered_multiset<V, value_hash<V>, std::equal_to<V>>         sm;
+                    typedef leptstl::unordered_multiset<V, value_hash<V>, leptstl::equal_to<V>> lm;
+
+                    add_pair("unordered_set", t, "insert",    set_insert_bench<ss>,    set_insert_bench<ls>,    sizes);
+                    add_pair("unordered_set", t, "find_hit",  set_find_hit_bench<ss>,  set_find_hit_bench<ls>,  sizes);
+                    add_pair("unordered_set", t, "find_miss", set_find_miss_bench<ss>, set_find_miss_bench<ls>, sizes);
+                    add_pair("unordered_set", t, "erase",     set_erase_bench<ss>,     set_erase_bench<ls>,     sizes);
+                    add_pair("unordered_set", t, "iterate",   set_iterate_bench<ss>,   set_iterate_bench<ls>,   sizes);
+
+                    add_pair("unordered_multiset", t, "insert",  set_insert_bench<sm>,     set_insert_bench<lm>,     sizes);
+                    add_pair("unordered_multiset", t, "count",   multiset_count_bench<sm>, multiset_count_bench<lm>, sizes);
+                    add_pair("unordered_multiset", t, "iterate", set_iterate_bench<sm>,    set_iterate_bench<lm>,    sizes);
+                }
+
+            /* n 个取自 n / 8 + 1 个不同值的伪随机键，只缓存最近一次的长度*/
+            inline const std::vector<int>& counter_keys(size_t n)
+            {
+                static std::vector<int> cache;
+                if (cache.size() != n)
+                {
+                    const std::vector<int>& vals = values<int>(n / 8 + 1);
+                    std::vector<int> keys;
+                    keys.reserve(n);
+                    uint32_t x = 2463534242u;
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+                        keys.push_back(vals[x % vals.size()]);
+                    }
+                    cache.swap(keys);
+                }
+                return cache;
+            }
+
+            template <typename Map>
+                void map_counter_bench(state& st)
+                {
+                    st.pause_timing();
+                    const std::vector<int>& keys = counter_keys(static_cast<size_t>(st.arg()));
+                    st.resume_timing();
+                    st.set_items(keys.size());
+                    for (size_t i = 0; i < st.iterations(); ++i)
+                    {
+                        Map m;
+                        for (size_t k = 0; k < keys.size(); ++k)
+                            ++m[keys[k]];
+                        do_not_optimize(m);
+                    }
+                }
+
+#define LEPTSTL_COUNTER_SIZES 2000, 200000
+
+            LEPTSTL_BENCH_(std_unordered_map_counter, "std::unordered_map<int, int>", "counter", LEPTSTL_COUNTER_SIZES)
+            { map_counter_bench<std::unordered_map<int, int, value_hash<int>>>(st); }
+            LEPTSTL_BENCH_(unordered_map_counter, "leptstl::unordered_map<int, int>", "counter", LEPTSTL_COUNTER_SIZES)
+            { map_counter_bench<leptstl::unordered_map<int, int, value_hash<int>>>(st); }
+
+#undef LEPTSTL_COUNTER_SIZES
+
+        }   /* namespace container_bench */
+
+    }   /* namespace bench */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_UNORDERED_BENCH_H__ */
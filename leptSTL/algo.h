@@ -1335,41 +1335,23 @@ namespace leptstl
             auto result = first + (last - middle);
             if(l == r)
             {
-                leptstl::swap_ranges(first, middle, last);
+                leptstl::swap_ranges(first, middle, middle);
                 return result;
             }
+            /* 共有 gcd(n, l) 个环，每个环上位置 p 的元素来自 p+l（越过尾部则回绕）*/
             auto cycle_times = rgcd(n, l);
-            for(auto i = 0; i < cycle_times; ++i)
+            for(decltype(cycle_times) i = 0; i < cycle_times; ++i)
             {
-                auto tmp = *first;
+                auto tmp = leptstl::move(*first);
                 auto p = first;
-                if(l < r)
+                auto q = first + l;
+                while(q != first)
                 {
-                    for(auto j = 0; j < r / cycle_times; ++j)
-                    {
-                        if(p > first + r)
-                        {
-                            *p = *(p -r);
-                            p -= r;
-                        }
-                        *p = *(p + l);
-                        p += l;
-                    }
+                    *p = leptstl::move(*q);
+                    p = q;
+                    q = last - q > l ? q + l : q - r;
                 }
-                else 
-                {
-                    for(auto j = 0; j < l / cycle_times - 1; ++j)
-                    {
-                        if(p < last - l)
-                        {
-                            *p = *(p + l);
-                            p += l;
-                        }
-                        *p = *(p - r);
-                        p -= r;
-                    }
-                }
-                *p = tmp;
+                *p = leptstl::move(tmp);
                 ++first;
             }
             return result;
@@ -1405,8 +1387,8 @@ namespace leptstl
                                    && leptstl::is_random_access_iterator<ForwardIter2>::value;
             if(is_ra_it)
             {
-                auto len1 = last1 - first1;
-                auto len2 = last2 - first2;
+                auto len1 = leptstl::distance(first1, last1);
+                auto len2 = leptstl::distance(first2, last2);
                 if(len1 != len2)
                         return false;
             }
@@ -2135,8 +2117,12 @@ namespace leptstl
     template<typename RandomIter>
         void unchecked_insertion_sort(RandomIter first, RandomIter last)
         {
+            /* 先取出 *i，挪动元素时会覆盖它所在的位置*/
             for(auto i = first; i != last; ++i)
-                leptstl::unchecked_linear_insert(i ,*i);
+            {
+                auto value = *i;
+                leptstl::unchecked_linear_insert(i ,value);
+            }
         }
 
     template<typename RandomIter>
@@ -2237,7 +2223,10 @@ namespace leptstl
         void unchecked_insertion_sort(RandomIter first, RandomIter last, Compared comp)
         {
             for(auto i = first; i != last; ++i)
-                leptstl::unchecked_linear_insert(i ,*i, comp);
+            {
+                auto value = *i;
+                leptstl::unchecked_linear_insert(i ,value, comp);
+            }
         }
 
     template<typename RandomIter, typename Compared>
@@ -0,0 +1,354 @@
+/*************************************************************************
+	> File Name: alloc_stats.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 11:04:52 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_ALLOC_STATS_H__
+#define LEPTSTL_ALLOC_STATS_H__
+
+/* 此头文件包含分配器的内存统计：按元素类型记录分配与释放的次数、字节数、当前占用与峰值占用，
+ * 以及按大小（2 的幂区间）划分的直方图，可在运行时查询，也可输出为文本或 JSON
+ *
+ * 编译时定义 LEPTSTL_ALLOC_STATS 为 1 才会启用，此时 allocator.h 中的各个分配器在分配、释放时调用这里的记录函数；
+ * 默认为 0，分配路径与不包含此功能时完全相同，查询函数只返回空的统计
+ * 启用后 allocator<T> 在每块内存前多分配一个 16 字节的头部保存块的大小，
+ * 因为有些容器释放时不给出元素个数（deallocate(ptr)），没有头部就无法知道释放了多少字节
+ *
+ * 查询：
+ *   leptstl::alloc_stats::of<int>().snapshot()     某个元素类型的统计
+ *   leptstl::alloc_stats::total()                   所有类型的合计，峰值是整体的峰值，不是各类型峰值之和
+ *   leptstl::alloc_stats::dump(std::cout)           文本表格
+ *   leptstl::alloc_stats::dump_json(std::cout)      JSON
+ */
+
+#ifndef LEPTSTL_ALLOC_STATS
+#define LEPTSTL_ALLOC_STATS 0
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <new>
+#include <ostream>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#if defined(__GNUC__)
+#include <cstdlib>
+#include <cxxabi.h>
+#endif
+
+namespace leptstl
+{
+    /* 直方图的桶数：第 k 个桶统计大小在 [2^k, 2^(k+1)) 字节的分配，最后一个桶包含所有更大的分配*/
+    static const size_t alloc_histogram_buckets = 32;
+
+    /* 某一时刻的统计值*/
+    struct alloc_counters
+    {
+        uint64_t allocations;
+        uint64_t deallocations;
+        uint64_t bytes_allocated;
+        uint64_t bytes_freed;
+        uint64_t live_bytes;
+        uint64_t peak_live_bytes;
+        uint64_t histogram[alloc_histogram_buckets];
+    };
+
+    /* 一个元素类型的统计，计数都是原子的，多个线程同时分配时也正确*/
+    class alloc_type_stats
+    {
+        public:
+            explicit alloc_type_stats(const std::string& name)
+                :name_(name), next_(nullptr)
+            {
+                reset_all();
+            }
+
+            alloc_type_stats(const alloc_type_stats&) = delete;
+            alloc_type_stats& operator=(const alloc_type_stats&) = delete;
+
+            static size_t bucket(size_t bytes) noexcept
+            {
+                size_t k = 0;
+                while (k + 1 < alloc_histogram_buckets && (bytes >> (k + 1)) != 0)
+                    ++k;
+                return k;
+            }
+
+            void record_allocate(size_t bytes) noexcept
+            {
+                allocations_.fetch_add(1, std::memory_order_relaxed);
+                bytes_allocated_.fetch_add(bytes, std::memory_order_relaxed);
+                histogram_[bucket(bytes)].fetch_add(1, std::memory_order_relaxed);
+                const uint64_t live = live_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+                uint64_t peak = peak_.load(std::memory_order_relaxed);
+                while (live > peak && !peak_.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+                {
+                }
+            }
+
+            void record_deallocate(size_t bytes) noexcept
+            {
+                deallocations_.fetch_add(1, std::memory_order_relaxed);
+                bytes_freed_.fetch_add(bytes, std::memory_order_relaxed);
+                live_.fetch_sub(bytes, std::memory_order_relaxed);
+            }
+
+            alloc_counters snapshot() const noexcept
+            {
+                alloc_counters c;
+                c.allocations = allocations_.load(std::memory_order_relaxed);
+                c.deallocations = deallocations_.load(std::memory_order_relaxed);
+                c.bytes_allocated = bytes_allocated_.load(std::memory_order_relaxed);
+                c.bytes_freed = bytes_freed_.load(std::memory_order_relaxed);
+                c.live_bytes = live_.load(std::memory_order_relaxed);
+                c.peak_live_bytes = peak_.load(std::memory_order_relaxed);
+                for (size_t k = 0; k < alloc_histogram_buckets; ++k)
+                    c.histogram[k] = histogram_[k].load(std::memory_order_relaxed);
+                return c;
+            }
+
+            /* 清零次数、字节数与直方图；仍未释放的内存还在占用，当前占用保留，峰值从当前占用重新开始*/
+            void reset() noexcept
+            {
+                allocations_.store(0, std::memory_order_relaxed);
+                deallocations_.store(0, std::memory_order_relaxed);
+                bytes_allocated_.store(0, std::memory_order_relaxed);
+                bytes_freed_.store(0, std::memory_order_relaxed);
+                peak_.store(live_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                for (size_t k = 0; k < alloc_histogram_buckets; ++k)
+                    histogram_[k].store(0, std::memory_order_relaxed);
+            }
+
+            const std::string& name() const noexcept { return name_; }
+            alloc_type_stats*  next() const noexcept { return next_; }
+
+        private:
+            friend class alloc_stats;
+
+            void reset_all() noexcept
+            {
+                live_.store(0, std::memory_order_relaxed);
+                reset();
+            }
+
+        private:
+            std::string           name_;
+            alloc_type_stats*     next_;    /* 注册链表*/
+            std::atomic<uint64_t> allocations_;
+            std::atomic<uint64_t> deallocations_;
+            std::atomic<uint64_t> bytes_allocated_;
+            std::atomic<uint64_t> bytes_freed_;
+            std::atomic<uint64_t> live_;
+            std::atomic<uint64_t> peak_;
+            std::atomic<uint64_t> histogram_[alloc_histogram_buckets];
+    };
+
+    /* 统计的注册表与查询接口，只有静态成员*/
+    class alloc_stats
+    {
+        public:
+            /* allocator<T> 在块前保存大小的头部，保持 max_align_t 的对齐*/
+            static const size_t header_size = alignof(std::max_align_t);
+
+            static constexpr bool enabled() noexcept { return LEPTSTL_ALLOC_STATS != 0; }
+
+            /* 元素类型 T 的统计，第一次使用时注册
+             * 统计对象有意不释放：静态对象析构之后仍可能有容器释放内存*/
+            template <typename T>
+                static alloc_type_stats& of()
+                {
+                    static alloc_type_stats* const s = add(new alloc_type_stats(type_name(typeid(T).name())));
+                    return *s;
+                }
+
+            /* 所有类型的合计*/
+            static alloc_type_stats& all()
+            {
+                static alloc_type_stats* const s = new alloc_type_stats("total");
+                return *s;
+            }
+
+            static alloc_counters total() noexcept { return all().snapshot(); }
+
+            /* 第一个注册的类型，沿 next() 遍历全部*/
+            static alloc_type_stats* first() noexcept { return head().load(std::memory_order_acquire); }
+
+            static void reset() noexcept
+            {
+                all().reset();
+                for (alloc_type_stats* s = first(); s != nullptr; s = s->next())
+                    s->reset();
+            }
+
+            template <typename T>
+                static void record_allocate(size_t bytes) noexcept
+                {
+                    of<T>().record_allocate(bytes);
+                    all().record_allocate(bytes);
+                }
+
+            template <typename T>
+                static void record_deallocate(size_t bytes) noexcept
+                {
+                    of<T>().record_deallocate(bytes);
+                    all().record_deallocate(bytes);
+                }
+
+            /* allocator<T> 使用：在块前保存大小，释放时不需要调用方给出元素个数*/
+            template <typename T>
+                static void* allocate_with_header(size_t bytes)
+                {
+                    char* raw = static_cast<char*>(::operator new(bytes + header_size));
+                    *reinterpret_cast<size_t*>(raw) = bytes;
+                    record_allocate<T>(bytes);
+                    return raw + header_size;
+                }
+
+            template <typename T>
+                static void deallocate_with_header(void* ptr) noexcept
+                {
+                    char* raw = static_cast<char*>(ptr) - header_size;
+                    record_deallocate<T>(*reinterpret_cast<size_t*>(raw));
+                    ::operator delete(raw);
+                }
+
+            /* 文本表格：每个类型一行，按分配字节数从大到小，之后是非空的直方图桶*/
+            static void dump(std::ostream& os)
+            {
+                const std::vector<alloc_type_stats*> types = sorted();
+                char line[256];
+                std::snprintf(line, sizeof(line), "%-60s %12s %12s %14s %14s %14s\n",
+                              "type", "allocs", "frees", "bytes", "live", "peak");
+                os << line;
+                for (size_t i = 0; i <= types.size(); ++i)
+                {
+                    const alloc_type_stats& s = i < types.size() ? *types[i] : all();
+                    const alloc_counters c = s.snapshot();
+                    std::snprintf(line, sizeof(line), "%-60.60s %12llu %12llu %14llu %14llu %14llu\n",
+                                  s.name().c_str(),
+                                  static_cast<unsigned long long>(c.allocations),
+                                  static_cast<unsigned long long>(c.deallocations),
+                                  static_cast<unsigned long long>(c.bytes_allocated),
+                                  static_cast<unsigned long long>(c.live_bytes),
+                                  static_cast<unsigned long long>(c.peak_live_bytes));
+                    os << line << "    sizes:";
+                    for (size_t k = 0; k < alloc_histogram_buckets; ++k)
+                    {
+                        if (c.histogram[k] != 0)
+                            os << " " << bucket_label(k) << ":" << c.histogram[k];
+                    }
+                    os << "\n";
+                }
+            }
+
+            /* {"total": {...}, "types": [{"name": ..., ..., "histogram": {"8": n, ...}}, ...]}
+             * 直方图的键是桶的下界（字节）*/
+            static void dump_json(std::ostream& os)
+            {
+                const std::vector<alloc_type_stats*> types = sorted();
+                os << "{\"total\": ";
+                write_json(os, all());
+                os << ", \"types\": [";
+                for (size_t i = 0; i < types.size(); ++i)
+                {
+                    os << (i ? ", " : "");
+                    write_json(os, *types[i]);
+                }
+                os << "]}";
+            }
+
+        private:
+            static std::atomic<alloc_type_stats*>& head() noexcept
+            {
+                static std::atomic<alloc_type_stats*> h(nullptr);
+                return h;
+            }
+
+            static alloc_type_stats* add(alloc_type_stats* s) noexcept
+            {
+                alloc_type_stats* old = head().load(std::memory_order_relaxed);
+                do
+                {
+                    s->next_ = old;
+                } while (!head().compare_exchange_weak(old, s, std::memory_order_release, std::memory_order_relaxed));
+                return s;
+            }
+
+            static std::string type_name(const char* mangled)
+            {
+#if defined(__GNUC__)
+                int status = 0;
+                char* p = abi::__cxa_demangle(mangled, nullptr, nullptr, &status);
+                if (status == 0 && p != nullptr)
+                {
+                    std::string name(p);
+                    std::free(p);
+                    return name;
+                }
+#endif
+                return mangled;
+            }
+
+            static std::vector<alloc_type_stats*> sorted()
+            {
+                std::vector<alloc_type_stats*> v;
+                for (alloc_type_stats* s = first(); s != nullptr; s = s->next())
+                {
+                    size_t i = v.size();
+                    const uint64_t bytes = s->snapshot().bytes_allocated;
+                    v.push_back(s);
+                    for (; i > 0 && v[i - 1]->snapshot().bytes_allocated < bytes; --i)
+                        v[i] = v[i - 1];
+                    v[i] = s;
+                }
+                return v;
+            }
+
+            static std::string bucket_label(size_t k)
+            {
+                static const char* const units[] = { "B", "KB", "MB", "GB" };
+                char buf[32];
+                std::snprintf(buf, sizeof(buf), "%llu%s%s", 1ull << (k % 10), units[k / 10],
+                              k + 1 == alloc_histogram_buckets ? "+" : "");
+                return buf;
+            }
+
+            static void write_json(std::ostream& os, const alloc_type_stats& s)
+            {
+                const alloc_counters c = s.snapshot();
+                os << "{\"name\": \"";
+                for (size_t i = 0; i < s.name().size(); ++i)
+                {
+                    const char ch = s.name()[i];
+                    if (ch == '"' || ch == '\\')
+                        os << '\\';
+                    os << ch;
+                }
+                os << "\", \"allocations\": " << c.allocations
+                   << ", \"deallocations\": " << c.deallocations
+                   << ", \"bytes_allocated\": " << c.bytes_allocated
+                   << ", \"bytes_freed\": " << c.bytes_freed
+                   << ", \"live_bytes\": " << c.live_bytes
+                   << ", \"peak_live_bytes\": " << c.peak_live_bytes
+                   << ", \"histogram\": {";
+                bool first_bucket = true;
+                for (size_t k = 0; k < alloc_histogram_buckets; ++k)
+                {
+                    if (c.histogram[k] == 0)
+                        continue;
+                    os << (first_bucket ? "" : ", ") << "\"" << (1ull << k) << "\": " << c.histogram[k];
+                    first_bucket = false;
+                }
+                os << "}}";
+            }
+    };
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_ALLOC_STATS_H__ */
@@ -8,9 +8,28 @@
 #ifndef LEPTSTL_ALLOCATOR_H__
 #define LEPTSTL_ALLOCATOR_H__ 
 
-/*此头文件包含一个模板类allocator，用于管理内存分配，释放，对象的构造、析构*/
+/*此头文件包含一个模板类allocator，用于管理内存分配，释放，对象的构造、析构
+ * 以及模板类realloc_allocator，为可平凡复制的类型提供可原地扩容的内存
+ * 编译时定义 LEPTSTL_ALLOC_STATS 为 1 可统计各元素类型的分配，见 alloc_stats.h*/
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #include "construct.h"
 
+#if defined(LEPTSTL_ALLOC_STATS) && LEPTSTL_ALLOC_STATS
+#include "alloc_stats.h"
+#define LEPTSTL_ALLOC_STATS_ON 1
+#else
+#define LEPTSTL_ALLOC_STATS_ON 0
+#endif
+
 namespace leptstl 
 {
     /* 模板类：allocator */
@@ -47,7 +66,11 @@ namespace leptstl
     template<typename T>
         T* allocator<T>::allocate()
         {
+#if LEPTSTL_ALLOC_STATS_ON
+            return static_cast<T*>(alloc_stats::allocate_with_header<T>(sizeof(T)));
+#else
             return static_cast<T*>(::operator new(sizeof(T)));
+#endif
         }
 
     template<typename T>
@@ -55,7 +78,11 @@ namespace leptstl
         {
             if(n == 0)
                 return nullptr;
+#if LEPTSTL_ALLOC_STATS_ON
+            return static_cast<T*>(alloc_stats::allocate_with_header<T>(n*sizeof(T)));
+#else
             return static_cast<T*>(::operator new(n*sizeof(T)));
+#endif
         }
 
     template<typename T>
@@ -63,14 +90,22 @@ namespace leptstl
         {
             if(ptr == nullptr)
                 return;
+#if LEPTSTL_ALLOC_STATS_ON
+            alloc_stats::deallocate_with_header<T>(ptr);
+#else
             ::operator delete(ptr);
+#endif
         }
     template<typename T>
         void allocator<T>::deallocate(T* ptr, size_type /*size*/)
         {
             if(ptr == nullptr)
                 return;
+#if LEPTSTL_ALLOC_STATS_ON
+            alloc_stats::deallocate_with_header<T>(ptr);
+#else
             ::operator delete(ptr);
+#endif
         }
 
     template<typename T>
@@ -110,6 +145,171 @@ namespace leptstl
             leptstl::destroy(first, last);
         }
 
+    /*********************************************************************************/
+    /* 模板类：realloc_allocator
+     * 内存来自 malloc，扩容时用 realloc，分配器可能直接在原地延长，省去一次整块复制；
+     * Linux 下不小于 LEPTSTL_MREMAP_THRESHOLD 字节的块直接 mmap，扩容用 mremap 重新映射页表，
+     * 不复制数据，也不会出现新旧两块同时驻留的峰值
+     * 按字节搬运元素，只能用于可平凡复制的类型；deallocate 必须给出与分配时相同的元素个数*/
+#ifndef LEPTSTL_MREMAP_THRESHOLD
+#define LEPTSTL_MREMAP_THRESHOLD (1 << 20)
+#endif
+
+    template<typename T>
+        class realloc_allocator : public allocator<T>
+        {
+            static_assert(std::is_trivially_copyable<T>::value,
+                          "realloc_allocator requires a trivially copyable type");
+            public:
+                typedef typename allocator<T>::size_type    size_type;
+
+            public:
+                static T* allocate(size_type n);
+                static void deallocate(T* ptr, size_type n);
+                /* 把 ptr 处 old_n 个元素的空间调整为 new_n 个，返回新地址，失败时抛出 bad_alloc 且原空间不变*/
+                static T* reallocate(T* ptr, size_type old_n, size_type new_n);
+
+            private:
+                static bool use_mmap(size_type n) noexcept;
+                static size_t map_bytes(size_type n) noexcept;
+#if LEPTSTL_ALLOC_STATS_ON
+                /* realloc / mremap 计为释放旧块并分配新块，原地延长也算一次分配*/
+                static void record_reallocate(size_type old_n, size_type new_n) noexcept
+                {
+                    alloc_stats::record_deallocate<T>(old_n * sizeof(T));
+                    alloc_stats::record_allocate<T>(new_n * sizeof(T));
+                }
+#endif
+        };
+
+    template<typename T>
+        bool realloc_allocator<T>::use_mmap(size_type n) noexcept
+        {
+#if defined(__linux__)
+            return n * sizeof(T) >= static_cast<size_t>(LEPTSTL_MREMAP_THRESHOLD);
+#else
+            (void)n;
+            return false;
+#endif
+        }
+
+    /* 映射长度按页向上取整*/
+    template<typename T>
+        size_t realloc_allocator<T>::map_bytes(size_type n) noexcept
+        {
+#if defined(__linux__)
+            static const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+            return (n * sizeof(T) + page - 1) / page * page;
+#else
+            return n * sizeof(T);
+#endif
+        }
+
+    template<typename T>
+        T* realloc_allocator<T>::allocate(size_type n)
+        {
+            if(n == 0)
+                return nullptr;
+            if(n > static_cast<size_type>(-1) / sizeof(T))
+                throw std::bad_alloc();
+            void* p = nullptr;
+#if defined(__linux__)
+            if(use_mmap(n))
+            {
+                p = ::mmap(nullptr, map_bytes(n), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if(p == MAP_FAILED)
+                    throw std::bad_alloc();
+#if LEPTSTL_ALLOC_STATS_ON
+                alloc_stats::record_allocate<T>(n * sizeof(T));
+#endif
+                return static_cast<T*>(p);
+            }
+#endif
+            p = std::malloc(n * sizeof(T));
+            if(p == nullptr)
+                throw std::bad_alloc();
+#if LEPTSTL_ALLOC_STATS_ON
+            alloc_stats::record_allocate<T>(n * sizeof(T));
+#endif
+            return static_cast<T*>(p);
+        }
+
+    template<typename T>
+        void realloc_allocator<T>::deallocate(T* ptr, size_type n)
+        {
+            if(ptr == nullptr)
+                return;
+#if LEPTSTL_ALLOC_STATS_ON
+            alloc_stats::record_deallocate<T>(n * sizeof(T));
+#endif
+#if defined(__linux__)
+            if(use_mmap(n))
+            {
+                ::munmap(static_cast<void*>(ptr), map_bytes(n));
+                return;
+            }
+#endif
+            std::free(static_cast<void*>(ptr));
+        }
+
+    template<typename T>
+        T* realloc_allocator<T>::reallocate(T* ptr, size_type old_n, size_type new_n)
+        {
+            if(ptr == nullptr)
+                return allocate(new_n);
+            if(new_n == 0)
+            {
+                deallocate(ptr, old_n);
+                return nullptr;
+            }
+            if(new_n > static_cast<size_type>(-1) / sizeof(T))
+                throw std::bad_alloc();
+            const bool old_map = use_mmap(old_n);
+            const bool new_map = use_mmap(new_n);
+#if defined(__linux__)
+            if(old_map && new_map)
+            {
+                void* p = ::mremap(static_cast<void*>(ptr), map_bytes(old_n), map_bytes(new_n), MREMAP_MAYMOVE);
+                if(p == MAP_FAILED)
+                    throw std::bad_alloc();
+#if LEPTSTL_ALLOC_STATS_ON
+                record_reallocate(old_n, new_n);
+#endif
+                return static_cast<T*>(p);
+            }
+#endif
+            if(!old_map && !new_map)
+            {
+                void* p = std::realloc(static_cast<void*>(ptr), new_n * sizeof(T));
+                if(p == nullptr)
+                    throw std::bad_alloc();
+#if LEPTSTL_ALLOC_STATS_ON
+                record_reallocate(old_n, new_n);
+#endif
+                return static_cast<T*>(p);
+            }
+            /* 跨越阈值时两种来源不能互相调整，只能复制一次*/
+            T* p = allocate(new_n);
+            std::memcpy(static_cast<void*>(p), static_cast<const void*>(ptr), (old_n < new_n ? old_n : new_n) * sizeof(T));
+            deallocate(ptr, old_n);
+            return p;
+        }
+
+    /* 分配器是否提供 reallocate，vector 据此选择原地扩容的路径*/
+    template<typename Alloc>
+        struct is_realloc_allocator : std::false_type{};
+    template<typename T>
+        struct is_realloc_allocator<realloc_allocator<T>> : std::true_type{};
+
+    /* 取同一种分配器的另一种元素类型版本（leptstl 的分配器没有 rebind 成员）*/
+    template<typename Alloc, typename U>
+        struct allocator_rebind;
+    template<template<typename> class A, typename T, typename U>
+        struct allocator_rebind<A<T>, U>
+        {
+            typedef A<U> type;
+        };
+
 }   /* namespace leptstl */
 
 #endif  /* LEPTSTL_ALLOCATOR_H__ */
@@ -392,6 +392,11 @@ namespace leptstl
             void resize(size_type count)
             { resize(count, value_type()); }
             void resize(size_type count, value_type ch);
+            /* 新增字符不做初始化，随后由调用者写入*/
+            void resize_default_init(size_type count);
+            /* 容量扩到至少count，调用 op(buffer, count) 写入，op 返回实际长度 r（r <= count），size() 变为 r*/
+            template <typename Op>
+                void resize_and_overwrite(size_type count, Op op);
 
             void clear() noexcept 
             { size_ = 0; }
@@ -844,6 +849,37 @@ namespace leptstl
             }
         }
 
+    /* 重置大小，新增字符保持未初始化*/
+    template <typename CharType, typename CharTraits>
+        void basic_string<CharType, CharTraits>::resize_default_init(size_type count)
+        {
+            if (count < size_)
+            {
+                erase(buffer_ + count, buffer_ + size_);
+            }
+            else
+            {
+                THROW_LENGTH_ERROR_IF(count >= max_size(), "basic_string<Char, Tratis>'s size too big");
+                /* 多留一个位置给 c_str() 的结尾符*/
+                if (cap_ <= count)
+                    reserve(leptstl::max(count + 1, cap_ + (cap_ >> 1)));
+                size_ = count;
+            }
+        }
+
+    /* 由 op 直接写入缓冲区*/
+    template <typename CharType, typename CharTraits>
+        template <typename Op>
+        void basic_string<CharType, CharTraits>::resize_and_overwrite(size_type count, Op op)
+        {
+            THROW_LENGTH_ERROR_IF(count >= max_size(), "basic_string<Char, Tratis>'s size too big");
+            if (cap_ <= count)
+                reserve(leptstl::max(count + 1, cap_ + (cap_ >> 1)));
+            const size_type r = static_cast<size_type>(op(buffer_, count));
+            LEPTSTL_DEBUG(r <= count);
+            size_ = r;
+        }
+
     /* 比较两个basic_string，小于返回-1， 大于返回1，等于返回0*/
     template <typename CharType, typename CharTraits>
         int basic_string<CharType, CharTraits>::compare(const basic_string& other) const
@@ -1928,13 +1964,16 @@ namespace leptstl
     template <typename CharType, typename CharTraits>
         struct hash<basic_string<CharType, CharTraits>>
         {
-          size_t operator()(const basic_string<CharType, CharTraits>& str)
+          size_t operator()(const basic_string<CharType, CharTraits>& str) const noexcept
           {
-            return bitwise_hash((const unsigned char*)str.c_str(),
-                                str.size() * sizeof(CharType));
+            return static_cast<size_t>(hash_bytes(str.data(), str.size() * sizeof(CharType)));
           }
         };
 
+    /* basic_string 只保存指向堆空间的指针与大小，可以按字节搬迁*/
+    template <typename CharType, typename CharTraits>
+        struct is_trivially_relocatable<basic_string<CharType, CharTraits>> : leptstl::lept_true_type{};
+
 }   /* namespace leptstl */
 
 #endif  /* LEPTSTL_BASIC_STRING_H__ */
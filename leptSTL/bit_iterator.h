@@ -0,0 +1,260 @@
+/*************************************************************************
+	> File Name: bit_iterator.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Mon 19 Oct 2026 11:05:32 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_BIT_ITERATOR_H__
+#define LEPTSTL_BIT_ITERATOR_H__
+
+/* 此头文件包含按位存储的容器（vector<bool>, dynamic_bitset）以及 hive 的占用位图共用的部分：
+ * 字的位运算辅助函数 bit_popcount, bit_ctz, bit_msb，
+ * 代理引用 bit_reference，以及随机访问迭代器 bit_iterator, bit_const_iterator
+ * 第 i 位存放在第 i / 64 个字的第 i % 64 位（低位在前）
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include "iterator.h"
+
+namespace leptstl
+{
+    typedef uint64_t bit_word;
+    constexpr size_t bit_word_bits = 64;
+
+    /* 存放 n 位需要的字数*/
+    inline size_t bit_words_for(size_t n) noexcept
+    { return (n + bit_word_bits - 1) / bit_word_bits; }
+
+    /* 字中置位的个数*/
+    inline size_t bit_popcount(bit_word w) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<size_t>(__builtin_popcountll(w));
+#else
+        w = w - ((w >> 1) & 0x5555555555555555ull);
+        w = (w & 0x3333333333333333ull) + ((w >> 2) & 0x3333333333333333ull);
+        w = (w + (w >> 4)) & 0x0f0f0f0f0f0f0f0full;
+        return static_cast<size_t>((w * 0x0101010101010101ull) >> 56);
+#endif
+    }
+
+    /* 最低置位的下标，w 不能为0*/
+    inline size_t bit_ctz(bit_word w) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<size_t>(__builtin_ctzll(w));
+#else
+        size_t n = 0;
+        while (!(w & 1))
+        {
+            w >>= 1;
+            ++n;
+        }
+        return n;
+#endif
+    }
+
+    /* 最高置位的下标，w 不能为0*/
+    inline size_t bit_msb(bit_word w) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return bit_word_bits - 1 - static_cast<size_t>(__builtin_clzll(w));
+#else
+        size_t n = 0;
+        while (w >>= 1)
+            ++n;
+        return n;
+#endif
+    }
+
+    /* 指向某一位的代理引用*/
+    class bit_reference
+    {
+        public:
+            bit_reference(bit_word* p, bit_word mask) noexcept
+                : p_(p), mask_(mask) {}
+            bit_reference(const bit_reference&) noexcept = default;
+
+            operator bool() const noexcept
+            { return (*p_ & mask_) != 0; }
+            bool operator~() const noexcept
+            { return (*p_ & mask_) == 0; }
+
+            bit_reference& operator=(bool value) noexcept
+            {
+                if (value)
+                    *p_ |= mask_;
+                else
+                    *p_ &= ~mask_;
+                return *this;
+            }
+            bit_reference& operator=(const bit_reference& rhs) noexcept
+            { return *this = static_cast<bool>(rhs); }
+
+            void flip() noexcept
+            { *p_ ^= mask_; }
+
+            bool operator==(const bit_reference& rhs) const noexcept
+            { return static_cast<bool>(*this) == static_cast<bool>(rhs); }
+            bool operator<(const bit_reference& rhs) const noexcept
+            { return !static_cast<bool>(*this) && static_cast<bool>(rhs); }
+
+        private:
+            bit_word* p_;
+            bit_word  mask_;
+    };
+
+    inline void swap(bit_reference lhs, bit_reference rhs) noexcept
+    {
+        const bool tmp = lhs;
+        lhs = static_cast<bool>(rhs);
+        rhs = tmp;
+    }
+    inline void swap(bit_reference lhs, bool& rhs) noexcept
+    {
+        const bool tmp = lhs;
+        lhs = rhs;
+        rhs = tmp;
+    }
+    inline void swap(bool& lhs, bit_reference rhs) noexcept
+    { swap(rhs, lhs); }
+
+    /* 两种位迭代器共有的部分：所在的字以及字内的偏移*/
+    struct bit_iterator_base : public iterator<random_access_iterator_tag, bool>
+    {
+        bit_word* p;
+        unsigned  offset;
+
+        bit_iterator_base(bit_word* x, unsigned o) noexcept
+            : p(x), offset(o) {}
+
+        void bump_up() noexcept
+        {
+            if (offset++ == bit_word_bits - 1)
+            {
+                offset = 0;
+                ++p;
+            }
+        }
+        void bump_down() noexcept
+        {
+            if (offset-- == 0)
+            {
+                offset = bit_word_bits - 1;
+                --p;
+            }
+        }
+        void incr(ptrdiff_t n) noexcept
+        {
+            ptrdiff_t k = n + static_cast<ptrdiff_t>(offset);
+            p += k / static_cast<ptrdiff_t>(bit_word_bits);
+            k %= static_cast<ptrdiff_t>(bit_word_bits);
+            if (k < 0)
+            {
+                k += bit_word_bits;
+                --p;
+            }
+            offset = static_cast<unsigned>(k);
+        }
+
+        bool operator==(const bit_iterator_base& rhs) const noexcept
+        { return p == rhs.p && offset == rhs.offset; }
+        bool operator!=(const bit_iterator_base& rhs) const noexcept
+        { return !(*this == rhs); }
+        bool operator<(const bit_iterator_base& rhs) const noexcept
+        { return p < rhs.p || (p == rhs.p && offset < rhs.offset); }
+        bool operator>(const bit_iterator_base& rhs) const noexcept
+        { return rhs < *this; }
+        bool operator<=(const bit_iterator_base& rhs) const noexcept
+        { return !(rhs < *this); }
+        bool operator>=(const bit_iterator_base& rhs) const noexcept
+        { return !(*this < rhs); }
+    };
+
+    inline ptrdiff_t operator-(const bit_iterator_base& lhs, const bit_iterator_base& rhs) noexcept
+    {
+        return static_cast<ptrdiff_t>(bit_word_bits) * (lhs.p - rhs.p)
+            + static_cast<ptrdiff_t>(lhs.offset) - static_cast<ptrdiff_t>(rhs.offset);
+    }
+
+    struct bit_iterator : public bit_iterator_base
+    {
+        typedef bit_reference       reference;
+        typedef bit_reference*      pointer;
+        typedef bit_iterator        self;
+
+        bit_iterator() noexcept : bit_iterator_base(nullptr, 0) {}
+        bit_iterator(bit_word* x, unsigned o) noexcept : bit_iterator_base(x, o) {}
+
+        reference operator*() const noexcept
+        { return reference(p, bit_word(1) << offset); }
+        reference operator[](ptrdiff_t n) const noexcept
+        { return *(*this + n); }
+
+        self& operator++() noexcept { bump_up(); return *this; }
+        self operator++(int) noexcept { self tmp = *this; bump_up(); return tmp; }
+        self& operator--() noexcept { bump_down(); return *this; }
+        self operator--(int) noexcept { self tmp = *this; bump_down(); return tmp; }
+        self& operator+=(ptrdiff_t n) noexcept { incr(n); return *this; }
+        self& operator-=(ptrdiff_t n) noexcept { incr(-n); return *this; }
+        self operator+(ptrdiff_t n) const noexcept { self tmp = *this; return tmp += n; }
+        self operator-(ptrdiff_t n) const noexcept { self tmp = *this; return tmp -= n; }
+    };
+
+    inline bit_iterator operator+(ptrdiff_t n, const bit_iterator& x) noexcept
+    { return x + n; }
+
+    struct bit_const_iterator : public bit_iterator_base
+    {
+        typedef bool                reference;
+        typedef const bool*         pointer;
+        typedef bit_const_iterator  self;
+
+        bit_const_iterator() noexcept : bit_iterator_base(nullptr, 0) {}
+        bit_const_iterator(const bit_word* x, unsigned o) noexcept
+            : bit_iterator_base(const_cast<bit_word*>(x), o) {}
+        bit_const_iterator(const bit_iterator& x) noexcept
+            : bit_iterator_base(x.p, x.offset) {}
+
+        reference operator*() const noexcept
+        { return (*p >> offset) & 1; }
+        reference operator[](ptrdiff_t n) const noexcept
+        { return *(*this + n); }
+
+        self& operator++() noexcept { bump_up(); return *this; }
+        self operator++(int) noexcept { self tmp = *this; bump_up(); return tmp; }
+        self& operator--() noexcept { bump_down(); return *this; }
+        self operator--(int) noexcept { self tmp = *this; bump_down(); return tmp; }
+        self& operator+=(ptrdiff_t n) noexcept { incr(n); return *this; }
+        self& operator-=(ptrdiff_t n) noexcept { incr(-n); return *this; }
+        self operator+(ptrdiff_t n) const noexcept { self tmp = *this; return tmp += n; }
+        self operator-(ptrdiff_t n) const noexcept { self tmp = *this; return tmp -= n; }
+    };
+
+    inline bit_const_iterator operator+(ptrdiff_t n, const bit_const_iterator& x) noexcept
+    { return x + n; }
+
+    /* 把 [first, last) 之间的位全部置为 value，两端不满一字的部分逐位处理，中间整字填充*/
+    inline void bit_fill(bit_iterator first, bit_iterator last, bool value) noexcept
+    {
+        while (first != last && first.offset != 0)
+        {
+            *first = value;
+            ++first;
+        }
+        const bit_word fill = value ? ~bit_word(0) : bit_word(0);
+        while (first.p != last.p)
+            *first.p++ = fill;
+        while (first != last)
+        {
+            *first = value;
+            ++first;
+        }
+    }
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_BIT_ITERATOR_H__ */
@@ -0,0 +1,995 @@
+/*************************************************************************
+	> File Name: btree.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Mon 19 Oct 2026 04:10:37 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_BTREE_H__
+#define LEPTSTL_BTREE_H__
+
+/* 此头文件包含一个模板类 btree，作为 btree_set / btree_multiset / btree_map / btree_multimap 的底层机制
+ * 采用 B+ 树：元素只存放在叶子节点中，叶子之间双向链接，内部节点只存放分隔键的副本
+ * 每个节点的大小约为 LEPTSTL_BTREE_NODE_SIZE 字节（默认4个缓存行），一个节点内连续存放多个元素，
+ * 查找时每层只需访问一个节点，顺序遍历时只需沿叶子链表前进
+ *
+ * 不变式：内部节点第 i 个孩子中的所有键 k 满足 keys[i-1] <= k <= keys[i]
+ * 删除时合并过于稀疏的相邻节点，内部节点只剩一个孩子又无法合并时从兄弟借一个孩子，根只剩一个孩子时树变矮一层
+ * 注意：插入与删除会使所有迭代器失效（元素会在节点间移动），erase 返回下一个元素的有效迭代器
+ */
+
+#include <initializer_list>
+#include <type_traits>
+
+#include "algobase.h"
+#include "functional.h"
+#include "iterator.h"
+#include "memory.h"
+#include "util.h"
+
+namespace leptstl
+{
+/* 节点的目标字节数*/
+#ifndef LEPTSTL_BTREE_NODE_SIZE
+#define LEPTSTL_BTREE_NODE_SIZE 256
+#endif
+
+    /* 节点公共部分*/
+    struct btree_node_base
+    {
+        btree_node_base* parent;
+        size_t           count;   /* 叶子：元素个数；内部节点：键的个数（孩子数为 count + 1）*/
+        bool             leaf;
+    };
+
+    /* 叶子节点：存放元素*/
+    template <typename Value, size_t N>
+        struct btree_leaf_node : public btree_node_base
+        {
+            btree_leaf_node* prev;
+            btree_leaf_node* next;
+            typename std::aligned_storage<sizeof(Value), alignof(Value)>::type slots[N];
+
+            Value* value(size_t i) noexcept { return reinterpret_cast<Value*>(&slots[i]); }
+        };
+
+    /* 内部节点：存放分隔键与孩子指针*/
+    template <typename Key, size_t N>
+        struct btree_internal_node : public btree_node_base
+        {
+            typename std::aligned_storage<sizeof(Key), alignof(Key)>::type keys[N];
+            btree_node_base* children[N + 1];
+
+            Key* key(size_t i) noexcept { return reinterpret_cast<Key*>(&keys[i]); }
+        };
+
+    /* 根据元素与键的大小计算每个节点的容量*/
+    template <typename Key, typename Value>
+        struct btree_node_traits
+        {
+            static constexpr size_t leaf_bytes  = LEPTSTL_BTREE_NODE_SIZE - 4 * sizeof(void*);
+            static constexpr size_t inner_bytes = LEPTSTL_BTREE_NODE_SIZE - 3 * sizeof(void*);
+
+            static constexpr size_t leaf_slots  =
+                leaf_bytes / sizeof(Value) < 4 ? 4 : leaf_bytes / sizeof(Value);
+            static constexpr size_t inner_slots =
+                inner_bytes / (sizeof(Key) + sizeof(void*)) < 3 ? 3 : inner_bytes / (sizeof(Key) + sizeof(void*));
+        };
+
+    /*****************************************************************************************/
+    /* btree_iterator：叶子指针 + 叶内下标，end() 为最后一个叶子的 count 位置*/
+    template <typename Value, typename Ref, typename Ptr, size_t N>
+        struct btree_iterator : public iterator<bidirectional_iterator_tag, Value>
+        {
+            typedef btree_iterator<Value, Value&, Value*, N>             iterator;
+            typedef btree_iterator<Value, const Value&, const Value*, N> const_iterator;
+            typedef btree_iterator                                      self;
+
+            typedef Value                   value_type;
+            typedef Ptr                     pointer;
+            typedef Ref                     reference;
+            typedef size_t                  size_type;
+            typedef ptrdiff_t               difference_type;
+            typedef btree_leaf_node<Value, N>* leaf_ptr;
+
+            leaf_ptr  leaf;
+            size_type idx;
+
+            btree_iterator() noexcept :leaf(nullptr), idx(0) {}
+            btree_iterator(leaf_ptr l, size_type i) noexcept :leaf(l), idx(i) {}
+            btree_iterator(const iterator& rhs) noexcept :leaf(rhs.leaf), idx(rhs.idx) {}
+            self& operator=(const self& rhs) = default;
+
+            reference operator*()  const { return *leaf->value(idx); }
+            pointer   operator->() const { return &(operator*()); }
+
+            self& operator++()
+            {
+                if (++idx == leaf->count && leaf->next != nullptr)
+                {
+                    leaf = leaf->next;
+                    idx = 0;
+                }
+                return *this;
+            }
+            self operator++(int)
+            {
+                self tmp = *this;
+                ++*this;
+                return tmp;
+            }
+            self& operator--()
+            {
+                if (idx == 0)
+                {
+                    leaf = leaf->prev;
+                    idx = leaf->count;
+                }
+                --idx;
+                return *this;
+            }
+            self operator--(int)
+            {
+                self tmp = *this;
+                --*this;
+                return tmp;
+            }
+
+            bool operator==(const self& rhs) const { return leaf == rhs.leaf && idx == rhs.idx; }
+            bool operator!=(const self& rhs) const { return !(*this == rhs); }
+        };
+
+    /*****************************************************************************************/
+    /* 模板类 btree */
+    /* 参数一为键值类型，参数二为元素类型，参数三为从元素取出键值的仿函数，参数四为键值比较方式*/
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        class btree
+        {
+            public:
+                typedef btree_node_traits<Key, Value>                   node_traits;
+                static constexpr size_t leaf_slots  = node_traits::leaf_slots;
+                static constexpr size_t inner_slots = node_traits::inner_slots;
+
+                typedef btree_leaf_node<Value, leaf_slots>              leaf_node;
+                typedef btree_internal_node<Key, inner_slots>           internal_node;
+
+                typedef leptstl::allocator<Value>                       allocator_type;
+                typedef leptstl::allocator<Value>                       data_allocator;
+                typedef leptstl::allocator<Key>                         key_allocator;
+                typedef leptstl::allocator<leaf_node>                   leaf_allocator;
+                typedef leptstl::allocator<internal_node>               internal_allocator;
+
+                typedef Key                                             key_type;
+                typedef Value                                           value_type;
+                typedef Compare                                         key_compare;
+
+                typedef value_type*                                     pointer;
+                typedef const value_type*                               const_pointer;
+                typedef value_type&                                     reference;
+                typedef const value_type&                               const_reference;
+                typedef size_t                                          size_type;
+                typedef ptrdiff_t                                       difference_type;
+
+                typedef btree_iterator<Value, Value&, Value*, leaf_slots>             iterator;
+                typedef btree_iterator<Value, const Value&, const Value*, leaf_slots> const_iterator;
+                typedef leptstl::reverse_iterator<iterator>                           reverse_iterator;
+                typedef leptstl::reverse_iterator<const_iterator>                     const_reverse_iterator;
+
+                allocator_type get_allocator() const { return allocator_type(); }
+
+            private:
+                btree_node_base* root_;
+                leaf_node*       first_;   /* 最左叶子*/
+                leaf_node*       last_;    /* 最右叶子*/
+                size_type        size_;
+                key_compare      comp_;
+
+            public:
+                /* 构造、复制、移动、析构函数*/
+                explicit btree(const Compare& comp = Compare())
+                    :root_(nullptr), first_(nullptr), last_(nullptr), size_(0), comp_(comp)
+                {
+                }
+
+                btree(const btree& rhs)
+                    :root_(nullptr), first_(nullptr), last_(nullptr), size_(0), comp_(rhs.comp_)
+                {
+                    copy_from(rhs);
+                }
+                btree(btree&& rhs) noexcept
+                    :root_(rhs.root_), first_(rhs.first_), last_(rhs.last_), size_(rhs.size_), comp_(rhs.comp_)
+                {
+                    rhs.root_ = nullptr;
+                    rhs.first_ = rhs.last_ = nullptr;
+                    rhs.size_ = 0;
+                }
+
+                btree& operator=(const btree& rhs)
+                {
+                    if (this != &rhs)
+                    {
+                        clear();
+                        comp_ = rhs.comp_;
+                        copy_from(rhs);
+                    }
+                    return *this;
+                }
+                btree& operator=(btree&& rhs) noexcept
+                {
+                    btree tmp(leptstl::move(rhs));
+                    swap(tmp);
+                    return *this;
+                }
+
+                ~btree() { clear(); }
+
+            public:
+                /* 迭代器相关操作*/
+                iterator       begin()        noexcept { return iterator(first_, 0); }
+                const_iterator begin()  const noexcept { return const_iterator(first_, 0); }
+                iterator       end()          noexcept { return iterator(last_, last_ ? last_->count : 0); }
+                const_iterator end()    const noexcept { return const_iterator(last_, last_ ? last_->count : 0); }
+
+                reverse_iterator       rbegin()       noexcept { return reverse_iterator(end()); }
+                const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+                reverse_iterator       rend()         noexcept { return reverse_iterator(begin()); }
+                const_reverse_iterator rend()   const noexcept { return const_reverse_iterator(begin()); }
+
+                const_iterator cbegin() const noexcept { return begin(); }
+                const_iterator cend()   const noexcept { return end(); }
+
+                /* 容量相关操作*/
+                bool      empty()    const noexcept { return size_ == 0; }
+                size_type size()     const noexcept { return size_; }
+                size_type max_size() const noexcept { return static_cast<size_type>(-1); }
+
+                /* 树高，只有一个叶子时为1，空树为0*/
+                size_type height() const noexcept
+                {
+                    size_type h = 0;
+                    for (btree_node_base* p = root_; p != nullptr; ++h)
+                        p = p->leaf ? nullptr : static_cast<internal_node*>(p)->children[0];
+                    return h;
+                }
+
+                /* 修改容器相关操作*/
+                pair<iterator, bool> insert_unique(const value_type& value)
+                { return insert_unique_value(value); }
+                pair<iterator, bool> insert_unique(value_type&& value)
+                { return insert_unique_value(leptstl::move(value)); }
+                iterator insert_multi(const value_type& value)
+                { return insert_multi_value(value); }
+                iterator insert_multi(value_type&& value)
+                { return insert_multi_value(leptstl::move(value)); }
+
+                template <typename ...Args>
+                    pair<iterator, bool> emplace_unique(Args&& ...args)
+                    { return insert_unique_value(value_type(leptstl::forward<Args>(args)...)); }
+                template <typename ...Args>
+                    iterator emplace_multi(Args&& ...args)
+                    { return insert_multi_value(value_type(leptstl::forward<Args>(args)...)); }
+
+                template <typename InputIterator>
+                    void insert_unique(InputIterator first, InputIterator last)
+                    {
+                        for (; first != last; ++first)
+                            insert_unique(*first);
+                    }
+                template <typename InputIterator>
+                    void insert_multi(InputIterator first, InputIterator last)
+                    {
+                        for (; first != last; ++first)
+                            insert_multi(*first);
+                    }
+
+                iterator  erase(const_iterator pos);
+                iterator  erase(const_iterator first, const_iterator last);
+                size_type erase_unique(const key_type& key);
+                size_type erase_multi(const key_type& key);
+
+                void clear();
+                void swap(btree& rhs) noexcept
+                {
+                    leptstl::swap(root_, rhs.root_);
+                    leptstl::swap(first_, rhs.first_);
+                    leptstl::swap(last_, rhs.last_);
+                    leptstl::swap(size_, rhs.size_);
+                    leptstl::swap(comp_, rhs.comp_);
+                }
+
+                /* 查找相关操作*/
+                iterator       lower_bound(const key_type& key)
+                { return root_ ? lower_in(key) : end(); }
+                const_iterator lower_bound(const key_type& key) const
+                { return root_ ? const_cast<btree*>(this)->lower_in(key) : end(); }
+                iterator       upper_bound(const key_type& key)
+                { return root_ ? upper_in(key) : end(); }
+                const_iterator upper_bound(const key_type& key) const
+                { return root_ ? const_cast<btree*>(this)->upper_in(key) : end(); }
+
+                iterator       find(const key_type& key)
+                {
+                    iterator it = lower_bound(key);
+                    return (it == end() || comp_(key, key_of(*it))) ? end() : it;
+                }
+                const_iterator find(const key_type& key) const
+                { return const_cast<btree*>(this)->find(key); }
+
+                size_type count_unique(const key_type& key) const
+                { return find(key) == end() ? 0 : 1; }
+                size_type count_multi(const key_type& key) const
+                {
+                    auto p = equal_range_multi(key);
+                    return static_cast<size_type>(leptstl::distance(p.first, p.second));
+                }
+
+                pair<iterator, iterator> equal_range_unique(const key_type& key)
+                {
+                    iterator it = find(key);
+                    if (it == end())
+                        return pair<iterator, iterator>(it, it);
+                    iterator next = it;
+                    return pair<iterator, iterator>(it, ++next);
+                }
+                pair<const_iterator, const_iterator> equal_range_unique(const key_type& key) const
+                {
+                    auto p = const_cast<btree*>(this)->equal_range_unique(key);
+                    return pair<const_iterator, const_iterator>(p.first, p.second);
+                }
+                pair<iterator, iterator> equal_range_multi(const key_type& key)
+                { return pair<iterator, iterator>(lower_bound(key), upper_bound(key)); }
+                pair<const_iterator, const_iterator> equal_range_multi(const key_type& key) const
+                { return pair<const_iterator, const_iterator>(lower_bound(key), upper_bound(key)); }
+
+                key_compare key_comp() const { return comp_; }
+
+            private:
+                const key_type& key_of(const value_type& v) const { return KeyOfValue()(v); }
+
+                static internal_node* parent_of(btree_node_base* p)
+                { return static_cast<internal_node*>(p->parent); }
+
+                /* 节点的创建与销毁*/
+                leaf_node*     create_leaf();
+                internal_node* create_internal();
+                void           destroy_leaf(leaf_node* p);
+                void           destroy_internal(internal_node* p);
+                void           destroy_subtree(btree_node_base* p);
+
+                /* 节点内二分查找*/
+                size_type leaf_lower(leaf_node* p, const key_type& key) const;
+                size_type leaf_upper(leaf_node* p, const key_type& key) const;
+                size_type inner_lower(internal_node* p, const key_type& key) const;
+                size_type inner_upper(internal_node* p, const key_type& key) const;
+                size_type child_index(internal_node* p, btree_node_base* child) const;
+
+                iterator  make_iter(leaf_node* p, size_type i)
+                {
+                    if (i == p->count && p->next != nullptr)
+                        return iterator(p->next, 0);
+                    return iterator(p, i);
+                }
+                iterator  lower_in(const key_type& key);
+                iterator  upper_in(const key_type& key);
+
+                /* 插入辅助函数*/
+                template <typename V>
+                    pair<iterator, bool> insert_unique_value(V&& value);
+                template <typename V>
+                    iterator insert_multi_value(V&& value);
+                template <typename V>
+                    iterator insert_at(leaf_node* p, size_type pos, V&& value);
+                void      insert_into_parent(btree_node_base* left, const key_type& key, btree_node_base* right);
+                void      split_internal(internal_node* p);
+
+                /* 删除辅助函数*/
+                void      unlink_leaf(leaf_node* p);
+                void      remove_child(internal_node* p, btree_node_base* child);
+                void      rebalance_internal(internal_node* p);
+
+                void      copy_from(const btree& rhs);
+        };  /* btree */
+
+    /*****************************************************************************************/
+
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        typename btree<Key, Value, KeyOfValue, Compare>::leaf_node*
+        btree<Key, Value, KeyOfValue, Compare>::create_leaf()
+        {
+            leaf_node* p = leaf_allocator::allocate(1);
+            p->parent = nullptr;
+            p->count = 0;
+            p->leaf = true;
+            p->prev = p->next = nullptr;
+            return p;
+        }
+
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        typename btree<Key, Value, KeyOfValue, Compare>::internal_node*
+        btree<Key, Value, KeyOfValue, Compare>::create_internal()
+        {
+            internal_node* p = internal_allocator::allocate(1);
+            p->parent = nullptr;
+            p->count = 0;
+            p->leaf = false;
+            return p;
+        }
+
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        void btree<Key, Value, KeyOfValue, Compare>::destroy_leaf(leaf_node* p)
+        {
+            data_allocator::destroy(p->value(0), p->value(0) + p->count);
+            leaf_allocator::deallocate(p);
+        }
+
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        void btree<Key, Value, KeyOfValue, Compare>::destroy_internal(internal_node* p)
+        {
+            key_allocator::destroy(p->key(0), p->key(0) + p->count);
+            internal_allocator::deallocate(p);
+        }
+
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        void btree<Key, Value, KeyOfValue, Compare>::destroy_subtree(btree_node_base* p)
+        {
+            if (p->leaf)
+            {
+                destroy_leaf(static_cast<leaf_node*>(p));
+                return;
+            }
+            internal_node* q = static_cast<internal_node*>(p);
+            for (size_type i = 0; i <= q->count; ++i)
+                destroy_subtree(q->children[i]);
+            destroy_internal(q);
+        }
+
+    /* 返回叶子中第一个不小于 key 的位置*/
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        typename btree<Key, Value, KeyOfValue, Compare>::size_type
+        btree<Key, Value, KeyOfValue, Compare>::leaf_lower(leaf_node* p, const key_type& key) const
+        {
+            size_type lo = 0, hi = p->count;
+            while (lo < hi)
+            {
+                const size_type mid = (lo + hi) >> 1;
+                if (comp_(key_of(*p->value(mid)), key))
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+            return lo;
+        }
+
+    /* 返回叶子中第一个大于 key 的位置*/
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        typename btree<Key, Value, KeyOfValue, Compare>::size_type
+        btree<Key, Value, KeyOfValue, Compare>::leaf_upper(leaf_node* p, const key_type& key) const
+        {
+            size_type lo = 0, hi = p->count;
+            while (lo < hi)
+            {
+                const size_type mid = (lo + hi) >> 1;
+                if (comp_(key, key_of(*p->value(mid))))
+                    hi = mid;
+                else
+                    lo = mid + 1;
+            }
+            return lo;
+        }
+
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        typename btree<Key, Value, KeyOfValue, Compare>::size_type
+        btree<Key, Value, KeyOfValue, Compare>::inner_lower(internal_node* p, const key_type& key) const
+        {
+            size_type lo = 0, hi = p->count;
+            while (lo < hi)
+            {
+                const size_type mid = (lo + hi) >> 1;
+                if (comp_(*p->key(mid), key))
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+            return lo;
+        }
+
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        typename btree<Key, Value, KeyOfValue, Compare>::size_type
+        btree<Key, Value, KeyOfValue, Compare>::inner_upper(internal_node* p, const key_type& key) const
+        {
+            size_type lo = 0, hi = p->count;
+            while (lo < hi)
+            {
+                const size_type mid = (lo + hi) >> 1;
+                if (comp_(key, *p->key(mid)))
+                    hi = mid;
+                else
+                    lo = mid + 1;
+            }
+            return lo;
+        }
+
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        typename btree<Key, Value, KeyOfValue, Compare>::size_type
+        btree<Key, Value, KeyOfValue, Compare>::child_index(internal_node* p, btree_node_base* child) const
+        {
+            size_type i = 0;
+            while (p->children[i] != child)
+                ++i;
+            return i;
+        }
+
+    /* 沿着第一个不小于 key 的分隔键下降：左侧孩子中的键都不大于一个小于 key 的分隔键*/
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        typename btree<Key, Value, KeyOfValue, Compare>::iterator
+        btree<Key, Value, KeyOfValue, Compare>::lower_in(const key_type& key)
+        {
+            btree_node_base* p = root_;
+            while (!p->leaf)
+            {
+                internal_node* q = static_cast<internal_node*>(p);
+                p = q->children[inner_lower(q, key)];
+            }
+            leaf_node* l = static_cast<leaf_node*>(p);
+            return make_iter(l, leaf_lower(l, key));
+        }
+
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        typename btree<Key, Value, KeyOfValue, Compare>::iterator
+        btree<Key, Value, KeyOfValue, Compare>::upper_in(const key_type& key)
+        {
+            btree_node_base* p = root_;
+            while (!p->leaf)
+            {
+                internal_node* q = static_cast<internal_node*>(p);
+                p = q->children[inner_upper(q, key)];
+            }
+            leaf_node* l = static_cast<leaf_node*>(p);
+            return make_iter(l, leaf_upper(l, key));
+        }
+
+    /*****************************************************************************************/
+    /* 插入*/
+
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        template <typename V>
+        pair<typename btree<Key, Value, KeyOfValue, Compare>::iterator, bool>
+        btree<Key, Value, KeyOfValue, Compare>::insert_unique_value(V&& value)
+        {
+            if (root_ == nullptr)
+                root_ = first_ = last_ = create_leaf();
+            const key_type& key = key_of(value);
+            btree_node_base* p = root_;
+            while (!p->leaf)
+            {
+                internal_node* q = static_cast<internal_node*>(p);
+                p = q->children[inner_lower(q, key)];
+            }
+            leaf_node* l = static_cast<leaf_node*>(p);
+            const size_type pos = leaf_lower(l, key);
+            iterator it = make_iter(l, pos);
+            if (it != end() && !comp_(key, key_of(*it)))
+                return pair<iterator, bool>(it, false);
+            return pair<iterator, bool>(insert_at(l, pos, leptstl::forward<V>(value)), true);
+        }
+
+    /* 相等的键插入到最后一个相等元素之后，保持插入顺序*/
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        template <typename V>
+        typename btree<Key, Value, KeyOfValue, Compare>::iterator
+        btree<Key, Value, KeyOfValue, Compare>::insert_multi_value(V&& value)
+        {
+            if (root_ == nullptr)
+                root_ = first_ = last_ = create_leaf();
+            const key_type& key = key_of(value);
+            btree_node_base* p = root_;
+            while (!p->leaf)
+            {
+                internal_node* q = static_cast<internal_node*>(p);
+                p = q->children[inner_upper(q, key)];
+            }
+            leaf_node* l = static_cast<leaf_node*>(p);
+            return insert_at(l, leaf_upper(l, key), leptstl::forward<V>(value));
+        }
+
+    /* 在叶子 p 的 pos 处插入元素，叶子已满时先分裂
+     * 在最右叶子的末尾追加时（顺序插入）不平分，左边保持满载，顺序建树时节点利用率接近100%*/
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        template <typename V>
+        typename btree<Key, Value, KeyOfValue, Compare>::iterator
+        btree<Key, Value, KeyOfValue, Compare>::insert_at(leaf_node* p, size_type pos, V&& value)
+        {
+            if (p->count == leaf_slots)
+            {
+                const size_type split = (pos == p->count && p->next == nullptr) ? p->count : p->count / 2;
+                const key_type sep(pos == split ? key_of(value) : key_of(*p->value(split)));
+                leaf_node* r = create_leaf();
+                try
+                {
+                    insert_into_parent(p, sep, r);
+                }
+                catch (...)
+                {
+                    leaf_allocator::deallocate(r);
+                    throw;
+                }
+                for (size_type i = split; i < p->count; ++i)
+                {
+                    data_allocator::construct(r->value(i - split), leptstl::move(*p->value(i)));
+                    data_allocator::destroy(p->value(i));
+                }
+                r->count = p->count - split;
+                p->count = split;
+                r->next = p->next;
+                r->prev = p;
+                if (p->next != nullptr)
+                    p->next->prev = r;
+                else
+                    last_ = r;
+                p->next = r;
+                if (pos >= split)
+                {
+                    pos -= split;
+                    p = r;
+                }
+            }
+            for (size_type i = p->count; i > pos; --i)
+            {
+                data_allocator::construct(p->value(i), leptstl::move(*p->value(i - 1)));
+                data_allocator::destroy(p->value(i - 1));
+            }
+            data_allocator::construct(p->value(pos), leptstl::forward<V>(value));
+            ++p->count;
+            ++size_;
+            return iterator(p, pos);
+        }
+
+    /* 在 left 之后挂上新的兄弟节点 right，key 为两者的分隔键*/
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        void btree<Key, Value, KeyOfValue, Compare>::
+        insert_into_parent(btree_node_base* left, const key_type& key, btree_node_base* right)
+        {
+            if (left->parent == nullptr)
+            { /* 根节点分裂，树长高一层*/
+                internal_node* root = create_internal();
+                key_allocator::construct(root->key(0), key);
+                root->children[0] = left;
+                root->children[1] = right;
+                root->count = 1;
+                left->parent = right->parent = root;
+                root_ = root;
+                return;
+            }
+            if (parent_of(left)->count == inner_slots)
+                split_internal(parent_of(left));
+            internal_node* p = parent_of(left);
+            const size_type i = child_index(p, left);
+            for (size_type j = p->count; j > i; --j)
+            {
+                key_allocator::construct(p->key(j), leptstl::move(*p->key(j - 1)));
+                key_allocator::destroy(p->key(j - 1));
+                p->children[j + 1] = p->children[j];
+            }
+            key_allocator::construct(p->key(i), key);
+            p->children[i + 1] = right;
+            right->parent = p;
+            ++p->count;
+        }
+
+    /* 内部节点分裂：中间的键上移，右半部分移到新节点*/
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        void btree<Key, Value, KeyOfValue, Compare>::split_internal(internal_node* p)
+        {
+            const size_type n = p->count;
+            const size_type mid = n / 2;
+            internal_node* r = create_internal();
+            try
+            {
+                insert_into_parent(p, *p->key(mid), r);
+            }
+            catch (...)
+            {
+                internal_allocator::deallocate(r);
+                throw;
+            }
+            for (size_type i = mid + 1; i < n; ++i)
+            {
+                key_allocator::construct(r->key(i - mid - 1), leptstl::move(*p->key(i)));
+                key_allocator::destroy(p->key(i));
+            }
+            for (size_type i = mid + 1; i <= n; ++i)
+            {
+                r->children[i - mid - 1] = p->children[i];
+                p->children[i]->parent = r;
+            }
+            key_allocator::destroy(p->key(mid));
+            r->count = n - mid - 1;
+            p->count = mid;
+        }
+
+    /*****************************************************************************************/
+    /* 删除*/
+
+    /* 删除 pos 处的元素，返回下一个元素的迭代器
+     * 叶子变空时回收该叶子；元素少于容量的1/4时尝试与相邻叶子合并*/
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        typename btree<Key, Value, KeyOfValue, Compare>::iterator
+        btree<Key, Value, KeyOfValue, Compare>::erase(const_iterator pos)
+        {
+            leaf_node* p = pos.leaf;
+            const size_type i = pos.idx;
+            data_allocator::destroy(p->value(i));
+            for (size_type j = i + 1; j < p->count; ++j)
+            {
+                data_allocator::construct(p->value(j - 1), leptstl::move(*p->value(j)));
+                data_allocator::destroy(p->value(j));
+            }
+            --p->count;
+            --size_;
+
+            if (p == root_)
+            {
+                if (p->count == 0)
+                {
+                    leaf_allocator::deallocate(p);
+                    root_ = first_ = last_ = nullptr;
+                    return end();
+                }
+                return make_iter(p, i);
+            }
+            if (p->count == 0)
+            {
+                leaf_node* next = p->next;
+                unlink_leaf(p);
+                return next ? iterator(next, 0) : end();
+            }
+            if (p->count < leaf_slots / 4)
+            {
+                internal_node* parent = parent_of(p);
+                const size_type ci = child_index(parent, p);
+                if (ci > 0)
+                { /* 并入左兄弟*/
+                    leaf_node* l = static_cast<leaf_node*>(parent->children[ci - 1]);
+                    if (l->count + p->count <= leaf_slots)
+                    {
+                        const size_type off = l->count;
+                        for (size_type j = 0; j < p->count; ++j)
+                        {
+                            data_allocator::construct(l->value(off + j), leptstl::move(*p->value(j)));
+                            data_allocator::destroy(p->value(j));
+                        }
+                        l->count += p->count;
+                        p->count = 0;
+                        unlink_leaf(p);
+                        return make_iter(l, off + i);
+                    }
+                }
+                if (ci < parent->count)
+                { /* 右兄弟并入自身*/
+                    leaf_node* r = static_cast<leaf_node*>(parent->children[ci + 1]);
+                    if (r->count + p->count <= leaf_slots)
+                    {
+                        for (size_type j = 0; j < r->count; ++j)
+                        {
+                            data_allocator::construct(p->value(p->count + j), leptstl::move(*r->value(j)));
+                            data_allocator::destroy(r->value(j));
+                        }
+                        p->count += r->count;
+                        r->count = 0;
+                        unlink_leaf(r);
+                        return make_iter(p, i);
+                    }
+                }
+            }
+            return make_iter(p, i);
+        }
+
+    /* 合并可能移动元素，所以先算出个数，再依次删除*/
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        typename btree<Key, Value, KeyOfValue, Compare>::iterator
+        btree<Key, Value, KeyOfValue, Compare>::erase(const_iterator first, const_iterator last)
+        {
+            if (first == begin() && last == end())
+            {
+                clear();
+                return end();
+            }
+            size_type n = static_cast<size_type>(leptstl::distance(first, last));
+            iterator it(first.leaf, first.idx);
+            while (n-- > 0)
+                it = erase(it);
+            return it;
+        }
+
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        typename btree<Key, Value, KeyOfValue, Compare>::size_type
+        btree<Key, Value, KeyOfValue, Compare>::erase_unique(const key_type& key)
+        {
+            iterator it = find(key);
+            if (it == end())
+                return 0;
+            erase(it);
+            return 1;
+        }
+
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        typename btree<Key, Value, KeyOfValue, Compare>::size_type
+        btree<Key, Value, KeyOfValue, Compare>::erase_multi(const key_type& key)
+        {
+            size_type n = 0;
+            iterator it = lower_bound(key);
+            while (it != end() && !comp_(key, key_of(*it)))
+            {
+                it = erase(it);
+                ++n;
+            }
+            return n;
+        }
+
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        void btree<Key, Value, KeyOfValue, Compare>::clear()
+        {
+            if (root_ != nullptr)
+            {
+                destroy_subtree(root_);
+                root_ = first_ = last_ = nullptr;
+                size_ = 0;
+            }
+        }
+
+    /* 从叶子链表与父节点中摘除一个已空的叶子并释放*/
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        void btree<Key, Value, KeyOfValue, Compare>::unlink_leaf(leaf_node* p)
+        {
+            if (p->prev != nullptr)
+                p->prev->next = p->next;
+            else
+                first_ = p->next;
+            if (p->next != nullptr)
+                p->next->prev = p->prev;
+            else
+                last_ = p->prev;
+            remove_child(parent_of(p), p);
+            leaf_allocator::deallocate(p);
+        }
+
+    /* 从内部节点 p 中去掉孩子 child 以及与其相邻的一个分隔键
+     * 去掉 keys[i-1] 后左邻孩子的键范围变为 [keys[i-2], keys[i]]，不变式仍然成立*/
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        void btree<Key, Value, KeyOfValue, Compare>::remove_child(internal_node* p, btree_node_base* child)
+        {
+            const size_type ci = child_index(p, child);
+            const size_type ki = ci > 0 ? ci - 1 : 0;
+            key_allocator::destroy(p->key(ki));
+            for (size_type j = ki + 1; j < p->count; ++j)
+            {
+                key_allocator::construct(p->key(j - 1), leptstl::move(*p->key(j)));
+                key_allocator::destroy(p->key(j));
+            }
+            for (size_type j = ci + 1; j <= p->count; ++j)
+                p->children[j - 1] = p->children[j];
+            --p->count;
+            rebalance_internal(p);
+        }
+
+    /* 内部节点失去一个孩子后的调整：
+     * 根只剩一个孩子时树变矮一层；其余节点键少于容量的1/4时尝试与相邻兄弟合并（父节点的分隔键下移），
+     * 只剩一个孩子又无法合并时（兄弟已满）从兄弟借一个孩子，分隔键经父节点轮转
+     * 因此除根以外的内部节点至少有两个孩子，根要么是叶子，要么至少有两个孩子*/
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        void btree<Key, Value, KeyOfValue, Compare>::rebalance_internal(internal_node* p)
+        {
+            if (p == root_)
+            {
+                if (p->count == 0)
+                { /* 根只剩一个孩子，树变矮一层*/
+                    root_ = p->children[0];
+                    root_->parent = nullptr;
+                    internal_allocator::deallocate(p);
+                }
+                return;
+            }
+            if (p->count > 0 && p->count >= inner_slots / 4)
+                return;
+            internal_node* parent = parent_of(p);
+            const size_type ci = child_index(parent, p);
+            internal_node* l = ci > 0 ? static_cast<internal_node*>(parent->children[ci - 1]) : nullptr;
+            internal_node* r = ci < parent->count ? static_cast<internal_node*>(parent->children[ci + 1]) : nullptr;
+            /* 把 right 并入 left，sep 为两者之间的分隔键*/
+            auto merge = [](internal_node* left, const key_type& sep, internal_node* right)
+            {
+                const size_type off = left->count + 1;
+                key_allocator::construct(left->key(left->count), sep);
+                for (size_type j = 0; j < right->count; ++j)
+                {
+                    key_allocator::construct(left->key(off + j), leptstl::move(*right->key(j)));
+                    key_allocator::destroy(right->key(j));
+                }
+                for (size_type j = 0; j <= right->count; ++j)
+                {
+                    left->children[off + j] = right->children[j];
+                    right->children[j]->parent = left;
+                }
+                left->count += right->count + 1;
+                right->count = 0;
+            };
+            if (l != nullptr && l->count + p->count + 1 <= inner_slots)
+            {
+                merge(l, *parent->key(ci - 1), p);
+                remove_child(parent, p);
+                internal_allocator::deallocate(p);
+                return;
+            }
+            if (r != nullptr && p->count + r->count + 1 <= inner_slots)
+            {
+                merge(p, *parent->key(ci), r);
+                remove_child(parent, r);
+                internal_allocator::deallocate(r);
+                return;
+            }
+            if (p->count > 0)
+                return;
+            if (l != nullptr)
+            { /* 左兄弟的最后一个孩子移到最前面*/
+                p->children[1] = p->children[0];
+                p->children[0] = l->children[l->count];
+                p->children[0]->parent = p;
+                key_allocator::construct(p->key(0), leptstl::move(*parent->key(ci - 1)));
+                *parent->key(ci - 1) = leptstl::move(*l->key(l->count - 1));
+                key_allocator::destroy(l->key(l->count - 1));
+                --l->count;
+            }
+            else
+            { /* 右兄弟的第一个孩子移到最后面*/
+                p->children[1] = r->children[0];
+                p->children[1]->parent = p;
+                key_allocator::construct(p->key(0), leptstl::move(*parent->key(ci)));
+                *parent->key(ci) = leptstl::move(*r->key(0));
+                for (size_type j = 1; j < r->count; ++j)
+                    *r->key(j - 1) = leptstl::move(*r->key(j));
+                key_allocator::destroy(r->key(r->count - 1));
+                for (size_type j = 1; j <= r->count; ++j)
+                    r->children[j - 1] = r->children[j];
+                --r->count;
+            }
+            p->count = 1;
+        }
+
+    /* 源序列已经有序，逐个追加到最右叶子，分裂时左边保持满载*/
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        void btree<Key, Value, KeyOfValue, Compare>::copy_from(const btree& rhs)
+        {
+            for (auto it = rhs.begin(); it != rhs.end(); ++it)
+            {
+                if (root_ == nullptr)
+                    root_ = first_ = last_ = create_leaf();
+                insert_at(last_, last_->count, *it);
+            }
+        }
+
+    /* 重载比较操作符*/
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        bool operator==(const btree<Key, Value, KeyOfValue, Compare>& lhs,
+                        const btree<Key, Value, KeyOfValue, Compare>& rhs)
+        {
+            return lhs.size() == rhs.size() && leptstl::equal(lhs.begin(), lhs.end(), rhs.begin());
+        }
+
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        bool operator<(const btree<Key, Value, KeyOfValue, Compare>& lhs,
+                       const btree<Key, Value, KeyOfValue, Compare>& rhs)
+        {
+            return leptstl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+
+    template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+        void swap(btree<Key, Value, KeyOfValue, Compare>& lhs,
+                  btree<Key, Value, KeyOfValue, Compare>& rhs) noexcept
+        {
+            lhs.swap(rhs);
+        }
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_BTREE_H__ */
+
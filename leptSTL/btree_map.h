@@ -0,0 +1,367 @@
+/*************************************************************************
+	> File Name: btree_map.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Mon 19 Oct 2026 05:31:09 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_BTREE_MAP_H__
+#define LEPTSTL_BTREE_MAP_H__
+
+/*此头文件包含两个模板类btree_map和btree_multimap*/
+
+#include "btree.h"
+#include "exceptdef.h"
+
+namespace leptstl
+{
+    /* 模板类 btree_map，键值不允许重复*/
+    /* 参数一代表键值类型，参数二代表实值类型，参数三代表键值比较方式，缺省使用 leptstl::less*/
+    template <typename Key, typename T, typename Compare = leptstl::less<Key>>
+        class btree_map
+        {
+            public:
+                typedef Key                                         key_type;
+                typedef T                                           mapped_type;
+                typedef leptstl::pair<const Key, T>                 value_type;
+                typedef Compare                                     key_compare;
+
+                /* 比较两个元素的键值*/
+                class value_compare : public binary_function<value_type, value_type, bool>
+                {
+                    friend class btree_map<Key, T, Compare>;
+                    private:
+                        Compare comp;
+                        value_compare(Compare c) : comp(c) {}
+                    public:
+                        bool operator()(const value_type& lhs, const value_type& rhs) const
+                        { return comp(lhs.first, rhs.first); }
+                };
+
+            private:
+                /* 使用btree作为底层机制*/
+                typedef btree<Key, value_type, leptstl::selectfirst<value_type>, Compare> base_type;
+                base_type tree_;
+
+            public:
+                typedef typename base_type::allocator_type          allocator_type;
+                typedef typename base_type::size_type               size_type;
+                typedef typename base_type::difference_type         difference_type;
+                typedef typename base_type::pointer                 pointer;
+                typedef typename base_type::const_pointer           const_pointer;
+                typedef typename base_type::reference               reference;
+                typedef typename base_type::const_reference         const_reference;
+
+                typedef typename base_type::iterator                iterator;
+                typedef typename base_type::const_iterator          const_iterator;
+                typedef typename base_type::reverse_iterator        reverse_iterator;
+                typedef typename base_type::const_reverse_iterator  const_reverse_iterator;
+
+                allocator_type get_allocator() const { return tree_.get_allocator(); }
+
+            public:
+                /*构造 复制 移动函数*/
+                btree_map() = default;
+
+                explicit btree_map(const Compare& comp)
+                    :tree_(comp)
+                {
+                }
+
+                template <typename InputIterator>
+                    btree_map(InputIterator first, InputIterator last, const Compare& comp = Compare())
+                    :tree_(comp)
+                {
+                    tree_.insert_unique(first, last);
+                }
+
+                btree_map(std::initializer_list<value_type> ilist, const Compare& comp = Compare())
+                    :tree_(comp)
+                {
+                    tree_.insert_unique(ilist.begin(), ilist.end());
+                }
+
+                btree_map(const btree_map& rhs) = default;
+                btree_map(btree_map&& rhs) noexcept
+                    :tree_(leptstl::move(rhs.tree_))
+                {
+                }
+
+                btree_map& operator=(const btree_map& rhs) = default;
+                btree_map& operator=(btree_map&& rhs) noexcept
+                {
+                    tree_ = leptstl::move(rhs.tree_);
+                    return *this;
+                }
+
+                btree_map& operator=(std::initializer_list<value_type> ilist)
+                {
+                    tree_.clear();
+                    tree_.insert_unique(ilist.begin(), ilist.end());
+                    return *this;
+                }
+
+                ~btree_map() = default;
+
+                /*迭代器相关*/
+                iterator               begin()         noexcept { return tree_.begin(); }
+                const_iterator         begin()   const noexcept { return tree_.begin(); }
+                iterator               end()           noexcept { return tree_.end(); }
+                const_iterator         end()     const noexcept { return tree_.end(); }
+                reverse_iterator       rbegin()        noexcept { return tree_.rbegin(); }
+                const_reverse_iterator rbegin()  const noexcept { return tree_.rbegin(); }
+                reverse_iterator       rend()          noexcept { return tree_.rend(); }
+                const_reverse_iterator rend()    const noexcept { return tree_.rend(); }
+                const_iterator         cbegin()  const noexcept { return tree_.cbegin(); }
+                const_iterator         cend()    const noexcept { return tree_.cend(); }
+
+                /* 容量相关*/
+                bool      empty()    const noexcept { return tree_.empty(); }
+                size_type size()     const noexcept { return tree_.size(); }
+                size_type max_size() const noexcept { return tree_.max_size(); }
+                size_type height()   const noexcept { return tree_.height(); }
+
+                /* 访问元素相关*/
+
+                /* 若键值不存在，at 会抛出异常*/
+                mapped_type& at(const key_type& key)
+                {
+                    iterator it = tree_.find(key);
+                    THROW_OUT_OF_RANGE_IF(it == end(), "btree_map<Key, T> no such element exists");
+                    return it->second;
+                }
+                const mapped_type& at(const key_type& key) const
+                {
+                    const_iterator it = tree_.find(key);
+                    THROW_OUT_OF_RANGE_IF(it == end(), "btree_map<Key, T> no such element exists");
+                    return it->second;
+                }
+
+                /* 若键值不存在，插入一个实值为默认值的元素*/
+                mapped_type& operator[](const key_type& key)
+                {
+                    iterator it = tree_.lower_bound(key);
+                    if (it == end() || key_comp()(key, it->first))
+                        it = tree_.emplace_unique(key, T()).first;
+                    return it->second;
+                }
+                mapped_type& operator[](key_type&& key)
+                {
+                    iterator it = tree_.lower_bound(key);
+                    if (it == end() || key_comp()(key, it->first))
+                        it = tree_.emplace_unique(leptstl::move(key), T()).first;
+                    return it->second;
+                }
+
+                /* 修改容器操作*/
+                template <typename ...Args>
+                    pair<iterator, bool> emplace(Args&& ...args)
+                    { return tree_.emplace_unique(leptstl::forward<Args>(args)...); }
+
+                pair<iterator, bool> insert(const value_type& value)
+                { return tree_.insert_unique(value); }
+                pair<iterator, bool> insert(value_type&& value)
+                { return tree_.insert_unique(leptstl::move(value)); }
+
+                template <typename InputIterator>
+                    void insert(InputIterator first, InputIterator last)
+                    { tree_.insert_unique(first, last); }
+
+                iterator  erase(const_iterator it)
+                { return tree_.erase(it); }
+                iterator  erase(const_iterator first, const_iterator last)
+                { return tree_.erase(first, last); }
+                size_type erase(const key_type& key)
+                { return tree_.erase_unique(key); }
+
+                void      clear()
+                { tree_.clear(); }
+
+                void      swap(btree_map& other) noexcept
+                { tree_.swap(other.tree_); }
+
+                /* 查找相关*/
+                size_type      count(const key_type& key)       const { return tree_.count_unique(key); }
+
+                iterator       find(const key_type& key)              { return tree_.find(key); }
+                const_iterator find(const key_type& key)        const { return tree_.find(key); }
+
+                iterator       lower_bound(const key_type& key)       { return tree_.lower_bound(key); }
+                const_iterator lower_bound(const key_type& key) const { return tree_.lower_bound(key); }
+                iterator       upper_bound(const key_type& key)       { return tree_.upper_bound(key); }
+                const_iterator upper_bound(const key_type& key) const { return tree_.upper_bound(key); }
+
+                pair<iterator, iterator> equal_range(const key_type& key)
+                { return tree_.equal_range_unique(key); }
+                pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+                { return tree_.equal_range_unique(key); }
+
+                key_compare   key_comp()   const { return tree_.key_comp(); }
+                value_compare value_comp() const { return value_compare(tree_.key_comp()); }
+
+            public:
+                friend bool operator==(const btree_map& lhs, const btree_map& rhs) { return lhs.tree_ == rhs.tree_; }
+                friend bool operator!=(const btree_map& lhs, const btree_map& rhs) { return !(lhs.tree_ == rhs.tree_); }
+                friend bool operator< (const btree_map& lhs, const btree_map& rhs) { return lhs.tree_ < rhs.tree_; }
+                friend bool operator> (const btree_map& lhs, const btree_map& rhs) { return rhs.tree_ < lhs.tree_; }
+                friend bool operator<=(const btree_map& lhs, const btree_map& rhs) { return !(rhs.tree_ < lhs.tree_); }
+                friend bool operator>=(const btree_map& lhs, const btree_map& rhs) { return !(lhs.tree_ < rhs.tree_); }
+
+        };  /* btree_map */
+
+    template <typename Key, typename T, typename Compare>
+        void swap(btree_map<Key, T, Compare>& lhs, btree_map<Key, T, Compare>& rhs) noexcept
+        {
+            lhs.swap(rhs);
+        }
+
+    /*****************************************************************************************/
+
+    /* 模板类 btree_multimap，键值允许重复，相等的键值保持插入顺序*/
+    /* 参数一代表键值类型，参数二代表实值类型，参数三代表键值比较方式，缺省使用 leptstl::less*/
+    template <typename Key, typename T, typename Compare = leptstl::less<Key>>
+        class btree_multimap
+        {
+            public:
+                typedef Key                                         key_type;
+                typedef T                                           mapped_type;
+                typedef leptstl::pair<const Key, T>                 value_type;
+                typedef Compare                                     key_compare;
+
+            private:
+                /* 使用btree作为底层机制*/
+                typedef btree<Key, value_type, leptstl::selectfirst<value_type>, Compare> base_type;
+                base_type tree_;
+
+            public:
+                typedef typename base_type::allocator_type          allocator_type;
+                typedef typename base_type::size_type               size_type;
+                typedef typename base_type::difference_type         difference_type;
+                typedef typename base_type::pointer                 pointer;
+                typedef typename base_type::const_pointer           const_pointer;
+                typedef typename base_type::reference               reference;
+                typedef typename base_type::const_reference         const_reference;
+
+                typedef typename base_type::iterator                iterator;
+                typedef typename base_type::const_iterator          const_iterator;
+                typedef typename base_type::reverse_iterator        reverse_iterator;
+                typedef typename base_type::const_reverse_iterator  const_reverse_iterator;
+
+                allocator_type get_allocator() const { return tree_.get_allocator(); }
+
+            public:
+                /*构造 复制 移动函数*/
+                btree_multimap() = default;
+
+                explicit btree_multimap(const Compare& comp)
+                    :tree_(comp)
+                {
+                }
+
+                template <typename InputIterator>
+                    btree_multimap(InputIterator first, InputIterator last, const Compare& comp = Compare())
+                    :tree_(comp)
+                {
+                    tree_.insert_multi(first, last);
+                }
+
+                btree_multimap(std::initializer_list<value_type> ilist, const Compare& comp = Compare())
+                    :tree_(comp)
+                {
+                    tree_.insert_multi(ilist.begin(), ilist.end());
+                }
+
+                btree_multimap(const btree_multimap& rhs) = default;
+                btree_multimap(btree_multimap&& rhs) noexcept
+                    :tree_(leptstl::move(rhs.tree_))
+                {
+                }
+
+                btree_multimap& operator=(const btree_multimap& rhs) = default;
+                btree_multimap& operator=(btree_multimap&& rhs) noexcept
+                {
+                    tree_ = leptstl::move(rhs.tree_);
+                    return *this;
+                }
+
+                ~btree_multimap() = default;
+
+                /*迭代器相关*/
+                iterator               begin()         noexcept { return tree_.begin(); }
+                const_iterator         begin()   const noexcept { return tree_.begin(); }
+                iterator               end()           noexcept { return tree_.end(); }
+                const_iterator         end()     const noexcept { return tree_.end(); }
+                reverse_iterator       rbegin()        noexcept { return tree_.rbegin(); }
+                const_reverse_iterator rbegin()  const noexcept { return tree_.rbegin(); }
+                reverse_iterator       rend()          noexcept { return tree_.rend(); }
+                const_reverse_iterator rend()    const noexcept { return tree_.rend(); }
+                const_iterator         cbegin()  const noexcept { return tree_.cbegin(); }
+                const_iterator         cend()    const noexcept { return tree_.cend(); }
+
+                /* 容量相关*/
+                bool      empty()    const noexcept { return tree_.empty(); }
+                size_type size()     const noexcept { return tree_.size(); }
+                size_type max_size() const noexcept { return tree_.max_size(); }
+                size_type height()   const noexcept { return tree_.height(); }
+
+                /* 修改容器操作*/
+                template <typename ...Args>
+                    iterator emplace(Args&& ...args)
+                    { return tree_.emplace_multi(leptstl::forward<Args>(args)...); }
+
+                iterator insert(const value_type& value)
+                { return tree_.insert_multi(value); }
+                iterator insert(value_type&& value)
+                { return tree_.insert_multi(leptstl::move(value)); }
+
+                template <typename InputIterator>
+                    void insert(InputIterator first, InputIterator last)
+                    { tree_.insert_multi(first, last); }
+
+                iterator  erase(const_iterator it)
+                { return tree_.erase(it); }
+                iterator  erase(const_iterator first, const_iterator last)
+                { return tree_.erase(first, last); }
+                size_type erase(const key_type& key)
+                { return tree_.erase_multi(key); }
+
+                void      clear()
+                { tree_.clear(); }
+
+                void      swap(btree_multimap& other) noexcept
+                { tree_.swap(other.tree_); }
+
+                /* 查找相关*/
+                size_type      count(const key_type& key)       const { return tree_.count_multi(key); }
+
+                iterator       find(const key_type& key)              { return tree_.find(key); }
+                const_iterator find(const key_type& key)        const { return tree_.find(key); }
+
+                iterator       lower_bound(const key_type& key)       { return tree_.lower_bound(key); }
+                const_iterator lower_bound(const key_type& key) const { return tree_.lower_bound(key); }
+                iterator       upper_bound(const key_type& key)       { return tree_.upper_bound(key); }
+                const_iterator upper_bound(const key_type& key) const { return tree_.upper_bound(key); }
+
+                pair<iterator, iterator> equal_range(const key_type& key)
+                { return tree_.equal_range_multi(key); }
+                pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+                { return tree_.equal_range_multi(key); }
+
+                key_compare key_comp() const { return tree_.key_comp(); }
+
+            public:
+                friend bool operator==(const btree_multimap& lhs, const btree_multimap& rhs) { return lhs.tree_ == rhs.tree_; }
+                friend bool operator!=(const btree_multimap& lhs, const btree_multimap& rhs) { return !(lhs.tree_ == rhs.tree_); }
+
+        };  /* btree_multimap */
+
+    template <typename Key, typename T, typename Compare>
+        void swap(btree_multimap<Key, T, Compare>& lhs, btree_multimap<Key, T, Compare>& rhs) noexcept
+        {
+            lhs.swap(rhs);
+        }
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_BTREE_MAP_H__ */
+
@@ -0,0 +1,319 @@
+/*************************************************************************
+	> File Name: btree_set.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Mon 19 Oct 2026 05:02:44 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_BTREE_SET_H__
+#define LEPTSTL_BTREE_SET_H__
+
+/*此头文件包含两个模板类btree_set和btree_multiset*/
+
+#include "btree.h"
+
+namespace leptstl
+{
+    /* 模板类 btree_set，键值不允许重复*/
+    /* 参数一代表键值类型，参数二代表键值比较方式，缺省使用 leptstl::less*/
+    template <typename Key, typename Compare = leptstl::less<Key>>
+        class btree_set
+        {
+            private:
+                /* 使用btree作为底层机制*/
+                typedef btree<Key, Key, leptstl::identity<Key>, Compare> base_type;
+                base_type tree_;
+
+            public:
+                typedef typename base_type::allocator_type          allocator_type;
+                typedef typename base_type::key_type                key_type;
+                typedef typename base_type::value_type              value_type;
+                typedef typename base_type::key_compare             key_compare;
+                typedef typename base_type::key_compare             value_compare;
+
+                typedef typename base_type::size_type               size_type;
+                typedef typename base_type::difference_type         difference_type;
+                typedef typename base_type::pointer                 pointer;
+                typedef typename base_type::const_pointer           const_pointer;
+                typedef typename base_type::reference               reference;
+                typedef typename base_type::const_reference         const_reference;
+
+                typedef typename base_type::const_iterator          iterator;
+                typedef typename base_type::const_iterator          const_iterator;
+                typedef typename base_type::const_reverse_iterator  reverse_iterator;
+                typedef typename base_type::const_reverse_iterator  const_reverse_iterator;
+
+                allocator_type get_allocator() const { return tree_.get_allocator(); }
+
+            public:
+                /*构造 复制 移动函数*/
+                btree_set() = default;
+
+                explicit btree_set(const Compare& comp)
+                    :tree_(comp)
+                {
+                }
+
+                template <typename InputIterator>
+                    btree_set(InputIterator first, InputIterator last, const Compare& comp = Compare())
+                    :tree_(comp)
+                {
+                    tree_.insert_unique(first, last);
+                }
+
+                btree_set(std::initializer_list<value_type> ilist, const Compare& comp = Compare())
+                    :tree_(comp)
+                {
+                    tree_.insert_unique(ilist.begin(), ilist.end());
+                }
+
+                btree_set(const btree_set& rhs) = default;
+                btree_set(btree_set&& rhs) noexcept
+                    :tree_(leptstl::move(rhs.tree_))
+                {
+                }
+
+                btree_set& operator=(const btree_set& rhs) = default;
+                btree_set& operator=(btree_set&& rhs) noexcept
+                {
+                    tree_ = leptstl::move(rhs.tree_);
+                    return *this;
+                }
+
+                btree_set& operator=(std::initializer_list<value_type> ilist)
+                {
+                    tree_.clear();
+                    tree_.insert_unique(ilist.begin(), ilist.end());
+                    return *this;
+                }
+
+                ~btree_set() = default;
+
+                /*迭代器相关*/
+                iterator               begin()   const noexcept { return tree_.begin(); }
+                iterator               end()     const noexcept { return tree_.end(); }
+                reverse_iterator       rbegin()  const noexcept { return tree_.rbegin(); }
+                reverse_iterator       rend()    const noexcept { return tree_.rend(); }
+                const_iterator         cbegin()  const noexcept { return tree_.cbegin(); }
+                const_iterator         cend()    const noexcept { return tree_.cend(); }
+
+                /* 容量相关*/
+                bool      empty()    const noexcept { return tree_.empty(); }
+                size_type size()     const noexcept { return tree_.size(); }
+                size_type max_size() const noexcept { return tree_.max_size(); }
+                size_type height()   const noexcept { return tree_.height(); }
+
+                /* 修改容器操作*/
+                template <typename ...Args>
+                    pair<iterator, bool> emplace(Args&& ...args)
+                    {
+                        auto p = tree_.emplace_unique(leptstl::forward<Args>(args)...);
+                        return pair<iterator, bool>(p.first, p.second);
+                    }
+
+                pair<iterator, bool> insert(const value_type& value)
+                {
+                    auto p = tree_.insert_unique(value);
+                    return pair<iterator, bool>(p.first, p.second);
+                }
+                pair<iterator, bool> insert(value_type&& value)
+                {
+                    auto p = tree_.insert_unique(leptstl::move(value));
+                    return pair<iterator, bool>(p.first, p.second);
+                }
+
+                template <typename InputIterator>
+                    void insert(InputIterator first, InputIterator last)
+                    { tree_.insert_unique(first, last); }
+
+                iterator  erase(iterator it)
+                { return tree_.erase(it); }
+                iterator  erase(iterator first, iterator last)
+                { return tree_.erase(first, last); }
+                size_type erase(const key_type& key)
+                { return tree_.erase_unique(key); }
+
+                void      clear()
+                { tree_.clear(); }
+
+                void      swap(btree_set& other) noexcept
+                { tree_.swap(other.tree_); }
+
+                /* 查找相关*/
+                size_type      count(const key_type& key)       const { return tree_.count_unique(key); }
+                iterator       find(const key_type& key)        const { return tree_.find(key); }
+                iterator       lower_bound(const key_type& key) const { return tree_.lower_bound(key); }
+                iterator       upper_bound(const key_type& key) const { return tree_.upper_bound(key); }
+
+                pair<iterator, iterator> equal_range(const key_type& key) const
+                { return tree_.equal_range_unique(key); }
+
+                key_compare   key_comp()   const { return tree_.key_comp(); }
+                value_compare value_comp() const { return tree_.key_comp(); }
+
+            public:
+                friend bool operator==(const btree_set& lhs, const btree_set& rhs) { return lhs.tree_ == rhs.tree_; }
+                friend bool operator!=(const btree_set& lhs, const btree_set& rhs) { return !(lhs.tree_ == rhs.tree_); }
+                friend bool operator< (const btree_set& lhs, const btree_set& rhs) { return lhs.tree_ < rhs.tree_; }
+                friend bool operator> (const btree_set& lhs, const btree_set& rhs) { return rhs.tree_ < lhs.tree_; }
+                friend bool operator<=(const btree_set& lhs, const btree_set& rhs) { return !(rhs.tree_ < lhs.tree_); }
+                friend bool operator>=(const btree_set& lhs, const btree_set& rhs) { return !(lhs.tree_ < rhs.tree_); }
+
+        };  /* btree_set */
+
+    template <typename Key, typename Compare>
+        void swap(btree_set<Key, Compare>& lhs, btree_set<Key, Compare>& rhs) noexcept
+        {
+            lhs.swap(rhs);
+        }
+
+    /*****************************************************************************************/
+
+    /* 模板类 btree_multiset，键值允许重复，相等的键值保持插入顺序*/
+    /* 参数一代表键值类型，参数二代表键值比较方式，缺省使用 leptstl::less*/
+    template <typename Key, typename Compare = leptstl::less<Key>>
+        class btree_multiset
+        {
+            private:
+                /* 使用btree作为底层机制*/
+                typedef btree<Key, Key, leptstl::identity<Key>, Compare> base_type;
+                base_type tree_;
+
+            public:
+                typedef typename base_type::allocator_type          allocator_type;
+                typedef typename base_type::key_type                key_type;
+                typedef typename base_type::value_type              value_type;
+                typedef typename base_type::key_compare             key_compare;
+                typedef typename base_type::key_compare             value_compare;
+
+                typedef typename base_type::size_type               size_type;
+                typedef typename base_type::difference_type         difference_type;
+                typedef typename base_type::pointer                 pointer;
+                typedef typename base_type::const_pointer           const_pointer;
+                typedef typename base_type::reference               reference;
+                typedef typename base_type::const_reference         const_reference;
+
+                typedef typename base_type::const_iterator          iterator;
+                typedef typename base_type::const_iterator          const_iterator;
+                typedef typename base_type::const_reverse_iterator  reverse_iterator;
+                typedef typename base_type::const_reverse_iterator  const_reverse_iterator;
+
+                allocator_type get_allocator() const { return tree_.get_allocator(); }
+
+            public:
+                /*构造 复制 移动函数*/
+                btree_multiset() = default;
+
+                explicit btree_multiset(const Compare& comp)
+                    :tree_(comp)
+                {
+                }
+
+                template <typename InputIterator>
+                    btree_multiset(InputIterator first, InputIterator last, const Compare& comp = Compare())
+                    :tree_(comp)
+                {
+                    tree_.insert_multi(first, last);
+                }
+
+                btree_multiset(std::initializer_list<value_type> ilist, const Compare& comp = Compare())
+                    :tree_(comp)
+                {
+                    tree_.insert_multi(ilist.begin(), ilist.end());
+                }
+
+                btree_multiset(const btree_multiset& rhs) = default;
+                btree_multiset(btree_multiset&& rhs) noexcept
+                    :tree_(leptstl::move(rhs.tree_))
+                {
+                }
+
+                btree_multiset& operator=(const btree_multiset& rhs) = default;
+                btree_multiset& operator=(btree_multiset&& rhs) noexcept
+                {
+                    tree_ = leptstl::move(rhs.tree_);
+                    return *this;
+                }
+
+                btree_multiset& operator=(std::initializer_list<value_type> ilist)
+                {
+                    tree_.clear();
+                    tree_.insert_multi(ilist.begin(), ilist.end());
+                    return *this;
+                }
+
+                ~btree_multiset() = default;
+
+                /*迭代器相关*/
+                iterator               begin()   const noexcept { return tree_.begin(); }
+                iterator               end()     const noexcept { return tree_.end(); }
+                reverse_iterator       rbegin()  const noexcept { return tree_.rbegin(); }
+                reverse_iterator       rend()    const noexcept { return tree_.rend(); }
+                const_iterator         cbegin()  const noexcept { return tree_.cbegin(); }
+                const_iterator         cend()    const noexcept { return tree_.cend(); }
+
+                /* 容量相关*/
+                bool      empty()    const noexcept { return tree_.empty(); }
+                size_type size()     const noexcept { return tree_.size(); }
+                size_type max_size() const noexcept { return tree_.max_size(); }
+                size_type height()   const noexcept { return tree_.height(); }
+
+                /* 修改容器操作*/
+                template <typename ...Args>
+                    iterator emplace(Args&& ...args)
+                    { return tree_.emplace_multi(leptstl::forward<Args>(args)...); }
+
+                iterator insert(const value_type& value)
+                { return tree_.insert_multi(value); }
+                iterator insert(value_type&& value)
+                { return tree_.insert_multi(leptstl::move(value)); }
+
+                template <typename InputIterator>
+                    void insert(InputIterator first, InputIterator last)
+                    { tree_.insert_multi(first, last); }
+
+                iterator  erase(iterator it)
+                { return tree_.erase(it); }
+                iterator  erase(iterator first, iterator last)
+                { return tree_.erase(first, last); }
+                size_type erase(const key_type& key)
+                { return tree_.erase_multi(key); }
+
+                void      clear()
+                { tree_.clear(); }
+
+                void      swap(btree_multiset& other) noexcept
+                { tree_.swap(other.tree_); }
+
+                /* 查找相关*/
+                size_type      count(const key_type& key)       const { return tree_.count_multi(key); }
+                iterator       find(const key_type& key)        const { return tree_.find(key); }
+                iterator       lower_bound(const key_type& key) const { return tree_.lower_bound(key); }
+                iterator       upper_bound(const key_type& key) const { return tree_.upper_bound(key); }
+
+                pair<iterator, iterator> equal_range(const key_type& key) const
+                { return tree_.equal_range_multi(key); }
+
+                key_compare   key_comp()   const { return tree_.key_comp(); }
+                value_compare value_comp() const { return tree_.key_comp(); }
+
+            public:
+                friend bool operator==(const btree_multiset& lhs, const btree_multiset& rhs) { return lhs.tree_ == rhs.tree_; }
+                friend bool operator!=(const btree_multiset& lhs, const btree_multiset& rhs) { return !(lhs.tree_ == rhs.tree_); }
+                friend bool operator< (const btree_multiset& lhs, const btree_multiset& rhs) { return lhs.tree_ < rhs.tree_; }
+                friend bool operator> (const btree_multiset& lhs, const btree_multiset& rhs) { return rhs.tree_ < lhs.tree_; }
+                friend bool operator<=(const btree_multiset& lhs, const btree_multiset& rhs) { return !(rhs.tree_ < lhs.tree_); }
+                friend bool operator>=(const btree_multiset& lhs, const btree_multiset& rhs) { return !(lhs.tree_ < rhs.tree_); }
+
+        };  /* btree_multiset */
+
+    template <typename Key, typename Compare>
+        void swap(btree_multiset<Key, Compare>& lhs, btree_multiset<Key, Compare>& rhs) noexcept
+        {
+            lhs.swap(rhs);
+        }
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_BTREE_SET_H__ */
+
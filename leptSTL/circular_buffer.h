@@ -0,0 +1,448 @@
+/*************************************************************************
+	> File Name: circular_buffer.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Mon 19 Oct 2026 09:12:40 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_CIRCULAR_BUFFER_H__
+#define LEPTSTL_CIRCULAR_BUFFER_H__
+
+/* 此头文件包含一个模板类circular_buffer
+ * 固定容量的环形缓冲区，底层为一块连续的、大小为2的幂的空间，
+ * 下标通过 & mask 回绕，头尾的插入删除均为O(1)
+ * 满时可选择覆盖最旧的元素（overwrite模式）或抛出length_error
+ */
+
+#include <initializer_list>
+
+#include "iterator.h"
+#include "memory.h"
+#include "util.h"
+#include "exceptdef.h"
+
+namespace leptstl
+{
+    template<typename T>
+        class circular_buffer;
+
+    /* circular_buffer 迭代器设计：保存容器指针与相对头部的逻辑下标*/
+    template<typename T, typename Ref, typename Ptr>
+        struct circular_buffer_iterator : public iterator<random_access_iterator_tag, T>
+        {
+            typedef circular_buffer_iterator<T, T&, T*>             iterator;
+            typedef circular_buffer_iterator<T, const T&, const T*> const_iterator;
+            typedef circular_buffer_iterator                        self;
+
+            typedef T                           value_type;
+            typedef Ptr                         pointer;
+            typedef Ref                         reference;
+            typedef size_t                      size_type;
+            typedef ptrdiff_t                   difference_type;
+            typedef const circular_buffer<T>*   contain_ptr;
+
+            contain_ptr cb;     /* 保持与容器的连结*/
+            size_type   idx;    /* 相对于头部的逻辑位置*/
+
+            circular_buffer_iterator() noexcept
+                : cb(nullptr), idx(0) {}
+
+            circular_buffer_iterator(contain_ptr c, size_type i) noexcept
+                : cb(c), idx(i) {}
+
+            circular_buffer_iterator(const iterator& rhs) noexcept
+                : cb(rhs.cb), idx(rhs.idx) {}
+
+            self& operator=(const iterator& rhs) noexcept
+            {
+                cb = rhs.cb;
+                idx = rhs.idx;
+                return *this;
+            }
+
+            /* 重载运算符 */
+            reference operator*()  const
+            { return const_cast<reference>(cb->at_index(idx)); }
+            pointer   operator->() const { return &(operator*()); }
+
+            difference_type operator-(const self& x) const
+            { return static_cast<difference_type>(idx) - static_cast<difference_type>(x.idx); }
+
+            self& operator++()    { ++idx; return *this; }
+            self  operator++(int) { self tmp = *this; ++idx; return tmp; }
+            self& operator--()    { --idx; return *this; }
+            self  operator--(int) { self tmp = *this; --idx; return tmp; }
+
+            self& operator+=(difference_type n) { idx += n; return *this; }
+            self& operator-=(difference_type n) { idx -= n; return *this; }
+            self  operator+(difference_type n) const { self tmp = *this; return tmp += n; }
+            self  operator-(difference_type n) const { self tmp = *this; return tmp -= n; }
+
+            reference operator[](difference_type n) const { return *(*this + n); }
+
+            /* 重载比较操作符 */
+            bool operator==(const self& rhs) const { return idx == rhs.idx; }
+            bool operator!=(const self& rhs) const { return idx != rhs.idx; }
+            bool operator< (const self& rhs) const { return idx < rhs.idx; }
+            bool operator> (const self& rhs) const { return rhs < *this; }
+            bool operator<=(const self& rhs) const { return !(rhs < *this); }
+            bool operator>=(const self& rhs) const { return !(*this < rhs); }
+        };  /* circular_buffer_iterator */
+
+    /* 模板类circular_buffer */
+    template<typename T>
+        class circular_buffer
+        {
+            template<typename, typename, typename>
+                friend struct circular_buffer_iterator;
+
+            public:
+                /* circular_buffer 型别定义*/
+                typedef leptstl::allocator<T>                       allocator_type;
+                typedef leptstl::allocator<T>                       data_allocator;
+
+                typedef typename allocator_type::value_type         value_type;
+                typedef typename allocator_type::pointer            pointer;
+                typedef typename allocator_type::const_pointer      const_pointer;
+                typedef typename allocator_type::reference          reference;
+                typedef typename allocator_type::const_reference    const_reference;
+                typedef typename allocator_type::size_type          size_type;
+                typedef typename allocator_type::difference_type    difference_type;
+
+                typedef circular_buffer_iterator<T, T&, T*>             iterator;
+                typedef circular_buffer_iterator<T, const T&, const T*> const_iterator;
+                typedef leptstl::reverse_iterator<iterator>             reverse_iterator;
+                typedef leptstl::reverse_iterator<const_iterator>       const_reverse_iterator;
+
+                /* 一段连续的元素区间：起始地址与元素个数*/
+                typedef leptstl::pair<pointer, size_type>               array_range;
+                typedef leptstl::pair<const_pointer, size_type>         const_array_range;
+
+                allocator_type get_allocator() { return allocator_type(); }
+
+            private:
+                /* 用以下五个数据表现一个circular_buffer*/
+                pointer     buffer_;    /* 连续储存空间的起始位置*/
+                size_type   cap_;       /* 容量，为2的幂*/
+                size_type   head_;      /* 第一个元素的物理下标*/
+                size_type   size_;      /* 元素数量*/
+                bool        overwrite_; /* 满时是否覆盖最旧的元素*/
+
+            public:
+                /* 构造 复制 移动 析构*/
+                explicit circular_buffer(size_type capacity, bool overwrite = true)
+                    :buffer_(nullptr), cap_(0), head_(0), size_(0), overwrite_(overwrite)
+                { init_space(capacity); }
+
+                circular_buffer(std::initializer_list<value_type> ilist, bool overwrite = true)
+                    :buffer_(nullptr), cap_(0), head_(0), size_(0), overwrite_(overwrite)
+                {
+                    init_space(ilist.size());
+                    for (auto& v : ilist)
+                        emplace_back(v);
+                }
+
+                circular_buffer(const circular_buffer& rhs)
+                    :buffer_(nullptr), cap_(0), head_(0), size_(0), overwrite_(rhs.overwrite_)
+                {
+                    init_space(rhs.cap_);
+                    for (size_type i = 0; i < rhs.size_; ++i)
+                        emplace_back(rhs.at_index(i));
+                }
+
+                /* 被移动的对象不再持有空间，容量为0，下一次插入时重新申请最小的空间*/
+                circular_buffer(circular_buffer&& rhs) noexcept
+                    :buffer_(rhs.buffer_), cap_(rhs.cap_), head_(rhs.head_),
+                    size_(rhs.size_), overwrite_(rhs.overwrite_)
+                {
+                    rhs.buffer_ = nullptr;
+                    rhs.cap_ = 0;
+                    rhs.head_ = 0;
+                    rhs.size_ = 0;
+                }
+
+                circular_buffer& operator=(const circular_buffer& rhs)
+                {
+                    if (this != &rhs)
+                    {
+                        circular_buffer tmp(rhs);
+                        swap(tmp);
+                    }
+                    return *this;
+                }
+
+                circular_buffer& operator=(circular_buffer&& rhs) noexcept
+                {
+                    circular_buffer tmp(leptstl::move(rhs));
+                    swap(tmp);
+                    return *this;
+                }
+
+                ~circular_buffer()
+                {
+                    clear();
+                    data_allocator::deallocate(buffer_, cap_);
+                    buffer_ = nullptr;
+                }
+
+            public:
+                /* 迭代器相关操作*/
+                iterator               begin()         noexcept
+                { return iterator(this, 0); }
+                const_iterator         begin()   const noexcept
+                { return const_iterator(this, 0); }
+                iterator               end()           noexcept
+                { return iterator(this, size_); }
+                const_iterator         end()     const noexcept
+                { return const_iterator(this, size_); }
+
+                reverse_iterator       rbegin()        noexcept
+                { return reverse_iterator(end()); }
+                const_reverse_iterator rbegin()  const noexcept
+                { return const_reverse_iterator(end()); }
+                reverse_iterator       rend()          noexcept
+                { return reverse_iterator(begin()); }
+                const_reverse_iterator rend()    const noexcept
+                { return const_reverse_iterator(begin()); }
+
+                const_iterator         cbegin()  const noexcept
+                { return begin(); }
+                const_iterator         cend()    const noexcept
+                { return end(); }
+
+                /* 容量相关操作*/
+                bool      empty()    const noexcept { return size_ == 0; }
+                bool      full()     const noexcept { return size_ == cap_; }
+                size_type size()     const noexcept { return size_; }
+                size_type capacity() const noexcept { return cap_; }
+                size_type max_size() const noexcept { return static_cast<size_type>(-1) / sizeof(T); }
+
+                bool      overwrite() const noexcept { return overwrite_; }
+                void      overwrite(bool ow) noexcept { overwrite_ = ow; }
+
+                /* 访问元素相关操作*/
+                reference       operator[](size_type n)
+                {
+                    LEPTSTL_DEBUG(n < size_);
+                    return buffer_[(head_ + n) & (cap_ - 1)];
+                }
+                const_reference operator[](size_type n) const
+                {
+                    LEPTSTL_DEBUG(n < size_);
+                    return buffer_[(head_ + n) & (cap_ - 1)];
+                }
+                reference       at(size_type n)
+                {
+                    THROW_OUT_OF_RANGE_IF(!(n < size_), "circular_buffer<T>::at() subscript out of range");
+                    return (*this)[n];
+                }
+                const_reference at(size_type n) const
+                {
+                    THROW_OUT_OF_RANGE_IF(!(n < size_), "circular_buffer<T>::at() subscript out of range");
+                    return (*this)[n];
+                }
+
+                reference       front()
+                {
+                    LEPTSTL_DEBUG(!empty());
+                    return buffer_[head_];
+                }
+                const_reference front() const
+                {
+                    LEPTSTL_DEBUG(!empty());
+                    return buffer_[head_];
+                }
+                reference       back()
+                {
+                    LEPTSTL_DEBUG(!empty());
+                    return buffer_[(head_ + size_ - 1) & (cap_ - 1)];
+                }
+                const_reference back() const
+                {
+                    LEPTSTL_DEBUG(!empty());
+                    return buffer_[(head_ + size_ - 1) & (cap_ - 1)];
+                }
+
+                /* 元素按逻辑顺序分布在至多两段连续空间上，可直接整段 memcpy*/
+                array_range       array_one() noexcept
+                { return array_range(buffer_ + head_, first_len()); }
+                const_array_range array_one() const noexcept
+                { return const_array_range(buffer_ + head_, first_len()); }
+                array_range       array_two() noexcept
+                { return array_range(buffer_, size_ - first_len()); }
+                const_array_range array_two() const noexcept
+                { return const_array_range(buffer_, size_ - first_len()); }
+
+                /* 修改容器相关操作*/
+
+                /* emplace_front / emplace_back */
+                template <typename ...Args>
+                    void emplace_front(Args&& ...args);
+                template <typename ...Args>
+                    void emplace_back(Args&& ...args);
+
+                /* push_front / push_back */
+                void push_front(const value_type& value)  { emplace_front(value); }
+                void push_front(value_type&& value)       { emplace_front(leptstl::move(value)); }
+                void push_back(const value_type& value)   { emplace_back(value); }
+                void push_back(value_type&& value)        { emplace_back(leptstl::move(value)); }
+
+                /* pop_front / pop_back */
+                void pop_front();
+                void pop_back();
+
+                /* 批量移出最多n个元素到out并从头部弹出，返回实际移出的数量
+                 * out 指向已构造的对象，元素按移动赋值写入*/
+                size_type pop_front_n(pointer out, size_type n);
+
+                void clear() noexcept;
+                void swap(circular_buffer& rhs) noexcept;
+
+            private:
+                /* helper function */
+                void        init_space(size_type n);
+                size_type   first_len() const noexcept
+                { return leptstl::min(size_, cap_ - head_); }
+                const_reference at_index(size_type n) const noexcept
+                { return buffer_[(head_ + n) & (cap_ - 1)]; }
+
+        };  /* circular_buffer */
+
+    /* 在头部就地构造元素，满时覆盖尾部元素*/
+    template <typename T>
+        template <typename ...Args>
+        void circular_buffer<T>::emplace_front(Args&& ...args)
+        {
+            if (cap_ == 0)
+                init_space(1);
+            const size_type pos = (head_ - 1) & (cap_ - 1);
+            if (full())
+            {
+                THROW_LENGTH_ERROR_IF(!overwrite_, "circular_buffer<T> is full");
+                /* 先构造临时对象：args 可能引用将被覆盖的尾部元素；尾部正是新的头部位置*/
+                value_type tmp(leptstl::forward<Args>(args)...);
+                buffer_[pos] = leptstl::move(tmp);
+                head_ = pos;
+                return;
+            }
+            data_allocator::construct(buffer_ + pos, leptstl::forward<Args>(args)...);
+            head_ = pos;
+            ++size_;
+        }
+
+    /* 在尾部就地构造元素，满时覆盖头部元素*/
+    template <typename T>
+        template <typename ...Args>
+        void circular_buffer<T>::emplace_back(Args&& ...args)
+        {
+            if (cap_ == 0)
+                init_space(1);
+            if (full())
+            {
+                THROW_LENGTH_ERROR_IF(!overwrite_, "circular_buffer<T> is full");
+                /* 先构造临时对象：args 可能引用将被覆盖的头部元素；新元素放在原头部位置*/
+                value_type tmp(leptstl::forward<Args>(args)...);
+                buffer_[head_] = leptstl::move(tmp);
+                head_ = (head_ + 1) & (cap_ - 1);
+                return;
+            }
+            data_allocator::construct(buffer_ + ((head_ + size_) & (cap_ - 1)),
+                                      leptstl::forward<Args>(args)...);
+            ++size_;
+        }
+
+    /* 弹出头部元素*/
+    template <typename T>
+        void circular_buffer<T>::pop_front()
+        {
+            LEPTSTL_DEBUG(!empty());
+            data_allocator::destroy(buffer_ + head_);
+            head_ = (head_ + 1) & (cap_ - 1);
+            --size_;
+        }
+
+    /* 弹出尾部元素*/
+    template <typename T>
+        void circular_buffer<T>::pop_back()
+        {
+            LEPTSTL_DEBUG(!empty());
+            data_allocator::destroy(buffer_ + ((head_ + size_ - 1) & (cap_ - 1)));
+            --size_;
+        }
+
+    /* 批量弹出：对两段连续空间各做一次拷贝*/
+    template <typename T>
+        typename circular_buffer<T>::size_type
+        circular_buffer<T>::pop_front_n(pointer out, size_type n)
+        {
+            n = leptstl::min(n, size_);
+            const size_type n1 = leptstl::min(n, first_len());
+            out = leptstl::move(buffer_ + head_, buffer_ + head_ + n1, out);
+            leptstl::move(buffer_, buffer_ + (n - n1), out);
+            data_allocator::destroy(buffer_ + head_, buffer_ + head_ + n1);
+            data_allocator::destroy(buffer_, buffer_ + (n - n1));
+            head_ = (head_ + n) & (cap_ - 1);
+            size_ -= n;
+            return n;
+        }
+
+    /* 清空元素，保留空间*/
+    template <typename T>
+        void circular_buffer<T>::clear() noexcept
+        {
+            const size_type n1 = first_len();
+            data_allocator::destroy(buffer_ + head_, buffer_ + head_ + n1);
+            data_allocator::destroy(buffer_, buffer_ + (size_ - n1));
+            head_ = 0;
+            size_ = 0;
+        }
+
+    /* 与另一个circular_buffer交换*/
+    template <typename T>
+        void circular_buffer<T>::swap(circular_buffer& rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                leptstl::swap(buffer_, rhs.buffer_);
+                leptstl::swap(cap_, rhs.cap_);
+                leptstl::swap(head_, rhs.head_);
+                leptstl::swap(size_, rhs.size_);
+                leptstl::swap(overwrite_, rhs.overwrite_);
+            }
+        }
+
+    /* init_space 申请不小于n的2的幂大小的空间*/
+    template <typename T>
+        void circular_buffer<T>::init_space(size_type n)
+        {
+            size_type cap = 1;
+            while (cap < n)
+                cap <<= 1;
+            buffer_ = data_allocator::allocate(cap);
+            cap_ = cap;
+        }
+
+    /* 重载比较操作符*/
+    template <typename T>
+        bool operator==(const circular_buffer<T>& lhs, const circular_buffer<T>& rhs)
+        {
+            return lhs.size() == rhs.size() && leptstl::equal(lhs.begin(), lhs.end(), rhs.begin());
+        }
+
+    template <typename T>
+        bool operator!=(const circular_buffer<T>& lhs, const circular_buffer<T>& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+    /* 重载leptstl::swap*/
+    template <typename T>
+        void swap(circular_buffer<T>& lhs, circular_buffer<T>& rhs) noexcept
+        {
+            lhs.swap(rhs);
+        }
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_CIRCULAR_BUFFER_H__ */
+
@@ -0,0 +1,258 @@
+/*************************************************************************
+	> File Name: concurrent_unordered_set.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Mon 19 Oct 2026 02:20:51 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_CONCURRENT_UNORDERED_SET_H__
+#define LEPTSTL_CONCURRENT_UNORDERED_SET_H__
+
+/* 此头文件包含一个模板类concurrent_unordered_set
+ * 键值按哈希值的高位分散到 N 个 hashtable 分片上，每个分片有独立的读写锁，
+ * 不同分片上的操作互不阻塞，同一分片上的读操作可以并发
+ * hashtable 用哈希值对桶数取模（低位），分片用高位，两者互不干扰
+ */
+
+#include <atomic>
+#include <thread>
+
+#include "hashtable.h"
+#include "lockfree_queue.h"
+
+namespace leptstl
+{
+    /* 读写自旋锁：state_ > 0 表示读者数量，-1 表示有写者*/
+    class rw_spinlock
+    {
+        public:
+            rw_spinlock() noexcept : state_(0) {}
+            rw_spinlock(const rw_spinlock&) = delete;
+            rw_spinlock& operator=(const rw_spinlock&) = delete;
+
+            void lock_shared() noexcept
+            {
+                for (;;)
+                {
+                    int s = state_.load(std::memory_order_relaxed);
+                    if (s >= 0 && state_.compare_exchange_weak(s, s + 1, std::memory_order_acquire))
+                        return;
+                    std::this_thread::yield();
+                }
+            }
+            void unlock_shared() noexcept
+            { state_.fetch_sub(1, std::memory_order_release); }
+
+            void lock() noexcept
+            {
+                for (;;)
+                {
+                    int s = 0;
+                    if (state_.compare_exchange_weak(s, -1, std::memory_order_acquire))
+                        return;
+                    std::this_thread::yield();
+                }
+            }
+            void unlock() noexcept
+            { state_.store(0, std::memory_order_release); }
+
+        private:
+            std::atomic<int> state_;
+    };
+
+    /* RAII 辅助类*/
+    template <typename Lock>
+        struct shared_lock_guard
+        {
+            Lock& lk;
+            explicit shared_lock_guard(Lock& l) : lk(l) { lk.lock_shared(); }
+            ~shared_lock_guard() { lk.unlock_shared(); }
+            shared_lock_guard(const shared_lock_guard&) = delete;
+            shared_lock_guard& operator=(const shared_lock_guard&) = delete;
+        };
+
+    template <typename Lock>
+        struct unique_lock_guard
+        {
+            Lock& lk;
+            explicit unique_lock_guard(Lock& l) : lk(l) { lk.lock(); }
+            ~unique_lock_guard() { lk.unlock(); }
+            unique_lock_guard(const unique_lock_guard&) = delete;
+            unique_lock_guard& operator=(const unique_lock_guard&) = delete;
+        };
+
+    /* 模板类 concurrent_unordered_set，键值不允许重复*/
+    /* 参数一代表键值类型，参数二代表哈希函数，参数三代表键值比较方式*/
+    template <typename Key, typename Hash = leptstl::hash<Key>, typename KeyEqual = leptstl::equal_to<Key>>
+        class concurrent_unordered_set
+        {
+            public:
+                typedef hashtable<Key, Hash, KeyEqual>          shard_type;
+                typedef typename shard_type::key_type           key_type;
+                typedef typename shard_type::value_type         value_type;
+                typedef typename shard_type::hasher             hasher;
+                typedef typename shard_type::key_equal          key_equal;
+                typedef typename shard_type::size_type          size_type;
+
+            private:
+                /* 分片：锁与 hashtable 放在一起，并填充到独占缓存行*/
+                struct shard
+                {
+                    rw_spinlock lock;
+                    shard_type  ht;
+                    char        pad[LEPTSTL_CACHE_LINE_SIZE];
+
+                    shard(size_type bucket_count, const Hash& hash, const KeyEqual& equal)
+                        :lock(), ht(bucket_count, hash, equal) {}
+                };
+                typedef leptstl::allocator<shard>               shard_allocator;
+
+                shard*      shards_;
+                size_type   shard_count_;   /* 2的幂*/
+                unsigned    bits_;          /* log2(shard_count_)，即取哈希值高位的位数*/
+                hasher      hash_;
+
+            public:
+                /* 默认分片数为64，bucket_count 为总桶数，平均分到各个分片*/
+                explicit concurrent_unordered_set(size_type shard_count = 64,
+                                                  size_type bucket_count = 100,
+                                                  const Hash& hash = Hash(),
+                                                  const KeyEqual& equal = KeyEqual())
+                    :shards_(nullptr), shard_count_(lfq_round_up_pow2(shard_count == 0 ? 1 : shard_count)),
+                    bits_(0), hash_(hash)
+                {
+                    while ((static_cast<size_type>(1) << bits_) < shard_count_)
+                        ++bits_;
+                    shards_ = shard_allocator::allocate(shard_count_);
+                    size_type i = 0;
+                    try
+                    {
+                        for (; i < shard_count_; ++i)
+                            ::new (static_cast<void*>(shards_ + i))
+                                shard(bucket_count / shard_count_ + 1, hash, equal);
+                    }
+                    catch (...)
+                    {
+                        leptstl::destroy(shards_, shards_ + i);
+                        shard_allocator::deallocate(shards_, shard_count_);
+                        throw;
+                    }
+                }
+
+                concurrent_unordered_set(const concurrent_unordered_set&) = delete;
+                concurrent_unordered_set& operator=(const concurrent_unordered_set&) = delete;
+
+                ~concurrent_unordered_set()
+                {
+                    leptstl::destroy(shards_, shards_ + shard_count_);
+                    shard_allocator::deallocate(shards_, shard_count_);
+                }
+
+                /* 修改容器相关操作，返回是否成功插入 / 删除的数量*/
+                bool insert(const value_type& value)
+                {
+                    shard& s = shard_for(value);
+                    unique_lock_guard<rw_spinlock> g(s.lock);
+                    return s.ht.insert_unique(value).second;
+                }
+                bool insert(value_type&& value)
+                {
+                    shard& s = shard_for(value);
+                    unique_lock_guard<rw_spinlock> g(s.lock);
+                    return s.ht.emplace_unique(leptstl::move(value)).second;
+                }
+                template <typename ...Args>
+                    bool emplace(Args&& ...args)
+                    { return insert(value_type(leptstl::forward<Args>(args)...)); }
+
+                size_type erase(const key_type& key)
+                {
+                    shard& s = shard_for(key);
+                    unique_lock_guard<rw_spinlock> g(s.lock);
+                    return s.ht.erase_unique(key);
+                }
+
+                void clear()
+                {
+                    for (size_type i = 0; i < shard_count_; ++i)
+                    {
+                        unique_lock_guard<rw_spinlock> g(shards_[i].lock);
+                        shards_[i].ht.clear();
+                    }
+                }
+
+                /* 查找相关操作*/
+                bool contains(const key_type& key) const
+                {
+                    shard& s = shard_for(key);
+                    shared_lock_guard<rw_spinlock> g(s.lock);
+                    const shard_type& ht = s.ht;
+                    return ht.find(key) != ht.end();
+                }
+                size_type count(const key_type& key) const
+                { return contains(key) ? 1 : 0; }
+
+                /* 容量相关操作：并发修改时只是一个快照*/
+                size_type size() const
+                {
+                    size_type n = 0;
+                    for (size_type i = 0; i < shard_count_; ++i)
+                    {
+                        shared_lock_guard<rw_spinlock> g(shards_[i].lock);
+                        n += shards_[i].ht.size();
+                    }
+                    return n;
+                }
+                bool      empty()       const { return size() == 0; }
+                size_type shard_count() const noexcept { return shard_count_; }
+
+                void reserve(size_type count)
+                {
+                    for (size_type i = 0; i < shard_count_; ++i)
+                    {
+                        unique_lock_guard<rw_spinlock> g(shards_[i].lock);
+                        shards_[i].ht.reserve(count / shard_count_ + 1);
+                    }
+                }
+
+                /* 依次在每个分片的读锁下调用 f(shard_index, const hashtable&)*/
+                template <typename Func>
+                    void for_each_shard(Func f) const
+                    {
+                        for (size_type i = 0; i < shard_count_; ++i)
+                        {
+                            shared_lock_guard<rw_spinlock> g(shards_[i].lock);
+                            const shard_type& ht = shards_[i].ht;
+                            f(i, ht);
+                        }
+                    }
+
+                /* 依次在每个分片的读锁下对每个元素调用 f(const value_type&)*/
+                template <typename Func>
+                    void for_each(Func f) const
+                    {
+                        for_each_shard([&f](size_type, const shard_type& ht) {
+                            for (auto it = ht.begin(); it != ht.end(); ++it)
+                                f(*it);
+                        });
+                    }
+
+                hasher hash_fcn() const { return hash_; }
+
+            private:
+                /* 整型的 leptstl::hash 是恒等映射，高位几乎全为0，先乘以黄金分割常数把低位扩散到高位*/
+                size_type shard_index(const key_type& key) const
+                {
+                    const unsigned long long h =
+                        static_cast<unsigned long long>(hash_(key)) * 0x9E3779B97F4A7C15ull;
+                    return bits_ == 0 ? 0 : static_cast<size_type>(h >> (64 - bits_));
+                }
+                shard& shard_for(const key_type& key) const
+                { return shards_[shard_index(key)]; }
+
+        };  /* concurrent_unordered_set */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_CONCURRENT_UNORDERED_SET_H__ */
+
@@ -53,6 +53,9 @@ namespace leptstl
             }
         }
 
+    template<typename T>
+        void destroy(T* pointer);
+
     template<typename ForwardIter>
         void destroy_cat(ForwardIter, ForwardIter, std::true_type){}
 
@@ -0,0 +1,314 @@
+/*************************************************************************
+	> File Name: cuckoo_filter.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 06:38:27 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_CUCKOO_FILTER_H__
+#define LEPTSTL_CUCKOO_FILTER_H__
+
+/* 此头文件包含一个模板类 cuckoo_filter，布谷鸟过滤器（Fan 等，2014），与 bloom_filter 一样用作概率性预过滤，
+ * 另外支持删除：
+ *   每个键保存一个 16 位的指纹，放在两个候选桶之一，桶 i1 由哈希的低位决定，i2 = i1 ^ hash(指纹)，
+ *   所以只凭指纹与所在的桶就能算出另一个候选桶；两个桶都满时随机踢出一个指纹搬到它的另一个桶，最多 max_kicks 次
+ *   每个桶 4 个指纹，正好是一个 64 位字，查找一个桶用一次按 16 位分段的比较（SWAR），不需要循环
+ * 查找最多访问两个桶；误报率约为 8 / 65536，装载率可达 95%
+ * 只能删除确实插入过的键（删除不存在的键可能删掉别的键的同一指纹）；同一个键可以插入多次，需要删除同样多次
+ * 插入失败（表满）时返回 false，被踢出的最后一个指纹保存在 victim_ 中，不会丢失已经插入的键*/
+
+#include <cstdint>
+
+#include "bit_iterator.h"
+#include "functional.h"
+#include "vector.h"
+
+namespace leptstl
+{
+    /* 模板类 cuckoo_filter*/
+    /* 参数一代表键值类型，参数二代表哈希函数，缺省使用 leptstl::hash*/
+    template <typename Key, typename Hash = leptstl::hash<Key>>
+        class cuckoo_filter
+        {
+            public:
+                typedef Key                 key_type;
+                typedef Hash                hasher;
+                typedef size_t              size_type;
+                typedef lept_true_type      supports_erase;   /* 供 filtered_unordered_set 判断能否删除*/
+
+                static constexpr size_type slots_per_bucket = 4;
+                static constexpr size_type max_kicks = 500;
+
+            private:
+                /* 一个桶 4 个 16 位指纹，指纹 0 表示空位*/
+                typedef uint64_t bucket_type;
+
+                static constexpr uint64_t lanes_low  = 0x0001000100010001ull;
+                static constexpr uint64_t lanes_high = 0x8000800080008000ull;
+
+                struct victim_type
+                {
+                    bool      used;
+                    size_type index;
+                    uint16_t  fingerprint;
+                };
+
+                leptstl::vector<bucket_type> buckets_;
+                size_type                    mask_;     /* 桶数减一，桶数是 2 的幂*/
+                size_type                    size_;
+                victim_type                  victim_;
+                uint64_t                     rng_;      /* 选择踢出位置的 xorshift 状态*/
+                hasher                       hash_;
+
+            public:
+                /* capacity 是预计的键数，桶数取不小于 capacity / (4 * 0.95) 的 2 的幂*/
+                explicit cuckoo_filter(size_type capacity = 1024, const Hash& hash = Hash())
+                    :buckets_(), mask_(buckets_for(capacity) - 1), size_(0), rng_(0x9e3779b97f4a7c15ull), hash_(hash)
+                {
+                    buckets_.assign(mask_ + 1, bucket_type(0));
+                    victim_.used = false;
+                    victim_.index = 0;
+                    victim_.fingerprint = 0;
+                }
+
+                cuckoo_filter(const cuckoo_filter& rhs) = default;
+
+                /* 被移走的过滤器换成一个桶的空过滤器，之后仍可插入、查询与删除*/
+                cuckoo_filter(cuckoo_filter&& rhs)
+                    :cuckoo_filter(0, rhs.hash_)
+                {
+                    swap(rhs);
+                }
+
+                cuckoo_filter& operator=(const cuckoo_filter& rhs) = default;
+                cuckoo_filter& operator=(cuckoo_filter&& rhs)
+                {
+                    cuckoo_filter tmp(leptstl::move(rhs));
+                    swap(tmp);
+                    return *this;
+                }
+
+                /* 插入成功返回 true；表满时返回 false，此后应当换用更大的过滤器重建*/
+                bool insert(const key_type& key)
+                {
+                    if (victim_.used)
+                        return false;
+                    const uint64_t h = key_hash(key);
+                    const uint16_t fp = fingerprint(h);
+                    const size_type i1 = static_cast<size_type>(h) & mask_;
+                    const size_type i2 = alt_index(i1, fp);
+                    if (put(i1, fp) || put(i2, fp))
+                    {
+                        ++size_;
+                        return true;
+                    }
+                    /* 两个桶都满：从其中一个开始，随机踢出一个指纹搬到它的另一个桶*/
+                    size_type index = next_random() & 1 ? i1 : i2;
+                    uint16_t cur = fp;
+                    for (size_type kick = 0; kick < max_kicks; ++kick)
+                    {
+                        const size_type slot = static_cast<size_type>(next_random() % slots_per_bucket);
+                        const uint16_t out = get(buckets_[index], slot);
+                        set(buckets_[index], slot, cur);
+                        cur = out;
+                        index = alt_index(index, cur);
+                        if (put(index, cur))
+                        {
+                            ++size_;
+                            return true;
+                        }
+                    }
+                    /* 最后被踢出的指纹放进 victim_，新键已经在表中，这次插入仍然算成功*/
+                    victim_.used = true;
+                    victim_.index = index;
+                    victim_.fingerprint = cur;
+                    ++size_;
+                    return true;
+                }
+
+                /* false 表示一定不存在，true 表示可能存在*/
+                bool may_contain(const key_type& key) const
+                {
+                    const uint64_t h = key_hash(key);
+                    const uint16_t fp = fingerprint(h);
+                    const size_type i1 = static_cast<size_type>(h) & mask_;
+                    const size_type i2 = alt_index(i1, fp);
+                    return has(buckets_[i1], fp) || has(buckets_[i2], fp)
+                        || (victim_.used && victim_.fingerprint == fp && (victim_.index == i1 || victim_.index == i2));
+                }
+
+                /* 删除一个之前插入过的键，找到并删除了一个指纹时返回 true*/
+                bool erase(const key_type& key)
+                {
+                    const uint64_t h = key_hash(key);
+                    const uint16_t fp = fingerprint(h);
+                    const size_type i1 = static_cast<size_type>(h) & mask_;
+                    const size_type i2 = alt_index(i1, fp);
+                    if (victim_.used && victim_.fingerprint == fp && (victim_.index == i1 || victim_.index == i2))
+                    {
+                        victim_.used = false;
+                        --size_;
+                        return true;
+                    }
+                    if (remove(i1, fp) || remove(i2, fp))
+                    {
+                        --size_;
+                        /* 腾出了位置，把 victim_ 放回表中*/
+                        if (victim_.used)
+                        {
+                            victim_.used = false;
+                            --size_;
+                            insert_fingerprint(victim_.index, victim_.fingerprint);
+                        }
+                        return true;
+                    }
+                    return false;
+                }
+
+                void clear() noexcept
+                {
+                    for (size_type i = 0; i < buckets_.size(); ++i)
+                        buckets_[i] = 0;
+                    size_ = 0;
+                    victim_.used = false;
+                }
+
+                size_type size()         const noexcept { return size_; }
+                size_type bucket_count() const noexcept { return mask_ + 1; }
+                size_type capacity()     const noexcept { return (mask_ + 1) * slots_per_bucket; }
+                double    load_factor()  const noexcept { return static_cast<double>(size_) / capacity(); }
+                size_type memory_bytes() const noexcept { return buckets_.size() * sizeof(bucket_type); }
+                hasher    hash_function() const { return hash_; }
+
+                void swap(cuckoo_filter& rhs) noexcept
+                {
+                    buckets_.swap(rhs.buckets_);
+                    leptstl::swap(mask_, rhs.mask_);
+                    leptstl::swap(size_, rhs.size_);
+                    leptstl::swap(victim_, rhs.victim_);
+                    leptstl::swap(rng_, rhs.rng_);
+                    leptstl::swap(hash_, rhs.hash_);
+                }
+
+            private:
+                static size_type buckets_for(size_type capacity)
+                {
+                    const size_type need = static_cast<size_type>(capacity / (slots_per_bucket * 0.95)) + 1;
+                    size_type n = 1;
+                    while (n < need)
+                        n <<= 1;
+                    return n;
+                }
+
+                uint64_t key_hash(const key_type& key) const
+                {
+                    return hash_mix(static_cast<uint64_t>(hash_(key)));
+                }
+
+                /* 指纹取哈希的最高 16 位，与选桶用的低位无关；0 留作空位标记*/
+                static uint16_t fingerprint(uint64_t h) noexcept
+                {
+                    const uint16_t fp = static_cast<uint16_t>(h >> 48);
+                    return fp == 0 ? 1 : fp;
+                }
+
+                /* 另一个候选桶，对同一指纹是对合：alt_index(alt_index(i, fp), fp) == i*/
+                size_type alt_index(size_type index, uint16_t fp) const noexcept
+                {
+                    return (index ^ static_cast<size_type>(hash_mix(fp))) & mask_;
+                }
+
+                uint64_t next_random() noexcept
+                {
+                    rng_ ^= rng_ << 13;
+                    rng_ ^= rng_ >> 7;
+                    rng_ ^= rng_ << 17;
+                    return rng_;
+                }
+
+                static uint16_t get(bucket_type b, size_type slot) noexcept
+                {
+                    return static_cast<uint16_t>(b >> (16 * slot));
+                }
+                static void set(bucket_type& b, size_type slot, uint16_t fp) noexcept
+                {
+                    b = (b & ~(bucket_type(0xffff) << (16 * slot))) | (bucket_type(fp) << (16 * slot));
+                }
+
+                /* 各 16 位段中为 0 的段，最高位置 1；最低的一个标记总是准确的，更高的段可能因借位误标*/
+                static uint64_t zero_lanes(bucket_type b) noexcept
+                {
+                    return (b - lanes_low) & ~b & lanes_high;
+                }
+                static bool has(bucket_type b, uint16_t fp) noexcept
+                {
+                    return zero_lanes(b ^ (lanes_low * fp)) != 0;
+                }
+
+                /* 放进桶中的空位，没有空位时返回 false*/
+                bool put(size_type index, uint16_t fp) noexcept
+                {
+                    const uint64_t empty = zero_lanes(buckets_[index]);
+                    if (empty == 0)
+                        return false;
+                    set(buckets_[index], bit_ctz(empty) / 16, fp);
+                    return true;
+                }
+
+                bool remove(size_type index, uint16_t fp) noexcept
+                {
+                    const uint64_t match = zero_lanes(buckets_[index] ^ (lanes_low * fp));
+                    if (match == 0)
+                        return false;
+                    set(buckets_[index], bit_ctz(match) / 16, 0);
+                    return true;
+                }
+
+                /* 按已知的桶与指纹插入，用于放回 victim_*/
+                void insert_fingerprint(size_type index, uint16_t fp)
+                {
+                    if (put(index, fp) || put(alt_index(index, fp), fp))
+                    {
+                        ++size_;
+                        return;
+                    }
+                    uint16_t cur = fp;
+                    for (size_type kick = 0; kick < max_kicks; ++kick)
+                    {
+                        const size_type slot = static_cast<size_type>(next_random() % slots_per_bucket);
+                        const uint16_t out = get(buckets_[index], slot);
+                        set(buckets_[index], slot, cur);
+                        cur = out;
+                        index = alt_index(index, cur);
+                        if (put(index, cur))
+                        {
+                            ++size_;
+                            return;
+                        }
+                    }
+                    victim_.used = true;
+                    victim_.index = index;
+                    victim_.fingerprint = cur;
+                    ++size_;
+                }
+        };
+
+    template <typename Key, typename Hash>
+        constexpr typename cuckoo_filter<Key, Hash>::size_type cuckoo_filter<Key, Hash>::slots_per_bucket;
+    template <typename Key, typename Hash>
+        constexpr typename cuckoo_filter<Key, Hash>::size_type cuckoo_filter<Key, Hash>::max_kicks;
+    template <typename Key, typename Hash>
+        constexpr uint64_t cuckoo_filter<Key, Hash>::lanes_low;
+    template <typename Key, typename Hash>
+        constexpr uint64_t cuckoo_filter<Key, Hash>::lanes_high;
+
+    /* 重载 leptstl 的 swap*/
+    template <typename Key, typename Hash>
+        void swap(cuckoo_filter<Key, Hash>& lhs, cuckoo_filter<Key, Hash>& rhs) noexcept
+        {
+            lhs.swap(rhs);
+        }
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_CUCKOO_FILTER_H__ */
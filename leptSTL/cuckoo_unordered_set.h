@@ -0,0 +1,818 @@
+/*************************************************************************
+	> File Name: cuckoo_unordered_set.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 09:12:37 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_CUCKOO_UNORDERED_SET_H__
+#define LEPTSTL_CUCKOO_UNORDERED_SET_H__
+
+/* 此头文件包含一个模板类 cuckoo_unordered_set，接口与 unordered_set 相同，查找的最坏情况有界：
+ *   每个键有两个候选桶，每个桶 4 个槽位，元素只会在这 8 个槽位中，查找最多比较 8 次，不存在长链
+ *   两个候选桶由 hash(key) 与种子 seed_ 经过 hash_mix 得到，低 32 位与高 32 位各选一个桶；
+ *   每个槽位另存 8 位的标签，一个桶的 4 个标签一次比较，标签不同的槽位不调用 KeyEqual
+ *   两个桶都满时随机踢出一个元素放到它的另一个候选桶，最多 max_kicks 次；仍然失败说明出现了环，
+ *   元素先放进很小的溢出区 stash_，溢出区满了就换种子重建（必要时桶数加倍）
+ * 针对 hashtable 的攻击（构造 hash 值模桶数相同的键）对它无效：桶由带种子的混合函数决定，重建时种子随之改变
+ * 只有 hash 值完全相同的键超过 8 个时才会长期留在溢出区，这是 Hash 本身的问题，任何哈希表都无法避免
+ * 插入可能移动其它元素，插入与重建使所有迭代器失效；删除只使被删元素的迭代器失效
+ * 装载率上限缺省为 0.9，超过时桶数加倍*/
+
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <type_traits>
+
+#include "allocator.h"
+#include "construct.h"
+#include "exceptdef.h"
+#include "functional.h"
+#include "iterator.h"
+#include "util.h"
+#include "vector.h"
+
+namespace leptstl
+{
+    /* 桶：4 个标签与 4 个槽位，标签为 0 表示空槽位*/
+    template <typename T>
+        struct cuckoo_bucket
+        {
+            static constexpr size_t slots_per_bucket = 4;
+
+            uint8_t tags[slots_per_bucket];
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type slots[slots_per_bucket];
+
+            T*       value(size_t i) noexcept       { return reinterpret_cast<T*>(&slots[i]); }
+            const T* value(size_t i) const noexcept { return reinterpret_cast<const T*>(&slots[i]); }
+        };
+
+    template <typename T>
+        constexpr size_t cuckoo_bucket<T>::slots_per_bucket;
+
+    /*****************************************************************************************/
+    /* cuckoo_set_iterator：容器指针 + 位置，位置先按槽位编号遍历表，再遍历溢出区*/
+    template <typename Table>
+        struct cuckoo_set_iterator :public leptstl::iterator<leptstl::forward_iterator_tag, typename Table::value_type>
+        {
+            typedef typename Table::value_type      value_type;
+            typedef const value_type*               pointer;
+            typedef const value_type&               reference;
+            typedef size_t                          size_type;
+            typedef ptrdiff_t                       difference_type;
+            typedef cuckoo_set_iterator             self;
+
+            const Table* table;
+            size_type    pos;
+
+            cuckoo_set_iterator() noexcept :table(nullptr), pos(0) {}
+            cuckoo_set_iterator(const Table* t, size_type p) noexcept :table(t), pos(p) {}
+
+            reference operator*()  const { return table->value_at(pos); }
+            pointer   operator->() const { return &(operator*()); }
+
+            self& operator++()
+            {
+                pos = table->next_position(pos + 1);
+                return *this;
+            }
+            self operator++(int)
+            {
+                self tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            bool operator==(const self& rhs) const noexcept { return pos == rhs.pos; }
+            bool operator!=(const self& rhs) const noexcept { return pos != rhs.pos; }
+        };
+
+    /*****************************************************************************************/
+    /* 模板类 cuckoo_unordered_set，键值不允许重复*/
+    /* 参数一代表键值类型，参数二代表哈希函数，缺省使用 leptstl::hash，*/
+    /* 参数三代表键值比较方式，缺省使用 leptstl::equal_to*/
+    template <typename Key, typename Hash = leptstl::hash<Key>, typename KeyEqual = leptstl::equal_to<Key>>
+        class cuckoo_unordered_set
+        {
+            friend struct cuckoo_set_iterator<cuckoo_unordered_set>;
+
+            public:
+                typedef leptstl::allocator<Key>                     allocator_type;
+                typedef Key                                         key_type;
+                typedef Key                                         value_type;
+                typedef Hash                                        hasher;
+                typedef KeyEqual                                    key_equal;
+
+                typedef size_t                                      size_type;
+                typedef ptrdiff_t                                   difference_type;
+                typedef value_type*                                 pointer;
+                typedef const value_type*                           const_pointer;
+                typedef value_type&                                 reference;
+                typedef const value_type&                           const_reference;
+
+                typedef cuckoo_set_iterator<cuckoo_unordered_set>   iterator;
+                typedef cuckoo_set_iterator<cuckoo_unordered_set>   const_iterator;
+
+                static constexpr size_type slots_per_bucket = cuckoo_bucket<Key>::slots_per_bucket;
+                static constexpr size_type max_kicks = 500;
+
+                allocator_type get_allocator() const { return allocator_type(); }
+
+            private:
+                typedef cuckoo_bucket<Key>                          bucket_type;
+                typedef leptstl::allocator<bucket_type>             bucket_allocator;
+                typedef leptstl::vector<value_type>                 staging_type;
+
+                static constexpr size_type npos = static_cast<size_type>(-1);
+                static constexpr size_type min_stash_limit = 4;
+                static constexpr size_type max_rebuild_attempts = 6;
+
+                /* 一个键的两个候选桶与标签*/
+                struct position
+                {
+                    size_type b1;
+                    size_type b2;
+                    uint8_t   tag;
+                };
+
+                bucket_type* buckets_;
+                size_type    mask_;           /* 桶数减一，桶数是 2 的幂*/
+                size_type    size_;           /* 元素总数，包括溢出区*/
+                staging_type stash_;          /* 溢出区：放不进表的元素*/
+                size_type    stash_limit_;    /* 溢出区达到此大小时重建*/
+                uint64_t     seed_;
+                uint64_t     rng_;            /* 选择踢出位置的 xorshift 状态*/
+                float        mlf_;
+                hasher       hash_;
+                key_equal    equal_;
+
+            public:
+                /*构造 复制 移动函数*/
+                cuckoo_unordered_set()
+                    :cuckoo_unordered_set(16)
+                {
+                }
+
+                /* bucket_count 是桶数，向上取整为 2 的幂，每个桶 4 个槽位*/
+                explicit cuckoo_unordered_set(size_type bucket_count,
+                                              const Hash& hash = Hash(),
+                                              const KeyEqual& equal = KeyEqual())
+                    :buckets_(nullptr), mask_(0), size_(0), stash_(), stash_limit_(min_stash_limit),
+                     seed_(0x243f6a8885a308d3ull), rng_(0x9e3779b97f4a7c15ull), mlf_(0.9f), hash_(hash), equal_(equal)
+                {
+                    init_buckets(round_buckets(bucket_count));
+                }
+
+                template <typename InputIterator>
+                    cuckoo_unordered_set(InputIterator first, InputIterator last,
+                                         const size_type bucket_count = 16,
+                                         const Hash& hash = Hash(),
+                                         const KeyEqual& equal = KeyEqual())
+                    :cuckoo_unordered_set(bucket_count, hash, equal)
+                {
+                    insert(first, last);
+                }
+
+                cuckoo_unordered_set(std::initializer_list<value_type> ilist,
+                                     const size_type bucket_count = 16,
+                                     const Hash& hash = Hash(),
+                                     const KeyEqual& equal = KeyEqual())
+                    :cuckoo_unordered_set(ilist.begin(), ilist.end(), bucket_count, hash, equal)
+                {
+                }
+
+                cuckoo_unordered_set(const cuckoo_unordered_set& rhs)
+                    :buckets_(nullptr), mask_(0), size_(0), stash_(rhs.stash_), stash_limit_(rhs.stash_limit_),
+                     seed_(rhs.seed_), rng_(rhs.rng_), mlf_(rhs.mlf_), hash_(rhs.hash_), equal_(rhs.equal_)
+                {
+                    init_buckets(rhs.mask_ + 1);
+                    try
+                    {
+                        for (size_type b = 0; b <= mask_; ++b)
+                        {
+                            for (size_type s = 0; s < slots_per_bucket; ++s)
+                            {
+                                if (rhs.buckets_[b].tags[s] != 0)
+                                {
+                                    leptstl::construct(buckets_[b].value(s), *rhs.buckets_[b].value(s));
+                                    buckets_[b].tags[s] = rhs.buckets_[b].tags[s];
+                                }
+                            }
+                        }
+                    }
+                    catch (...)
+                    {
+                        free_buckets();
+                        throw;
+                    }
+                    size_ = rhs.size_;
+                }
+
+                cuckoo_unordered_set(cuckoo_unordered_set&& rhs) noexcept
+                    :buckets_(rhs.buckets_), mask_(rhs.mask_), size_(rhs.size_), stash_(leptstl::move(rhs.stash_)),
+                     stash_limit_(rhs.stash_limit_), seed_(rhs.seed_), rng_(rhs.rng_), mlf_(rhs.mlf_),
+                     hash_(rhs.hash_), equal_(rhs.equal_)
+                {
+                    rhs.buckets_ = empty_bucket();
+                    rhs.mask_ = 0;
+                    rhs.size_ = 0;
+                }
+
+                cuckoo_unordered_set& operator=(const cuckoo_unordered_set& rhs)
+                {
+                    if (this != &rhs)
+                    {
+                        cuckoo_unordered_set tmp(rhs);
+                        swap(tmp);
+                    }
+                    return *this;
+                }
+                cuckoo_unordered_set& operator=(cuckoo_unordered_set&& rhs) noexcept
+                {
+                    cuckoo_unordered_set tmp(leptstl::move(rhs));
+                    swap(tmp);
+                    return *this;
+                }
+
+                cuckoo_unordered_set& operator=(std::initializer_list<value_type> ilist)
+                {
+                    clear();
+                    reserve(ilist.size());
+                    insert(ilist.begin(), ilist.end());
+                    return *this;
+                }
+
+                ~cuckoo_unordered_set()
+                {
+                    free_buckets();
+                }
+
+                /*迭代器相关*/
+                iterator       begin()        noexcept
+                { return iterator(this, next_position(0)); }
+                const_iterator begin()  const noexcept
+                { return const_iterator(this, next_position(0)); }
+                iterator       end()          noexcept
+                { return iterator(this, end_position()); }
+                const_iterator end()    const noexcept
+                { return const_iterator(this, end_position()); }
+
+                const_iterator cbegin() const noexcept
+                { return begin(); }
+                const_iterator cend()   const noexcept
+                { return end(); }
+
+                /* 容量相关*/
+
+                bool      empty()    const noexcept { return size_ == 0; }
+                size_type size()     const noexcept { return size_; }
+                size_type max_size() const noexcept { return static_cast<size_type>(-1) / sizeof(bucket_type); }
+
+                /* 修改容器操作*/
+
+                /* empalce / empalce_hint*/
+
+                template <typename ...Args>
+                    pair<iterator, bool> emplace(Args&& ...args)
+                    {
+                        value_type hand(leptstl::forward<Args>(args)...);
+                        const size_type pos = find_position(hand);
+                        if (pos != npos)
+                            return leptstl::make_pair(iterator(this, pos), false);
+                        return leptstl::make_pair(iterator(this, insert_new(hand)), true);
+                    }
+
+                template <typename ...Args>
+                    iterator emplace_hint(const_iterator, Args&& ...args)
+                    { return emplace(leptstl::forward<Args>(args)...).first; }
+
+                /* insert*/
+
+                pair<iterator, bool> insert(const value_type& value)
+                {
+                    const size_type pos = find_position(value);
+                    if (pos != npos)
+                        return leptstl::make_pair(iterator(this, pos), false);
+                    value_type hand(value);
+                    return leptstl::make_pair(iterator(this, insert_new(hand)), true);
+                }
+                pair<iterator, bool> insert(value_type&& value)
+                {
+                    const size_type pos = find_position(value);
+                    if (pos != npos)
+                        return leptstl::make_pair(iterator(this, pos), false);
+                    value_type hand(leptstl::move(value));
+                    return leptstl::make_pair(iterator(this, insert_new(hand)), true);
+                }
+
+                iterator insert(const_iterator, const value_type& value)
+                { return insert(value).first; }
+                iterator insert(const_iterator, value_type&& value)
+                { return insert(leptstl::move(value)).first; }
+
+                template <typename InputIterator>
+                    void insert(InputIterator first, InputIterator last)
+                    {
+                        for (; first != last; ++first)
+                            insert(*first);
+                    }
+
+                /* erase / clear*/
+
+                void      erase(const_iterator it)
+                { erase_position(it.pos); }
+                void      erase(const_iterator first, const_iterator last)
+                {
+                    /* 删除溢出区的元素会把最后一个元素移到空位，先记下要删除的元素再删*/
+                    if (first == begin() && last == end())
+                    {
+                        clear();
+                        return;
+                    }
+                    staging_type doomed;
+                    for (; first != last; ++first)
+                        doomed.push_back(*first);
+                    for (size_type i = 0; i < doomed.size(); ++i)
+                        erase(doomed[i]);
+                }
+
+                size_type erase(const key_type& key)
+                {
+                    const size_type pos = find_position(key);
+                    if (pos == npos)
+                        return 0;
+                    erase_position(pos);
+                    return 1;
+                }
+
+                void      clear()
+                {
+                    for (size_type b = 0; b <= mask_ && buckets_ != nullptr; ++b)
+                    {
+                        for (size_type s = 0; s < slots_per_bucket; ++s)
+                        {
+                            if (buckets_[b].tags[s] != 0)
+                            {
+                                leptstl::destroy(buckets_[b].value(s));
+                                buckets_[b].tags[s] = 0;
+                            }
+                        }
+                    }
+                    stash_.clear();
+                    size_ = 0;
+                }
+
+                void      swap(cuckoo_unordered_set& other) noexcept
+                {
+                    leptstl::swap(buckets_, other.buckets_);
+                    leptstl::swap(mask_, other.mask_);
+                    leptstl::swap(size_, other.size_);
+                    stash_.swap(other.stash_);
+                    leptstl::swap(stash_limit_, other.stash_limit_);
+                    leptstl::swap(seed_, other.seed_);
+                    leptstl::swap(rng_, other.rng_);
+                    leptstl::swap(mlf_, other.mlf_);
+                    leptstl::swap(hash_, other.hash_);
+                    leptstl::swap(equal_, other.equal_);
+                }
+
+                /* 查找相关，最多比较两个桶的 8 个槽位（溢出区为空时）*/
+
+                size_type      count(const key_type& key) const
+                { return find_position(key) == npos ? 0 : 1; }
+
+                iterator       find(const key_type& key)
+                {
+                    const size_type pos = find_position(key);
+                    return iterator(this, pos == npos ? end_position() : pos);
+                }
+                const_iterator find(const key_type& key)  const
+                {
+                    const size_type pos = find_position(key);
+                    return const_iterator(this, pos == npos ? end_position() : pos);
+                }
+
+                pair<iterator, iterator> equal_range(const key_type& key)
+                {
+                    iterator it = find(key);
+                    if (it == end())
+                        return leptstl::make_pair(it, it);
+                    iterator next = it;
+                    return leptstl::make_pair(it, ++next);
+                }
+                pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+                {
+                    const_iterator it = find(key);
+                    if (it == end())
+                        return leptstl::make_pair(it, it);
+                    const_iterator next = it;
+                    return leptstl::make_pair(it, ++next);
+                }
+
+                /* bucket interface*/
+
+                /* 返回桶数*/
+                size_type bucket_count()                 const noexcept
+                { return mask_ + 1; }
+                size_type max_bucket_count()             const noexcept
+                { return max_size(); }
+
+                /* 返回桶 n 中的元素数*/
+                size_type bucket_size(size_type n)       const noexcept
+                {
+                    size_type c = 0;
+                    for (size_type s = 0; s < slots_per_bucket; ++s)
+                        c += buckets_[n].tags[s] != 0;
+                    return c;
+                }
+                /* 返回 key 的第一个候选桶*/
+                size_type bucket(const key_type& key)    const
+                { return locate(key).b1; }
+
+                /* 溢出区中的元素数，哈希函数正常时为 0*/
+                size_type stash_size()                   const noexcept
+                { return stash_.size(); }
+
+                /* hash policy*/
+
+                /* 装载率按槽位数计算*/
+                float     load_factor()            const noexcept
+                { return static_cast<float>(size_) / static_cast<float>(slot_count()); }
+
+                float     max_load_factor()        const noexcept { return mlf_; }
+                void      max_load_factor(float ml)
+                {
+                    THROW_OUT_OF_RANGE_IF(ml != ml || ml <= 0 || ml > 1,
+                                          "invalid cuckoo_unordered_set max_load_factor");
+                    mlf_ = ml;
+                }
+
+                /* count 是桶数，不小于容纳现有元素所需的桶数*/
+                void      rehash(size_type count)
+                {
+                    const size_type nb = leptstl::max(round_buckets(count), buckets_for(size_));
+                    if (nb != mask_ + 1)
+                        rebuild_all(nb);
+                }
+                void      reserve(size_type count)
+                {
+                    const size_type nb = buckets_for(count);
+                    if (nb > mask_ + 1)
+                        rebuild_all(nb);
+                }
+
+                hasher    hash_fcn()               const          { return hash_; }
+                key_equal key_eq()                 const          { return equal_; }
+
+            private:
+                /* 位置编号：[0, slot_count()) 是表中的槽位，其后是溢出区*/
+                size_type slot_count()   const noexcept { return (mask_ + 1) * slots_per_bucket; }
+                size_type end_position() const noexcept { return slot_count() + stash_.size(); }
+
+                const value_type& value_at(size_type pos) const
+                {
+                    const size_type n = slot_count();
+                    return pos < n ? *buckets_[pos / slots_per_bucket].value(pos % slots_per_bucket) : stash_[pos - n];
+                }
+
+                /* pos 及之后第一个有元素的位置*/
+                size_type next_position(size_type pos) const noexcept
+                {
+                    const size_type n = slot_count();
+                    while (pos < n && buckets_[pos / slots_per_bucket].tags[pos % slots_per_bucket] == 0)
+                        ++pos;
+                    return pos;
+                }
+
+                /* 两个候选桶取自同一个 64 位混合值的低、高 32 位；标签用乘法取高 8 位，与两个桶号都无关*/
+                position locate(const key_type& key) const
+                {
+                    const uint64_t x = hash_mix(static_cast<uint64_t>(hash_(key)) ^ seed_);
+                    position p;
+                    p.b1 = static_cast<size_type>(x) & mask_;
+                    p.b2 = static_cast<size_type>(x >> 32) & mask_;
+                    const uint8_t tag = static_cast<uint8_t>((x * 0x9e3779b97f4a7c15ull) >> 56);
+                    p.tag = tag == 0 ? 1 : tag;
+                    return p;
+                }
+
+                /* 4 个标签按 8 位分段一次比较（SWAR），没有相同的标签时直接跳过这个桶，否则只对标签相同的槽位调用 KeyEqual*/
+                size_type find_in_bucket(size_type b, uint8_t tag, const key_type& key) const
+                {
+                    const bucket_type& bk = buckets_[b];
+                    uint32_t tags;
+                    std::memcpy(&tags, bk.tags, sizeof(tags));
+                    const uint32_t x = tags ^ (0x01010101u * tag);
+                    if (((x - 0x01010101u) & ~x & 0x80808080u) == 0)
+                        return npos;
+                    for (size_type s = 0; s < slots_per_bucket; ++s)
+                        if (bk.tags[s] == tag && equal_(*bk.value(s), key))
+                            return b * slots_per_bucket + s;
+                    return npos;
+                }
+
+                size_type find_position(const key_type& key) const
+                {
+                    const position p = locate(key);
+                    size_type pos = find_in_bucket(p.b1, p.tag, key);
+                    if (pos != npos)
+                        return pos;
+                    pos = find_in_bucket(p.b2, p.tag, key);
+                    if (pos != npos || stash_.empty())
+                        return pos;
+                    for (size_type i = 0; i < stash_.size(); ++i)
+                        if (equal_(stash_[i], key))
+                            return slot_count() + i;
+                    return npos;
+                }
+
+                void erase_position(size_type pos)
+                {
+                    const size_type n = slot_count();
+                    if (pos < n)
+                    {
+                        bucket_type& bk = buckets_[pos / slots_per_bucket];
+                        leptstl::destroy(bk.value(pos % slots_per_bucket));
+                        bk.tags[pos % slots_per_bucket] = 0;
+                    }
+                    else
+                    {
+                        const size_type i = pos - n;
+                        if (i + 1 != stash_.size())
+                            stash_[i] = leptstl::move(stash_.back());
+                        stash_.pop_back();
+                    }
+                    --size_;
+                }
+
+                /* 把 value 移入桶 b 的空槽位，返回槽位编号，桶满时返回 npos*/
+                size_type put(size_type b, uint8_t tag, value_type& value)
+                {
+                    bucket_type& bk = buckets_[b];
+                    for (size_type s = 0; s < slots_per_bucket; ++s)
+                    {
+                        if (bk.tags[s] == 0)
+                        {
+                            leptstl::construct(bk.value(s), leptstl::move(value));
+                            bk.tags[s] = tag;
+                            return b * slots_per_bucket + s;
+                        }
+                    }
+                    return npos;
+                }
+
+                /* 把 hand 放进表中，成功返回 true
+                 * where 跟踪最初的 hand 所在的槽位：踢出过程中它可能又被踢出，npos 表示它还在 hand 中
+                 * 失败时 hand 中是最后被踢出的元素（可能就是最初的元素）*/
+                bool place(value_type& hand, size_type& where)
+                {
+                    where = npos;
+                    const position p = locate(hand);
+                    size_type slot = put(p.b1, p.tag, hand);
+                    if (slot == npos)
+                        slot = put(p.b2, p.tag, hand);
+                    if (slot != npos)
+                    {
+                        where = slot;
+                        return true;
+                    }
+                    size_type b = next_random() & 1 ? p.b1 : p.b2;
+                    uint8_t tag = p.tag;
+                    for (size_type kick = 0; kick < max_kicks; ++kick)
+                    {
+                        const size_type s = static_cast<size_type>(next_random() % slots_per_bucket);
+                        bucket_type& bk = buckets_[b];
+                        const size_type victim_slot = b * slots_per_bucket + s;
+                        leptstl::swap(*bk.value(s), hand);
+                        leptstl::swap(bk.tags[s], tag);
+                        if (where == npos)
+                            where = victim_slot;
+                        else if (where == victim_slot)
+                            where = npos;
+                        /* 被踢出的元素去它的另一个候选桶*/
+                        const position q = locate(hand);
+                        b = q.b1 == b ? q.b2 : q.b1;
+                        slot = put(b, tag, hand);
+                        if (slot != npos)
+                        {
+                            if (where == npos)
+                                where = slot;
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+
+                /* 插入一个确定不存在的元素，返回它的位置*/
+                size_type insert_new(value_type& hand)
+                {
+                    if (buckets_ == empty_bucket() || size_ + 1 > static_cast<size_type>(slot_count() * mlf_))
+                        rebuild_all(2 * (mask_ + 1));
+                    size_type where;
+                    if (place(hand, where))
+                    {
+                        ++size_;
+                        return where;
+                    }
+                    ++size_;
+                    /* 出现了环：无家可归的元素先进溢出区*/
+                    if (stash_.size() < stash_limit_)
+                    {
+                        stash_.push_back(leptstl::move(hand));
+                        return where == npos ? end_position() - 1 : where;
+                    }
+                    /* 溢出区已满，换种子重建；新元素放在 staging 的第一个，最后放入，以便得到它的位置*/
+                    staging_type staging;
+                    staging.reserve(size_);
+                    if (where == npos)
+                    {
+                        staging.push_back(leptstl::move(hand));
+                    }
+                    else
+                    {
+                        bucket_type& bk = buckets_[where / slots_per_bucket];
+                        staging.push_back(leptstl::move(*bk.value(where % slots_per_bucket)));
+                        leptstl::destroy(bk.value(where % slots_per_bucket));
+                        bk.tags[where % slots_per_bucket] = 0;
+                        staging.push_back(leptstl::move(hand));
+                    }
+                    drain(staging);
+                    const size_type load_buckets = buckets_for(size_);
+                    return rebuild(leptstl::max(load_buckets, mask_ + 1), staging);
+                }
+
+                /* 把表与溢出区中的元素全部移到 staging*/
+                void drain(staging_type& staging)
+                {
+                    for (size_type b = 0; b <= mask_; ++b)
+                    {
+                        for (size_type s = 0; s < slots_per_bucket; ++s)
+                        {
+                            if (buckets_[b].tags[s] != 0)
+                            {
+                                staging.push_back(leptstl::move(*buckets_[b].value(s)));
+                                leptstl::destroy(buckets_[b].value(s));
+                                buckets_[b].tags[s] = 0;
+                            }
+                        }
+                    }
+                    for (size_type i = 0; i < stash_.size(); ++i)
+                        staging.push_back(leptstl::move(stash_[i]));
+                    stash_.clear();
+                }
+
+                void rebuild_all(size_type nb)
+                {
+                    staging_type staging;
+                    staging.reserve(size_);
+                    drain(staging);
+                    rebuild(nb, staging);
+                }
+
+                /* 用新的种子与 nb 个桶重建，staging 中的元素从后往前放入，返回 staging[0] 的位置
+                 * 某个元素放不进时把已放入的元素收回 staging，换种子再试，每两次失败桶数加倍；
+                 * 最后一次尝试中放不进的元素留在溢出区*/
+                size_type rebuild(size_type nb, staging_type& staging)
+                {
+                    size_type first_pos = npos;
+                    for (size_type attempt = 0; ; ++attempt)
+                    {
+                        const bool last = attempt + 1 == max_rebuild_attempts;
+                        if (attempt > 0 && attempt % 2 == 0)
+                            nb *= 2;
+                        free_buckets();
+                        init_buckets(nb);
+                        seed_ = hash_mix(seed_ + 0x9e3779b97f4a7c15ull);
+                        bool ok = true;
+                        while (!staging.empty())
+                        {
+                            value_type hand(leptstl::move(staging.back()));
+                            staging.pop_back();
+                            const bool is_first = staging.empty();
+                            size_type where;
+                            if (place(hand, where))
+                            {
+                                if (is_first)
+                                    first_pos = where;
+                                continue;
+                            }
+                            if (!last)
+                            {
+                                /* staging[0] 放不进时，它可能已在表中而 hand 是别的元素，把它取回放在最前面*/
+                                if (is_first && where != npos)
+                                {
+                                    bucket_type& bk = buckets_[where / slots_per_bucket];
+                                    staging.push_back(leptstl::move(*bk.value(where % slots_per_bucket)));
+                                    leptstl::destroy(bk.value(where % slots_per_bucket));
+                                    bk.tags[where % slots_per_bucket] = 0;
+                                }
+                                staging.push_back(leptstl::move(hand));
+                                ok = false;
+                                break;
+                            }
+                            stash_.push_back(leptstl::move(hand));
+                            if (is_first)
+                                first_pos = where == npos ? slot_count() + stash_.size() - 1 : where;
+                        }
+                        if (ok)
+                            break;
+                        /* 失败：收回已放入的元素，staging[0] 仍在最前面*/
+                        drain(staging);
+                    }
+                    stash_limit_ = leptstl::max(min_stash_limit, 2 * stash_.size());
+                    return first_pos;
+                }
+
+                uint64_t next_random() noexcept
+                {
+                    rng_ ^= rng_ << 13;
+                    rng_ ^= rng_ >> 7;
+                    rng_ ^= rng_ << 17;
+                    return rng_;
+                }
+
+                static size_type round_buckets(size_type n)
+                {
+                    size_type nb = 1;
+                    while (nb < n)
+                        nb <<= 1;
+                    return nb;
+                }
+
+                /* 在 mlf_ 下容纳 n 个元素所需的桶数*/
+                size_type buckets_for(size_type n) const
+                {
+                    return round_buckets(static_cast<size_type>(n / (slots_per_bucket * mlf_)) + 1);
+                }
+
+                void init_buckets(size_type nb)
+                {
+                    buckets_ = bucket_allocator::allocate(nb);
+                    for (size_type b = 0; b < nb; ++b)
+                        for (size_type s = 0; s < slots_per_bucket; ++s)
+                            buckets_[b].tags[s] = 0;
+                    mask_ = nb - 1;
+                }
+
+                /* 被移走的表指向这个共享的空桶，查找与遍历照常进行，第一次插入时换成新分配的桶数组*/
+                static bucket_type* empty_bucket() noexcept
+                {
+                    static bucket_type bk;
+                    return &bk;
+                }
+
+                void free_buckets() noexcept
+                {
+                    if (buckets_ == nullptr || buckets_ == empty_bucket())
+                        return;
+                    for (size_type b = 0; b <= mask_; ++b)
+                        for (size_type s = 0; s < slots_per_bucket; ++s)
+                            if (buckets_[b].tags[s] != 0)
+                                leptstl::destroy(buckets_[b].value(s));
+                    bucket_allocator::deallocate(buckets_, mask_ + 1);
+                    buckets_ = nullptr;
+                }
+
+                friend bool operator==(const cuckoo_unordered_set& lhs, const cuckoo_unordered_set& rhs)
+                {
+                    if (lhs.size() != rhs.size())
+                        return false;
+                    for (const_iterator it = lhs.begin(); it != lhs.end(); ++it)
+                        if (rhs.find_position(*it) == npos)
+                            return false;
+                    return true;
+                }
+                friend bool operator!=(const cuckoo_unordered_set& lhs, const cuckoo_unordered_set& rhs)
+                {
+                    return !(lhs == rhs);
+                }
+
+        }; /* cuckoo_unordered_set */
+
+    template <typename Key, typename Hash, typename KeyEqual>
+        constexpr typename cuckoo_unordered_set<Key, Hash, KeyEqual>::size_type
+        cuckoo_unordered_set<Key, Hash, KeyEqual>::slots_per_bucket;
+    template <typename Key, typename Hash, typename KeyEqual>
+        constexpr typename cuckoo_unordered_set<Key, Hash, KeyEqual>::size_type
+        cuckoo_unordered_set<Key, Hash, KeyEqual>::max_kicks;
+    template <typename Key, typename Hash, typename KeyEqual>
+        constexpr typename cuckoo_unordered_set<Key, Hash, KeyEqual>::size_type
+        cuckoo_unordered_set<Key, Hash, KeyEqual>::npos;
+    template <typename Key, typename Hash, typename KeyEqual>
+        constexpr typename cuckoo_unordered_set<Key, Hash, KeyEqual>::size_type
+        cuckoo_unordered_set<Key, Hash, KeyEqual>::min_stash_limit;
+    template <typename Key, typename Hash, typename KeyEqual>
+        constexpr typename cuckoo_unordered_set<Key, Hash, KeyEqual>::size_type
+        cuckoo_unordered_set<Key, Hash, KeyEqual>::max_rebuild_attempts;
+
+    /* 重载 leptstl 的 swap*/
+    template <typename Key, typename Hash, typename KeyEqual>
+        void swap(cuckoo_unordered_set<Key, Hash, KeyEqual>& lhs,
+                  cuckoo_unordered_set<Key, Hash, KeyEqual>& rhs) noexcept
+        {
+            lhs.swap(rhs);
+        }
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_CUCKOO_UNORDERED_SET_H__ */
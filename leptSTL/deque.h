@@ -31,19 +31,19 @@ namespace leptstl
 #ifndef DEQUE_MAP_INIT_SIZE
 #define DEQUE_MAP_INIT_SIZE 8
 #endif 
-    /* deque buf 初始化大小*/
-    template<typename T>
+    /* deque 缓冲区的元素个数，BufSize 为0时使用默认值：约 4KB，元素较大时为16个*/
+    template<typename T, size_t BufSize = 0>
         struct deque_buf_size
         {
-            static constexpr size_t value = sizeof(T) < 256 ? 4096 / sizeof(T) : 16;
+            static constexpr size_t value = BufSize != 0 ? BufSize : (sizeof(T) < 256 ? 4096 / sizeof(T) : 16);
         };
 
     /* deque 迭代器设计*/
-    template<typename T, typename Ref, typename Ptr>
+    template<typename T, typename Ref, typename Ptr, size_t BufSize = 0>
         struct deque_iterator : public iterator<random_access_iterator_tag, T>
         {
-            typedef deque_iterator<T, T&, T*>             iterator;
-            typedef deque_iterator<T, const T&, const T*> const_iterator;
+            typedef deque_iterator<T, T&, T*, BufSize>             iterator;
+            typedef deque_iterator<T, const T&, const T*, BufSize> const_iterator;
             typedef deque_iterator                        self;
 
             typedef T            value_type;
@@ -54,7 +54,7 @@ namespace leptstl
             typedef T*           value_pointer;
             typedef T**          map_pointer;
 
-            static const size_type buffer_size = deque_buf_size<T>::value;
+            static const size_type buffer_size = deque_buf_size<T, BufSize>::value;
 
             /* 迭代器所含成员数据*/
             value_pointer cur;    /* 指向所在缓冲区的当前元素*/
@@ -84,7 +84,7 @@ namespace leptstl
             deque_iterator(const const_iterator& rhs)
                 :cur(rhs.cur), first(rhs.first), last(rhs.last), node(rhs.node) {}
 
-            self& operator=(const iterator& rhs)
+            self& operator=(const self& rhs)
             {
                 if(this != &rhs)
                 {
@@ -193,14 +193,17 @@ namespace leptstl
           
         }; /* deque_iterator */
 
-    /* 模板类deque */
-    template<typename T>
+    /* 模板类deque，参数一代表元素类型，参数二代表缓冲区的分配器（只使用其静态成员函数），
+     * 参数三代表每个缓冲区的元素个数，0 表示使用 deque_buf_size 的默认值
+     * 默认的缓冲区只有约 4KB，使用 hugepage_allocator 时应取 LEPTSTL_HUGEPAGE_SIZE / sizeof(T)，
+     * 否则缓冲区小于一个大页，分配器会退回 operator new*/
+    template<typename T, typename Alloc = leptstl::allocator<T>, size_t BufSize = 0>
         class deque 
         {
             public:
                 /* deque 型别定义*/
-                typedef leptstl::allocator<T>                       allocator_type;
-                typedef leptstl::allocator<T>                       data_allocator;
+                typedef Alloc                                       allocator_type;
+                typedef Alloc                                       data_allocator;
                 typedef leptstl::allocator<T*>                      map_allocator;
               
                 typedef typename allocator_type::value_type         value_type;
@@ -213,14 +216,14 @@ namespace leptstl
                 typedef pointer*                                    map_pointer;
                 typedef const_pointer*                              const_map_pointer;
               
-                typedef deque_iterator<T, T&, T*>                   iterator;
-                typedef deque_iterator<T, const T&, const T*>       const_iterator;
+                typedef deque_iterator<T, T&, T*, BufSize>          iterator;
+                typedef deque_iterator<T, const T&, const T*, BufSize> const_iterator;
                 typedef leptstl::reverse_iterator<iterator>         reverse_iterator;
                 typedef leptstl::reverse_iterator<const_iterator>   const_reverse_iterator;
               
                 allocator_type get_allocator() { return allocator_type(); }
               
-                static const size_type buffer_size = deque_buf_size<T>::value;
+                static const size_type buffer_size = deque_buf_size<T, BufSize>::value;
 
             private:
                 /* 用以下四个数据表现一个deque*/
@@ -459,8 +462,8 @@ namespace leptstl
         }; /* deque */
 
     /*复制赋值运算符*/
-    template <typename T>
-        deque<T>& deque<T>::operator=(const deque& rhs)
+    template<typename T, typename Alloc, size_t BufSize>
+        deque<T, Alloc, BufSize>& deque<T, Alloc, BufSize>::operator=(const deque& rhs)
         {
             if (this != &rhs)
             {
@@ -480,8 +483,8 @@ namespace leptstl
         }
 
     /* 移动赋值运算符*/
-    template<typename T>
-        deque<T>& deque<T>::operator=(deque&& rhs)
+    template<typename T, typename Alloc, size_t BufSize>
+        deque<T, Alloc, BufSize>& deque<T, Alloc, BufSize>::operator=(deque&& rhs)
         {
             clear();
             data_allocator::deallocate(*begin_.node, buffer_size);
@@ -496,8 +499,8 @@ namespace leptstl
         }
 
     /* 重置容器大小*/
-    template<typename T>
-        void deque<T>::resize(size_type new_size, const value_type& value)
+    template<typename T, typename Alloc, size_t BufSize>
+        void deque<T, Alloc, BufSize>::resize(size_type new_size, const value_type& value)
         {
             const auto len = size();
             if(new_size < len)
@@ -507,8 +510,8 @@ namespace leptstl
         }
 
     /* 减小容器容量 */
-    template<typename T>
-        void deque<T>::shrink_to_fit() noexcept 
+    template<typename T, typename Alloc, size_t BufSize>
+        void deque<T, Alloc, BufSize>::shrink_to_fit() noexcept 
         {
             /* 至少留下头部缓冲区*/
             for(auto cur = map_; cur < begin_.node; ++cur)
@@ -524,9 +527,9 @@ namespace leptstl
         }
 
     /* 在头部就地构造元素*/
-    template <typename T>
+    template<typename T, typename Alloc, size_t BufSize>
         template <typename ...Args>
-        void deque<T>::emplace_front(Args&& ...args)
+        void deque<T, Alloc, BufSize>::emplace_front(Args&& ...args)
         {
             if (begin_.cur != begin_.first)
             {
@@ -550,9 +553,9 @@ namespace leptstl
         }
 
     /* 在尾部就地构造元素*/
-    template <typename T>
+    template<typename T, typename Alloc, size_t BufSize>
         template <typename ...Args>
-        void deque<T>::emplace_back(Args&& ...args)
+        void deque<T, Alloc, BufSize>::emplace_back(Args&& ...args)
         {
             if (end_.cur != end_.last - 1)
             {
@@ -568,9 +571,9 @@ namespace leptstl
         }
 
     /* 在pos位置就地构造元素 */
-    template <typename T>
+    template<typename T, typename Alloc, size_t BufSize>
         template <typename ...Args>
-        typename deque<T>::iterator deque<T>::emplace(iterator pos, Args&& ...args)
+        typename deque<T, Alloc, BufSize>::iterator deque<T, Alloc, BufSize>::emplace(iterator pos, Args&& ...args)
         {
             if (pos.cur == begin_.cur)
             {
@@ -586,8 +589,8 @@ namespace leptstl
         }
 
     /* 在头部插入元素 */
-    template <typename T>
-        void deque<T>::push_front(const value_type& value)
+    template<typename T, typename Alloc, size_t BufSize>
+        void deque<T, Alloc, BufSize>::push_front(const value_type& value)
         {
             if (begin_.cur != begin_.first)
             {
@@ -611,8 +614,8 @@ namespace leptstl
         }
 
     /* 在尾部插入元素*/
-    template <typename T>
-        void deque<T>::push_back(const value_type& value)
+    template<typename T, typename Alloc, size_t BufSize>
+        void deque<T, Alloc, BufSize>::push_back(const value_type& value)
         {
             if (end_.cur != end_.last - 1)
             {
@@ -628,8 +631,8 @@ namespace leptstl
         }
 
     /* 弹出头部元素*/
-    template <typename T>
-        void deque<T>::pop_front()
+    template<typename T, typename Alloc, size_t BufSize>
+        void deque<T, Alloc, BufSize>::pop_front()
         {
             LEPTSTL_DEBUG(!empty());
             if (begin_.cur != begin_.last - 1)
@@ -646,8 +649,8 @@ namespace leptstl
         }
         
         /* 弹出尾部元素*/
-    template <typename T>
-        void deque<T>::pop_back()
+    template<typename T, typename Alloc, size_t BufSize>
+        void deque<T, Alloc, BufSize>::pop_back()
         {
             LEPTSTL_DEBUG(!empty());
             if (end_.cur != end_.first)
@@ -664,9 +667,9 @@ namespace leptstl
         }
 
     /* 在pos处插入元素*/
-    template <typename T>
-        typename deque<T>::iterator
-        deque<T>::insert(iterator position, const value_type& value)
+    template<typename T, typename Alloc, size_t BufSize>
+        typename deque<T, Alloc, BufSize>::iterator
+        deque<T, Alloc, BufSize>::insert(iterator position, const value_type& value)
         {
             if (position.cur == begin_.cur)
             {
@@ -686,9 +689,9 @@ namespace leptstl
             }
         }
         
-    template <typename T>
-        typename deque<T>::iterator
-        deque<T>::insert(iterator position, value_type&& value)
+    template<typename T, typename Alloc, size_t BufSize>
+        typename deque<T, Alloc, BufSize>::iterator
+        deque<T, Alloc, BufSize>::insert(iterator position, value_type&& value)
         {
             if (position.cur == begin_.cur)
             {
@@ -709,8 +712,8 @@ namespace leptstl
         }
         
         /* 在 position 位置插入 n 个元素*/
-    template <typename T>
-        void deque<T>::insert(iterator position, size_type n, const value_type& value)
+    template<typename T, typename Alloc, size_t BufSize>
+        void deque<T, Alloc, BufSize>::insert(iterator position, size_type n, const value_type& value)
         {
             if (position.cur == begin_.cur)
             {
@@ -733,9 +736,9 @@ namespace leptstl
         }
 
     /* 删除position处的元素*/
-    template <typename T>
-        typename deque<T>::iterator
-        deque<T>::erase(iterator position)
+    template<typename T, typename Alloc, size_t BufSize>
+        typename deque<T, Alloc, BufSize>::iterator
+        deque<T, Alloc, BufSize>::erase(iterator position)
         {
             auto next = position;
             ++next;
@@ -754,9 +757,9 @@ namespace leptstl
         }
 
     /* 删除[first,last)上的元素*/
-    template <typename T>
-        typename deque<T>::iterator
-        deque<T>::erase(iterator first, iterator last)
+    template<typename T, typename Alloc, size_t BufSize>
+        typename deque<T, Alloc, BufSize>::iterator
+        deque<T, Alloc, BufSize>::erase(iterator first, iterator last)
         {
             if (first == begin_ && last == end_)
             {
@@ -786,8 +789,8 @@ namespace leptstl
         }
         
     /* 清空 deque */
-    template <typename T>
-        void deque<T>::clear()
+    template<typename T, typename Alloc, size_t BufSize>
+        void deque<T, Alloc, BufSize>::clear()
         {
             /* clear 会保留头部的缓冲区*/
             for (map_pointer cur = begin_.node + 1; cur < end_.node; ++cur)
@@ -808,8 +811,8 @@ namespace leptstl
         }
 
     /* 交换两个deque*/
-    template <typename T>
-        void deque<T>::swap(deque& rhs) noexcept
+    template<typename T, typename Alloc, size_t BufSize>
+        void deque<T, Alloc, BufSize>::swap(deque& rhs) noexcept
         {
             if (this != &rhs)
             {
@@ -823,9 +826,9 @@ namespace leptstl
     /**************************************************************************************/
     /* helper function*/
 
-    template <typename T>
-        typename deque<T>::map_pointer
-        deque<T>::create_map(size_type size)
+    template<typename T, typename Alloc, size_t BufSize>
+        typename deque<T, Alloc, BufSize>::map_pointer
+        deque<T, Alloc, BufSize>::create_map(size_type size)
         {
             map_pointer mp = nullptr;
             mp = map_allocator::allocate(size);
@@ -835,8 +838,8 @@ namespace leptstl
         }
         
     /* create_buffer 函数*/
-    template <typename T>
-        void deque<T>::create_buffer(map_pointer nstart, map_pointer nfinish)
+    template<typename T, typename Alloc, size_t BufSize>
+        void deque<T, Alloc, BufSize>::create_buffer(map_pointer nstart, map_pointer nfinish)
         {
             map_pointer cur;
             try
@@ -859,8 +862,8 @@ namespace leptstl
         }
         
     /* destroy_buffer 函数*/
-    template <typename T>
-        void deque<T>::destroy_buffer(map_pointer nstart, map_pointer nfinish)
+    template<typename T, typename Alloc, size_t BufSize>
+        void deque<T, Alloc, BufSize>::destroy_buffer(map_pointer nstart, map_pointer nfinish)
         {
             for (map_pointer n = nstart; n <= nfinish; ++n)
             {
@@ -870,8 +873,8 @@ namespace leptstl
         }
 
     /* map_init 函数*/
-    template <typename T>
-        void deque<T>::map_init(size_type nElem)
+    template<typename T, typename Alloc, size_t BufSize>
+        void deque<T, Alloc, BufSize>::map_init(size_type nElem)
         {
             const size_type nNode = nElem / buffer_size + 1;  // 需要分配的缓冲区个数
             map_size_ = leptstl::max(static_cast<size_type>(DEQUE_MAP_INIT_SIZE), nNode + 2);
@@ -907,8 +910,8 @@ namespace leptstl
         }
         
     /* fill_init 函数*/
-    template <typename T>
-        void deque<T>::fill_init(size_type n, const value_type& value)
+    template<typename T, typename Alloc, size_t BufSize>
+        void deque<T, Alloc, BufSize>::fill_init(size_type n, const value_type& value)
         {
             map_init(n);
             if (n != 0)
@@ -922,9 +925,9 @@ namespace leptstl
         }
         
     /* copy_init 函数*/
-    template <typename T>
+    template<typename T, typename Alloc, size_t BufSize>
         template <typename IIter>
-        void deque<T>::copy_init(IIter first, IIter last, input_iterator_tag)
+        void deque<T, Alloc, BufSize>::copy_init(IIter first, IIter last, input_iterator_tag)
         {
             const size_type n = leptstl::distance(first, last);
             map_init(n);
@@ -932,9 +935,9 @@ namespace leptstl
                 emplace_back(*first);
         }
         
-    template <typename T>
+    template<typename T, typename Alloc, size_t BufSize>
         template <typename FIter>
-        void deque<T>::copy_init(FIter first, FIter last, forward_iterator_tag)
+        void deque<T, Alloc, BufSize>::copy_init(FIter first, FIter last, forward_iterator_tag)
         {
             const size_type n = leptstl::distance(first, last);
             map_init(n);
@@ -949,8 +952,8 @@ namespace leptstl
         }
 
     /* fill_assign 函数*/
-    template <typename T>
-        void deque<T>::fill_assign(size_type n, const value_type& value)
+    template<typename T, typename Alloc, size_t BufSize>
+        void deque<T, Alloc, BufSize>::fill_assign(size_type n, const value_type& value)
         {
             if (n > size())
             {
@@ -965,9 +968,9 @@ namespace leptstl
         }
         
     /* copy_assign 函数*/
-    template <typename T>
+    template<typename T, typename Alloc, size_t BufSize>
         template <typename IIter>
-        void deque<T>::copy_assign(IIter first, IIter last, input_iterator_tag)
+        void deque<T, Alloc, BufSize>::copy_assign(IIter first, IIter last, input_iterator_tag)
         {
             auto first1 = begin();
             auto last1 = end();
@@ -985,9 +988,9 @@ namespace leptstl
             }
         }
         
-    template <typename T>
+    template<typename T, typename Alloc, size_t BufSize>
         template <typename FIter>
-        void deque<T>::copy_assign(FIter first, FIter last, forward_iterator_tag)
+        void deque<T, Alloc, BufSize>::copy_assign(FIter first, FIter last, forward_iterator_tag)
         {  
             const size_type len1 = size();
             const size_type len2 = leptstl::distance(first, last);
@@ -1005,10 +1008,10 @@ namespace leptstl
         }
 
     /* insert_aux 函数*/
-    template <typename T>
+    template<typename T, typename Alloc, size_t BufSize>
         template <typename... Args>
-        typename deque<T>::iterator
-        deque<T>::insert_aux(iterator position, Args&& ...args)
+        typename deque<T, Alloc, BufSize>::iterator
+        deque<T, Alloc, BufSize>::insert_aux(iterator position, Args&& ...args)
         {
             const size_type elems_before = position - begin_;
             value_type value_copy = value_type(leptstl::forward<Args>(args)...);
@@ -1039,8 +1042,8 @@ namespace leptstl
         }
         
     /* fill_insert 函数*/
-    template <typename T>
-        void deque<T>::fill_insert(iterator position, size_type n, const value_type& value)
+    template<typename T, typename Alloc, size_t BufSize>
+        void deque<T, Alloc, BufSize>::fill_insert(iterator position, size_type n, const value_type& value)
         {
             const size_type elems_before = position - begin_;
             const size_type len = size();
@@ -1113,9 +1116,9 @@ namespace leptstl
         }
         
     /* copy_insert*/
-    template <typename T>
+    template<typename T, typename Alloc, size_t BufSize>
         template <typename FIter>
-        void deque<T>::copy_insert(iterator position, FIter first, FIter last, size_type n)
+        void deque<T, Alloc, BufSize>::copy_insert(iterator position, FIter first, FIter last, size_type n)
         {
             const size_type elems_before = position - begin_;
             auto len = size();
@@ -1191,9 +1194,9 @@ namespace leptstl
         }
 
     /* insert_dispatch 函数*/
-    template <typename T>
+    template<typename T, typename Alloc, size_t BufSize>
         template <typename IIter>
-        void deque<T>::insert_dispatch(iterator position, IIter first, IIter last, input_iterator_tag)
+        void deque<T, Alloc, BufSize>::insert_dispatch(iterator position, IIter first, IIter last, input_iterator_tag)
         {
             if (last <= first)  return;
             const size_type n = leptstl::distance(first, last);
@@ -1214,9 +1217,9 @@ namespace leptstl
             }
         }
         
-    template <typename T>
+    template<typename T, typename Alloc, size_t BufSize>
         template <typename FIter>
-        void deque<T>::insert_dispatch(iterator position, FIter first, FIter last, forward_iterator_tag)
+        void deque<T, Alloc, BufSize>::insert_dispatch(iterator position, FIter first, FIter last, forward_iterator_tag)
         {
             if (last <= first)  return;
             const size_type n = leptstl::distance(first, last);
@@ -1259,8 +1262,8 @@ namespace leptstl
         }
         
     /* require_capacity 函数*/
-    template <typename T>
-        void deque<T>::require_capacity(size_type n, bool front)
+    template<typename T, typename Alloc, size_t BufSize>
+        void deque<T, Alloc, BufSize>::require_capacity(size_type n, bool front)
         {
             shrink_to_fit();
             if (front && (static_cast<size_type>(begin_.cur - begin_.first) < n))
@@ -1286,8 +1289,8 @@ namespace leptstl
         }
 
     /* reallocate_map_at_front 函数*/
-    template <typename T>
-        void deque<T>::reallocate_map_at_front(size_type need_buffer)
+    template<typename T, typename Alloc, size_t BufSize>
+        void deque<T, Alloc, BufSize>::reallocate_map_at_front(size_type need_buffer)
         {
             const size_type new_map_size = leptstl::max(map_size_ << 1,
                                                       map_size_ + need_buffer + DEQUE_MAP_INIT_SIZE);
@@ -1312,8 +1315,8 @@ namespace leptstl
         }
         
         /* reallocate_map_at_back 函数*/
-    template <typename T>
-        void deque<T>::reallocate_map_at_back(size_type need_buffer)
+    template<typename T, typename Alloc, size_t BufSize>
+        void deque<T, Alloc, BufSize>::reallocate_map_at_back(size_type need_buffer)
         {
             const size_type new_map_size = leptstl::max(map_size_ << 1,
                                                       map_size_ + need_buffer + DEQUE_MAP_INIT_SIZE);
@@ -1338,47 +1341,47 @@ namespace leptstl
         }
         
     /* 重载比较操作符*/
-    template <typename T>
-        bool operator==(const deque<T>& lhs, const deque<T>& rhs)
+    template<typename T, typename Alloc, size_t BufSize>
+        bool operator==(const deque<T, Alloc, BufSize>& lhs, const deque<T, Alloc, BufSize>& rhs)
         {
             return lhs.size() == rhs.size() && 
                     leptstl::equal(lhs.begin(), lhs.end(), rhs.begin());
         }
         
-    template <typename T>
-        bool operator<(const deque<T>& lhs, const deque<T>& rhs)
+    template<typename T, typename Alloc, size_t BufSize>
+        bool operator<(const deque<T, Alloc, BufSize>& lhs, const deque<T, Alloc, BufSize>& rhs)
         {
             return leptstl::lexicographical_compare(
                     lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
         }
         
-    template <typename T>
-        bool operator!=(const deque<T>& lhs, const deque<T>& rhs)
+    template<typename T, typename Alloc, size_t BufSize>
+        bool operator!=(const deque<T, Alloc, BufSize>& lhs, const deque<T, Alloc, BufSize>& rhs)
         {
             return !(lhs == rhs);
         }
         
-    template <typename T>
-        bool operator>(const deque<T>& lhs, const deque<T>& rhs)
+    template<typename T, typename Alloc, size_t BufSize>
+        bool operator>(const deque<T, Alloc, BufSize>& lhs, const deque<T, Alloc, BufSize>& rhs)
         {
             return rhs < lhs;
         }
         
-    template <typename T>
-        bool operator<=(const deque<T>& lhs, const deque<T>& rhs)
+    template<typename T, typename Alloc, size_t BufSize>
+        bool operator<=(const deque<T, Alloc, BufSize>& lhs, const deque<T, Alloc, BufSize>& rhs)
         {
             return !(rhs < lhs);
         }
         
-    template <typename T>
-        bool operator>=(const deque<T>& lhs, const deque<T>& rhs)
+    template<typename T, typename Alloc, size_t BufSize>
+        bool operator>=(const deque<T, Alloc, BufSize>& lhs, const deque<T, Alloc, BufSize>& rhs)
         {
             return !(lhs < rhs);
         }
         
     /* 重载 leptstl 的 swap*/
-    template <typename T>
-        void swap(deque<T>& lhs, deque<T>& rhs)
+    template<typename T, typename Alloc, size_t BufSize>
+        void swap(deque<T, Alloc, BufSize>& lhs, deque<T, Alloc, BufSize>& rhs)
         {
             lhs.swap(rhs);
         }
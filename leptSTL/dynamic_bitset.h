@@ -0,0 +1,347 @@
+/*************************************************************************
+	> File Name: dynamic_bitset.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Mon 19 Oct 2026 11:32:18 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_DYNAMIC_BITSET_H__
+#define LEPTSTL_DYNAMIC_BITSET_H__
+
+/* 此头文件包含一个类 dynamic_bitset，长度可变的位集合
+ * 按 64 位的字存储，set/reset/flip/count/find_first/find_next 以及 &=, |=, ^= 都按整字进行，
+ * count 用 popcount，查找用 tzcnt（bit_popcount, bit_ctz）
+ * 与 vector<bool> 的区别在于提供集合运算与按字的计数、查找，不提供迭代器
+ * 不变式：最后一个字中超出 size() 的位始终为0
+ */
+
+#include <string>
+
+#include "vector.h"
+#include "exceptdef.h"
+
+namespace leptstl
+{
+    class dynamic_bitset
+    {
+        public:
+            typedef size_t                      size_type;
+            typedef bit_word                    block_type;
+            typedef leptstl::bit_reference      reference;
+            typedef bool                        const_reference;
+
+            static constexpr size_type bits_per_block = bit_word_bits;
+            static constexpr size_type npos = static_cast<size_type>(-1);
+
+        private:
+            leptstl::vector<block_type> words_;  /* 存放各位的字*/
+            size_type                   size_;   /* 位数*/
+
+        public:
+            /* 构造 复制 移动函数*/
+            explicit dynamic_bitset(size_type n = 0, bool value = false)
+                : words_(bit_words_for(n), value ? ~block_type(0) : block_type(0)), size_(n)
+            { clear_tail(); }
+
+            dynamic_bitset(const dynamic_bitset& rhs)
+                : words_(rhs.words_), size_(rhs.size_) {}
+
+            dynamic_bitset(dynamic_bitset&& rhs) noexcept
+                : words_(leptstl::move(rhs.words_)), size_(rhs.size_)
+            {
+                rhs.size_ = 0;
+            }
+
+            dynamic_bitset& operator=(const dynamic_bitset& rhs)
+            {
+                if (this != &rhs)
+                {
+                    words_ = rhs.words_;
+                    size_ = rhs.size_;
+                }
+                return *this;
+            }
+            dynamic_bitset& operator=(dynamic_bitset&& rhs) noexcept
+            {
+                words_ = leptstl::move(rhs.words_);
+                size_ = rhs.size_;
+                rhs.size_ = 0;
+                return *this;
+            }
+
+        public:
+            /* 容量相关操作*/
+            size_type   size()       const noexcept { return size_; }
+            size_type   num_blocks() const noexcept { return words_.size(); }
+            bool        empty()      const noexcept { return size_ == 0; }
+            block_type  block(size_type i) const
+            {
+                LEPTSTL_DEBUG(i < num_blocks());
+                return words_[i];
+            }
+
+            void resize(size_type n, bool value = false);
+            void clear() noexcept
+            {
+                words_.clear();
+                size_ = 0;
+            }
+            void push_back(bool value)
+            {
+                if (size_ % bits_per_block == 0)
+                    words_.push_back(block_type(0));
+                if (value)
+                    words_.back() |= block_type(1) << (size_ % bits_per_block);
+                ++size_;
+            }
+            /* 在末尾追加一个字的 64 位，低位在前*/
+            void append(block_type block);
+
+            /* 访问元素相关操作*/
+            bool test(size_type pos) const
+            {
+                THROW_OUT_OF_RANGE_IF(!(pos < size_), "dynamic_bitset::test() subscript out of range");
+                return (*this)[pos];
+            }
+            reference operator[](size_type pos)
+            {
+                LEPTSTL_DEBUG(pos < size_);
+                return reference(&words_[pos / bits_per_block], block_type(1) << (pos % bits_per_block));
+            }
+            const_reference operator[](size_type pos) const
+            {
+                LEPTSTL_DEBUG(pos < size_);
+                return (words_[pos / bits_per_block] >> (pos % bits_per_block)) & 1;
+            }
+
+            /* 修改相关操作*/
+            dynamic_bitset& set()
+            {
+                for (auto& w : words_)
+                    w = ~block_type(0);
+                clear_tail();
+                return *this;
+            }
+            dynamic_bitset& set(size_type pos, bool value = true)
+            {
+                LEPTSTL_DEBUG(pos < size_);
+                (*this)[pos] = value;
+                return *this;
+            }
+            dynamic_bitset& reset()
+            {
+                for (auto& w : words_)
+                    w = block_type(0);
+                return *this;
+            }
+            dynamic_bitset& reset(size_type pos)
+            { return set(pos, false); }
+            dynamic_bitset& flip()
+            {
+                for (auto& w : words_)
+                    w = ~w;
+                clear_tail();
+                return *this;
+            }
+            dynamic_bitset& flip(size_type pos)
+            {
+                LEPTSTL_DEBUG(pos < size_);
+                (*this)[pos].flip();
+                return *this;
+            }
+
+            /* 统计与查找*/
+            size_type count() const noexcept;
+            bool      any()   const noexcept;
+            bool      none()  const noexcept { return !any(); }
+            bool      all()   const noexcept { return count() == size_; }
+            /* 第一个置位的位置，没有则返回 npos*/
+            size_type find_first() const noexcept
+            { return find_from_block(0); }
+            /* pos 之后第一个置位的位置，没有则返回 npos*/
+            size_type find_next(size_type pos) const noexcept;
+
+            /* 集合运算，两者长度必须相同*/
+            dynamic_bitset& operator&=(const dynamic_bitset& rhs);
+            dynamic_bitset& operator|=(const dynamic_bitset& rhs);
+            dynamic_bitset& operator^=(const dynamic_bitset& rhs);
+            /* 差集：清除 rhs 中置位的位*/
+            dynamic_bitset& operator-=(const dynamic_bitset& rhs);
+            dynamic_bitset  operator~() const
+            {
+                dynamic_bitset tmp(*this);
+                return tmp.flip();
+            }
+
+            bool operator==(const dynamic_bitset& rhs) const noexcept
+            { return size_ == rhs.size_ && leptstl::equal(words_.begin(), words_.end(), rhs.words_.begin()); }
+            bool operator!=(const dynamic_bitset& rhs) const noexcept
+            { return !(*this == rhs); }
+
+            /* 高位在前的 0/1 字符串，与 std::bitset::to_string 一致*/
+            std::string to_string() const;
+
+            void swap(dynamic_bitset& rhs) noexcept
+            {
+                words_.swap(rhs.words_);
+                leptstl::swap(size_, rhs.size_);
+            }
+
+        private:
+            void clear_tail() noexcept
+            {
+                if (size_ % bits_per_block != 0)
+                    words_.back() &= (block_type(1) << (size_ % bits_per_block)) - 1;
+            }
+            size_type find_from_block(size_type i) const noexcept;
+    };
+
+    /*************************************************************************/
+
+    inline void dynamic_bitset::resize(size_type n, bool value)
+    {
+        const size_type old_size = size_;
+        const size_type old_blocks = words_.size();
+        words_.resize(bit_words_for(n), value ? ~block_type(0) : block_type(0));
+        size_ = n;
+        if (value && n > old_size && old_size % bits_per_block != 0)
+        {
+            /* 原来最后一个字的空闲高位也要置位*/
+            words_[old_blocks - 1] |= ~block_type(0) << (old_size % bits_per_block);
+        }
+        clear_tail();
+    }
+
+    inline void dynamic_bitset::append(block_type block)
+    {
+        const size_type r = size_ % bits_per_block;
+        if (r == 0)
+        {
+            words_.push_back(block);
+        }
+        else
+        {
+            words_.back() |= block << r;
+            words_.push_back(block >> (bits_per_block - r));
+        }
+        size_ += bits_per_block;
+    }
+
+    inline dynamic_bitset::size_type dynamic_bitset::count() const noexcept
+    {
+        size_type n = 0;
+        const block_type* p = words_.data();
+        const size_type nb = words_.size();
+        for (size_type i = 0; i < nb; ++i)
+            n += bit_popcount(p[i]);
+        return n;
+    }
+
+    inline bool dynamic_bitset::any() const noexcept
+    {
+        for (auto w : words_)
+            if (w != 0)
+                return true;
+        return false;
+    }
+
+    inline dynamic_bitset::size_type dynamic_bitset::find_from_block(size_type i) const noexcept
+    {
+        const block_type* p = words_.data();
+        const size_type nb = words_.size();
+        for (; i < nb; ++i)
+            if (p[i] != 0)
+                return i * bits_per_block + bit_ctz(p[i]);
+        return npos;
+    }
+
+    inline dynamic_bitset::size_type dynamic_bitset::find_next(size_type pos) const noexcept
+    {
+        if (pos >= size_ || ++pos == size_)
+            return npos;
+        const size_type i = pos / bits_per_block;
+        /* 先在 pos 所在的字里找，去掉 pos 之前的位*/
+        const block_type w = words_[i] & (~block_type(0) << (pos % bits_per_block));
+        if (w != 0)
+            return i * bits_per_block + bit_ctz(w);
+        return find_from_block(i + 1);
+    }
+
+    inline dynamic_bitset& dynamic_bitset::operator&=(const dynamic_bitset& rhs)
+    {
+        LEPTSTL_DEBUG(size_ == rhs.size_);
+        for (size_type i = 0; i < words_.size(); ++i)
+            words_[i] &= rhs.words_[i];
+        return *this;
+    }
+
+    inline dynamic_bitset& dynamic_bitset::operator|=(const dynamic_bitset& rhs)
+    {
+        LEPTSTL_DEBUG(size_ == rhs.size_);
+        for (size_type i = 0; i < words_.size(); ++i)
+            words_[i] |= rhs.words_[i];
+        return *this;
+    }
+
+    inline dynamic_bitset& dynamic_bitset::operator^=(const dynamic_bitset& rhs)
+    {
+        LEPTSTL_DEBUG(size_ == rhs.size_);
+        for (size_type i = 0; i < words_.size(); ++i)
+            words_[i] ^= rhs.words_[i];
+        return *this;
+    }
+
+    inline dynamic_bitset& dynamic_bitset::operator-=(const dynamic_bitset& rhs)
+    {
+        LEPTSTL_DEBUG(size_ == rhs.size_);
+        for (size_type i = 0; i < words_.size(); ++i)
+            words_[i] &= ~rhs.words_[i];
+        return *this;
+    }
+
+    inline std::string dynamic_bitset::to_string() const
+    {
+        std::string s(size_, '0');
+        for (size_type i = find_first(); i != npos; i = find_next(i))
+            s[size_ - 1 - i] = '1';
+        return s;
+    }
+
+    /*************************************************************************/
+    /* 重载集合运算符*/
+    inline dynamic_bitset operator&(const dynamic_bitset& lhs, const dynamic_bitset& rhs)
+    {
+        dynamic_bitset tmp(lhs);
+        return tmp &= rhs;
+    }
+
+    inline dynamic_bitset operator|(const dynamic_bitset& lhs, const dynamic_bitset& rhs)
+    {
+        dynamic_bitset tmp(lhs);
+        return tmp |= rhs;
+    }
+
+    inline dynamic_bitset operator^(const dynamic_bitset& lhs, const dynamic_bitset& rhs)
+    {
+        dynamic_bitset tmp(lhs);
+        return tmp ^= rhs;
+    }
+
+    inline dynamic_bitset operator-(const dynamic_bitset& lhs, const dynamic_bitset& rhs)
+    {
+        dynamic_bitset tmp(lhs);
+        return tmp -= rhs;
+    }
+
+    /*重载leptstl::swap*/
+    inline void swap(dynamic_bitset& lhs, dynamic_bitset& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+
+    template<>
+        struct is_trivially_relocatable<dynamic_bitset> : leptstl::lept_true_type{};
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_DYNAMIC_BITSET_H__ */
@@ -0,0 +1,201 @@
+/*************************************************************************
+	> File Name: filtered_unordered_set.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 07:02:15 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_FILTERED_UNORDERED_SET_H__
+#define LEPTSTL_FILTERED_UNORDERED_SET_H__
+
+/* 此头文件包含一个模板类 filtered_unordered_set，在 unordered_set 前加一层概率过滤器：
+ * find / count 先查询过滤器，过滤器判断一定不存在时直接返回，不访问哈希表的桶与节点
+ * 适合查找多数失败、哈希表远大于缓存的场景；查找多数命中时过滤器只是额外开销
+ * 过滤器缺省是 bloom_filter，也可以是 cuckoo_filter，两者共用 Hash：
+ *   元素数超过过滤器的预计容量（或 cuckoo_filter 插入失败）时，按两倍容量重建过滤器
+ *   bloom_filter 不能删除，erase 后留下的过期位只会增加误报；过期的键超过元素数一半时重建
+ *   cuckoo_filter 直接删除对应的指纹*/
+
+#include "bloom_filter.h"
+#include "cuckoo_filter.h"
+#include "unordered_set.h"
+
+namespace leptstl
+{
+    /* 模板类 filtered_unordered_set，键值不允许重复*/
+    /* 参数一代表键值类型，参数二代表哈希函数，参数三代表键值比较方式，参数四代表过滤器类型*/
+    template <typename Key, typename Hash = leptstl::hash<Key>, typename KeyEqual = leptstl::equal_to<Key>,
+              typename Filter = bloom_filter<Key, Hash>>
+        class filtered_unordered_set
+        {
+            private:
+                typedef unordered_set<Key, Hash, KeyEqual> set_type;
+
+            public:
+                typedef Filter                                 filter_type;
+                typedef typename set_type::key_type            key_type;
+                typedef typename set_type::value_type          value_type;
+                typedef typename set_type::hasher              hasher;
+                typedef typename set_type::key_equal           key_equal;
+                typedef typename set_type::size_type           size_type;
+                typedef typename set_type::iterator            iterator;
+                typedef typename set_type::const_iterator      const_iterator;
+
+            private:
+                set_type    set_;
+                filter_type filter_;
+                size_type   capacity_;    /* 过滤器按此键数建立*/
+                size_type   stale_;       /* 已从 set_ 删除但仍留在过滤器中的键数，只用于不能删除的过滤器*/
+
+            public:
+                explicit filtered_unordered_set(size_type expected_keys = 1024)
+                    :set_(), filter_(leptstl::max(expected_keys, size_type(16))),
+                     capacity_(leptstl::max(expected_keys, size_type(16))), stale_(0)
+                {
+                }
+
+                filtered_unordered_set(const filtered_unordered_set& rhs) = default;
+
+                /* 被移走的集合只剩最小的过滤器，capacity_ 置 0，下一次插入时按实际的键数重建过滤器*/
+                filtered_unordered_set(filtered_unordered_set&& rhs)
+                    :set_(leptstl::move(rhs.set_)), filter_(leptstl::move(rhs.filter_)),
+                     capacity_(rhs.capacity_), stale_(rhs.stale_)
+                {
+                    rhs.capacity_ = 0;
+                    rhs.stale_ = 0;
+                }
+
+                filtered_unordered_set& operator=(const filtered_unordered_set& rhs) = default;
+                filtered_unordered_set& operator=(filtered_unordered_set&& rhs)
+                {
+                    filtered_unordered_set tmp(leptstl::move(rhs));
+                    swap(tmp);
+                    return *this;
+                }
+
+                pair<iterator, bool> insert(const value_type& value)
+                {
+                    pair<iterator, bool> r = set_.insert(value);
+                    if (r.second)
+                        add_to_filter(*r.first);
+                    return r;
+                }
+                pair<iterator, bool> insert(value_type&& value)
+                {
+                    pair<iterator, bool> r = set_.insert(leptstl::move(value));
+                    if (r.second)
+                        add_to_filter(*r.first);
+                    return r;
+                }
+
+                size_type erase(const key_type& key)
+                {
+                    if (set_.erase(key) == 0)
+                        return 0;
+                    remove_from_filter(key, typename filter_type::supports_erase());
+                    return 1;
+                }
+
+                void clear()
+                {
+                    set_.clear();
+                    filter_.clear();
+                    stale_ = 0;
+                }
+
+                /* 查找先经过过滤器*/
+                const_iterator find(const key_type& key) const
+                {
+                    return filter_.may_contain(key) ? set_.find(key) : set_.end();
+                }
+                size_type count(const key_type& key) const
+                {
+                    return filter_.may_contain(key) ? set_.count(key) : 0;
+                }
+                bool contains(const key_type& key) const
+                {
+                    return find(key) != end();
+                }
+
+                const_iterator begin() const noexcept { return set_.begin(); }
+                const_iterator end()   const noexcept { return set_.end(); }
+
+                size_type size()  const noexcept { return set_.size(); }
+                bool      empty() const noexcept { return set_.empty(); }
+
+                /* 底层的过滤器与哈希表，用于观察误报率与内存占用*/
+                const filter_type& filter() const noexcept { return filter_; }
+                const set_type&    set()    const noexcept { return set_; }
+
+                void swap(filtered_unordered_set& rhs) noexcept
+                {
+                    set_.swap(rhs.set_);
+                    filter_.swap(rhs.filter_);
+                    leptstl::swap(capacity_, rhs.capacity_);
+                    leptstl::swap(stale_, rhs.stale_);
+                }
+
+            private:
+                void add_to_filter(const key_type& key)
+                {
+                    if (set_.size() + stale_ > capacity_ || !filter_insert(key))
+                        rebuild(leptstl::max(capacity_ * 2, set_.size() * 2));
+                }
+
+                /* bloom_filter::insert 没有返回值，总是成功*/
+                bool filter_insert(const key_type& key)
+                {
+                    return insert_result(filter_, key, typename filter_type::supports_erase());
+                }
+                static bool insert_result(filter_type& f, const key_type& key, lept_false_type)
+                {
+                    f.insert(key);
+                    return true;
+                }
+                static bool insert_result(filter_type& f, const key_type& key, lept_true_type)
+                {
+                    return f.insert(key);
+                }
+
+                void remove_from_filter(const key_type& key, lept_true_type)
+                {
+                    filter_.erase(key);
+                }
+                void remove_from_filter(const key_type&, lept_false_type)
+                {
+                    if (++stale_ > set_.size() / 2 && stale_ > 64)
+                        rebuild(capacity_);
+                }
+
+                /* 用 set_ 中现有的键重新建立过滤器，cuckoo_filter 装不下时继续加倍*/
+                void rebuild(size_type capacity)
+                {
+                    for (;;)
+                    {
+                        filter_type f(capacity);
+                        bool ok = true;
+                        for (const_iterator it = set_.begin(); ok && it != set_.end(); ++it)
+                            ok = insert_result(f, *it, typename filter_type::supports_erase());
+                        if (ok)
+                        {
+                            filter_.swap(f);
+                            capacity_ = capacity;
+                            stale_ = 0;
+                            return;
+                        }
+                        capacity *= 2;
+                    }
+                }
+        };
+
+    /* 重载 leptstl 的 swap*/
+    template <typename Key, typename Hash, typename KeyEqual, typename Filter>
+        void swap(filtered_unordered_set<Key, Hash, KeyEqual, Filter>& lhs,
+                  filtered_unordered_set<Key, Hash, KeyEqual, Filter>& rhs) noexcept
+        {
+            lhs.swap(rhs);
+        }
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_FILTERED_UNORDERED_SET_H__ */
@@ -0,0 +1,456 @@
+/*************************************************************************
+	> File Name: flat_map.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 04:58:33 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_FLAT_MAP_H__
+#define LEPTSTL_FLAT_MAP_H__
+
+/* 此头文件包含一个模板类 flat_map，键值与实值分别有序地存放在两个 vector 中，键值不允许重复
+ * 查找时 lower_bound 只访问紧密排列的键值，不会把实值一起读进缓存
+ * 由于键值与实值分开存放，解引用迭代器得到的是 pair<const Key&, T&>，而不是 pair<const Key, T>&，
+ * 因此遍历时应写作 for (auto kv : m) 或 for (const auto& kv : m)
+ * 单个插入 / 删除是 O(n) 的；区间插入先把新元素排序，再与原有部分做一次线性合并
+ * 注意：插入与删除会使所有迭代器失效
+ */
+
+#include <initializer_list>
+#include <type_traits>
+
+#include "vector.h"
+#include "algo.h"
+#include "exceptdef.h"
+#include "functional.h"
+#include "iterator.h"
+#include "util.h"
+
+namespace leptstl
+{
+    /* operator-> 需要返回指针，这里保存解引用得到的 pair 并返回它的地址*/
+    template <typename Ref>
+        struct flat_map_arrow
+        {
+            Ref ref;
+            Ref* operator->() { return &ref; }
+        };
+
+    /* flat_map 的迭代器：同时指向键值与实值，参数二为 T 或 const T*/
+    template <typename Key, typename V>
+        struct flat_map_iterator
+            : public iterator<random_access_iterator_tag,
+                              pair<Key, typename std::remove_const<V>::type>, ptrdiff_t,
+                              flat_map_arrow<pair<const Key&, V&>>, pair<const Key&, V&>>
+        {
+            typedef flat_map_iterator<Key, typename std::remove_const<V>::type>  iterator;
+            typedef flat_map_iterator<Key, const V>                              const_iterator;
+            typedef flat_map_iterator                                            self;
+
+            typedef pair<const Key&, V&>    reference;
+            typedef flat_map_arrow<reference> pointer;
+            typedef ptrdiff_t               difference_type;
+
+            const Key* key;
+            V*         value;
+
+            flat_map_iterator() noexcept : key(nullptr), value(nullptr) {}
+            flat_map_iterator(const Key* k, V* v) noexcept : key(k), value(v) {}
+            flat_map_iterator(const iterator& rhs) noexcept : key(rhs.key), value(rhs.value) {}
+            self& operator=(const self& rhs) = default;
+
+            reference operator*()  const { return reference(*key, *value); }
+            pointer   operator->() const { return pointer{ operator*() }; }
+            reference operator[](difference_type n) const { return reference(key[n], value[n]); }
+
+            self& operator++()    { ++key; ++value; return *this; }
+            self  operator++(int) { self tmp = *this; ++*this; return tmp; }
+            self& operator--()    { --key; --value; return *this; }
+            self  operator--(int) { self tmp = *this; --*this; return tmp; }
+
+            self& operator+=(difference_type n) { key += n; value += n; return *this; }
+            self& operator-=(difference_type n) { key -= n; value -= n; return *this; }
+            self  operator+(difference_type n) const { self tmp = *this; return tmp += n; }
+            self  operator-(difference_type n) const { self tmp = *this; return tmp -= n; }
+            difference_type operator-(const self& rhs) const { return key - rhs.key; }
+
+            bool operator==(const self& rhs) const { return key == rhs.key; }
+            bool operator!=(const self& rhs) const { return key != rhs.key; }
+            bool operator< (const self& rhs) const { return key <  rhs.key; }
+            bool operator> (const self& rhs) const { return key >  rhs.key; }
+            bool operator<=(const self& rhs) const { return key <= rhs.key; }
+            bool operator>=(const self& rhs) const { return key >= rhs.key; }
+        };
+
+    /*****************************************************************************************/
+
+    /* 模板类 flat_map，键值不允许重复*/
+    /* 参数一代表键值类型，参数二代表实值类型，参数三代表键值比较方式，缺省使用 leptstl::less*/
+    template <typename Key, typename T, typename Compare = leptstl::less<Key>>
+        class flat_map
+        {
+            /* vector<bool> 按位存放，无法取得元素的地址*/
+            static_assert(!std::is_same<bool, Key>::value && !std::is_same<bool, T>::value,
+                          "flat_map with bool keys or values is not supported in leptstl");
+
+            public:
+                typedef leptstl::vector<Key>                        key_container_type;
+                typedef leptstl::vector<T>                          mapped_container_type;
+
+                typedef Key                                         key_type;
+                typedef T                                           mapped_type;
+                typedef leptstl::pair<Key, T>                       value_type;
+                typedef Compare                                     key_compare;
+
+                /* 比较两个元素的键值*/
+                class value_compare : public binary_function<value_type, value_type, bool>
+                {
+                    friend class flat_map<Key, T, Compare>;
+                    private:
+                        Compare comp;
+                        value_compare(Compare c) : comp(c) {}
+                    public:
+                        bool operator()(const value_type& lhs, const value_type& rhs) const
+                        { return comp(lhs.first, rhs.first); }
+                };
+
+                typedef flat_map_iterator<Key, T>                   iterator;
+                typedef flat_map_iterator<Key, const T>             const_iterator;
+                typedef leptstl::reverse_iterator<iterator>         reverse_iterator;
+                typedef leptstl::reverse_iterator<const_iterator>   const_reverse_iterator;
+
+                typedef typename iterator::reference                reference;
+                typedef typename const_iterator::reference          const_reference;
+                typedef typename iterator::pointer                  pointer;
+                typedef typename const_iterator::pointer            const_pointer;
+                typedef size_t                                      size_type;
+                typedef ptrdiff_t                                   difference_type;
+
+            private:
+                key_container_type    keys_;
+                mapped_container_type values_;
+                Compare               comp_;
+
+            public:
+                /*构造 复制 移动函数*/
+                flat_map() = default;
+
+                explicit flat_map(const Compare& comp)
+                    :comp_(comp)
+                {
+                }
+
+                template <typename InputIterator>
+                    flat_map(InputIterator first, InputIterator last, const Compare& comp = Compare())
+                    :comp_(comp)
+                {
+                    insert(first, last);
+                }
+
+                flat_map(std::initializer_list<value_type> ilist, const Compare& comp = Compare())
+                    :comp_(comp)
+                {
+                    insert(ilist.begin(), ilist.end());
+                }
+
+                flat_map(const flat_map& rhs) = default;
+                flat_map(flat_map&& rhs) noexcept
+                    :keys_(leptstl::move(rhs.keys_)), values_(leptstl::move(rhs.values_)), comp_(rhs.comp_)
+                {
+                }
+
+                flat_map& operator=(const flat_map& rhs) = default;
+                flat_map& operator=(flat_map&& rhs) noexcept
+                {
+                    keys_ = leptstl::move(rhs.keys_);
+                    values_ = leptstl::move(rhs.values_);
+                    comp_ = rhs.comp_;
+                    return *this;
+                }
+
+                flat_map& operator=(std::initializer_list<value_type> ilist)
+                {
+                    clear();
+                    insert(ilist.begin(), ilist.end());
+                    return *this;
+                }
+
+                ~flat_map() = default;
+
+                /*迭代器相关*/
+                iterator               begin()         noexcept { return iterator(keys_.data(), values_.data()); }
+                const_iterator         begin()   const noexcept { return const_iterator(keys_.data(), values_.data()); }
+                iterator               end()           noexcept { return begin() + size(); }
+                const_iterator         end()     const noexcept { return begin() + size(); }
+                reverse_iterator       rbegin()        noexcept { return reverse_iterator(end()); }
+                const_reverse_iterator rbegin()  const noexcept { return const_reverse_iterator(end()); }
+                reverse_iterator       rend()          noexcept { return reverse_iterator(begin()); }
+                const_reverse_iterator rend()    const noexcept { return const_reverse_iterator(begin()); }
+                const_iterator         cbegin()  const noexcept { return begin(); }
+                const_iterator         cend()    const noexcept { return end(); }
+
+                /* 容量相关*/
+                bool      empty()    const noexcept { return keys_.empty(); }
+                size_type size()     const noexcept { return keys_.size(); }
+                size_type max_size() const noexcept { return keys_.max_size(); }
+                size_type capacity() const noexcept { return keys_.capacity(); }
+                void      reserve(size_type n)
+                {
+                    keys_.reserve(n);
+                    values_.reserve(n);
+                }
+                void      shrink_to_fit()
+                {
+                    keys_.shrink_to_fit();
+                    values_.shrink_to_fit();
+                }
+
+                /* 按顺序存放的全部键值与实值，下标一一对应*/
+                const key_container_type&    keys()   const noexcept { return keys_; }
+                const mapped_container_type& values() const noexcept { return values_; }
+
+                /* 访问元素相关*/
+
+                /* 若键值不存在，at 会抛出异常*/
+                mapped_type& at(const key_type& key)
+                {
+                    iterator it = find(key);
+                    THROW_OUT_OF_RANGE_IF(it == end(), "flat_map<Key, T> no such element exists");
+                    return *it.value;
+                }
+                const mapped_type& at(const key_type& key) const
+                {
+                    const_iterator it = find(key);
+                    THROW_OUT_OF_RANGE_IF(it == end(), "flat_map<Key, T> no such element exists");
+                    return *it.value;
+                }
+
+                /* 若键值不存在，插入一个实值为默认值的元素*/
+                mapped_type& operator[](const key_type& key)
+                { return *try_emplace(key).first.value; }
+                mapped_type& operator[](key_type&& key)
+                { return *try_emplace(leptstl::move(key)).first.value; }
+
+                /* 修改容器操作*/
+                template <typename ...Args>
+                    pair<iterator, bool> emplace(Args&& ...args)
+                    {
+                        value_type value(leptstl::forward<Args>(args)...);
+                        return try_emplace(leptstl::move(value.first), leptstl::move(value.second));
+                    }
+
+                /* 键值已存在时不构造实值*/
+                template <typename K, typename ...Args>
+                    pair<iterator, bool> try_emplace(K&& key, Args&& ...args);
+
+                pair<iterator, bool> insert(const value_type& value)
+                { return try_emplace(value.first, value.second); }
+                pair<iterator, bool> insert(value_type&& value)
+                { return try_emplace(leptstl::move(value.first), leptstl::move(value.second)); }
+
+                template <typename InputIterator>
+                    void insert(InputIterator first, InputIterator last);
+
+                iterator  erase(const_iterator it)
+                { return erase(it, it + 1); }
+                iterator  erase(const_iterator first, const_iterator last)
+                {
+                    const size_type f = first.key - keys_.data();
+                    const size_type l = last.key - keys_.data();
+                    keys_.erase(keys_.begin() + f, keys_.begin() + l);
+                    values_.erase(values_.begin() + f, values_.begin() + l);
+                    return begin() + f;
+                }
+                size_type erase(const key_type& key)
+                {
+                    iterator it = find(key);
+                    if (it == end())
+                        return 0;
+                    erase(it);
+                    return 1;
+                }
+
+                void      clear()
+                {
+                    keys_.clear();
+                    values_.clear();
+                }
+
+                void      swap(flat_map& other) noexcept
+                {
+                    keys_.swap(other.keys_);
+                    values_.swap(other.values_);
+                    leptstl::swap(comp_, other.comp_);
+                }
+
+                /* 查找相关*/
+                iterator       lower_bound(const key_type& key)       { return begin() + lower_index(key); }
+                const_iterator lower_bound(const key_type& key) const { return begin() + lower_index(key); }
+                iterator       upper_bound(const key_type& key)
+                { return begin() + (leptstl::upper_bound(keys_.begin(), keys_.end(), key, comp_) - keys_.begin()); }
+                const_iterator upper_bound(const key_type& key) const
+                { return begin() + (leptstl::upper_bound(keys_.begin(), keys_.end(), key, comp_) - keys_.begin()); }
+
+                iterator       find(const key_type& key)              { return begin() + find_index(key); }
+                const_iterator find(const key_type& key)        const { return begin() + find_index(key); }
+                size_type      count(const key_type& key)       const { return find_index(key) == size() ? 0 : 1; }
+                bool           contains(const key_type& key)    const { return find_index(key) != size(); }
+
+                pair<iterator, iterator> equal_range(const key_type& key)
+                {
+                    iterator it = find(key);
+                    return pair<iterator, iterator>(it, it == end() ? it : it + 1);
+                }
+                pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+                {
+                    const_iterator it = find(key);
+                    return pair<const_iterator, const_iterator>(it, it == end() ? it : it + 1);
+                }
+
+                key_compare   key_comp()   const { return comp_; }
+                value_compare value_comp() const { return value_compare(comp_); }
+
+            private:
+                size_type lower_index(const key_type& key) const
+                { return leptstl::lower_bound(keys_.begin(), keys_.end(), key, comp_) - keys_.begin(); }
+
+                /* 找不到时返回 size()*/
+                size_type find_index(const key_type& key) const
+                {
+                    const size_type i = lower_index(key);
+                    return (i == size() || comp_(key, keys_[i])) ? size() : i;
+                }
+
+            public:
+                friend bool operator==(const flat_map& lhs, const flat_map& rhs)
+                { return lhs.keys_ == rhs.keys_ && lhs.values_ == rhs.values_; }
+                friend bool operator!=(const flat_map& lhs, const flat_map& rhs)
+                { return !(lhs == rhs); }
+                friend bool operator< (const flat_map& lhs, const flat_map& rhs)
+                {
+                    const size_type n = lhs.size() < rhs.size() ? lhs.size() : rhs.size();
+                    for (size_type i = 0; i < n; ++i)
+                    {
+                        if (lhs.keys_[i] < rhs.keys_[i])
+                            return true;
+                        if (rhs.keys_[i] < lhs.keys_[i])
+                            return false;
+                        if (lhs.values_[i] < rhs.values_[i])
+                            return true;
+                        if (rhs.values_[i] < lhs.values_[i])
+                            return false;
+                    }
+                    return lhs.size() < rhs.size();
+                }
+                friend bool operator> (const flat_map& lhs, const flat_map& rhs) { return rhs < lhs; }
+                friend bool operator<=(const flat_map& lhs, const flat_map& rhs) { return !(rhs < lhs); }
+                friend bool operator>=(const flat_map& lhs, const flat_map& rhs) { return !(lhs < rhs); }
+
+        };  /* flat_map */
+
+    /*****************************************************************************************/
+
+    template <typename Key, typename T, typename Compare>
+        template <typename K, typename ...Args>
+        pair<typename flat_map<Key, T, Compare>::iterator, bool>
+        flat_map<Key, T, Compare>::try_emplace(K&& key, Args&& ...args)
+        {
+            const size_type i = lower_index(key);
+            if (i != size() && !comp_(key, keys_[i]))
+                return pair<iterator, bool>(begin() + i, false);
+            keys_.emplace(keys_.begin() + i, leptstl::forward<K>(key));
+            try
+            {
+                values_.emplace(values_.begin() + i, leptstl::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                keys_.erase(keys_.begin() + i);
+                throw;
+            }
+            return pair<iterator, bool>(begin() + i, true);
+        }
+
+    /* 两个 vector 无法一起交给 inplace_merge，所以把新元素收集到一个临时 vector 中排序、去重，
+     * 然后与原有部分从前往后线性合并到新的 vector 里，原有的键值优先
+     * leptstl::sort 不稳定，所以排序的是新元素的下标，键相同时按下标排，去重时保留输入中最先出现的一个，
+     * 与逐个 insert 的结果相同*/
+    template <typename Key, typename T, typename Compare>
+        template <typename InputIterator>
+        void flat_map<Key, T, Compare>::insert(InputIterator first, InputIterator last)
+        {
+            leptstl::vector<value_type> fresh;
+            for (; first != last; ++first)
+                fresh.emplace_back(*first);
+            if (fresh.empty())
+                return;
+            const Compare comp = comp_;
+            const value_type* p = fresh.data();
+            leptstl::vector<size_type> order(fresh.size());
+            for (size_type k = 0; k < order.size(); ++k)
+                order[k] = k;
+            leptstl::sort(order.begin(), order.end(), [comp, p](size_type lhs, size_type rhs) {
+                return comp(p[lhs].first, p[rhs].first) || (!comp(p[rhs].first, p[lhs].first) && lhs < rhs);
+            });
+            leptstl::vector<value_type> sorted;
+            sorted.reserve(fresh.size());
+            for (size_type k = 0; k < order.size(); ++k)
+                if (sorted.empty() || comp(sorted.back().first, fresh[order[k]].first))
+                    sorted.emplace_back(leptstl::move(fresh[order[k]]));
+            fresh.swap(sorted);
+            /* 新元素都大于原有元素时直接追加，例如按顺序批量插入*/
+            if (empty() || comp_(keys_.back(), fresh.front().first))
+            {
+                reserve(size() + fresh.size());
+                for (size_type j = 0; j < fresh.size(); ++j)
+                {
+                    keys_.emplace_back(leptstl::move(fresh[j].first));
+                    values_.emplace_back(leptstl::move(fresh[j].second));
+                }
+                return;
+            }
+            key_container_type    keys;
+            mapped_container_type values;
+            keys.reserve(size() + fresh.size());
+            values.reserve(size() + fresh.size());
+            size_type i = 0, j = 0;
+            while (i < size() && j < fresh.size())
+            {
+                if (comp_(fresh[j].first, keys_[i]))
+                {
+                    keys.emplace_back(leptstl::move(fresh[j].first));
+                    values.emplace_back(leptstl::move(fresh[j].second));
+                    ++j;
+                }
+                else
+                {
+                    if (!comp_(keys_[i], fresh[j].first))
+                        ++j;    /* 键值已存在，丢弃新元素*/
+                    keys.emplace_back(leptstl::move(keys_[i]));
+                    values.emplace_back(leptstl::move(values_[i]));
+                    ++i;
+                }
+            }
+            for (; i < size(); ++i)
+            {
+                keys.emplace_back(leptstl::move(keys_[i]));
+                values.emplace_back(leptstl::move(values_[i]));
+            }
+            for (; j < fresh.size(); ++j)
+            {
+                keys.emplace_back(leptstl::move(fresh[j].first));
+                values.emplace_back(leptstl::move(fresh[j].second));
+            }
+            keys_.swap(keys);
+            values_.swap(values);
+        }
+
+    template <typename Key, typename T, typename Compare>
+        void swap(flat_map<Key, T, Compare>& lhs, flat_map<Key, T, Compare>& rhs) noexcept
+        {
+            lhs.swap(rhs);
+        }
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_FLAT_MAP_H__ */
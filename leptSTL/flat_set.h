@@ -0,0 +1,238 @@
+/*************************************************************************
+	> File Name: flat_set.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 04:27:08 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_FLAT_SET_H__
+#define LEPTSTL_FLAT_SET_H__
+
+/* 此头文件包含一个模板类 flat_set，元素有序地存放在一个 vector 中，键值不允许重复
+ * 适合读多写少、规模不大的查找表：没有节点与桶数组的额外内存，查找是一次 lower_bound，遍历是顺序访问
+ * 单个插入 / 删除需要移动插入点之后的元素，是 O(n) 的；
+ * 区间插入先把新元素追加到末尾、排序，再与原有部分做一次 inplace_merge，整体为 O(n + m log m)
+ * 注意：插入与删除会使所有迭代器失效
+ */
+
+#include <initializer_list>
+
+#include "vector.h"
+#include "algo.h"
+#include "functional.h"
+#include "util.h"
+
+namespace leptstl
+{
+    /* 模板类 flat_set，键值不允许重复*/
+    /* 参数一代表键值类型，参数二代表键值比较方式，缺省使用 leptstl::less*/
+    template <typename Key, typename Compare = leptstl::less<Key>>
+        class flat_set
+        {
+            private:
+                typedef leptstl::vector<Key>                        container_type;
+
+            public:
+                typedef Key                                         key_type;
+                typedef Key                                         value_type;
+                typedef Compare                                     key_compare;
+                typedef Compare                                     value_compare;
+
+                typedef typename container_type::size_type          size_type;
+                typedef typename container_type::difference_type    difference_type;
+                typedef typename container_type::const_pointer      pointer;
+                typedef typename container_type::const_pointer      const_pointer;
+                typedef typename container_type::const_reference    reference;
+                typedef typename container_type::const_reference    const_reference;
+
+                /* 元素的顺序由容器维护，只提供常量迭代器*/
+                typedef typename container_type::const_iterator          iterator;
+                typedef typename container_type::const_iterator          const_iterator;
+                typedef typename container_type::const_reverse_iterator  reverse_iterator;
+                typedef typename container_type::const_reverse_iterator  const_reverse_iterator;
+
+            private:
+                container_type keys_;
+                Compare        comp_;
+
+            public:
+                /*构造 复制 移动函数*/
+                flat_set() = default;
+
+                explicit flat_set(const Compare& comp)
+                    :comp_(comp)
+                {
+                }
+
+                template <typename InputIterator>
+                    flat_set(InputIterator first, InputIterator last, const Compare& comp = Compare())
+                    :comp_(comp)
+                {
+                    insert(first, last);
+                }
+
+                flat_set(std::initializer_list<value_type> ilist, const Compare& comp = Compare())
+                    :comp_(comp)
+                {
+                    insert(ilist.begin(), ilist.end());
+                }
+
+                flat_set(const flat_set& rhs) = default;
+                flat_set(flat_set&& rhs) noexcept
+                    :keys_(leptstl::move(rhs.keys_)), comp_(rhs.comp_)
+                {
+                }
+
+                flat_set& operator=(const flat_set& rhs) = default;
+                flat_set& operator=(flat_set&& rhs) noexcept
+                {
+                    keys_ = leptstl::move(rhs.keys_);
+                    comp_ = rhs.comp_;
+                    return *this;
+                }
+
+                flat_set& operator=(std::initializer_list<value_type> ilist)
+                {
+                    keys_.clear();
+                    insert(ilist.begin(), ilist.end());
+                    return *this;
+                }
+
+                ~flat_set() = default;
+
+                /*迭代器相关*/
+                iterator               begin()   const noexcept { return keys_.begin(); }
+                iterator               end()     const noexcept { return keys_.end(); }
+                reverse_iterator       rbegin()  const noexcept { return keys_.rbegin(); }
+                reverse_iterator       rend()    const noexcept { return keys_.rend(); }
+                const_iterator         cbegin()  const noexcept { return keys_.cbegin(); }
+                const_iterator         cend()    const noexcept { return keys_.cend(); }
+
+                /* 容量相关*/
+                bool      empty()    const noexcept { return keys_.empty(); }
+                size_type size()     const noexcept { return keys_.size(); }
+                size_type max_size() const noexcept { return keys_.max_size(); }
+                size_type capacity() const noexcept { return keys_.capacity(); }
+                void      reserve(size_type n)      { keys_.reserve(n); }
+                void      shrink_to_fit()           { keys_.shrink_to_fit(); }
+
+                /* 按顺序存放的全部键值*/
+                const container_type& keys() const noexcept { return keys_; }
+
+                /* 修改容器操作*/
+                template <typename ...Args>
+                    pair<iterator, bool> emplace(Args&& ...args)
+                    { return insert(value_type(leptstl::forward<Args>(args)...)); }
+
+                pair<iterator, bool> insert(const value_type& value)
+                {
+                    iterator pos = lower_bound(value);
+                    if (pos != end() && !comp_(value, *pos))
+                        return pair<iterator, bool>(pos, false);
+                    return pair<iterator, bool>(keys_.insert(pos, value), true);
+                }
+                pair<iterator, bool> insert(value_type&& value)
+                {
+                    iterator pos = lower_bound(value);
+                    if (pos != end() && !comp_(value, *pos))
+                        return pair<iterator, bool>(pos, false);
+                    return pair<iterator, bool>(keys_.insert(pos, leptstl::move(value)), true);
+                }
+
+                template <typename InputIterator>
+                    void insert(InputIterator first, InputIterator last);
+
+                iterator  erase(const_iterator it)
+                { return keys_.erase(it); }
+                iterator  erase(const_iterator first, const_iterator last)
+                { return keys_.erase(first, last); }
+                size_type erase(const key_type& key)
+                {
+                    iterator it = find(key);
+                    if (it == end())
+                        return 0;
+                    keys_.erase(it);
+                    return 1;
+                }
+
+                void      clear()
+                { keys_.clear(); }
+
+                void      swap(flat_set& other) noexcept
+                {
+                    keys_.swap(other.keys_);
+                    leptstl::swap(comp_, other.comp_);
+                }
+
+                /* 查找相关*/
+                iterator       lower_bound(const key_type& key) const
+                { return leptstl::lower_bound(keys_.begin(), keys_.end(), key, comp_); }
+                iterator       upper_bound(const key_type& key) const
+                { return leptstl::upper_bound(keys_.begin(), keys_.end(), key, comp_); }
+
+                iterator       find(const key_type& key) const
+                {
+                    iterator it = lower_bound(key);
+                    return (it == end() || comp_(key, *it)) ? end() : it;
+                }
+                size_type      count(const key_type& key)    const { return find(key) == end() ? 0 : 1; }
+                bool           contains(const key_type& key) const { return find(key) != end(); }
+
+                pair<iterator, iterator> equal_range(const key_type& key) const
+                {
+                    iterator it = find(key);
+                    return pair<iterator, iterator>(it, it == end() ? it : it + 1);
+                }
+
+                key_compare   key_comp()   const { return comp_; }
+                value_compare value_comp() const { return comp_; }
+
+            public:
+                friend bool operator==(const flat_set& lhs, const flat_set& rhs) { return lhs.keys_ == rhs.keys_; }
+                friend bool operator!=(const flat_set& lhs, const flat_set& rhs) { return !(lhs.keys_ == rhs.keys_); }
+                friend bool operator< (const flat_set& lhs, const flat_set& rhs) { return lhs.keys_ < rhs.keys_; }
+                friend bool operator> (const flat_set& lhs, const flat_set& rhs) { return rhs.keys_ < lhs.keys_; }
+                friend bool operator<=(const flat_set& lhs, const flat_set& rhs) { return !(rhs.keys_ < lhs.keys_); }
+                friend bool operator>=(const flat_set& lhs, const flat_set& rhs) { return !(lhs.keys_ < rhs.keys_); }
+
+        };  /* flat_set */
+
+    /*****************************************************************************************/
+
+    /* 追加到末尾后只排序新的部分，再与原有部分合并一次，最后去掉重复的键值
+     * inplace_merge 是稳定的，相等的键值中原有的元素排在前面，unique 保留的正是它*/
+    template <typename Key, typename Compare>
+        template <typename InputIterator>
+        void flat_set<Key, Compare>::insert(InputIterator first, InputIterator last)
+        {
+            const size_type old_size = keys_.size();
+            for (; first != last; ++first)
+                keys_.emplace_back(*first);
+            if (keys_.size() == old_size)
+                return;
+            typename container_type::iterator mid = keys_.begin() + old_size;
+            leptstl::sort(mid, keys_.end(), comp_);
+            /* 新元素都不小于原有元素时不需要合并，例如按顺序批量插入，此时重复只可能出现在接合处之后*/
+            typename container_type::iterator dedup = keys_.begin();
+            if (old_size != 0)
+            {
+                if (comp_(*mid, *(mid - 1)))
+                    leptstl::inplace_merge(keys_.begin(), mid, keys_.end(), comp_);
+                else
+                    dedup = mid - 1;
+            }
+            const Compare comp = comp_;
+            keys_.erase(leptstl::unique(dedup, keys_.end(),
+                                        [comp](const Key& lhs, const Key& rhs) { return !comp(lhs, rhs); }),
+                        keys_.end());
+        }
+
+    template <typename Key, typename Compare>
+        void swap(flat_set<Key, Compare>& lhs, flat_set<Key, Compare>& rhs) noexcept
+        {
+            lhs.swap(rhs);
+        }
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_FLAT_SET_H__ */
@@ -9,7 +9,17 @@
 #define LEPTSTL_FUNCTIONAL_H__ 
 
 /*此头文件包含了leptstl的函数对象与哈希函数*/
+#include <cfloat>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/* 为1时整型的 leptstl::hash 先经过 hash_mix 打散再返回，默认为0，保持返回原值
+ * hashtable 的桶数是质数，原值已经分布均匀；按2的幂取桶或取高位的表（例如 bloom 过滤器）应打开，
+ * 也可以只对个别容器使用 mixed_hash<T>*/
+#ifndef LEPTSTL_MIXED_INTEGER_HASH
+#define LEPTSTL_MIXED_INTEGER_HASH 0
+#endif
 
 namespace leptstl 
 {
@@ -202,13 +212,146 @@ namespace leptstl
             }
         };
 
-    /* 对于整型，只是返回原值   特化*/
+    /***********************************************************/
+    /* 64 位的整数混合与字节串哈希，仿照 wyhash：
+     * 每次把两个 64 位字乘成 128 位，再把高低两半异或（hash_mum_mix），一次乘法就让每个输入位影响全部输出位
+     * 长输入每次读 48 字节，分三路互不依赖的乘法，乘法器可以流水并行*/
+
+    /* 常量取自 wyhash，都是奇数且 0 与 1 的位各占一半*/
+    static constexpr uint64_t hash_secret[4] = {
+        0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull
+    };
+
+    /* a * b 的 128 位乘积，低 64 位写回 a，高 64 位写回 b*/
+    inline void hash_mum(uint64_t& a, uint64_t& b) noexcept
+    {
+#if defined(__SIZEOF_INT128__)
+        const unsigned __int128 r = static_cast<unsigned __int128>(a) * b;
+        a = static_cast<uint64_t>(r);
+        b = static_cast<uint64_t>(r >> 64);
+#else
+        const uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<uint32_t>(a), lb = static_cast<uint32_t>(b);
+        const uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+        const uint64_t t = rl + (rm0 << 32);
+        const uint64_t lo = t + (rm1 << 32);
+        const uint64_t carry = (t < rl) + (lo < t);
+        a = lo;
+        b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+#endif
+    }
+
+    inline uint64_t hash_mum_mix(uint64_t a, uint64_t b) noexcept
+    {
+        hash_mum(a, b);
+        return a ^ b;
+    }
+
+    /* 不要求对齐的读取，memcpy 会被编译成一条 mov*/
+    inline uint64_t hash_read64(const unsigned char* p) noexcept
+    {
+        uint64_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return v;
+    }
+
+    inline uint64_t hash_read32(const unsigned char* p) noexcept
+    {
+        uint32_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return v;
+    }
+
+    /* 1 到 3 个字节：首、中、尾三个字节拼在一起，不需要分支*/
+    inline uint64_t hash_read_small(const unsigned char* p, size_t n) noexcept
+    {
+        return (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[n >> 1]) << 8) | p[n - 1];
+    }
+
+    /* 任意字节串的 64 位哈希，seed 不同时得到互相独立的哈希函数*/
+    inline uint64_t hash_bytes(const void* key, size_t len, uint64_t seed = 0) noexcept
+    {
+        const unsigned char* p = static_cast<const unsigned char*>(key);
+        seed ^= hash_mum_mix(seed ^ hash_secret[0], hash_secret[1]);
+        uint64_t a, b;
+        if (len <= 16)
+        {
+            if (len >= 4)
+            {
+                /* 4 到 16 个字节：首尾各取两个可能重叠的 4 字节*/
+                const size_t mid = (len >> 3) << 2;
+                a = (hash_read32(p) << 32) | hash_read32(p + mid);
+                b = (hash_read32(p + len - 4) << 32) | hash_read32(p + len - 4 - mid);
+            }
+            else if (len > 0)
+            {
+                a = hash_read_small(p, len);
+                b = 0;
+            }
+            else
+            {
+                a = b = 0;
+            }
+        }
+        else
+        {
+            size_t i = len;
+            if (i > 48)
+            {
+                uint64_t see1 = seed, see2 = seed;
+                do
+                {
+                    seed = hash_mum_mix(hash_read64(p) ^ hash_secret[1], hash_read64(p + 8) ^ seed);
+                    see1 = hash_mum_mix(hash_read64(p + 16) ^ hash_secret[2], hash_read64(p + 24) ^ see1);
+                    see2 = hash_mum_mix(hash_read64(p + 32) ^ hash_secret[3], hash_read64(p + 40) ^ see2);
+                    p += 48;
+                    i -= 48;
+                } while (i > 48);
+                seed ^= see1 ^ see2;
+            }
+            while (i > 16)
+            {
+                seed = hash_mum_mix(hash_read64(p) ^ hash_secret[1], hash_read64(p + 8) ^ seed);
+                p += 16;
+                i -= 16;
+            }
+            /* 最后 16 个字节，可能与已处理的部分重叠*/
+            a = hash_read64(p + i - 16);
+            b = hash_read64(p + i - 8);
+        }
+        a ^= hash_secret[1];
+        b ^= seed;
+        hash_mum(a, b);
+        return hash_mum_mix(a ^ hash_secret[0] ^ len, b ^ hash_secret[1]);
+    }
+
+    /* 整数的混合函数（murmur3 的 fmix64），是双射，不会产生新的冲突，
+     * 输入只差一位时输出约有一半的位不同，用于把递增、等差的键打散到低位与高位*/
+    inline uint64_t hash_mix(uint64_t x) noexcept
+    {
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdull;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ull;
+        x ^= x >> 33;
+        return x;
+    }
+
+    /* 对于整型，只是返回原值   特化；LEPTSTL_MIXED_INTEGER_HASH 为1时经过 hash_mix*/
+#if LEPTSTL_MIXED_INTEGER_HASH
+#define LEPTSTL_TRIVIAL_HASH_FUN(Type)              \
+    template<> struct hash<Type>                    \
+    {                                               \
+        size_t operator()(Type val) const noexcept  \
+        { return static_cast<size_t>(hash_mix(static_cast<uint64_t>(val))); } \
+    };
+#else
 #define LEPTSTL_TRIVIAL_HASH_FUN(Type)              \
     template<> struct hash<Type>                    \
     {                                               \
         size_t operator()(Type val) const noexcept  \
         { return static_cast<size_t>(val); }        \
     };
+#endif
 
     /* 显式实例化*/
     LEPTSTL_TRIVIAL_HASH_FUN(bool)
@@ -228,6 +371,17 @@ namespace leptstl
     LEPTSTL_TRIVIAL_HASH_FUN(unsigned long long)
 #undef LEPTSTL_TRIVIAL_HASH_FUN
 
+    /* 在任意哈希函数的结果上再经过 hash_mix，用于只对个别容器打散整数或指针键：
+     *   leptstl::unordered_set<int, leptstl::mixed_hash<int>>*/
+    template <typename T, typename Hash = hash<T>>
+        struct mixed_hash
+        {
+            size_t operator()(const T& val) const noexcept(noexcept(Hash()(val)))
+            {
+                return static_cast<size_t>(hash_mix(static_cast<uint64_t>(Hash()(val))));
+            }
+        };
+
 
     /*对于浮点数 逐位hash*/
     inline size_t bitwise_hash(const unsigned char* first, size_t count)
@@ -252,7 +406,7 @@ namespace leptstl
     template<>
         struct hash<float>
         {
-            size_t operator()(const float& val)
+            size_t operator()(const float& val) const noexcept
             {
                 return val == 0.0f ? 0 : bitwise_hash((const unsigned char*)&val, sizeof(float));
             }
@@ -261,18 +415,24 @@ namespace leptstl
     template <>
         struct hash<double>
         {
-            size_t operator()(const double& val)
+            size_t operator()(const double& val) const noexcept
             {
                 return val == 0.0f ? 0 : bitwise_hash((const unsigned char*)&val,sizeof(double));
             }
         };
 
+    /* x87 扩展精度只有前 10 个字节有效，其余是填充，内容不确定，相等的值也可能不同，不能参与哈希*/
     template <>
         struct hash<long double>
         {
-            size_t operator()(const long double& val)
+            size_t operator()(const long double& val) const noexcept
             {
-                return val == 0.0f ? 0 : bitwise_hash((const unsigned char*)&val,sizeof(long double));
+#if LDBL_MANT_DIG == 64
+                const size_t bytes = 10;
+#else
+                const size_t bytes = sizeof(long double);
+#endif
+                return val == 0.0f ? 0 : bitwise_hash((const unsigned char*)&val, bytes);
             }
         };
 
@@ -103,14 +103,39 @@ namespace leptstl
                 }
         };
 
+    /* hashtable::stats() 的结果：链长分布与内存占用，用来发现分布不均的哈希函数
+     * 查找的探测次数是比较键值的次数，按已有元素估计：
+     *   成功查找：每个元素被查找的概率相同，链上第 k 个元素需要 k 次比较，即 sum(L*(L+1)/2) / size
+     *   失败查找：假设待查的键与已有的键落在各个桶的概率相同，需要比较整条链，即 sum(L*L) / size
+     * 哈希均匀时两者约为 1 + load/2 与 1 + load，明显更大说明许多键挤在少数桶中*/
+    struct hashtable_stats
+    {
+        static const size_t histogram_size = 16;   /* 最后一项统计长度不小于 histogram_size - 1 的链*/
+
+        size_t size;
+        size_t bucket_count;
+        size_t used_buckets;            /* 非空的桶数*/
+        size_t max_chain_length;
+        double mean_chain_length;       /* 非空桶的平均链长*/
+        double load_factor;
+        double empty_bucket_fraction;
+        double probes_hit;              /* 成功查找的平均比较次数*/
+        double probes_miss;             /* 失败查找的平均比较次数*/
+        size_t chain_histogram[histogram_size];    /* chain_histogram[k] 为长度为 k 的链（桶）的个数*/
+        size_t bucket_bytes;            /* 桶数组占用的字节数（按容量计）*/
+        size_t node_bytes;              /* 节点占用的字节数，不含元素自身另外申请的内存*/
+        size_t memory_bytes;            /* 以上两者加上 hashtable 对象本身*/
+    };
+
     /* forward declaration */
-    template <typename T, typename HashFun, typename KeyEqual>
+    template <typename T, typename HashFun, typename KeyEqual,
+              typename BucketAlloc = typename vector_default_allocator<hashtable_node<T>*>::type>
         class hashtable;
         
-    template <typename T, typename HashFun, typename KeyEqual>
+    template <typename T, typename HashFun, typename KeyEqual, typename BucketAlloc>
         struct ht_iterator;
         
-    template <typename T, typename HashFun, typename KeyEqual>
+    template <typename T, typename HashFun, typename KeyEqual, typename BucketAlloc>
         struct ht_const_iterator;
         
     template <typename T>
@@ -120,13 +145,13 @@ namespace leptstl
         struct ht_const_local_iterator;
 
     /* ht_iterator */
-    template <typename T, typename Hash, typename KeyEqual>
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
         struct ht_iterator_base :public leptstl::iterator<leptstl::forward_iterator_tag, T>
         {
-            typedef leptstl::hashtable<T, Hash, KeyEqual>           hashtable;
-            typedef ht_iterator_base<T, Hash, KeyEqual>             base;
-            typedef leptstl::ht_iterator<T, Hash, KeyEqual>         iterator;
-            typedef leptstl::ht_const_iterator<T, Hash, KeyEqual>   const_iterator;
+            typedef leptstl::hashtable<T, Hash, KeyEqual, BucketAlloc>           hashtable;
+            typedef ht_iterator_base<T, Hash, KeyEqual, BucketAlloc>             base;
+            typedef leptstl::ht_iterator<T, Hash, KeyEqual, BucketAlloc>         iterator;
+            typedef leptstl::ht_const_iterator<T, Hash, KeyEqual, BucketAlloc>   const_iterator;
             typedef hashtable_node<T>*                              node_ptr;
             typedef hashtable*                                      contain_ptr;
             typedef const node_ptr                                  const_node_ptr;
@@ -144,10 +169,10 @@ namespace leptstl
             bool operator!=(const base& rhs) const { return node != rhs.node; }
         };
 
-    template <typename T, typename Hash, typename KeyEqual>
-        struct ht_iterator :public ht_iterator_base<T, Hash, KeyEqual>
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        struct ht_iterator :public ht_iterator_base<T, Hash, KeyEqual, BucketAlloc>
         {
-            typedef ht_iterator_base<T, Hash, KeyEqual> base;
+            typedef ht_iterator_base<T, Hash, KeyEqual, BucketAlloc> base;
             typedef typename base::hashtable            hashtable;
             typedef typename base::iterator             iterator;
             typedef typename base::const_iterator       const_iterator;
@@ -222,10 +247,10 @@ namespace leptstl
             }
         };
 
-    template <typename T, typename Hash, typename KeyEqual>
-        struct ht_const_iterator :public ht_iterator_base<T, Hash, KeyEqual>
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        struct ht_const_iterator :public ht_iterator_base<T, Hash, KeyEqual, BucketAlloc>
         {
-            typedef ht_iterator_base<T, Hash, KeyEqual> base;
+            typedef ht_iterator_base<T, Hash, KeyEqual, BucketAlloc> base;
             typedef typename base::hashtable            hashtable;
             typedef typename base::iterator             iterator;
             typedef typename base::const_iterator       const_iterator;
@@ -470,12 +495,12 @@ namespace leptstl
         }
 
         /* 模板类 hashtable*/
-    /* 参数一代表数据类型，参数二代表哈希函数，参数三代表键值相等的比较函数*/
-    template <typename T, typename Hash, typename KeyEqual>
+    /* 参数一代表数据类型，参数二代表哈希函数，参数三代表键值相等的比较函数，参数四代表桶数组的分配器*/
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
         class hashtable
         {  
-            friend struct leptstl::ht_iterator<T, Hash, KeyEqual>;
-            friend struct leptstl::ht_const_iterator<T, Hash, KeyEqual>;
+            friend struct leptstl::ht_iterator<T, Hash, KeyEqual, BucketAlloc>;
+            friend struct leptstl::ht_const_iterator<T, Hash, KeyEqual, BucketAlloc>;
             
           public:
             /* hashtable 的型别定义*/
@@ -488,7 +513,7 @@ namespace leptstl
             
             typedef hashtable_node<T>                           node_type;        /*节点类型*/
             typedef node_type*                                  node_ptr;         /*节点指针*/
-            typedef leptstl::vector<node_ptr>                   bucket_type;      /*桶数组类型*/
+            typedef leptstl::vector<node_ptr, BucketAlloc>      bucket_type;      /*桶数组类型*/
             
             typedef leptstl::allocator<T>                         allocator_type; /*数据分配器*/
             typedef leptstl::allocator<T>                         data_allocator; /*数据分配器*/
@@ -501,8 +526,8 @@ namespace leptstl
             typedef typename allocator_type::size_type          size_type;        /*数据类型大小*/
             typedef typename allocator_type::difference_type    difference_type;  /*数据类型指针距离*/
             
-            typedef leptstl::ht_iterator<T, Hash, KeyEqual>       iterator;       /*迭代器*/
-            typedef leptstl::ht_const_iterator<T, Hash, KeyEqual> const_iterator; /*const迭代器*/
+            typedef leptstl::ht_iterator<T, Hash, KeyEqual, BucketAlloc>       iterator;       /*迭代器*/
+            typedef leptstl::ht_const_iterator<T, Hash, KeyEqual, BucketAlloc> const_iterator; /*const迭代器*/
             typedef leptstl::ht_local_iterator<T>                 local_iterator; /*迭代器（不指向其他桶）*/
             typedef leptstl::ht_const_local_iterator<T>           const_local_iterator;/*const迭代器*/
             
@@ -636,6 +661,23 @@ namespace leptstl
             template <typename ...Args>
                 iterator emplace_unique_use_hint(const_iterator /*hint*/, Args&& ...args)
             { return emplace_unique(leptstl::forward<Args>(args)...).first; }
+
+            /* try_emplace / insert_or_assign：仅用于 pair 类型的元素*/
+            /* 先按键值查找，未命中时才分配节点并就地构造实值*/
+            template <typename K, typename ...Args>
+                pair<iterator, bool> try_emplace_unique(K&& key, Args&& ...args);
+
+            template <typename K, typename M>
+                pair<iterator, bool> insert_or_assign_unique(K&& key, M&& obj)
+            {
+                auto it = find(key);
+                if (it.node != nullptr)
+                {
+                    it->second = leptstl::forward<M>(obj);
+                    return leptstl::make_pair(it, false);
+                }
+                return try_emplace_unique(leptstl::forward<K>(key), leptstl::forward<M>(obj));
+            }
         
             /* insert*/
         
@@ -707,33 +749,33 @@ namespace leptstl
         
             local_iterator       begin(size_type n)        noexcept
             { 
-                LEPTSTL_DEBUG(n < size_);
+                LEPTSTL_DEBUG(n < bucket_size_);
                 return buckets_[n];
             }
             const_local_iterator begin(size_type n)  const noexcept
             { 
-                LEPTSTL_DEBUG(n < size_);
+                LEPTSTL_DEBUG(n < bucket_size_);
                 return buckets_[n];
             }
             const_local_iterator cbegin(size_type n) const noexcept
             { 
-                LEPTSTL_DEBUG(n < size_);
+                LEPTSTL_DEBUG(n < bucket_size_);
                 return buckets_[n];
             }
         
             local_iterator       end(size_type n)          noexcept
             {
-                LEPTSTL_DEBUG(n < size_);
+                LEPTSTL_DEBUG(n < bucket_size_);
                 return nullptr;
             }
             const_local_iterator end(size_type n)    const noexcept
             { 
-                LEPTSTL_DEBUG(n < size_);
+                LEPTSTL_DEBUG(n < bucket_size_);
                 return nullptr; 
             }
             const_local_iterator cend(size_type n)   const noexcept
             {
-                LEPTSTL_DEBUG(n < size_);
+                LEPTSTL_DEBUG(n < bucket_size_);
                 return nullptr; 
             }
         
@@ -766,6 +808,9 @@ namespace leptstl
         
             hasher    hash_fcn() const { return hash_; }
             key_equal key_eq()   const { return equal_; }
+
+            /* 链长分布与内存占用，需要遍历所有桶与节点*/
+            hashtable_stats stats() const noexcept;
         
         private:
           /* hashtable 成员函数*/
@@ -803,18 +848,19 @@ namespace leptstl
           void replace_bucket(size_type bucket_count);
           void erase_bucket(size_type n, node_ptr first, node_ptr last);
           void erase_bucket(size_type n, node_ptr last);
-        
+
+        public:
           /* comparision*/
-          bool equal_to_multi(const hashtable& other);
-          bool equal_to_unique(const hashtable& other);
+          bool equal_to_multi(const hashtable& other) const;
+          bool equal_to_unique(const hashtable& other) const;
         };
 
     /************************************************************************************************/
 
     /* 复制赋值运算符*/
-    template <typename T, typename Hash, typename KeyEqual>
-        hashtable<T, Hash, KeyEqual>&
-        hashtable<T, Hash, KeyEqual>::operator=(const hashtable& rhs)
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        hashtable<T, Hash, KeyEqual, BucketAlloc>&
+        hashtable<T, Hash, KeyEqual, BucketAlloc>::operator=(const hashtable& rhs)
         {
             if (this != &rhs)
             {
@@ -825,9 +871,9 @@ namespace leptstl
         }
         
     /* 移动赋值运算符*/
-    template <typename T, typename Hash, typename KeyEqual>
-        hashtable<T, Hash, KeyEqual>&
-        hashtable<T, Hash, KeyEqual>::operator=(hashtable&& rhs) noexcept
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        hashtable<T, Hash, KeyEqual, BucketAlloc>&
+        hashtable<T, Hash, KeyEqual, BucketAlloc>::operator=(hashtable&& rhs) noexcept
         {
             hashtable tmp(leptstl::move(rhs));
             swap(tmp);
@@ -836,10 +882,10 @@ namespace leptstl
 
     /* 就地构造元素，键值允许重复*/
     /* 强异常安全保证*/
-    template <typename T, typename Hash, typename KeyEqual>
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
         template <typename ...Args>
-        typename hashtable<T, Hash, KeyEqual>::iterator
-        hashtable<T, Hash, KeyEqual>::emplace_multi(Args&& ...args)
+        typename hashtable<T, Hash, KeyEqual, BucketAlloc>::iterator
+        hashtable<T, Hash, KeyEqual, BucketAlloc>::emplace_multi(Args&& ...args)
         {
             auto np = create_node(leptstl::forward<Args>(args)...);
             try
@@ -857,10 +903,10 @@ namespace leptstl
         
     /* 就地构造元素，键值不允许重复*/
     /* 强异常安全保证*/
-    template <typename T, typename Hash, typename KeyEqual>
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
         template <typename ...Args>
-        pair<typename hashtable<T, Hash, KeyEqual>::iterator, bool> 
-        hashtable<T, Hash, KeyEqual>::emplace_unique(Args&& ...args)
+        pair<typename hashtable<T, Hash, KeyEqual, BucketAlloc>::iterator, bool> 
+        hashtable<T, Hash, KeyEqual, BucketAlloc>::emplace_unique(Args&& ...args)
         {
             auto np = create_node(leptstl::forward<Args>(args)...);
             try
@@ -876,10 +922,35 @@ namespace leptstl
             return insert_node_unique(np);
         }
         
+    /* 键值已存在时什么也不做，参数不会被移动*/
+    /* 强异常安全保证*/
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        template <typename K, typename ...Args>
+        pair<typename hashtable<T, Hash, KeyEqual, BucketAlloc>::iterator, bool>
+        hashtable<T, Hash, KeyEqual, BucketAlloc>::try_emplace_unique(K&& key, Args&& ...args)
+        {
+            auto n = hash(key);
+            for (auto cur = buckets_[n]; cur; cur = cur->next)
+            {
+                if (is_equal(value_traits::get_key(cur->value), key))
+                    return leptstl::make_pair(iterator(cur, this), false);
+            }
+            const auto old_bucket_size = bucket_size_;
+            rehash_if_need(1);
+            if (bucket_size_ != old_bucket_size)
+                n = hash(key);
+            auto np = create_node(leptstl::emplace_second, leptstl::forward<K>(key),
+                                  leptstl::forward<Args>(args)...);
+            np->next = buckets_[n];
+            buckets_[n] = np;
+            ++size_;
+            return leptstl::make_pair(iterator(np, this), true);
+        }
+
     /* 在不需要重建表格的情况下插入新节点，键值不允许重复*/
-    template <typename T, typename Hash, typename KeyEqual>
-        pair<typename hashtable<T, Hash, KeyEqual>::iterator, bool>
-        hashtable<T, Hash, KeyEqual>::insert_unique_noresize(const value_type& value)
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        pair<typename hashtable<T, Hash, KeyEqual, BucketAlloc>::iterator, bool>
+        hashtable<T, Hash, KeyEqual, BucketAlloc>::insert_unique_noresize(const value_type& value)
         {
             const auto n = hash(value_traits::get_key(value));
             auto first = buckets_[n];
@@ -897,9 +968,9 @@ namespace leptstl
         }
         
     /* 在不需要重建表格的情况下插入新节点，键值允许重复*/
-    template <typename T, typename Hash, typename KeyEqual>
-        typename hashtable<T, Hash, KeyEqual>::iterator
-        hashtable<T, Hash, KeyEqual>::insert_multi_noresize(const value_type& value)
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        typename hashtable<T, Hash, KeyEqual, BucketAlloc>::iterator
+        hashtable<T, Hash, KeyEqual, BucketAlloc>::insert_multi_noresize(const value_type& value)
         {
             const auto n = hash(value_traits::get_key(value));
             auto first = buckets_[n];
@@ -922,8 +993,8 @@ namespace leptstl
         }
 
     /* 删除迭代器所指的节点*/
-    template <typename T, typename Hash, typename KeyEqual>
-        void hashtable<T, Hash, KeyEqual>::erase(const_iterator position)
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        void hashtable<T, Hash, KeyEqual, BucketAlloc>::erase(const_iterator position)
         {
             auto p = position.node;
             if (p)
@@ -959,8 +1030,8 @@ namespace leptstl
         }
         
     /* 删除[first, last)内的节点*/
-    template <typename T, typename Hash, typename KeyEqual>
-        void hashtable<T, Hash, KeyEqual>::erase(const_iterator first, const_iterator last)
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        void hashtable<T, Hash, KeyEqual, BucketAlloc>::erase(const_iterator first, const_iterator last)
         {
             if (first.node == last.node)
                 return;
@@ -990,22 +1061,23 @@ namespace leptstl
         }
         
     /* 删除键值为 key 的节点*/
-    template <typename T, typename Hash, typename KeyEqual>
-        typename hashtable<T, Hash, KeyEqual>::size_type
-        hashtable<T, Hash, KeyEqual>::erase_multi(const key_type& key)
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        typename hashtable<T, Hash, KeyEqual, BucketAlloc>::size_type
+        hashtable<T, Hash, KeyEqual, BucketAlloc>::erase_multi(const key_type& key)
         {
             auto p = equal_range_multi(key);
             if (p.first.node != nullptr)
-            {
+            { /* 先计数再删除，删除后区间内的节点已经释放*/
+                const size_type n = leptstl::distance(p.first, p.second);
                 erase(p.first, p.second);
-                return leptstl::distance(p.first, p.second);
+                return n;
             }
             return 0;
         }
         
-    template <typename T, typename Hash, typename KeyEqual>
-        typename hashtable<T, Hash, KeyEqual>::size_type
-        hashtable<T, Hash, KeyEqual>::erase_unique(const key_type& key)
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        typename hashtable<T, Hash, KeyEqual, BucketAlloc>::size_type
+        hashtable<T, Hash, KeyEqual, BucketAlloc>::erase_unique(const key_type& key)
         {
             const auto n = hash(key);
             auto first = buckets_[n];
@@ -1039,8 +1111,8 @@ namespace leptstl
         }
         
     /* 清空 hashtable*/
-    template <typename T, typename Hash, typename KeyEqual>
-        void hashtable<T, Hash, KeyEqual>::clear()
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        void hashtable<T, Hash, KeyEqual, BucketAlloc>::clear()
         {
             if (size_ != 0)
             {
@@ -1060,9 +1132,9 @@ namespace leptstl
         }
 
     /* 在某个 bucket 节点的个数*/
-    template <typename T, typename Hash, typename KeyEqual>
-        typename hashtable<T, Hash, KeyEqual>::size_type
-        hashtable<T, Hash, KeyEqual>::bucket_size(size_type n) const noexcept
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        typename hashtable<T, Hash, KeyEqual, BucketAlloc>::size_type
+        hashtable<T, Hash, KeyEqual, BucketAlloc>::bucket_size(size_type n) const noexcept
         {
             size_type result = 0;
             for (auto cur = buckets_[n]; cur; cur = cur->next)
@@ -1072,9 +1144,44 @@ namespace leptstl
             return result;
         }
         
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        hashtable_stats hashtable<T, Hash, KeyEqual, BucketAlloc>::stats() const noexcept
+        {
+            hashtable_stats s = hashtable_stats();
+            s.size = size_;
+            s.bucket_count = bucket_size_;
+            s.load_factor = load_factor();
+            double hit = 0, miss = 0;
+            for (size_type n = 0; n < bucket_size_; ++n)
+            {
+                const size_type len = bucket_size(n);
+                ++s.chain_histogram[len < hashtable_stats::histogram_size ? len : hashtable_stats::histogram_size - 1];
+                if (len == 0)
+                    continue;
+                ++s.used_buckets;
+                if (len > s.max_chain_length)
+                    s.max_chain_length = len;
+                hit += (double)len * (len + 1) / 2;
+                miss += (double)len * len;
+            }
+            if (bucket_size_ != 0)
+                s.empty_bucket_fraction = 1.0 - (double)s.used_buckets / bucket_size_;
+            if (s.used_buckets != 0)
+                s.mean_chain_length = (double)size_ / s.used_buckets;
+            if (size_ != 0)
+            {
+                s.probes_hit = hit / size_;
+                s.probes_miss = miss / size_;
+            }
+            s.bucket_bytes = buckets_.capacity() * sizeof(node_ptr);
+            s.node_bytes = size_ * sizeof(node_type);
+            s.memory_bytes = sizeof(*this) + s.bucket_bytes + s.node_bytes;
+            return s;
+        }
+
     /* 重新对元素进行一遍哈希，插入到新的位置*/
-    template <typename T, typename Hash, typename KeyEqual>
-        void hashtable<T, Hash, KeyEqual>::rehash(size_type count)
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        void hashtable<T, Hash, KeyEqual, BucketAlloc>::rehash(size_type count)
         {
             auto n = ht_next_prime(count);
             if (n > bucket_size_)
@@ -1092,9 +1199,9 @@ namespace leptstl
         }
         
     /* 查找键值为 key 的节点，返回其迭代器*/
-    template <typename T, typename Hash, typename KeyEqual>
-        typename hashtable<T, Hash, KeyEqual>::iterator
-        hashtable<T, Hash, KeyEqual>::find(const key_type& key)
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        typename hashtable<T, Hash, KeyEqual, BucketAlloc>::iterator
+        hashtable<T, Hash, KeyEqual, BucketAlloc>::find(const key_type& key)
         {
             const auto n = hash(key);
             node_ptr first = buckets_[n];
@@ -1102,9 +1209,9 @@ namespace leptstl
             return iterator(first, this);
         }
         
-    template <typename T, typename Hash, typename KeyEqual>
-        typename hashtable<T, Hash, KeyEqual>::const_iterator
-        hashtable<T, Hash, KeyEqual>::find(const key_type& key) const
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        typename hashtable<T, Hash, KeyEqual, BucketAlloc>::const_iterator
+        hashtable<T, Hash, KeyEqual, BucketAlloc>::find(const key_type& key) const
         {
             const auto n = hash(key);
             node_ptr first = buckets_[n];
@@ -1113,9 +1220,9 @@ namespace leptstl
         }
         
     /* 查找键值为 key 出现的次数*/
-    template <typename T, typename Hash, typename KeyEqual>
-        typename hashtable<T, Hash, KeyEqual>::size_type
-        hashtable<T, Hash, KeyEqual>::count(const key_type& key) const
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        typename hashtable<T, Hash, KeyEqual, BucketAlloc>::size_type
+        hashtable<T, Hash, KeyEqual, BucketAlloc>::count(const key_type& key) const
         {
             const auto n = hash(key);
             size_type result = 0;
@@ -1128,10 +1235,10 @@ namespace leptstl
         }
         
     /* 查找与键值 key 相等的区间，返回一个 pair，指向相等区间的首尾*/
-    template <typename T, typename Hash, typename KeyEqual>
-        pair<typename hashtable<T, Hash, KeyEqual>::iterator,
-          typename hashtable<T, Hash, KeyEqual>::iterator>
-        hashtable<T, Hash, KeyEqual>::equal_range_multi(const key_type& key)
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        pair<typename hashtable<T, Hash, KeyEqual, BucketAlloc>::iterator,
+          typename hashtable<T, Hash, KeyEqual, BucketAlloc>::iterator>
+        hashtable<T, Hash, KeyEqual, BucketAlloc>::equal_range_multi(const key_type& key)
         {
             const auto n = hash(key);
             for (node_ptr first = buckets_[n]; first; first = first->next)
@@ -1154,10 +1261,10 @@ namespace leptstl
             return leptstl::make_pair(end(), end());
         }
         
-    template <typename T, typename Hash, typename KeyEqual>
-        pair<typename hashtable<T, Hash, KeyEqual>::const_iterator,
-          typename hashtable<T, Hash, KeyEqual>::const_iterator>
-        hashtable<T, Hash, KeyEqual>::equal_range_multi(const key_type& key) const
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        pair<typename hashtable<T, Hash, KeyEqual, BucketAlloc>::const_iterator,
+          typename hashtable<T, Hash, KeyEqual, BucketAlloc>::const_iterator>
+        hashtable<T, Hash, KeyEqual, BucketAlloc>::equal_range_multi(const key_type& key) const
         {
             const auto n = hash(key);
             for (node_ptr first = buckets_[n]; first; first = first->next)
@@ -1180,10 +1287,10 @@ namespace leptstl
             return leptstl::make_pair(cend(), cend());
         }
         
-    template <typename T, typename Hash, typename KeyEqual>
-        pair<typename hashtable<T, Hash, KeyEqual>::iterator,
-          typename hashtable<T, Hash, KeyEqual>::iterator>
-        hashtable<T, Hash, KeyEqual>::equal_range_unique(const key_type& key)
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        pair<typename hashtable<T, Hash, KeyEqual, BucketAlloc>::iterator,
+          typename hashtable<T, Hash, KeyEqual, BucketAlloc>::iterator>
+        hashtable<T, Hash, KeyEqual, BucketAlloc>::equal_range_unique(const key_type& key)
         {
             const auto n = hash(key);
             for (node_ptr first = buckets_[n]; first; first = first->next)
@@ -1203,10 +1310,10 @@ namespace leptstl
             return leptstl::make_pair(end(), end());
         }
         
-    template <typename T, typename Hash, typename KeyEqual>
-        pair<typename hashtable<T, Hash, KeyEqual>::const_iterator,
-          typename hashtable<T, Hash, KeyEqual>::const_iterator>
-        hashtable<T, Hash, KeyEqual>::equal_range_unique(const key_type& key) const
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        pair<typename hashtable<T, Hash, KeyEqual, BucketAlloc>::const_iterator,
+          typename hashtable<T, Hash, KeyEqual, BucketAlloc>::const_iterator>
+        hashtable<T, Hash, KeyEqual, BucketAlloc>::equal_range_unique(const key_type& key) const
         {
             const auto n = hash(key);
             for (node_ptr first = buckets_[n]; first; first = first->next)
@@ -1227,8 +1334,8 @@ namespace leptstl
         }
 
     /* 交换 hashtable*/
-    template <typename T, typename Hash, typename KeyEqual>
-        void hashtable<T, Hash, KeyEqual>::swap(hashtable& rhs) noexcept
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        void hashtable<T, Hash, KeyEqual, BucketAlloc>::swap(hashtable& rhs) noexcept
         {
             if (this != &rhs)
             {
@@ -1245,8 +1352,8 @@ namespace leptstl
     /* helper function*/
 
     /* init 函数*/
-    template <typename T, typename Hash, typename KeyEqual>
-        void hashtable<T, Hash, KeyEqual>::init(size_type n)
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        void hashtable<T, Hash, KeyEqual, BucketAlloc>::init(size_type n)
         {
             const auto bucket_nums = next_size(n);
             try
@@ -1264,8 +1371,8 @@ namespace leptstl
         }
         
     /* copy_init 函数*/
-    template <typename T, typename Hash, typename KeyEqual>
-        void hashtable<T, Hash, KeyEqual>::copy_init(const hashtable& ht)
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        void hashtable<T, Hash, KeyEqual, BucketAlloc>::copy_init(const hashtable& ht)
         {
             bucket_size_ = 0;
             buckets_.reserve(ht.bucket_size_);
@@ -1298,10 +1405,10 @@ namespace leptstl
         }
         
     /* create_node 函数*/
-    template <typename T, typename Hash, typename KeyEqual>
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
         template <typename ...Args>
-        typename hashtable<T, Hash, KeyEqual>::node_ptr
-        hashtable<T, Hash, KeyEqual>::create_node(Args&& ...args)
+        typename hashtable<T, Hash, KeyEqual, BucketAlloc>::node_ptr
+        hashtable<T, Hash, KeyEqual, BucketAlloc>::create_node(Args&& ...args)
         {
             node_ptr tmp = node_allocator::allocate(1);
             try
@@ -1318,8 +1425,8 @@ namespace leptstl
         }
         
     /* destroy_node 函数*/
-    template <typename T, typename Hash, typename KeyEqual>
-        void hashtable<T, Hash, KeyEqual>::destroy_node(node_ptr node)
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        void hashtable<T, Hash, KeyEqual, BucketAlloc>::destroy_node(node_ptr node)
         {
             data_allocator::destroy(leptstl::address_of(node->value));
             node_allocator::deallocate(node);
@@ -1327,40 +1434,40 @@ namespace leptstl
         }
         
     /* next_size 函数*/
-    template <typename T, typename Hash, typename KeyEqual>
-        typename hashtable<T, Hash, KeyEqual>::size_type
-        hashtable<T, Hash, KeyEqual>::next_size(size_type n) const
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        typename hashtable<T, Hash, KeyEqual, BucketAlloc>::size_type
+        hashtable<T, Hash, KeyEqual, BucketAlloc>::next_size(size_type n) const
         {
             return ht_next_prime(n);
         }
         
     /* hash 函数*/
-    template <typename T, typename Hash, typename KeyEqual>
-        typename hashtable<T, Hash, KeyEqual>::size_type
-        hashtable<T, Hash, KeyEqual>::hash(const key_type& key, size_type n) const
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        typename hashtable<T, Hash, KeyEqual, BucketAlloc>::size_type
+        hashtable<T, Hash, KeyEqual, BucketAlloc>::hash(const key_type& key, size_type n) const
         {
             return hash_(key) % n;
         }
         
-    template <typename T, typename Hash, typename KeyEqual>
-    typename hashtable<T, Hash, KeyEqual>::size_type
-        hashtable<T, Hash, KeyEqual>::hash(const key_type& key) const
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+    typename hashtable<T, Hash, KeyEqual, BucketAlloc>::size_type
+        hashtable<T, Hash, KeyEqual, BucketAlloc>::hash(const key_type& key) const
         {
             return hash_(key) % bucket_size_;
         }
         
     /* rehash_if_need 函数*/
-    template <typename T, typename Hash, typename KeyEqual>
-        void hashtable<T, Hash, KeyEqual>::rehash_if_need(size_type n)
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        void hashtable<T, Hash, KeyEqual, BucketAlloc>::rehash_if_need(size_type n)
         {
             if (static_cast<float>(size_ + n) > (float)bucket_size_ * max_load_factor())
                 rehash(size_ + n);
         }
         
     /* copy_insert*/
-    template <typename T, typename Hash, typename KeyEqual>
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
         template <typename InputIter>
-        void hashtable<T, Hash, KeyEqual>::copy_insert_multi(InputIter first, InputIter last, 
+        void hashtable<T, Hash, KeyEqual, BucketAlloc>::copy_insert_multi(InputIter first, InputIter last, 
                                                              leptstl::input_iterator_tag)
         {
             rehash_if_need(leptstl::distance(first, last));
@@ -1368,9 +1475,9 @@ namespace leptstl
                 insert_multi_noresize(*first);
         }
         
-    template <typename T, typename Hash, typename KeyEqual>
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
         template <typename ForwardIter>
-        void hashtable<T, Hash, KeyEqual>::copy_insert_multi(ForwardIter first, ForwardIter last,
+        void hashtable<T, Hash, KeyEqual, BucketAlloc>::copy_insert_multi(ForwardIter first, ForwardIter last,
                                                              leptstl::forward_iterator_tag)
         {
             size_type n = leptstl::distance(first, last);
@@ -1379,9 +1486,9 @@ namespace leptstl
                 insert_multi_noresize(*first);
         }
         
-    template <typename T, typename Hash, typename KeyEqual>
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
         template <typename InputIter>
-        void hashtable<T, Hash, KeyEqual>::copy_insert_unique(InputIter first, InputIter last, 
+        void hashtable<T, Hash, KeyEqual, BucketAlloc>::copy_insert_unique(InputIter first, InputIter last, 
                                                               leptstl::input_iterator_tag)
         {
             rehash_if_need(leptstl::distance(first, last));
@@ -1389,9 +1496,9 @@ namespace leptstl
                 insert_unique_noresize(*first);
         }
         
-    template <typename T, typename Hash, typename KeyEqual>
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
         template <typename ForwardIter>
-        void hashtable<T, Hash, KeyEqual>::copy_insert_unique(ForwardIter first, ForwardIter last, 
+        void hashtable<T, Hash, KeyEqual, BucketAlloc>::copy_insert_unique(ForwardIter first, ForwardIter last, 
                                                               leptstl::forward_iterator_tag)
         {
             size_type n = leptstl::distance(first, last);
@@ -1401,9 +1508,9 @@ namespace leptstl
         }
         
     /* insert_node 函数*/
-    template <typename T, typename Hash, typename KeyEqual>
-        typename hashtable<T, Hash, KeyEqual>::iterator
-        hashtable<T, Hash, KeyEqual>::insert_node_multi(node_ptr np)
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        typename hashtable<T, Hash, KeyEqual, BucketAlloc>::iterator
+        hashtable<T, Hash, KeyEqual, BucketAlloc>::insert_node_multi(node_ptr np)
         {
             const auto n = hash(value_traits::get_key(np->value));
             auto cur = buckets_[n];
@@ -1430,9 +1537,9 @@ namespace leptstl
         }
         
     /* insert_node_unique 函数*/
-    template <typename T, typename Hash, typename KeyEqual>
-        pair<typename hashtable<T, Hash, KeyEqual>::iterator, bool>
-        hashtable<T, Hash, KeyEqual>::insert_node_unique(node_ptr np)
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        pair<typename hashtable<T, Hash, KeyEqual, BucketAlloc>::iterator, bool>
+        hashtable<T, Hash, KeyEqual, BucketAlloc>::insert_node_unique(node_ptr np)
         {
             const auto n = hash(value_traits::get_key(np->value));
             auto cur = buckets_[n];
@@ -1457,48 +1564,37 @@ namespace leptstl
         }
         
     /* replace_bucket 函数*/
-    template <typename T, typename Hash, typename KeyEqual>
-        void hashtable<T, Hash, KeyEqual>::replace_bucket(size_type bucket_count)
+    /* 直接把原有节点摘下挂到新桶上，不复制元素，也不重新分配节点*/
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        void hashtable<T, Hash, KeyEqual, BucketAlloc>::replace_bucket(size_type bucket_count)
         {
             bucket_type bucket(bucket_count);
-            if (size_ != 0)
+            for (size_type i = 0; i < bucket_size_; ++i)
             {
-                for (size_type i = 0; i < bucket_size_; ++i)
+                node_ptr first = buckets_[i];
+                while (first != nullptr)
                 {
-                    for (auto first = buckets_[i]; first; first = first->next)
-                    {
-                        auto tmp = create_node(first->value);
-                        const auto n = hash(value_traits::get_key(first->value), bucket_count);
-                        auto f = bucket[n];
-                        bool is_inserted = false;
-                        for (auto cur = f; cur; cur = cur->next)
+                    node_ptr next = first->next;
+                    const auto n = hash(value_traits::get_key(first->value), bucket_count);
+                    bool is_inserted = false;
+                    for (auto cur = bucket[n]; cur; cur = cur->next)
+                    { /* 键值相同的节点保持相邻*/
+                        if (is_equal(value_traits::get_key(cur->value), value_traits::get_key(first->value)))
                         {
-                            if (is_equal(value_traits::get_key(cur->value), value_traits::get_key(first->value)))
-                            {
-                                tmp->next = cur->next;
-                                cur->next = tmp;
-                                is_inserted = true;
-                                break;
-                            }
-                        }
-                        if (!is_inserted)
-                        {
-                            tmp->next = f;
-                            bucket[n] = tmp;
+                            first->next = cur->next;
+                            cur->next = first;
+                            is_inserted = true;
+                            break;
                         }
                     }
-                }
-                for (size_type i = 0; i < bucket_size_; ++i)
-                {
-                    node_ptr cur = buckets_[i];
-                    while (cur != nullptr)
+                    if (!is_inserted)
                     {
-                        node_ptr next = cur->next;
-                        destroy_node(cur);
-                        cur = next;
+                        first->next = bucket[n];
+                        bucket[n] = first;
                     }
-                    buckets_[i] = nullptr;
+                    first = next;
                 }
+                buckets_[i] = nullptr;
             }
             buckets_.swap(bucket);
             bucket_size_ = buckets_.size();
@@ -1506,8 +1602,8 @@ namespace leptstl
         
     /* erase_bucket 函数*/
     /* 在第 n 个 bucket 内，删除 [first, last) 的节点*/
-    template <typename T, typename Hash, typename KeyEqual>
-        void hashtable<T, Hash, KeyEqual>::erase_bucket(size_type n, node_ptr first, node_ptr last)
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        void hashtable<T, Hash, KeyEqual, BucketAlloc>::erase_bucket(size_type n, node_ptr first, node_ptr last)
         {
             auto cur = buckets_[n];
             if (cur == first)
@@ -1530,8 +1626,8 @@ namespace leptstl
         
     /* erase_bucket 函数*/
     /* 在第 n 个 bucket 内，删除 [buckets_[n], last) 的节点*/
-    template <typename T, typename Hash, typename KeyEqual>
-        void hashtable<T, Hash, KeyEqual>::erase_bucket(size_type n, node_ptr last)
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        void hashtable<T, Hash, KeyEqual, BucketAlloc>::erase_bucket(size_type n, node_ptr last)
         {
             auto cur = buckets_[n];
             while (cur != last)
@@ -1545,8 +1641,8 @@ namespace leptstl
         }
         
     /* equal_to 函数*/
-    template <typename T, typename Hash, typename KeyEqual>
-        bool hashtable<T, Hash, KeyEqual>::equal_to_multi(const hashtable& other)
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        bool hashtable<T, Hash, KeyEqual, BucketAlloc>::equal_to_multi(const hashtable& other) const
         {
             if (size_ != other.size_)
                 return false;
@@ -1554,16 +1650,16 @@ namespace leptstl
             {
                 auto p1 = equal_range_multi(value_traits::get_key(*f));
                 auto p2 = other.equal_range_multi(value_traits::get_key(*f));
-                if (leptstl::distance(p1.first, p1.last) != leptstl::distance(p2.first, p2.last) ||
-                    !leptstl::is_permutation(p1.first, p2.last, p2.first, p2.last))
+                if (leptstl::distance(p1.first, p1.second) != leptstl::distance(p2.first, p2.second) ||
+                    !leptstl::is_permutation(p1.first, p1.second, p2.first, p2.second))
                     return false;
-                f = p1.last;
+                f = p1.second;
             }
             return true;
         }
         
-    template <typename T, typename Hash, typename KeyEqual>
-        bool hashtable<T, Hash, KeyEqual>::equal_to_unique(const hashtable& other)
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        bool hashtable<T, Hash, KeyEqual, BucketAlloc>::equal_to_unique(const hashtable& other) const
         {
             if (size_ != other.size_)
                 return false;
@@ -1577,9 +1673,9 @@ namespace leptstl
         }
         
     /* 重载 leptstl 的 swap*/
-    template <typename T, typename Hash, typename KeyEqual>
-        void swap(hashtable<T, Hash, KeyEqual>& lhs,
-                  hashtable<T, Hash, KeyEqual>& rhs) noexcept
+    template <typename T, typename Hash, typename KeyEqual, typename BucketAlloc>
+        void swap(hashtable<T, Hash, KeyEqual, BucketAlloc>& lhs,
+                  hashtable<T, Hash, KeyEqual, BucketAlloc>& rhs) noexcept
         {
             lhs.swap(rhs);
         }
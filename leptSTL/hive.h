@@ -0,0 +1,572 @@
+/*************************************************************************
+	> File Name: hive.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 01:47:52 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_HIVE_H__
+#define LEPTSTL_HIVE_H__
+
+/* 此头文件包含一个模板类 hive（也称 colony），元素地址稳定的无序容器
+ * 元素存放在一串容量递增（64 到 8192）的块中，每个块带一个占用位图作为跳跃字段：
+ * 迭代时用 bit_ctz 按字跳过已删除的槽位，块内的元素是连续的，遍历比 list 更友好
+ * 删除只析构元素并清除占用位，O(1)，其它元素的指针、引用、迭代器都不会失效
+ * 插入优先复用有空闲槽位的块中编号最小的空位，没有空位时才申请新块，同样不会使其它元素失效
+ * 插入位置不确定，元素的迭代顺序不是插入顺序
+ * 删除后变空的块会被释放（最后一个块除外），capacity() 随之减少
+ */
+
+#include <initializer_list>
+
+#include "allocator.h"
+#include "bit_iterator.h"
+#include "construct.h"
+#include "algobase.h"
+#include "exceptdef.h"
+
+namespace leptstl
+{
+    /* hive 的块：槽位数组、占用位图以及两条链表的指针*/
+    template <typename T>
+        struct hive_block
+        {
+            T*          slots;      /* capacity 个槽位*/
+            bit_word*   occupied;   /* 第 i 位为1表示第 i 个槽位上有元素*/
+            size_t      capacity;   /* 槽位数，64 的倍数*/
+            size_t      size;       /* 元素个数*/
+            hive_block* prev;       /* 迭代顺序上的前后块*/
+            hive_block* next;
+            hive_block* prev_free;  /* 有空闲槽位的块组成的链表*/
+            hive_block* next_free;
+
+            /* 不小于 i 的第一个有元素的槽位，没有则返回 capacity*/
+            size_t next_set(size_t i) const noexcept
+            {
+                size_t w = i / bit_word_bits;
+                if (i >= capacity)
+                    return capacity;
+                bit_word bits = occupied[w] & (~bit_word(0) << (i % bit_word_bits));
+                const size_t words = capacity / bit_word_bits;
+                while (bits == 0)
+                {
+                    if (++w == words)
+                        return capacity;
+                    bits = occupied[w];
+                }
+                return w * bit_word_bits + bit_ctz(bits);
+            }
+
+            /* 小于 i 的最后一个有元素的槽位，没有则返回 capacity*/
+            size_t prev_set(size_t i) const noexcept
+            {
+                if (i == 0)
+                    return capacity;
+                --i;
+                size_t w = i / bit_word_bits;
+                bit_word bits = occupied[w] & (~bit_word(0) >> (bit_word_bits - 1 - i % bit_word_bits));
+                while (bits == 0)
+                {
+                    if (w == 0)
+                        return capacity;
+                    bits = occupied[--w];
+                }
+                return w * bit_word_bits + bit_msb(bits);
+            }
+
+            /* 第一个空闲槽位，调用前保证 size < capacity*/
+            size_t first_free() const noexcept
+            {
+                size_t w = 0;
+                while (occupied[w] == ~bit_word(0))
+                    ++w;
+                return w * bit_word_bits + bit_ctz(~occupied[w]);
+            }
+
+            bool test(size_t i) const noexcept
+            { return (occupied[i / bit_word_bits] >> (i % bit_word_bits)) & 1; }
+        };
+
+    /* hive 的迭代器：所在的块以及槽位下标*/
+    template <typename T, typename Ref, typename Ptr>
+        struct hive_iterator : public iterator<bidirectional_iterator_tag, T>
+        {
+            typedef hive_iterator<T, T&, T*>                iterator;
+            typedef hive_iterator<T, const T&, const T*>    const_iterator;
+            typedef hive_iterator                           self;
+
+            typedef T               value_type;
+            typedef Ptr             pointer;
+            typedef Ref             reference;
+            typedef ptrdiff_t       difference_type;
+            typedef hive_block<T>*  block_ptr;
+
+            block_ptr block;    /* 所在的块，空容器时为 nullptr*/
+            size_t    index;    /* 块内的槽位，end() 为最后一个块的 capacity*/
+
+            hive_iterator() noexcept : block(nullptr), index(0) {}
+            hive_iterator(block_ptr b, size_t i) noexcept : block(b), index(i) {}
+            hive_iterator(const iterator& rhs) noexcept : block(rhs.block), index(rhs.index) {}
+            self& operator=(const self& rhs) = default;
+
+            reference operator*()  const { return block->slots[index]; }
+            pointer   operator->() const { return &(operator*()); }
+
+            self& operator++()
+            {
+                LEPTSTL_DEBUG(block != nullptr);
+                /* 下一个槽位有元素时直接前进，不依赖 ctz 的结果，便于处理器预测执行*/
+                const size_t j = index + 1;
+                if (j < block->capacity && block->test(j))
+                {
+                    index = j;
+                    return *this;
+                }
+                index = block->next_set(j);
+                while (index == block->capacity && block->next != nullptr)
+                {
+                    block = block->next;
+                    index = block->next_set(0);
+                }
+                return *this;
+            }
+            self operator++(int)
+            {
+                self tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            self& operator--()
+            {
+                LEPTSTL_DEBUG(block != nullptr);
+                index = block->prev_set(index);
+                while (index == block->capacity)
+                {
+                    block = block->prev;
+                    LEPTSTL_DEBUG(block != nullptr);
+                    index = block->prev_set(block->capacity);
+                }
+                return *this;
+            }
+            self operator--(int)
+            {
+                self tmp = *this;
+                --*this;
+                return tmp;
+            }
+
+            bool operator==(const self& rhs) const { return block == rhs.block && index == rhs.index; }
+            bool operator!=(const self& rhs) const { return !(*this == rhs); }
+        };
+
+    /* 模板类 hive，参数一代表元素类型*/
+    template <typename T>
+        class hive
+        {
+        public:
+            typedef leptstl::allocator<T>                       allocator_type;
+            typedef leptstl::allocator<T>                       data_allocator;
+            typedef leptstl::allocator<bit_word>                bits_allocator;
+            typedef leptstl::allocator<hive_block<T>>           block_allocator;
+
+            typedef typename allocator_type::value_type         value_type;
+            typedef typename allocator_type::pointer            pointer;
+            typedef typename allocator_type::const_pointer      const_pointer;
+            typedef typename allocator_type::reference          reference;
+            typedef typename allocator_type::const_reference    const_reference;
+            typedef typename allocator_type::size_type          size_type;
+            typedef typename allocator_type::difference_type    difference_type;
+
+            typedef hive_iterator<T, T&, T*>                    iterator;
+            typedef hive_iterator<T, const T&, const T*>        const_iterator;
+            typedef leptstl::reverse_iterator<iterator>         reverse_iterator;
+            typedef leptstl::reverse_iterator<const_iterator>   const_reverse_iterator;
+
+            typedef hive_block<T>*                              block_ptr;
+
+            allocator_type get_allocator() { return allocator_type(); }
+
+        private:
+            /* 块容量的上下限*/
+            enum : size_t { min_block_capacity = 64, max_block_capacity = 8192 };
+
+            block_ptr   head_;       /* 第一个块*/
+            block_ptr   tail_;       /* 最后一个块*/
+            block_ptr   free_head_;  /* 有空闲槽位的块*/
+            size_type   size_;
+            size_type   capacity_;
+
+        public:
+            /* 构造 复制 移动 析构函数*/
+            hive() noexcept
+                : head_(nullptr), tail_(nullptr), free_head_(nullptr), size_(0), capacity_(0) {}
+
+            explicit hive(size_type n)
+                : hive()
+            { fill_init(n, value_type()); }
+
+            hive(size_type n, const value_type& value)
+                : hive()
+            { fill_init(n, value); }
+
+            template <typename Iter, typename std::enable_if<
+                leptstl::is_input_iterator<Iter>::value, int>::type = 0>
+                hive(Iter first, Iter last)
+                : hive()
+                {
+                    range_init(first, last);
+                }
+
+            hive(std::initializer_list<value_type> ilist)
+                : hive()
+            { range_init(ilist.begin(), ilist.end()); }
+
+            hive(const hive& rhs)
+                : hive()
+            { range_init(rhs.begin(), rhs.end()); }
+
+            hive(hive&& rhs) noexcept
+                : head_(rhs.head_), tail_(rhs.tail_), free_head_(rhs.free_head_),
+                size_(rhs.size_), capacity_(rhs.capacity_)
+            {
+                rhs.head_ = rhs.tail_ = rhs.free_head_ = nullptr;
+                rhs.size_ = rhs.capacity_ = 0;
+            }
+
+            hive& operator=(const hive& rhs)
+            {
+                if (this != &rhs)
+                {
+                    hive tmp(rhs);
+                    swap(tmp);
+                }
+                return *this;
+            }
+            hive& operator=(hive&& rhs) noexcept
+            {
+                hive tmp(leptstl::move(rhs));
+                swap(tmp);
+                return *this;
+            }
+            hive& operator=(std::initializer_list<value_type> ilist)
+            {
+                hive tmp(ilist);
+                swap(tmp);
+                return *this;
+            }
+
+            ~hive()
+            { destroy_all(); }
+
+        public:
+            /* 迭代器相关操作，begin 从第一个块的 -1 号槽位前进一步得到*/
+            iterator begin() noexcept
+            { return tail_ == nullptr ? iterator() : ++iterator(head_, static_cast<size_t>(-1)); }
+            const_iterator begin() const noexcept
+            { return tail_ == nullptr ? const_iterator() : ++const_iterator(head_, static_cast<size_t>(-1)); }
+            iterator end() noexcept
+            { return tail_ == nullptr ? iterator() : iterator(tail_, tail_->capacity); }
+            const_iterator end() const noexcept
+            { return tail_ == nullptr ? const_iterator() : const_iterator(tail_, tail_->capacity); }
+
+            reverse_iterator        rbegin()          noexcept
+            { return reverse_iterator(end()); }
+            const_reverse_iterator  rbegin()    const noexcept
+            { return const_reverse_iterator(end()); }
+            reverse_iterator        rend()            noexcept
+            { return reverse_iterator(begin()); }
+            const_reverse_iterator  rend()      const noexcept
+            { return const_reverse_iterator(begin()); }
+
+            const_iterator          cbegin()    const noexcept
+            { return begin(); }
+            const_iterator          cend()      const noexcept
+            { return end(); }
+            const_reverse_iterator  crbegin()   const noexcept
+            { return rbegin(); }
+            const_reverse_iterator  crend()     const noexcept
+            { return rend(); }
+
+            /* 容量相关操作*/
+            bool      empty()    const noexcept { return size_ == 0; }
+            size_type size()     const noexcept { return size_; }
+            size_type capacity() const noexcept { return capacity_; }
+            size_type max_size() const noexcept { return static_cast<size_type>(-1) / sizeof(T); }
+            /* 预先申请块，使 capacity() 不小于 n*/
+            void      reserve(size_type n);
+
+            /* 修改容器相关操作*/
+            template <typename... Args>
+                iterator emplace(Args&&... args);
+
+            iterator insert(const value_type& value)
+            { return emplace(value); }
+            iterator insert(value_type&& value)
+            { return emplace(leptstl::move(value)); }
+            void insert(size_type n, const value_type& value)
+            {
+                reserve(size_ + n);
+                for (; n > 0; --n)
+                    emplace(value);
+            }
+            template <typename Iter, typename std::enable_if<
+                leptstl::is_input_iterator<Iter>::value, int>::type = 0>
+                void insert(Iter first, Iter last)
+                {
+                    for (; first != last; ++first)
+                        emplace(*first);
+                }
+            void insert(std::initializer_list<value_type> ilist)
+            { insert(ilist.begin(), ilist.end()); }
+
+            /* 删除 pos 处的元素，返回下一个元素的迭代器*/
+            iterator erase(const_iterator pos);
+            iterator erase(const_iterator first, const_iterator last);
+            void     clear() noexcept;
+
+            /* 由元素的地址得到迭代器，p 必须指向容器中的元素*/
+            iterator get_iterator(const_pointer p) noexcept;
+
+            void swap(hive& rhs) noexcept
+            {
+                leptstl::swap(head_, rhs.head_);
+                leptstl::swap(tail_, rhs.tail_);
+                leptstl::swap(free_head_, rhs.free_head_);
+                leptstl::swap(size_, rhs.size_);
+                leptstl::swap(capacity_, rhs.capacity_);
+            }
+
+        private:
+            void fill_init(size_type n, const value_type& value)
+            {
+                try
+                {
+                    insert(n, value);
+                }
+                catch (...)
+                {
+                    destroy_all();
+                    throw;
+                }
+            }
+            template <typename Iter>
+                void range_init(Iter first, Iter last)
+                {
+                    try
+                    {
+                        insert(first, last);
+                    }
+                    catch (...)
+                    {
+                        destroy_all();
+                        throw;
+                    }
+                }
+
+            /* 析构所有元素并释放所有块*/
+            void destroy_all() noexcept
+            {
+                clear();
+                while (head_ != nullptr)
+                    free_block(head_);
+            }
+
+            block_ptr new_block(size_type cap);
+            void      free_block(block_ptr b) noexcept;
+            void      push_free(block_ptr b) noexcept
+            {
+                b->prev_free = nullptr;
+                b->next_free = free_head_;
+                if (free_head_ != nullptr)
+                    free_head_->prev_free = b;
+                free_head_ = b;
+            }
+            void      pop_free(block_ptr b) noexcept
+            {
+                if (b->prev_free != nullptr)
+                    b->prev_free->next_free = b->next_free;
+                else
+                    free_head_ = b->next_free;
+                if (b->next_free != nullptr)
+                    b->next_free->prev_free = b->prev_free;
+                b->prev_free = b->next_free = nullptr;
+            }
+            size_type next_block_capacity() const noexcept
+            {
+                if (tail_ == nullptr)
+                    return min_block_capacity;
+                return leptstl::min(static_cast<size_type>(tail_->capacity * 2),
+                                    static_cast<size_type>(max_block_capacity));
+            }
+        };
+
+    /*************************************************************************/
+
+    template <typename T>
+        void hive<T>::reserve(size_type n)
+        {
+            THROW_LENGTH_ERROR_IF(n > max_size(), "hive<T>'s size too big");
+            while (capacity_ < n)
+            {
+                const size_type want = (n - capacity_ + bit_word_bits - 1) / bit_word_bits * bit_word_bits;
+                new_block(leptstl::min(leptstl::max(want, static_cast<size_type>(min_block_capacity)),
+                                       static_cast<size_type>(max_block_capacity)));
+            }
+        }
+
+    template <typename T>
+        template <typename... Args>
+        typename hive<T>::iterator hive<T>::emplace(Args&&... args)
+        {
+            block_ptr b = free_head_ != nullptr ? free_head_ : new_block(next_block_capacity());
+            const size_t i = b->first_free();
+            leptstl::construct(b->slots + i, leptstl::forward<Args>(args)...);
+            b->occupied[i / bit_word_bits] |= bit_word(1) << (i % bit_word_bits);
+            if (++b->size == b->capacity)
+                pop_free(b);
+            ++size_;
+            return iterator(b, i);
+        }
+
+    template <typename T>
+        typename hive<T>::iterator hive<T>::erase(const_iterator pos)
+        {
+            block_ptr b = pos.block;
+            const size_t i = pos.index;
+            LEPTSTL_DEBUG(b != nullptr && i < b->capacity && b->test(i));
+            iterator next(b, i);
+            ++next;
+            leptstl::destroy(b->slots + i);
+            b->occupied[i / bit_word_bits] &= ~(bit_word(1) << (i % bit_word_bits));
+            if (b->size-- == b->capacity)
+                push_free(b);
+            --size_;
+            if (b->size == 0 && b != tail_)
+            {
+                /* next 在后面的块中，不受释放影响*/
+                free_block(b);
+            }
+            return next;
+        }
+
+    template <typename T>
+        typename hive<T>::iterator hive<T>::erase(const_iterator first, const_iterator last)
+        {
+            iterator cur(first.block, first.index);
+            const iterator stop(last.block, last.index);
+            while (cur != stop)
+                cur = erase(cur);
+            return cur;
+        }
+
+    template <typename T>
+        void hive<T>::clear() noexcept
+        {
+            for (block_ptr b = head_; b != nullptr; b = b->next)
+            {
+                if (b->size == 0)
+                    continue;
+                if (!std::is_trivially_destructible<T>::value)
+                {
+                    for (size_t i = b->next_set(0); i != b->capacity; i = b->next_set(i + 1))
+                        leptstl::destroy(b->slots + i);
+                }
+                for (size_t w = 0; w < b->capacity / bit_word_bits; ++w)
+                    b->occupied[w] = 0;
+                if (b->size == b->capacity)
+                    push_free(b);
+                b->size = 0;
+            }
+            size_ = 0;
+        }
+
+    template <typename T>
+        typename hive<T>::iterator hive<T>::get_iterator(const_pointer p) noexcept
+        {
+            for (block_ptr b = head_; b != nullptr; b = b->next)
+            {
+                if (p >= b->slots && p < b->slots + b->capacity)
+                    return iterator(b, static_cast<size_t>(p - b->slots));
+            }
+            return end();
+        }
+
+    /* 申请一个新块接到末尾，并放入空闲链表*/
+    template <typename T>
+        typename hive<T>::block_ptr hive<T>::new_block(size_type cap)
+        {
+            block_ptr b = block_allocator::allocate(1);
+            b->slots = nullptr;
+            b->occupied = nullptr;
+            try
+            {
+                b->slots = data_allocator::allocate(cap);
+                b->occupied = bits_allocator::allocate(cap / bit_word_bits);
+            }
+            catch (...)
+            {
+                data_allocator::deallocate(b->slots, cap);
+                block_allocator::deallocate(b, 1);
+                throw;
+            }
+            for (size_t w = 0; w < cap / bit_word_bits; ++w)
+                b->occupied[w] = 0;
+            b->capacity = cap;
+            b->size = 0;
+            b->prev = tail_;
+            b->next = nullptr;
+            if (tail_ != nullptr)
+                tail_->next = b;
+            else
+                head_ = b;
+            tail_ = b;
+            push_free(b);
+            capacity_ += cap;
+            return b;
+        }
+
+    /* 释放一个空块*/
+    template <typename T>
+        void hive<T>::free_block(block_ptr b) noexcept
+        {
+            LEPTSTL_DEBUG(b->size == 0);
+            pop_free(b);
+            if (b->prev != nullptr)
+                b->prev->next = b->next;
+            else
+                head_ = b->next;
+            if (b->next != nullptr)
+                b->next->prev = b->prev;
+            else
+                tail_ = b->prev;
+            capacity_ -= b->capacity;
+            bits_allocator::deallocate(b->occupied, b->capacity / bit_word_bits);
+            data_allocator::deallocate(b->slots, b->capacity);
+            block_allocator::deallocate(b, 1);
+        }
+
+    /*************************************************************************/
+    /* 重载比较操作符：元素个数相同且按迭代顺序逐个相等*/
+    template <typename T>
+        bool operator==(const hive<T>& lhs, const hive<T>& rhs)
+        {
+            return lhs.size() == rhs.size() && leptstl::equal(lhs.begin(), lhs.end(), rhs.begin());
+        }
+
+    template <typename T>
+        bool operator!=(const hive<T>& lhs, const hive<T>& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+    /*重载leptstl::swap*/
+    template <typename T>
+        void swap(hive<T>& lhs, hive<T>& rhs) noexcept
+        {
+            lhs.swap(rhs);
+        }
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_HIVE_H__ */
@@ -0,0 +1,161 @@
+/*************************************************************************
+	> File Name: hugepage_allocator.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Mon 19 Oct 2026 10:26:43 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_HUGEPAGE_ALLOCATOR_H__
+#define LEPTSTL_HUGEPAGE_ALLOCATOR_H__
+
+/* 此头文件包含一个模板类hugepage_allocator，为大块的容器存储提供大页内存
+ * 不小于 LEPTSTL_HUGEPAGE_THRESHOLD 字节的块按大页对齐后 mmap：
+ * 先尝试 MAP_HUGETLB（需要系统预留大页），失败则退回普通映射并用 madvise(MADV_HUGEPAGE) 请求透明大页；
+ * 参数 Node >= 0 时在首次访问前用 mbind 把这段内存优先放在该 NUMA 节点上（失败时忽略）
+ * 更小的块交给 ::operator new，非 Linux 平台全部交给 ::operator new
+ * 与 allocator 一样只有静态成员函数，可以作为 vector、deque（缓冲区）以及 hashtable（桶数组）的分配器参数，
+ * 例如 vector<int, hugepage_allocator<int>>；deque 默认的缓冲区只有 4KB，要用第三个模板参数把缓冲区设为一个大页，
+ * 例如 deque<int, hugepage_allocator<int>, LEPTSTL_HUGEPAGE_SIZE / sizeof(int)>
+ * deallocate 必须给出与分配时相同的元素个数
+ */
+
+#include <cstdint>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "allocator.h"
+
+namespace leptstl
+{
+/* 大页大小，x86-64 上为 2MB*/
+#ifndef LEPTSTL_HUGEPAGE_SIZE
+#define LEPTSTL_HUGEPAGE_SIZE (static_cast<size_t>(2) << 20)
+#endif
+
+/* 不小于此字节数的块才使用大页*/
+#ifndef LEPTSTL_HUGEPAGE_THRESHOLD
+#define LEPTSTL_HUGEPAGE_THRESHOLD LEPTSTL_HUGEPAGE_SIZE
+#endif
+
+    /* 模板类 hugepage_allocator，参数一代表元素类型，参数二代表 NUMA 节点（-1 表示不绑定）*/
+    template <typename T, int Node = -1>
+        class hugepage_allocator : public allocator<T>
+        {
+            static_assert(Node >= -1 && Node < 64, "hugepage_allocator supports NUMA nodes 0-63");
+            public:
+                typedef typename allocator<T>::size_type    size_type;
+
+            public:
+                static T* allocate(size_type n);
+                static void deallocate(T* ptr, size_type n);
+
+            private:
+                static bool use_huge(size_type n) noexcept
+                {
+#if defined(__linux__)
+                    return n * sizeof(T) >= static_cast<size_t>(LEPTSTL_HUGEPAGE_THRESHOLD);
+#else
+                    (void)n;
+                    return false;
+#endif
+                }
+                /* 映射长度按大页向上取整*/
+                static size_t map_bytes(size_type n) noexcept
+                {
+                    return (n * sizeof(T) + LEPTSTL_HUGEPAGE_SIZE - 1) / LEPTSTL_HUGEPAGE_SIZE * LEPTSTL_HUGEPAGE_SIZE;
+                }
+                static void* map_huge(size_t len);
+        };
+
+    template <typename T, int Node>
+        T* hugepage_allocator<T, Node>::allocate(size_type n)
+        {
+            if (n == 0)
+                return nullptr;
+            if (n > static_cast<size_type>(-1) / sizeof(T) - LEPTSTL_HUGEPAGE_SIZE)
+                throw std::bad_alloc();
+#if LEPTSTL_ALLOC_STATS_ON
+            T* p = use_huge(n) ? static_cast<T*>(map_huge(map_bytes(n))) : static_cast<T*>(::operator new(n * sizeof(T)));
+            alloc_stats::record_allocate<T>(n * sizeof(T));
+            return p;
+#else
+            if (use_huge(n))
+                return static_cast<T*>(map_huge(map_bytes(n)));
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+#endif
+        }
+
+    template <typename T, int Node>
+        void hugepage_allocator<T, Node>::deallocate(T* ptr, size_type n)
+        {
+            if (ptr == nullptr)
+                return;
+#if LEPTSTL_ALLOC_STATS_ON
+            alloc_stats::record_deallocate<T>(n * sizeof(T));
+#endif
+#if defined(__linux__)
+            if (use_huge(n))
+            {
+                ::munmap(static_cast<void*>(ptr), map_bytes(n));
+                return;
+            }
+#endif
+            ::operator delete(ptr);
+        }
+
+    template <typename T, int Node>
+        void* hugepage_allocator<T, Node>::map_huge(size_t len)
+        {
+#if defined(__linux__)
+            void* p = MAP_FAILED;
+#ifdef MAP_HUGETLB
+            p = ::mmap(nullptr, len, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif
+            if (p == MAP_FAILED)
+            {
+                /* 多映射一个大页，裁掉首尾使起始地址按大页对齐，透明大页才能整页映射*/
+                void* raw = ::mmap(nullptr, len + LEPTSTL_HUGEPAGE_SIZE, PROT_READ | PROT_WRITE,
+                                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (raw == MAP_FAILED)
+                    throw std::bad_alloc();
+                const uintptr_t addr = reinterpret_cast<uintptr_t>(raw);
+                const uintptr_t aligned = (addr + LEPTSTL_HUGEPAGE_SIZE - 1) & ~(static_cast<uintptr_t>(LEPTSTL_HUGEPAGE_SIZE) - 1);
+                if (aligned != addr)
+                    ::munmap(raw, aligned - addr);
+                const size_t tail = LEPTSTL_HUGEPAGE_SIZE - (aligned - addr);
+                if (tail != 0)
+                    ::munmap(reinterpret_cast<void*>(aligned + len), tail);
+                p = reinterpret_cast<void*>(aligned);
+#ifdef MADV_HUGEPAGE
+                ::madvise(p, len, MADV_HUGEPAGE);
+#endif
+            }
+#ifdef SYS_mbind
+            if (Node >= 0)
+            {
+                /* MPOL_PREFERRED：优先在该节点分配，节点内存不足时退回其它节点*/
+                const unsigned long mask = 1ul << (Node < 0 ? 0 : Node);
+                ::syscall(SYS_mbind, p, len, 1 /* MPOL_PREFERRED */, &mask, sizeof(mask) * 8 + 1, 0);
+            }
+#endif
+            return p;
+#else
+            return ::operator new(len);
+#endif
+        }
+
+    template <typename T, int Node, typename U>
+        struct allocator_rebind<hugepage_allocator<T, Node>, U>
+        {
+            typedef hugepage_allocator<U, Node> type;
+        };
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_HUGEPAGE_ALLOCATOR_H__ */
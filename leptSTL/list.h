@@ -94,6 +94,7 @@ namespace leptstl
             list_iterator(base_ptr x) : node_(x) {}
             list_iterator(node_ptr x) : node_(x->as_base()) {}
             list_iterator(const list_iterator& rhs) : node_(rhs.node_) {}
+            list_iterator& operator=(const list_iterator&) = default;
 
             /*重载操作符*/
             reference operator*()   const { return node_->as_node()->value; }
@@ -147,6 +148,7 @@ namespace leptstl
             list_const_iterator(node_ptr x) : node_(x->as_base()) {}
             list_const_iterator(const list_iterator<T>& rhs) : node_(rhs.node_) {}
             list_const_iterator(const list_const_iterator<T>& rhs) : node_(rhs.node_) {}
+            list_const_iterator& operator=(const list_const_iterator&) = default;
 
             /*重载操作符*/
             reference operator*()   const { return node_->as_node()->value; }
@@ -0,0 +1,341 @@
+/*************************************************************************
+	> File Name: lockfree_queue.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Mon 19 Oct 2026 11:02:17 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_LOCKFREE_QUEUE_H__
+#define LEPTSTL_LOCKFREE_QUEUE_H__
+
+/* 此头文件包含两个无锁有界队列：
+ * spsc_queue：单生产者单消费者，头尾索引分处不同缓存行，支持批量 push / pop
+ * mpmc_queue：多生产者多消费者，每个槽位带序号（Dmitry Vyukov 的有界队列）
+ * 容量均向上取整为2的幂，try_* 系列不阻塞，push / pop 在满 / 空时自旋让出
+ */
+
+#include <atomic>
+#include <thread>
+#include <type_traits>
+
+#include "memory.h"
+#include "util.h"
+#include "exceptdef.h"
+
+namespace leptstl
+{
+/* 缓存行大小，用于隔开被不同线程频繁写的数据*/
+#ifndef LEPTSTL_CACHE_LINE_SIZE
+#define LEPTSTL_CACHE_LINE_SIZE 64
+#endif
+
+    /* 返回不小于n的2的幂*/
+    inline size_t lfq_round_up_pow2(size_t n)
+    {
+        size_t cap = 1;
+        while (cap < n)
+            cap <<= 1;
+        return cap;
+    }
+
+    /*****************************************************************************************/
+    /* 模板类 spsc_queue */
+    template <typename T>
+        class spsc_queue
+        {
+            public:
+                typedef leptstl::allocator<T>                   data_allocator;
+                typedef T                                       value_type;
+                typedef size_t                                  size_type;
+
+            private:
+                typedef std::atomic<size_type>                  index_type;
+
+                /* 只读数据*/
+                T*          buffer_;
+                size_type   mask_;
+                char        pad0_[LEPTSTL_CACHE_LINE_SIZE];
+
+                /* 生产者独占：写位置以及缓存的读位置*/
+                index_type  tail_;
+                size_type   head_cache_;
+                char        pad1_[LEPTSTL_CACHE_LINE_SIZE];
+
+                /* 消费者独占：读位置以及缓存的写位置*/
+                index_type  head_;
+                size_type   tail_cache_;
+                char        pad2_[LEPTSTL_CACHE_LINE_SIZE];
+
+            public:
+                explicit spsc_queue(size_type capacity)
+                    :buffer_(nullptr), mask_(0), tail_(0), head_cache_(0), head_(0), tail_cache_(0)
+                {
+                    const size_type cap = lfq_round_up_pow2(capacity < 2 ? 2 : capacity);
+                    buffer_ = data_allocator::allocate(cap);
+                    mask_ = cap - 1;
+                }
+
+                spsc_queue(const spsc_queue&) = delete;
+                spsc_queue& operator=(const spsc_queue&) = delete;
+
+                ~spsc_queue()
+                {
+                    size_type head = head_.load(std::memory_order_relaxed);
+                    const size_type tail = tail_.load(std::memory_order_relaxed);
+                    for (; head != tail; ++head)
+                        data_allocator::destroy(buffer_ + (head & mask_));
+                    data_allocator::deallocate(buffer_, mask_ + 1);
+                }
+
+                /* 以下函数只能由生产者调用*/
+                template <typename ...Args>
+                    bool try_emplace(Args&& ...args);
+                bool try_push(const value_type& value) { return try_emplace(value); }
+                bool try_push(value_type&& value)      { return try_emplace(leptstl::move(value)); }
+                void push(const value_type& value)
+                {
+                    while (!try_emplace(value))
+                        std::this_thread::yield();
+                }
+                /* 批量写入[first, first+n)，一次发布，返回实际写入的数量*/
+                size_type try_push_n(const value_type* first, size_type n);
+
+                /* 以下函数只能由消费者调用*/
+                bool try_pop(value_type& out);
+                void pop(value_type& out)
+                {
+                    while (!try_pop(out))
+                        std::this_thread::yield();
+                }
+                /* 批量读取至多n个元素到out，一次释放，返回实际读取的数量*/
+                size_type try_pop_n(value_type* out, size_type n);
+
+                /* 近似值，仅用于统计*/
+                size_type size_approx() const noexcept
+                {
+                    return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+                }
+                bool      empty_approx() const noexcept { return size_approx() == 0; }
+                size_type capacity()     const noexcept { return mask_ + 1; }
+        };  /* spsc_queue */
+
+    /* 就地构造元素，队列满时返回false*/
+    template <typename T>
+        template <typename ...Args>
+        bool spsc_queue<T>::try_emplace(Args&& ...args)
+        {
+            const size_type tail = tail_.load(std::memory_order_relaxed);
+            if (tail - head_cache_ > mask_)
+            { /* 缓存的读位置已经过期才去读共享的 head_*/
+                head_cache_ = head_.load(std::memory_order_acquire);
+                if (tail - head_cache_ > mask_)
+                    return false;
+            }
+            data_allocator::construct(buffer_ + (tail & mask_), leptstl::forward<Args>(args)...);
+            tail_.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+    template <typename T>
+        typename spsc_queue<T>::size_type
+        spsc_queue<T>::try_push_n(const value_type* first, size_type n)
+        {
+            const size_type tail = tail_.load(std::memory_order_relaxed);
+            size_type free = mask_ + 1 - (tail - head_cache_);
+            if (free < n)
+            {
+                head_cache_ = head_.load(std::memory_order_acquire);
+                free = mask_ + 1 - (tail - head_cache_);
+            }
+            n = leptstl::min(n, free);
+            for (size_type i = 0; i < n; ++i)
+                data_allocator::construct(buffer_ + ((tail + i) & mask_), first[i]);
+            tail_.store(tail + n, std::memory_order_release);
+            return n;
+        }
+
+    /* 取出头部元素，队列空时返回false*/
+    template <typename T>
+        bool spsc_queue<T>::try_pop(value_type& out)
+        {
+            const size_type head = head_.load(std::memory_order_relaxed);
+            if (head == tail_cache_)
+            {
+                tail_cache_ = tail_.load(std::memory_order_acquire);
+                if (head == tail_cache_)
+                    return false;
+            }
+            T* p = buffer_ + (head & mask_);
+            out = leptstl::move(*p);
+            data_allocator::destroy(p);
+            head_.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+    template <typename T>
+        typename spsc_queue<T>::size_type
+        spsc_queue<T>::try_pop_n(value_type* out, size_type n)
+        {
+            const size_type head = head_.load(std::memory_order_relaxed);
+            if (tail_cache_ - head < n)
+                tail_cache_ = tail_.load(std::memory_order_acquire);
+            n = leptstl::min(n, tail_cache_ - head);
+            for (size_type i = 0; i < n; ++i)
+            {
+                T* p = buffer_ + ((head + i) & mask_);
+                out[i] = leptstl::move(*p);
+                data_allocator::destroy(p);
+            }
+            head_.store(head + n, std::memory_order_release);
+            return n;
+        }
+
+    /*****************************************************************************************/
+    /* mpmc_queue 的槽位：序号标记该槽位当前可写还是可读*/
+    template <typename T>
+        struct mpmc_cell
+        {
+            std::atomic<size_t>                                             seq;
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type      storage;
+
+            T* value_ptr() noexcept { return reinterpret_cast<T*>(&storage); }
+        };
+
+    /* 模板类 mpmc_queue */
+    template <typename T>
+        class mpmc_queue
+        {
+            public:
+                typedef T                                       value_type;
+                typedef size_t                                  size_type;
+                typedef mpmc_cell<T>                            cell_type;
+                typedef leptstl::allocator<T>                   data_allocator;
+                typedef leptstl::allocator<cell_type>           cell_allocator;
+
+            private:
+                typedef std::atomic<size_type>                  index_type;
+
+                cell_type*  cells_;
+                size_type   mask_;
+                char        pad0_[LEPTSTL_CACHE_LINE_SIZE];
+                index_type  enqueue_pos_;
+                char        pad1_[LEPTSTL_CACHE_LINE_SIZE];
+                index_type  dequeue_pos_;
+                char        pad2_[LEPTSTL_CACHE_LINE_SIZE];
+
+            public:
+                explicit mpmc_queue(size_type capacity)
+                    :cells_(nullptr), mask_(0), enqueue_pos_(0), dequeue_pos_(0)
+                {
+                    const size_type cap = lfq_round_up_pow2(capacity < 2 ? 2 : capacity);
+                    cells_ = cell_allocator::allocate(cap);
+                    for (size_type i = 0; i < cap; ++i)
+                        ::new (static_cast<void*>(&cells_[i].seq)) std::atomic<size_type>(i);
+                    mask_ = cap - 1;
+                }
+
+                mpmc_queue(const mpmc_queue&) = delete;
+                mpmc_queue& operator=(const mpmc_queue&) = delete;
+
+                ~mpmc_queue()
+                {
+                    size_type head = dequeue_pos_.load(std::memory_order_relaxed);
+                    const size_type tail = enqueue_pos_.load(std::memory_order_relaxed);
+                    for (; head != tail; ++head)
+                        data_allocator::destroy(cells_[head & mask_].value_ptr());
+                    cell_allocator::deallocate(cells_, mask_ + 1);
+                }
+
+                template <typename ...Args>
+                    bool try_emplace(Args&& ...args);
+                bool try_push(const value_type& value) { return try_emplace(value); }
+                bool try_push(value_type&& value)      { return try_emplace(leptstl::move(value)); }
+                void push(const value_type& value)
+                {
+                    while (!try_emplace(value))
+                        std::this_thread::yield();
+                }
+
+                bool try_pop(value_type& out);
+                void pop(value_type& out)
+                {
+                    while (!try_pop(out))
+                        std::this_thread::yield();
+                }
+
+                size_type size_approx() const noexcept
+                {
+                    const size_type tail = enqueue_pos_.load(std::memory_order_acquire);
+                    const size_type head = dequeue_pos_.load(std::memory_order_acquire);
+                    return tail > head ? tail - head : 0;
+                }
+                bool      empty_approx() const noexcept { return size_approx() == 0; }
+                size_type capacity()     const noexcept { return mask_ + 1; }
+        };  /* mpmc_queue */
+
+    /* 抢占 enqueue_pos_ 所指的槽位，槽位序号等于位置时可写*/
+    template <typename T>
+        template <typename ...Args>
+        bool mpmc_queue<T>::try_emplace(Args&& ...args)
+        {
+            cell_type* cell;
+            size_type pos = enqueue_pos_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                cell = &cells_[pos & mask_];
+                const size_type seq = cell->seq.load(std::memory_order_acquire);
+                const auto diff = static_cast<ptrdiff_t>(seq) - static_cast<ptrdiff_t>(pos);
+                if (diff == 0)
+                {
+                    if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0)
+                { /* 槽位尚未被消费，队列已满*/
+                    return false;
+                }
+                else
+                {
+                    pos = enqueue_pos_.load(std::memory_order_relaxed);
+                }
+            }
+            data_allocator::construct(cell->value_ptr(), leptstl::forward<Args>(args)...);
+            cell->seq.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+    /* 抢占 dequeue_pos_ 所指的槽位，槽位序号等于位置+1时可读*/
+    template <typename T>
+        bool mpmc_queue<T>::try_pop(value_type& out)
+        {
+            cell_type* cell;
+            size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                cell = &cells_[pos & mask_];
+                const size_type seq = cell->seq.load(std::memory_order_acquire);
+                const auto diff = static_cast<ptrdiff_t>(seq) - static_cast<ptrdiff_t>(pos + 1);
+                if (diff == 0)
+                {
+                    if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0)
+                { /* 槽位尚未被生产，队列为空*/
+                    return false;
+                }
+                else
+                {
+                    pos = dequeue_pos_.load(std::memory_order_relaxed);
+                }
+            }
+            out = leptstl::move(*cell->value_ptr());
+            data_allocator::destroy(cell->value_ptr());
+            cell->seq.store(pos + mask_ + 1, std::memory_order_release);
+            return true;
+        }
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_LOCKFREE_QUEUE_H__ */
+
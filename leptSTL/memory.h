@@ -107,6 +107,7 @@ namespace leptstl
     /* 构造函数*/
     template<typename ForwardIter, typename T>
         temporary_buffer<ForwardIter, T>::temporary_buffer(ForwardIter first, ForwardIter last)
+        :original_len(0), len(0), buffer(nullptr)
         {
             try 
             {
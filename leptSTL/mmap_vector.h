@@ -0,0 +1,428 @@
+/*************************************************************************
+	> File Name: mmap_vector.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 12:31:09 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_MMAP_VECTOR_H__
+#define LEPTSTL_MMAP_VECTOR_H__
+
+/* 此头文件包含一个模板类 mmap_vector，元素直接存放在映射到内存的文件中
+ * 文件内容就是连续的 T 数组，没有文件头，元素个数 = 文件长度 / sizeof(T)
+ * 打开文件只做一次 mmap，不读取内容，启动时间与文件大小无关，页面在首次访问时才调入
+ * push_back 等增长操作按倍数 ftruncate 扩大文件并重新映射（Linux 上用 mremap），
+ * 因此文件长度可能暂时大于 size()；flush()、close() 与析构函数会把文件截断到 size() 并 msync
+ * 以 read_only 打开时映射为只读，修改容器的操作抛出 runtime_error，通过迭代器写入会触发 SIGSEGV
+ * 迭代器是原生指针，可以直接用于 leptstl::sort, lower_bound 等算法；增长后原有的迭代器失效
+ * 只支持可平凡复制的类型，且不同机器之间的字节序、对齐需要调用者自行保证一致
+ */
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "algobase.h"
+#include "iterator.h"
+#include "exceptdef.h"
+
+namespace leptstl
+{
+    /* 打开方式：只读；读写（文件不存在时创建）；读写并清空原有内容*/
+    enum class mmap_mode
+    {
+        read_only,
+        read_write,
+        truncate
+    };
+
+    /* 模板类 mmap_vector，参数一代表元素类型*/
+    template <typename T>
+        class mmap_vector
+        {
+            static_assert(std::is_trivially_copyable<T>::value,
+                          "mmap_vector requires a trivially copyable type");
+        public:
+            typedef T                                           value_type;
+            typedef T*                                          pointer;
+            typedef const T*                                    const_pointer;
+            typedef T&                                          reference;
+            typedef const T&                                    const_reference;
+            typedef size_t                                      size_type;
+            typedef ptrdiff_t                                   difference_type;
+
+            typedef value_type*                                 iterator;
+            typedef const value_type*                           const_iterator;
+            typedef leptstl::reverse_iterator<iterator>         reverse_iterator;
+            typedef leptstl::reverse_iterator<const_iterator>   const_reverse_iterator;
+
+        private:
+            int         fd_;        /* 文件描述符，未打开时为-1*/
+            T*          data_;      /* 映射的起始地址*/
+            size_type   size_;      /* 元素个数*/
+            size_type   file_cap_;  /* 文件长度能容纳的元素个数*/
+            size_t      map_len_;   /* 映射的字节数，按页对齐，不小于文件长度*/
+            bool        read_only_;
+
+        public:
+            /* 构造 移动 析构函数*/
+            mmap_vector() noexcept
+                : fd_(-1), data_(nullptr), size_(0), file_cap_(0), map_len_(0), read_only_(false) {}
+
+            explicit mmap_vector(const char* path, mmap_mode mode = mmap_mode::read_write)
+                : mmap_vector()
+            { open(path, mode); }
+
+            explicit mmap_vector(const std::string& path, mmap_mode mode = mmap_mode::read_write)
+                : mmap_vector()
+            { open(path.c_str(), mode); }
+
+            mmap_vector(const mmap_vector&) = delete;
+            mmap_vector& operator=(const mmap_vector&) = delete;
+
+            mmap_vector(mmap_vector&& rhs) noexcept
+                : fd_(rhs.fd_), data_(rhs.data_), size_(rhs.size_), file_cap_(rhs.file_cap_),
+                map_len_(rhs.map_len_), read_only_(rhs.read_only_)
+            {
+                rhs.fd_ = -1;
+                rhs.data_ = nullptr;
+                rhs.size_ = rhs.file_cap_ = rhs.map_len_ = 0;
+            }
+
+            mmap_vector& operator=(mmap_vector&& rhs) noexcept
+            {
+                if (this != &rhs)
+                {
+                    quiet_close();
+                    fd_ = rhs.fd_;
+                    data_ = rhs.data_;
+                    size_ = rhs.size_;
+                    file_cap_ = rhs.file_cap_;
+                    map_len_ = rhs.map_len_;
+                    read_only_ = rhs.read_only_;
+                    rhs.fd_ = -1;
+                    rhs.data_ = nullptr;
+                    rhs.size_ = rhs.file_cap_ = rhs.map_len_ = 0;
+                }
+                return *this;
+            }
+
+            ~mmap_vector()
+            { quiet_close(); }
+
+        public:
+            /* 打开与关闭*/
+            void open(const char* path, mmap_mode mode = mmap_mode::read_write);
+            /* 截断到 size() 并写回磁盘，然后解除映射、关闭文件*/
+            void close();
+            /* 把文件截断到 size()，并同步写回已修改的页面*/
+            void flush();
+
+            bool is_open()   const noexcept { return fd_ != -1; }
+            bool read_only() const noexcept { return read_only_; }
+
+            /* 迭代器相关操作*/
+            iterator                begin()           noexcept { return data_; }
+            const_iterator          begin()     const noexcept { return data_; }
+            iterator                end()             noexcept { return data_ + size_; }
+            const_iterator          end()       const noexcept { return data_ + size_; }
+
+            reverse_iterator        rbegin()          noexcept { return reverse_iterator(end()); }
+            const_reverse_iterator  rbegin()    const noexcept { return const_reverse_iterator(end()); }
+            reverse_iterator        rend()            noexcept { return reverse_iterator(begin()); }
+            const_reverse_iterator  rend()      const noexcept { return const_reverse_iterator(begin()); }
+
+            const_iterator          cbegin()    const noexcept { return begin(); }
+            const_iterator          cend()      const noexcept { return end(); }
+            const_reverse_iterator  crbegin()   const noexcept { return rbegin(); }
+            const_reverse_iterator  crend()     const noexcept { return rend(); }
+
+            /* 容量相关操作*/
+            bool        empty()     const noexcept { return size_ == 0; }
+            size_type   size()      const noexcept { return size_; }
+            size_type   capacity()  const noexcept { return file_cap_; }
+            size_type   max_size()  const noexcept { return static_cast<size_type>(-1) / sizeof(T); }
+            void        reserve(size_type n);
+
+            /* 访问元素相关操作*/
+            reference operator[](size_type n)
+            {
+                LEPTSTL_DEBUG(n < size());
+                return data_[n];
+            }
+            const_reference operator[](size_type n) const
+            {
+                LEPTSTL_DEBUG(n < size());
+                return data_[n];
+            }
+            reference at(size_type n)
+            {
+                THROW_OUT_OF_RANGE_IF(!(n < size()), "mmap_vector<T>::at() subscript out of range");
+                return data_[n];
+            }
+            const_reference at(size_type n) const
+            {
+                THROW_OUT_OF_RANGE_IF(!(n < size()), "mmap_vector<T>::at() subscript out of range");
+                return data_[n];
+            }
+            reference front()
+            {
+                LEPTSTL_DEBUG(!empty());
+                return data_[0];
+            }
+            const_reference front() const
+            {
+                LEPTSTL_DEBUG(!empty());
+                return data_[0];
+            }
+            reference back()
+            {
+                LEPTSTL_DEBUG(!empty());
+                return data_[size_ - 1];
+            }
+            const_reference back() const
+            {
+                LEPTSTL_DEBUG(!empty());
+                return data_[size_ - 1];
+            }
+            pointer       data()       noexcept { return data_; }
+            const_pointer data() const noexcept { return data_; }
+
+            /* 修改容器相关操作*/
+            void push_back(const value_type& value)
+            {
+                check_writable();
+                if (size_ == file_cap_)
+                    grow_file(get_new_cap(1));
+                data_[size_++] = value;
+            }
+            template <typename... Args>
+                reference emplace_back(Args&&... args)
+                {
+                    check_writable();
+                    if (size_ == file_cap_)
+                        grow_file(get_new_cap(1));
+                    data_[size_] = value_type(leptstl::forward<Args>(args)...);
+                    return data_[size_++];
+                }
+            void pop_back()
+            {
+                check_writable();
+                LEPTSTL_DEBUG(!empty());
+                --size_;
+            }
+            void resize(size_type new_size)
+            { resize(new_size, value_type()); }
+            void resize(size_type new_size, const value_type& value);
+            void clear()
+            {
+                check_writable();
+                size_ = 0;
+            }
+
+            void swap(mmap_vector& rhs) noexcept
+            {
+                leptstl::swap(fd_, rhs.fd_);
+                leptstl::swap(data_, rhs.data_);
+                leptstl::swap(size_, rhs.size_);
+                leptstl::swap(file_cap_, rhs.file_cap_);
+                leptstl::swap(map_len_, rhs.map_len_);
+                leptstl::swap(read_only_, rhs.read_only_);
+            }
+
+        private:
+            static size_t page_round(size_t bytes) noexcept
+            {
+                const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+                return (bytes + page - 1) / page * page;
+            }
+            void check_writable() const
+            {
+                THROW_RUNTIME_ERROR_IF(fd_ == -1, "mmap_vector<T>: file is not open");
+                THROW_RUNTIME_ERROR_IF(read_only_, "mmap_vector<T>: file is opened read-only");
+            }
+            size_type get_new_cap(size_type add_size) const
+            {
+                const size_type min_cap = leptstl::max(static_cast<size_type>(page_round(1) / sizeof(T)),
+                                                       static_cast<size_type>(1));
+                const size_type need = size_ + add_size;
+                return leptstl::max(leptstl::max(need, file_cap_ + file_cap_ / 2), min_cap);
+            }
+            void grow_file(size_type new_cap);
+            void remap(size_t new_len);
+            void quiet_close() noexcept;
+            void release() noexcept;
+        };
+
+    /*************************************************************************/
+
+    template <typename T>
+        void mmap_vector<T>::open(const char* path, mmap_mode mode)
+        {
+            close();
+            read_only_ = mode == mmap_mode::read_only;
+            int flags = read_only_ ? O_RDONLY : (O_RDWR | O_CREAT);
+            if (mode == mmap_mode::truncate)
+                flags |= O_TRUNC;
+            fd_ = ::open(path, flags | O_CLOEXEC, 0644);
+            THROW_RUNTIME_ERROR_IF(fd_ == -1, (std::string("mmap_vector<T>: cannot open ") + path
+                                               + ": " + std::strerror(errno)).c_str());
+            struct stat st;
+            if (::fstat(fd_, &st) != 0)
+            {
+                release();
+                THROW_RUNTIME_ERROR_IF(true, "mmap_vector<T>: fstat failed");
+            }
+            const size_t bytes = static_cast<size_t>(st.st_size);
+            size_ = file_cap_ = bytes / sizeof(T);
+            try
+            {
+                remap(page_round(bytes));
+            }
+            catch (...)
+            {
+                release();
+                throw;
+            }
+        }
+
+    template <typename T>
+        void mmap_vector<T>::flush()
+        {
+            if (fd_ == -1 || read_only_)
+                return;
+            if (file_cap_ != size_)
+            {
+                THROW_RUNTIME_ERROR_IF(::ftruncate(fd_, static_cast<off_t>(size_ * sizeof(T))) != 0,
+                                       "mmap_vector<T>: ftruncate failed");
+                file_cap_ = size_;
+            }
+            if (size_ != 0)
+                THROW_RUNTIME_ERROR_IF(::msync(static_cast<void*>(data_), page_round(size_ * sizeof(T)), MS_SYNC) != 0,
+                                       "mmap_vector<T>: msync failed");
+        }
+
+    template <typename T>
+        void mmap_vector<T>::close()
+        {
+            if (fd_ == -1)
+                return;
+            flush();
+            release();
+        }
+
+    /* 析构与移动赋值中使用：截断或写回失败时不抛出异常，仍然解除映射、关闭文件*/
+    template <typename T>
+        void mmap_vector<T>::quiet_close() noexcept
+        {
+            try
+            {
+                close();
+            }
+            catch (...)
+            {
+                release();
+            }
+        }
+
+    template <typename T>
+        void mmap_vector<T>::reserve(size_type n)
+        {
+            check_writable();
+            if (n > file_cap_)
+                grow_file(n);
+        }
+
+    template <typename T>
+        void mmap_vector<T>::resize(size_type new_size, const value_type& value)
+        {
+            check_writable();
+            if (new_size > file_cap_)
+                grow_file(leptstl::max(new_size, get_new_cap(0)));
+            for (size_type i = size_; i < new_size; ++i)
+                data_[i] = value;
+            size_ = new_size;
+        }
+
+    /* 扩大文件，映射不够大时重新映射*/
+    template <typename T>
+        void mmap_vector<T>::grow_file(size_type new_cap)
+        {
+            THROW_LENGTH_ERROR_IF(new_cap > max_size(), "mmap_vector<T>'s size too big");
+            const size_t bytes = new_cap * sizeof(T);
+            THROW_RUNTIME_ERROR_IF(::ftruncate(fd_, static_cast<off_t>(bytes)) != 0,
+                                   "mmap_vector<T>: ftruncate failed");
+            if (bytes > map_len_)
+                remap(page_round(bytes));
+            file_cap_ = new_cap;
+        }
+
+    template <typename T>
+        void mmap_vector<T>::remap(size_t new_len)
+        {
+            if (new_len == map_len_)
+                return;
+            void* p = MAP_FAILED;
+            if (map_len_ == 0)
+            {
+                p = ::mmap(nullptr, new_len, read_only_ ? PROT_READ : (PROT_READ | PROT_WRITE),
+                           MAP_SHARED, fd_, 0);
+            }
+            else
+            {
+#if defined(__linux__)
+                p = ::mremap(static_cast<void*>(data_), map_len_, new_len, MREMAP_MAYMOVE);
+#else
+                p = ::mmap(nullptr, new_len, read_only_ ? PROT_READ : (PROT_READ | PROT_WRITE),
+                           MAP_SHARED, fd_, 0);
+                if (p != MAP_FAILED)
+                    ::munmap(static_cast<void*>(data_), map_len_);
+#endif
+            }
+            THROW_RUNTIME_ERROR_IF(p == MAP_FAILED, "mmap_vector<T>: mmap failed");
+            data_ = static_cast<T*>(p);
+            map_len_ = new_len;
+        }
+
+    /* 解除映射并关闭文件，不截断*/
+    template <typename T>
+        void mmap_vector<T>::release() noexcept
+        {
+            if (map_len_ != 0)
+                ::munmap(static_cast<void*>(data_), map_len_);
+            if (fd_ != -1)
+                ::close(fd_);
+            fd_ = -1;
+            data_ = nullptr;
+            size_ = file_cap_ = map_len_ = 0;
+        }
+
+    /*************************************************************************/
+    /* 重载比较操作符*/
+    template <typename T>
+        bool operator==(const mmap_vector<T>& lhs, const mmap_vector<T>& rhs)
+        {
+            return lhs.size() == rhs.size() && leptstl::equal(lhs.begin(), lhs.end(), rhs.begin());
+        }
+
+    template <typename T>
+        bool operator!=(const mmap_vector<T>& lhs, const mmap_vector<T>& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+    /*重载leptstl::swap*/
+    template <typename T>
+        void swap(mmap_vector<T>& lhs, mmap_vector<T>& rhs) noexcept
+        {
+            lhs.swap(rhs);
+        }
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_MMAP_VECTOR_H__ */
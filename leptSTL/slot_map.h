@@ -0,0 +1,300 @@
+/*************************************************************************
+	> File Name: slot_map.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 03:18:45 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_SLOT_MAP_H__
+#define LEPTSTL_SLOT_MAP_H__
+
+/* 此头文件包含一个模板类 slot_map，用带代数（generation）的 64 位句柄访问元素
+ * 句柄的低 32 位是槽位下标，高 32 位是槽位的代数；元素删除时槽位代数加一，旧句柄随之失效，
+ * 因此用已删除元素的句柄查找只会得到 nullptr，不会访问到复用同一槽位的新元素
+ * 元素紧密地存放在一个 vector 中，删除时把最后一个元素移到空位，遍历就是遍历这个 vector
+ * 插入、删除、查找都是 O(1)；删除会改变元素在 vector 中的位置，但不会改变其它元素的句柄
+ * 代数从1开始，值为0的句柄（null_handle）永远无效
+ */
+
+#include <cstdint>
+
+#include "vector.h"
+#include "exceptdef.h"
+
+namespace leptstl
+{
+    /* 模板类 slot_map，参数一代表元素类型*/
+    template <typename T>
+        class slot_map
+        {
+        public:
+            typedef uint64_t                                        handle_type;
+            typedef leptstl::vector<T>                              value_vector;
+
+            typedef typename value_vector::value_type               value_type;
+            typedef typename value_vector::pointer                  pointer;
+            typedef typename value_vector::const_pointer            const_pointer;
+            typedef typename value_vector::reference                reference;
+            typedef typename value_vector::const_reference          const_reference;
+            typedef typename value_vector::size_type                size_type;
+            typedef typename value_vector::difference_type          difference_type;
+
+            typedef typename value_vector::iterator                 iterator;
+            typedef typename value_vector::const_iterator           const_iterator;
+            typedef typename value_vector::reverse_iterator         reverse_iterator;
+            typedef typename value_vector::const_reverse_iterator   const_reverse_iterator;
+
+            static constexpr handle_type null_handle = 0;
+
+        private:
+            /* 槽位：占用时 index 是元素在 values_ 中的下标，空闲时是下一个空闲槽位*/
+            struct slot
+            {
+                uint32_t index;
+                uint32_t generation;
+            };
+
+            static constexpr uint32_t npos = static_cast<uint32_t>(-1);
+
+            value_vector               values_;    /* 紧密存放的元素*/
+            leptstl::vector<uint32_t>  owners_;    /* owners_[i] 是 values_[i] 所在的槽位*/
+            leptstl::vector<slot>      slots_;
+            uint32_t                   free_head_; /* 空闲槽位链表*/
+
+        public:
+            /* 构造 复制 移动函数*/
+            slot_map() noexcept
+                : free_head_(npos) {}
+
+            slot_map(const slot_map& rhs) = default;
+            slot_map& operator=(const slot_map& rhs) = default;
+
+            slot_map(slot_map&& rhs) noexcept
+                : values_(leptstl::move(rhs.values_)), owners_(leptstl::move(rhs.owners_)),
+                slots_(leptstl::move(rhs.slots_)), free_head_(rhs.free_head_)
+            {
+                rhs.free_head_ = npos;
+            }
+            slot_map& operator=(slot_map&& rhs) noexcept
+            {
+                slot_map tmp(leptstl::move(rhs));
+                swap(tmp);
+                return *this;
+            }
+
+        public:
+            /* 迭代器相关操作，按紧密存放的顺序遍历*/
+            iterator                begin()           noexcept { return values_.begin(); }
+            const_iterator          begin()     const noexcept { return values_.begin(); }
+            iterator                end()             noexcept { return values_.end(); }
+            const_iterator          end()       const noexcept { return values_.end(); }
+            reverse_iterator        rbegin()          noexcept { return values_.rbegin(); }
+            const_reverse_iterator  rbegin()    const noexcept { return values_.rbegin(); }
+            reverse_iterator        rend()            noexcept { return values_.rend(); }
+            const_reverse_iterator  rend()      const noexcept { return values_.rend(); }
+            const_iterator          cbegin()    const noexcept { return begin(); }
+            const_iterator          cend()      const noexcept { return end(); }
+
+            /* 容量相关操作*/
+            bool      empty()    const noexcept { return values_.empty(); }
+            size_type size()     const noexcept { return values_.size(); }
+            size_type capacity() const noexcept { return values_.capacity(); }
+            size_type max_size() const noexcept { return static_cast<size_type>(npos); }
+            void      reserve(size_type n)
+            {
+                values_.reserve(n);
+                owners_.reserve(n);
+                slots_.reserve(n);
+            }
+
+            /* 查找相关操作*/
+            bool contains(handle_type h) const noexcept
+            { return find_index(h) != npos; }
+
+            /* 句柄有效时返回元素的地址，否则返回 nullptr*/
+            pointer find(handle_type h) noexcept
+            {
+                const uint32_t i = find_index(h);
+                return i == npos ? nullptr : values_.data() + i;
+            }
+            const_pointer find(handle_type h) const noexcept
+            {
+                const uint32_t i = find_index(h);
+                return i == npos ? nullptr : values_.data() + i;
+            }
+
+            reference operator[](handle_type h)
+            {
+                LEPTSTL_DEBUG(contains(h));
+                return values_[slots_[slot_of(h)].index];
+            }
+            const_reference operator[](handle_type h) const
+            {
+                LEPTSTL_DEBUG(contains(h));
+                return values_[slots_[slot_of(h)].index];
+            }
+            reference at(handle_type h)
+            {
+                THROW_OUT_OF_RANGE_IF(!contains(h), "slot_map<T>::at() invalid handle");
+                return (*this)[h];
+            }
+            const_reference at(handle_type h) const
+            {
+                THROW_OUT_OF_RANGE_IF(!contains(h), "slot_map<T>::at() invalid handle");
+                return (*this)[h];
+            }
+
+            /* 紧密存放的第 i 个元素的句柄，用于遍历时取得句柄*/
+            handle_type handle_at(size_type i) const noexcept
+            {
+                LEPTSTL_DEBUG(i < size());
+                const uint32_t s = owners_[i];
+                return make_handle(s, slots_[s].generation);
+            }
+            handle_type handle_of(const_iterator pos) const noexcept
+            { return handle_at(static_cast<size_type>(pos - begin())); }
+
+            /* 修改容器相关操作*/
+            template <typename... Args>
+                handle_type emplace(Args&&... args);
+
+            handle_type insert(const value_type& value)
+            { return emplace(value); }
+            handle_type insert(value_type&& value)
+            { return emplace(leptstl::move(value)); }
+
+            /* 删除句柄对应的元素，句柄无效时返回 false*/
+            bool erase(handle_type h);
+            /* 删除 pos 处的元素，最后一个元素会被移到 pos，返回 pos*/
+            iterator erase(const_iterator pos);
+
+            void clear();
+
+            void swap(slot_map& rhs) noexcept
+            {
+                values_.swap(rhs.values_);
+                owners_.swap(rhs.owners_);
+                slots_.swap(rhs.slots_);
+                leptstl::swap(free_head_, rhs.free_head_);
+            }
+
+        private:
+            static handle_type make_handle(uint32_t s, uint32_t generation) noexcept
+            { return (static_cast<handle_type>(generation) << 32) | s; }
+            static uint32_t slot_of(handle_type h) noexcept
+            { return static_cast<uint32_t>(h); }
+            static uint32_t generation_of(handle_type h) noexcept
+            { return static_cast<uint32_t>(h >> 32); }
+
+            /* 句柄有效时返回元素在 values_ 中的下标，否则返回 npos*/
+            uint32_t find_index(handle_type h) const noexcept
+            {
+                const uint32_t s = slot_of(h);
+                if (s >= slots_.size() || slots_[s].generation != generation_of(h))
+                    return npos;
+                return slots_[s].index;
+            }
+
+            void erase_index(uint32_t i);
+        };
+
+    template <typename T>
+        constexpr typename slot_map<T>::handle_type slot_map<T>::null_handle;
+
+    template <typename T>
+        constexpr uint32_t slot_map<T>::npos;
+
+    /*************************************************************************/
+
+    template <typename T>
+        template <typename... Args>
+        typename slot_map<T>::handle_type slot_map<T>::emplace(Args&&... args)
+        {
+            THROW_LENGTH_ERROR_IF(size() >= max_size() - 1, "slot_map<T>'s size too big");
+            if (free_head_ == npos)
+            {
+                slot fresh = { npos, 1 };
+                slots_.push_back(fresh);
+                free_head_ = static_cast<uint32_t>(slots_.size() - 1);
+            }
+            const uint32_t s = free_head_;
+            values_.emplace_back(leptstl::forward<Args>(args)...);
+            try
+            {
+                owners_.push_back(s);
+            }
+            catch (...)
+            {
+                values_.pop_back();
+                throw;
+            }
+            free_head_ = slots_[s].index;
+            slots_[s].index = static_cast<uint32_t>(values_.size() - 1);
+            return make_handle(s, slots_[s].generation);
+        }
+
+    template <typename T>
+        bool slot_map<T>::erase(handle_type h)
+        {
+            const uint32_t i = find_index(h);
+            if (i == npos)
+                return false;
+            erase_index(i);
+            return true;
+        }
+
+    template <typename T>
+        typename slot_map<T>::iterator slot_map<T>::erase(const_iterator pos)
+        {
+            const uint32_t i = static_cast<uint32_t>(pos - begin());
+            LEPTSTL_DEBUG(i < size());
+            erase_index(i);
+            return begin() + i;
+        }
+
+    /* 把最后一个元素移到 i，释放 i 原来的槽位*/
+    template <typename T>
+        void slot_map<T>::erase_index(uint32_t i)
+        {
+            const uint32_t s = owners_[i];
+            const uint32_t last = static_cast<uint32_t>(values_.size() - 1);
+            if (i != last)
+            {
+                values_[i] = leptstl::move(values_[last]);
+                owners_[i] = owners_[last];
+                slots_[owners_[i]].index = i;
+            }
+            values_.pop_back();
+            owners_.pop_back();
+            /* 代数加一使旧句柄失效，跳过0以保证 null_handle 无效*/
+            if (++slots_[s].generation == 0)
+                slots_[s].generation = 1;
+            slots_[s].index = free_head_;
+            free_head_ = s;
+        }
+
+    template <typename T>
+        void slot_map<T>::clear()
+        {
+            for (size_type i = 0; i < owners_.size(); ++i)
+            {
+                slot& sl = slots_[owners_[i]];
+                if (++sl.generation == 0)
+                    sl.generation = 1;
+                sl.index = free_head_;
+                free_head_ = owners_[i];
+            }
+            values_.clear();
+            owners_.clear();
+        }
+
+    /*重载leptstl::swap*/
+    template <typename T>
+        void swap(slot_map<T>& lhs, slot_map<T>& rhs) noexcept
+        {
+            lhs.swap(rhs);
+        }
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_SLOT_MAP_H__ */
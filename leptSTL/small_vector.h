@@ -0,0 +1,680 @@
+/*************************************************************************
+	> File Name: small_vector.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Mon 19 Oct 2026 08:14:36 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_SMALL_VECTOR_H__
+#define LEPTSTL_SMALL_VECTOR_H__
+
+/* 此头文件包含一个模板类small_vector
+ * 接口与 vector 相同，前 N 个元素保存在对象内部的缓冲区中，超过 N 个时才申请堆空间，
+ * 适合绝大多数时候只有几个元素的场合，省去一次堆分配并且元素与对象本身在同一缓存行
+ * 与 vector 不同，移动构造 / 移动赋值 / swap 在元素位于内部缓冲区时需要逐个搬迁元素，
+ * 迭代器也会随之失效
+ * 区间 insert / assign 的区间不能来自容器自身
+ */
+
+#include <initializer_list>
+
+#include "algo.h"
+#include "exceptdef.h"
+
+namespace leptstl
+{
+    /* 模板类 small_vector，参数一代表元素类型，参数二代表内部缓冲区可容纳的元素个数*/
+    template <typename T, size_t N = 8>
+        class small_vector
+        {
+            static_assert(N > 0, "small_vector needs at least one inline element");
+            static_assert(!std::is_same<bool, T>::value, "small_vector<bool> is abandoned in leptstl");
+        public:
+            typedef leptstl::allocator<T>                           allocator_type;
+            typedef leptstl::allocator<T>                           data_allocator;
+
+            typedef typename allocator_type::value_type             value_type;
+            typedef typename allocator_type::pointer                pointer;
+            typedef typename allocator_type::const_pointer          const_pointer;
+            typedef typename allocator_type::reference              reference;
+            typedef typename allocator_type::const_reference        const_reference;
+            typedef typename allocator_type::size_type              size_type;
+            typedef typename allocator_type::difference_type        difference_type;
+
+            typedef value_type*                                     iterator;
+            typedef const value_type*                               const_iterator;
+            typedef leptstl::reverse_iterator<iterator>             reverse_iterator;
+            typedef leptstl::reverse_iterator<const_iterator>       const_reverse_iterator;
+
+            allocator_type get_allocator() { return data_allocator(); }
+
+            static constexpr size_type inline_capacity = N;
+
+        private:
+            iterator begin_; /*表示目前使用空间的头部*/
+            iterator end_;   /*表示目前使用空间的尾部*/
+            iterator cap_;   /*表示目前储存空间的尾部*/
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type buf_[N]; /*内部缓冲区*/
+
+        public:
+            /*构造 复制 移动 析构*/
+            small_vector() noexcept
+            { init_inline(); }
+
+            explicit small_vector(size_type n)
+            {
+                init_inline();
+                resize(n);
+            }
+
+            small_vector(size_type n, const value_type& value)
+            {
+                init_inline();
+                insert(end_, n, value);
+            }
+
+            template<typename Iter, typename std::enable_if<
+                    leptstl::is_input_iterator<Iter>::value, int>::type = 0>
+                small_vector(Iter first, Iter last)
+                {
+                    init_inline();
+                    insert(end_, first, last);
+                }
+
+            small_vector(const small_vector& rhs)
+            {
+                init_inline();
+                insert(end_, rhs.begin_, rhs.end_);
+            }
+
+            small_vector(small_vector&& rhs) noexcept
+            {
+                init_inline();
+                steal(rhs);
+            }
+
+            small_vector(std::initializer_list<value_type> ilist)
+            {
+                init_inline();
+                insert(end_, ilist.begin(), ilist.end());
+            }
+
+            small_vector& operator=(const small_vector& rhs)
+            {
+                if(this != &rhs)
+                    assign(rhs.begin_, rhs.end_);
+                return *this;
+            }
+
+            small_vector& operator=(small_vector&& rhs) noexcept
+            {
+                if(this != &rhs)
+                {
+                    clear();
+                    release_heap();
+                    steal(rhs);
+                }
+                return *this;
+            }
+
+            small_vector& operator=(std::initializer_list<value_type> ilist)
+            {
+                assign(ilist.begin(), ilist.end());
+                return *this;
+            }
+
+            ~small_vector()
+            {
+                data_allocator::destroy(begin_, end_);
+                release_heap();
+            }
+
+        public:
+            /* 迭代器相关操作*/
+            iterator                begin()           noexcept
+            { return begin_; }
+            const_iterator          begin()     const noexcept
+            { return begin_; }
+            iterator                end()             noexcept
+            { return end_; }
+            const_iterator          end()       const noexcept
+            { return end_; }
+
+            reverse_iterator        rbegin()          noexcept
+            { return reverse_iterator(end()); }
+            const_reverse_iterator  rbegin()    const noexcept
+            { return const_reverse_iterator(end()); }
+            reverse_iterator        rend()            noexcept
+            { return reverse_iterator(begin()); }
+            const_reverse_iterator  rend()      const noexcept
+            { return const_reverse_iterator(begin()); }
+
+            const_iterator          cbegin()    const noexcept
+            { return begin(); }
+            const_iterator          cend()      const noexcept
+            { return end(); }
+            const_reverse_iterator  crbegin()   const noexcept
+            { return rbegin(); }
+            const_reverse_iterator  crend()     const noexcept
+            { return rend(); }
+
+            /* 容量相关操作*/
+            bool        empty()     const noexcept
+            { return begin_ == end_; }
+            size_type   size()      const noexcept
+            { return static_cast<size_type>(end_ - begin_); }
+            size_type   max_size()  const noexcept
+            { return static_cast<size_type>(-1) / sizeof(T); }
+            size_type   capacity()  const noexcept
+            { return static_cast<size_type>(cap_ - begin_); }
+            /* 元素是否仍保存在内部缓冲区中*/
+            bool        is_inline() const noexcept
+            { return begin_ == inline_begin(); }
+            void        reserve(size_type n)
+            {
+                if(capacity() < n)
+                {
+                    THROW_LENGTH_ERROR_IF(n > max_size(), "n can not larger than max_size() in small_vector<T, N>::reserve(n)");
+                    grow(n);
+                }
+            }
+            void        shrink_to_fit();
+
+            /* 访问元素相关操作*/
+            reference operator[](size_type n)
+            {
+                LEPTSTL_DEBUG(n < size());
+                return *(begin_ + n);
+            }
+            const_reference operator[](size_type n) const
+            {
+                LEPTSTL_DEBUG(n < size());
+                return *(begin_ + n);
+            }
+            reference at(size_type n)
+            {
+                THROW_OUT_OF_RANGE_IF(!(n < size()), "small_vector<T, N>::at() subscript out of range");
+                return (*this)[n];
+            }
+            const_reference at(size_type n) const
+            {
+                THROW_OUT_OF_RANGE_IF(!(n < size()), "small_vector<T, N>::at() subscript out of range");
+                return (*this)[n];
+            }
+
+            reference front()
+            {
+                LEPTSTL_DEBUG(!empty());
+                return *begin_;
+            }
+            const_reference front() const
+            {
+                LEPTSTL_DEBUG(!empty());
+                return *begin_;
+            }
+            reference back()
+            {
+                LEPTSTL_DEBUG(!empty());
+                return *(end_ - 1);
+            }
+            const_reference back() const
+            {
+                LEPTSTL_DEBUG(!empty());
+                return *(end_ - 1);
+            }
+
+            pointer         data()          noexcept { return begin_; }
+            const_pointer   data()  const   noexcept { return begin_; }
+
+            /* 修改容器相关操作*/
+            /* assign */
+            void assign(size_type n, const value_type& value)
+            {
+                const value_type value_copy = value;
+                clear();
+                insert(end_, n, value_copy);
+            }
+
+            template<typename Iter, typename std::enable_if<
+                    leptstl::is_input_iterator<Iter>::value, int>::type = 0>
+                void assign(Iter first, Iter last)
+                {
+                    clear();
+                    insert(end_, first, last);
+                }
+
+            void assign(std::initializer_list<value_type> il)
+            { assign(il.begin(), il.end()); }
+
+            /* emplace / emplace_back */
+            template<typename... Args>
+                iterator emplace(const_iterator pos, Args&& ...args);
+
+            template<typename... Args>
+                void emplace_back(Args&& ...args)
+                {
+                    if(end_ != cap_)
+                    {
+                        data_allocator::construct(end_, leptstl::forward<Args>(args)...);
+                        ++end_;
+                    }
+                    else
+                        grow_emplace_back(leptstl::forward<Args>(args)...);
+                }
+
+            /* push_back / pop_back */
+            void push_back(const value_type& value)
+            { emplace_back(value); }
+            void push_back(value_type&& value)
+            { emplace_back(leptstl::move(value)); }
+
+            void pop_back()
+            {
+                LEPTSTL_DEBUG(!empty());
+                data_allocator::destroy(end_ - 1);
+                --end_;
+            }
+
+            /* insert */
+            iterator insert(const_iterator pos, const value_type& value)
+            { return emplace(pos, value); }
+            iterator insert(const_iterator pos, value_type&& value)
+            { return emplace(pos, leptstl::move(value)); }
+
+            iterator insert(const_iterator pos, size_type n, const value_type& value);
+
+            template<typename Iter, typename std::enable_if<
+                    leptstl::is_input_iterator<Iter>::value, int>::type = 0>
+                iterator insert(const_iterator pos, Iter first, Iter last)
+                {
+                    LEPTSTL_DEBUG(pos >= begin() && pos <= end());
+                    return range_insert(const_cast<iterator>(pos), first, last, iterator_category(first));
+                }
+
+            iterator insert(const_iterator pos, std::initializer_list<value_type> il)
+            { return insert(pos, il.begin(), il.end()); }
+
+            /* erase / clear */
+            iterator erase(const_iterator pos)
+            {
+                LEPTSTL_DEBUG(pos >= begin() && pos < end());
+                return erase(pos, pos + 1);
+            }
+            iterator erase(const_iterator first, const_iterator last);
+            void     clear() noexcept
+            {
+                data_allocator::destroy(begin_, end_);
+                end_ = begin_;
+            }
+
+            /* resize / reverse */
+            void     resize(size_type new_size);
+            void     resize(size_type new_size, const value_type& value);
+
+            void     reverse() { leptstl::reverse(begin(), end()); }
+
+            /* swap */
+            void swap(small_vector& rhs) noexcept;
+
+        private:
+            /* helper functions */
+            pointer       inline_begin() noexcept
+            { return reinterpret_cast<pointer>(buf_); }
+            const_pointer inline_begin() const noexcept
+            { return reinterpret_cast<const_pointer>(buf_); }
+
+            void init_inline() noexcept
+            {
+                begin_ = end_ = inline_begin();
+                cap_ = begin_ + N;
+            }
+
+            void release_heap() noexcept
+            {
+                if(!is_inline())
+                    data_allocator::deallocate(begin_, capacity());
+                init_inline();
+            }
+
+            /* 取走 rhs 的元素：堆空间直接接管指针，内部缓冲区只能逐个搬迁；调用前*this为空且位于内部缓冲区*/
+            void steal(small_vector& rhs) noexcept
+            {
+                if(rhs.is_inline())
+                {
+                    end_ = leptstl::uninitialized_relocate(rhs.begin_, rhs.end_, begin_);
+                    rhs.end_ = rhs.begin_;
+                }
+                else
+                {
+                    begin_ = rhs.begin_;
+                    end_ = rhs.end_;
+                    cap_ = rhs.cap_;
+                    rhs.init_inline();
+                }
+            }
+
+            /* calculate the growth size */
+            size_type get_new_cap(size_type add_size) const
+            {
+                THROW_LENGTH_ERROR_IF(size() > max_size() - add_size, "small_vector<T, N>'s size too big");
+                const size_type cap = capacity();
+                return leptstl::max(cap + cap / 2, size() + add_size);
+            }
+
+            /* 把元素搬到容量为 new_cap 的新堆空间*/
+            void grow(size_type new_cap);
+
+            template<typename... Args>
+                void grow_emplace_back(Args&& ...args);
+
+            /* 在 pos 处空出 n 个未初始化的位置，要求容量足够且元素可平凡搬迁*/
+            void open_gap(iterator pos, size_type n) noexcept
+            {
+                leptstl::uninitialized_relocate(pos, end_, pos + n);
+                end_ += n;
+            }
+
+            template<typename Iter>
+                iterator range_insert(iterator pos, Iter first, Iter last, input_iterator_tag);
+            template<typename Iter>
+                iterator range_insert(iterator pos, Iter first, Iter last, forward_iterator_tag);
+
+        };  /* class small_vector */
+
+    template <typename T, size_t N>
+        constexpr typename small_vector<T, N>::size_type small_vector<T, N>::inline_capacity;
+
+    /*********************************************************************************/
+    /* 放弃多余容量，元素不超过N个时搬回内部缓冲区*/
+    template <typename T, size_t N>
+        void small_vector<T, N>::shrink_to_fit()
+        {
+            if(is_inline() || end_ == cap_)
+                return;
+            if(size() <= N)
+            {
+                pointer old_begin = begin_;
+                const size_type old_cap = capacity();
+                pointer old_end = end_;
+                init_inline();
+                end_ = leptstl::uninitialized_relocate(old_begin, old_end, begin_);
+                data_allocator::deallocate(old_begin, old_cap);
+            }
+            else
+                grow(size());
+        }
+
+    /* 在pos位置构造元素*/
+    template <typename T, size_t N>
+        template <typename ...Args>
+        typename small_vector<T, N>::iterator
+        small_vector<T, N>::emplace(const_iterator pos, Args&& ...args)
+        {
+            LEPTSTL_DEBUG(pos >= begin() && pos <= end());
+            const size_type n = pos - begin_;
+            if(pos == end_)
+            {
+                emplace_back(leptstl::forward<Args>(args)...);
+                return begin_ + n;
+            }
+            /* 先构造出新元素，args 可能引用容器内的元素*/
+            value_type tmp(leptstl::forward<Args>(args)...);
+            if(end_ == cap_)
+                grow(get_new_cap(1));
+            iterator xpos = begin_ + n;
+            if(is_trivially_relocatable<T>::value)
+            {
+                open_gap(xpos, 1);
+                data_allocator::construct(xpos, leptstl::move(tmp));
+            }
+            else
+            {
+                data_allocator::construct(end_, leptstl::move(*(end_ - 1)));
+                ++end_;
+                leptstl::move_backward(xpos, end_ - 2, end_ - 1);
+                *xpos = leptstl::move(tmp);
+            }
+            return xpos;
+        }
+
+    /* 在pos处插入n个value*/
+    template <typename T, size_t N>
+        typename small_vector<T, N>::iterator
+        small_vector<T, N>::insert(const_iterator pos, size_type n, const value_type& value)
+        {
+            LEPTSTL_DEBUG(pos >= begin() && pos <= end());
+            const size_type xpos = pos - begin_;
+            if(n == 0)
+                return begin_ + xpos;
+            const value_type value_copy = value;/*避免被覆盖*/
+            if(static_cast<size_type>(cap_ - end_) < n)
+                grow(get_new_cap(n));
+            iterator p = begin_ + xpos;
+            if(is_trivially_relocatable<T>::value)
+            {
+                iterator old_end = end_;
+                open_gap(p, n);
+                try
+                {
+                    leptstl::uninitialized_fill_n(p, n, value_copy);
+                }
+                catch(...)
+                {
+                    leptstl::uninitialized_relocate(p + n, end_, p);
+                    end_ = old_end;
+                    throw;
+                }
+            }
+            else
+            {
+                /* 先追加到尾部再旋转到位*/
+                iterator old_end = end_;
+                end_ = leptstl::uninitialized_fill_n(end_, n, value_copy);
+                leptstl::rotate(p, old_end, end_);
+            }
+            return p;
+        }
+
+    /* 输入迭代器只能逐个插入*/
+    template <typename T, size_t N>
+        template <typename Iter>
+        typename small_vector<T, N>::iterator
+        small_vector<T, N>::range_insert(iterator pos, Iter first, Iter last, input_iterator_tag)
+        {
+            const size_type xpos = pos - begin_;
+            for(size_type i = xpos; first != last; ++first, ++i)
+                emplace(begin_ + i, *first);
+            return begin_ + xpos;
+        }
+
+    template <typename T, size_t N>
+        template <typename Iter>
+        typename small_vector<T, N>::iterator
+        small_vector<T, N>::range_insert(iterator pos, Iter first, Iter last, forward_iterator_tag)
+        {
+            const size_type xpos = pos - begin_;
+            const size_type n = static_cast<size_type>(leptstl::distance(first, last));
+            if(n == 0)
+                return pos;
+            if(static_cast<size_type>(cap_ - end_) < n)
+                grow(get_new_cap(n));
+            iterator p = begin_ + xpos;
+            if(is_trivially_relocatable<T>::value)
+            {
+                iterator old_end = end_;
+                open_gap(p, n);
+                try
+                {
+                    leptstl::uninitialized_copy(first, last, p);
+                }
+                catch(...)
+                {
+                    leptstl::uninitialized_relocate(p + n, end_, p);
+                    end_ = old_end;
+                    throw;
+                }
+            }
+            else
+            {
+                iterator old_end = end_;
+                end_ = leptstl::uninitialized_copy(first, last, end_);
+                leptstl::rotate(p, old_end, end_);
+            }
+            return p;
+        }
+
+    /* 删除[firt,last)上的元素*/
+    template <typename T, size_t N>
+        typename small_vector<T, N>::iterator
+        small_vector<T, N>::erase(const_iterator first, const_iterator last)
+        {
+            LEPTSTL_DEBUG(first >= begin() && last <= end() && !(last < first));
+            iterator r = begin_ + (first - begin());
+            const size_type n = last - first;
+            if(is_trivially_relocatable<T>::value)
+            {
+                data_allocator::destroy(r, r + n);
+                leptstl::uninitialized_relocate(r + n, end_, r);
+            }
+            else
+                data_allocator::destroy(leptstl::move(r + n, end_, r), end_);
+            end_ -= n;
+            return r;
+        }
+
+    /* 重置容器大小*/
+    template <typename T, size_t N>
+        void small_vector<T, N>::resize(size_type new_size)
+        {
+            if(new_size < size())
+                erase(begin_ + new_size, end_);
+            else
+            {
+                reserve(new_size);
+                for(; size() < new_size; ++end_)
+                    data_allocator::construct(end_);
+            }
+        }
+
+    template <typename T, size_t N>
+        void small_vector<T, N>::resize(size_type new_size, const value_type& value)
+        {
+            if(new_size < size())
+                erase(begin_ + new_size, end_);
+            else
+                insert(end_, new_size - size(), value);
+        }
+
+    /* 与另一个small_vector交换，两者都在堆上时只交换指针*/
+    template <typename T, size_t N>
+        void small_vector<T, N>::swap(small_vector& rhs) noexcept
+        {
+            if(this == &rhs)
+                return;
+            if(!is_inline() && !rhs.is_inline())
+            {
+                leptstl::swap(begin_, rhs.begin_);
+                leptstl::swap(end_, rhs.end_);
+                leptstl::swap(cap_, rhs.cap_);
+                return;
+            }
+            small_vector tmp(leptstl::move(rhs));
+            rhs = leptstl::move(*this);
+            *this = leptstl::move(tmp);
+        }
+
+    /* grow */
+    template <typename T, size_t N>
+        void small_vector<T, N>::grow(size_type new_cap)
+        {
+            const size_type old_size = size();
+            pointer new_begin = data_allocator::allocate(new_cap);
+            try
+            {
+                leptstl::uninitialized_relocate(begin_, end_, new_begin);
+            }
+            catch(...)
+            {
+                data_allocator::deallocate(new_begin, new_cap);
+                throw;
+            }
+            if(!is_inline())
+                data_allocator::deallocate(begin_, capacity());
+            begin_ = new_begin;
+            end_ = new_begin + old_size;
+            cap_ = new_begin + new_cap;
+        }
+
+    /* 容量已满时在尾部构造：新元素先构造在新空间，再搬迁旧元素*/
+    template <typename T, size_t N>
+        template <typename ...Args>
+        void small_vector<T, N>::grow_emplace_back(Args&& ...args)
+        {
+            const size_type old_size = size();
+            const size_type new_cap = get_new_cap(1);
+            pointer new_begin = data_allocator::allocate(new_cap);
+            try
+            {
+                data_allocator::construct(new_begin + old_size, leptstl::forward<Args>(args)...);
+            }
+            catch(...)
+            {
+                data_allocator::deallocate(new_begin, new_cap);
+                throw;
+            }
+            leptstl::uninitialized_relocate(begin_, end_, new_begin);
+            if(!is_inline())
+                data_allocator::deallocate(begin_, capacity());
+            begin_ = new_begin;
+            end_ = new_begin + old_size + 1;
+            cap_ = new_begin + new_cap;
+        }
+
+    /*************************************************************************/
+    /* 重载比较操作符*/
+    template <typename T, size_t N>
+        bool operator==(const small_vector<T, N>& lhs, const small_vector<T, N>& rhs)
+        {
+            return lhs.size() == rhs.size() && leptstl::equal(lhs.begin(), lhs.end(), rhs.begin());
+        }
+
+    template <typename T, size_t N>
+        bool operator<(const small_vector<T, N>& lhs, const small_vector<T, N>& rhs)
+        {
+            return leptstl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+
+    template <typename T, size_t N>
+        bool operator!=(const small_vector<T, N>& lhs, const small_vector<T, N>& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+    template <typename T, size_t N>
+        bool operator>(const small_vector<T, N>& lhs, const small_vector<T, N>& rhs)
+        {
+            return rhs < lhs;
+        }
+
+    template <typename T, size_t N>
+        bool operator<=(const small_vector<T, N>& lhs, const small_vector<T, N>& rhs)
+        {
+            return !(rhs < lhs);
+        }
+
+    template <typename T, size_t N>
+        bool operator>=(const small_vector<T, N>& lhs, const small_vector<T, N>& rhs)
+        {
+            return !(lhs < rhs);
+        }
+
+    /*重载leptstl::swap*/
+    template <typename T, size_t N>
+        void swap(small_vector<T, N>& lhs, small_vector<T, N>& rhs) noexcept
+        {
+            lhs.swap(rhs);
+        }
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_SMALL_VECTOR_H__ */
@@ -0,0 +1,348 @@
+/*************************************************************************
+	> File Name: static_perfect_set.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 04:31:52 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_STATIC_PERFECT_SET_H__
+#define LEPTSTL_STATIC_PERFECT_SET_H__
+
+/* 此头文件包含一个模板类 static_perfect_set，用于固定不变的关键字表（HTTP 方法、配置项名称等）
+ * 在编译期为给定的 N 个字符串字面量找到一个种子，使它们的哈希在 table_size 个槽中互不冲突（完美哈希），
+ * 查找只需一次哈希、一次查表与一次比较，整个对象是字面量类型，可以是 constexpr 变量，不使用堆内存
+ *
+ *   constexpr auto methods = leptstl::make_static_perfect_set("GET", "HEAD", "POST", "PUT", "DELETE");
+ *   methods.contains(s);   // s 可以是 const char*、leptstl::string 或任何有 data() 与 size() 的字符串
+ *   methods.find(s);       // 返回 s 在初始列表中的下标，不存在时返回 npos，便于映射到枚举值
+ *
+ * 槽数是不小于 max(2N, N*N/4) 的 2 的幂，每个槽保存一个键的下标（N < 255 时一个字节）；
+ * 依次尝试 max_seeds 个种子，每个种子无冲突的概率约为 exp(-N*N / (2*table_size))
+ * 键有重复，或没有找到可用的种子时，编译期构造报错（运行期构造抛出 std::invalid_argument）
+ * 受 C++11 constexpr 的限制，构造过程全部写成递归，键的长度不宜超过数百个字符（递归深度）*/
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+namespace leptstl
+{
+    /* 编译期的下标序列 0, 1, ..., N-1，按二分拼接生成，模板递归深度为 log N*/
+    template <size_t... I>
+        struct static_index_sequence {};
+
+    template <typename A, typename B>
+        struct static_index_sequence_cat;
+
+    template <size_t... A, size_t... B>
+        struct static_index_sequence_cat<static_index_sequence<A...>, static_index_sequence<B...>>
+        {
+            typedef static_index_sequence<A..., (sizeof...(A) + B)...> type;
+        };
+
+    template <size_t N>
+        struct make_static_index_sequence
+        {
+            typedef typename static_index_sequence_cat<typename make_static_index_sequence<N / 2>::type,
+                                                       typename make_static_index_sequence<N - N / 2>::type>::type type;
+        };
+
+    template <>
+        struct make_static_index_sequence<0>
+        {
+            typedef static_index_sequence<> type;
+        };
+
+    template <>
+        struct make_static_index_sequence<1>
+        {
+            typedef static_index_sequence<0> type;
+        };
+
+    /***********************************************************/
+    /* 编译期与运行期结果相同的字符串哈希：每次取 8 个字节（小端序拼成一个 64 位字），乘法后右移异或，
+     * 最后经过 murmur3 的 fmix64 打散到全部的位；逐字而不是逐字节处理，十几个字符的键只需两轮乘法*/
+
+    constexpr size_t static_string_length(const char* s, size_t n = 0)
+    {
+        return s[n] == '\0' ? n : static_string_length(s, n + 1);
+    }
+
+    constexpr uint64_t static_hash_shift(uint64_t x, int shift)
+    {
+        return x ^ (x >> shift);
+    }
+
+    constexpr uint64_t static_hash_finalize(uint64_t x)
+    {
+        return static_hash_shift(static_hash_shift(static_hash_shift(x, 33) * 0xff51afd7ed558ccdull, 33)
+                                 * 0xc4ceb9fe1a85ec53ull, 33);
+    }
+
+    /* s 的前 n（<= 8）个字节按小端序拼成的字*/
+    constexpr uint64_t static_read_word(const char* s, size_t n)
+    {
+        return n == 0 ? 0 : static_cast<unsigned char>(s[0]) | (static_read_word(s + 1, n - 1) << 8);
+    }
+
+    constexpr uint64_t static_hash_round(uint64_t h, uint64_t word)
+    {
+        return static_hash_shift((h ^ word) * 0x9fb21c651e98df25ull, 29);
+    }
+
+    /* 每轮 8 个字节，最后一轮是剩下的 1 到 8 个字节（空串时为 0 个）*/
+    constexpr uint64_t static_hash_words(const char* s, size_t n, uint64_t h)
+    {
+        return n > 8 ? static_hash_words(s + 8, n - 8, static_hash_round(h, static_read_word(s, 8)))
+                     : static_hash_round(h, static_read_word(s, n));
+    }
+
+    constexpr uint64_t static_string_hash(const char* s, size_t n, uint64_t seed)
+    {
+        return static_hash_finalize(static_hash_words(s, n, ((seed + 1) * 0x9e3779b97f4a7c15ull) ^ n));
+    }
+
+    /* 运行期的循环版本，结果与 static_string_hash 相同*/
+    inline uint64_t runtime_read_word(const char* s) noexcept
+    {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        uint64_t w;
+        std::memcpy(&w, s, sizeof(w));
+        return w;
+#else
+        return static_read_word(s, 8);
+#endif
+    }
+
+    inline uint64_t runtime_string_hash(const char* s, size_t n, uint64_t seed) noexcept
+    {
+        uint64_t h = ((seed + 1) * 0x9e3779b97f4a7c15ull) ^ n;
+        const bool long_key = n >= 8;
+        while (n > 8)
+        {
+            h = static_hash_round(h, runtime_read_word(s));
+            s += 8;
+            n -= 8;
+        }
+        uint64_t w = 0;
+        if (n == 8)
+            w = runtime_read_word(s);
+        else if (long_key)
+            /* 键不短于 8 个字节时，剩下的 1 到 7 个字节用一次向前重叠的读取取得，再移到低位*/
+            w = runtime_read_word(s + n - 8) >> (64 - 8 * n);
+        else
+            for (size_t i = 0; i < n; ++i)
+                w |= static_cast<uint64_t>(static_cast<unsigned char>(s[i])) << (8 * i);
+        return static_hash_finalize(static_hash_round(h, w));
+    }
+
+    /* 不小于 n 的最小的 2 的幂*/
+    constexpr size_t static_next_pow2(size_t n, size_t p = 1)
+    {
+        return p >= n ? p : static_next_pow2(n, p * 2);
+    }
+
+    /***********************************************************/
+    /* 模板类 static_perfect_set，参数 N 代表键的个数*/
+    template <size_t N>
+        class static_perfect_set
+        {
+            static_assert(N > 0, "static_perfect_set needs at least one key");
+            static_assert(N < 65535, "static_perfect_set supports fewer than 65535 keys");
+
+            public:
+                typedef size_t          size_type;
+
+                static constexpr size_type npos = static_cast<size_type>(-1);
+                static constexpr size_type table_size = static_next_pow2(2 * N > N * N / 4 ? 2 * N : N * N / 4);
+                static constexpr uint64_t  max_seeds = 1024;
+
+            private:
+                /* 槽中保存键的下标加一，0 表示空槽*/
+                typedef typename std::conditional<(N < 255), uint8_t, uint16_t>::type slot_type;
+
+                struct entry
+                {
+                    const char* data;
+                    size_t      size;
+                };
+
+                struct key_array
+                {
+                    entry keys[N];
+                };
+
+                /* 某个种子下每个键落入的槽*/
+                struct slot_array
+                {
+                    size_t slots[N];
+                };
+
+            public:
+                /* 由 N 个以 '\0' 结尾的字符串构造，字符串须在对象的生存期内有效（通常是字符串字面量）*/
+                constexpr explicit static_perfect_set(const char* const (&keys)[N])
+                    :static_perfect_set(make_keys(keys, typename make_static_index_sequence<N>::type()))
+                {
+                }
+
+                /* 查找，返回键在初始列表中的下标，不存在时返回 npos*/
+                size_type find(const char* s, size_t n) const noexcept
+                {
+                    const size_t e = table_[runtime_string_hash(s, n, seed_) & (table_size - 1)];
+                    if (e == 0)
+                        return npos;
+                    const entry& k = keys_.keys[e - 1];
+                    return k.size == n && std::memcmp(k.data, s, n) == 0 ? e - 1 : npos;
+                }
+                size_type find(const char* s) const noexcept
+                {
+                    return find(s, std::strlen(s));
+                }
+                template <typename Str>
+                    size_type find(const Str& s) const noexcept
+                    {
+                        return find(s.data(), s.size());
+                    }
+
+                bool contains(const char* s, size_t n) const noexcept { return find(s, n) != npos; }
+                bool contains(const char* s) const noexcept           { return find(s) != npos; }
+                template <typename Str>
+                    bool contains(const Str& s) const noexcept        { return find(s) != npos; }
+
+                size_type count(const char* s) const noexcept         { return contains(s) ? 1 : 0; }
+                template <typename Str>
+                    size_type count(const Str& s) const noexcept      { return contains(s) ? 1 : 0; }
+
+                /* 初始列表中第 i 个键及其长度*/
+                constexpr const char* key(size_type i) const noexcept      { return keys_.keys[i].data; }
+                constexpr size_type   key_size(size_type i) const noexcept { return keys_.keys[i].size; }
+
+                constexpr size_type size() const noexcept  { return N; }
+                constexpr bool      empty() const noexcept { return false; }
+                constexpr uint64_t  seed() const noexcept  { return seed_; }
+
+            private:
+                /* 构造分为四步：求出每个键的长度 -> 找到种子 -> 求出每个键的槽 -> 填表*/
+                constexpr explicit static_perfect_set(const key_array& keys)
+                    :static_perfect_set(keys, checked_seed(find_seed(keys, 0, max_seeds)))
+                {
+                }
+
+                constexpr static_perfect_set(const key_array& keys, uint64_t seed)
+                    :static_perfect_set(keys, seed, make_slots(keys, seed, typename make_static_index_sequence<N>::type()),
+                                        typename make_static_index_sequence<table_size>::type())
+                {
+                }
+
+                template <size_t... I>
+                    constexpr static_perfect_set(const key_array& keys, uint64_t seed, const slot_array& slots,
+                                                 static_index_sequence<I...>)
+                        :keys_(keys), seed_(seed),
+                        table_{ static_cast<slot_type>(key_in_slot(slots, I, 0, N))... }
+                    {
+                    }
+
+                template <size_t... I>
+                    static constexpr key_array make_keys(const char* const (&keys)[N], static_index_sequence<I...>)
+                    {
+                        return key_array{ { entry{ keys[I], static_string_length(keys[I]) }... } };
+                    }
+
+                static constexpr size_t slot_of(const entry& k, uint64_t seed)
+                {
+                    return static_cast<size_t>(static_string_hash(k.data, k.size, seed) & (table_size - 1));
+                }
+
+                template <size_t... I>
+                    static constexpr slot_array make_slots(const key_array& keys, uint64_t seed, static_index_sequence<I...>)
+                    {
+                        return slot_array{ { slot_of(keys.keys[I], seed)... } };
+                    }
+
+                /* slots[first, last) 中是否有等于 slot 的，二分递归使深度为 log N*/
+                static constexpr bool has_slot(const slot_array& s, size_t slot, size_t first, size_t last)
+                {
+                    return last - first == 0 ? false
+                         : last - first == 1 ? s.slots[first] == slot
+                         : has_slot(s, slot, first, first + (last - first) / 2)
+                           || has_slot(s, slot, first + (last - first) / 2, last);
+                }
+
+                /* slots[first, last) 互不相同*/
+                static constexpr bool all_distinct(const slot_array& s, size_t first, size_t last)
+                {
+                    return last - first <= 1 ? true
+                         : last - first == 2 ? !has_slot(s, s.slots[first], first + 1, last)
+                         : all_distinct(s, first, first + (last - first) / 2)
+                           && all_distinct(s, first + (last - first) / 2, last)
+                           && no_common(s, first, first + (last - first) / 2, first + (last - first) / 2, last);
+                }
+
+                /* slots[a_first, a_last) 与 slots[b_first, b_last) 没有相同的值*/
+                static constexpr bool no_common(const slot_array& s, size_t a_first, size_t a_last,
+                                                size_t b_first, size_t b_last)
+                {
+                    return a_last - a_first == 0 ? true
+                         : a_last - a_first == 1 ? !has_slot(s, s.slots[a_first], b_first, b_last)
+                         : no_common(s, a_first, a_first + (a_last - a_first) / 2, b_first, b_last)
+                           && no_common(s, a_first + (a_last - a_first) / 2, a_last, b_first, b_last);
+                }
+
+                static constexpr bool seed_works(const key_array& keys, uint64_t seed)
+                {
+                    return all_distinct(make_slots(keys, seed, typename make_static_index_sequence<N>::type()), 0, N);
+                }
+
+                /* 在 [first, last) 中找第一个可用的种子，找不到时返回 max_seeds*/
+                static constexpr uint64_t find_seed(const key_array& keys, uint64_t first, uint64_t last)
+                {
+                    return last - first == 1 ? (seed_works(keys, first) ? first : max_seeds)
+                         : first_found(keys, find_seed(keys, first, first + (last - first) / 2),
+                                       first + (last - first) / 2, last);
+                }
+
+                static constexpr uint64_t first_found(const key_array& keys, uint64_t found, uint64_t first, uint64_t last)
+                {
+                    return found != max_seeds ? found : find_seed(keys, first, last);
+                }
+
+                static constexpr uint64_t checked_seed(uint64_t seed)
+                {
+                    /* 编译错误指向这里时：键有重复，或 max_seeds 个种子内都有冲突*/
+                    return seed != max_seeds ? seed
+                         : throw std::invalid_argument("static_perfect_set: duplicate keys or no collision-free seed");
+                }
+
+                /* 落在 slot 的键的下标加一，没有时为0*/
+                static constexpr size_t key_in_slot(const slot_array& s, size_t slot, size_t first, size_t last)
+                {
+                    return last - first == 0 ? 0
+                         : last - first == 1 ? (s.slots[first] == slot ? first + 1 : 0)
+                         : key_in_slot(s, slot, first, first + (last - first) / 2)
+                           + key_in_slot(s, slot, first + (last - first) / 2, last);
+                }
+
+            private:
+                key_array keys_;
+                uint64_t  seed_;
+                slot_type table_[table_size];
+        };
+
+    template <size_t N>
+        constexpr typename static_perfect_set<N>::size_type static_perfect_set<N>::npos;
+    template <size_t N>
+        constexpr typename static_perfect_set<N>::size_type static_perfect_set<N>::table_size;
+    template <size_t N>
+        constexpr uint64_t static_perfect_set<N>::max_seeds;
+
+    /* 由字符串字面量构造，N 由参数个数推导*/
+    template <typename... Keys>
+        constexpr static_perfect_set<sizeof...(Keys)> make_static_perfect_set(const Keys&... keys)
+        {
+            return static_perfect_set<sizeof...(Keys)>({ static_cast<const char*>(keys)... });
+        }
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_STATIC_PERFECT_SET_H__ */
@@ -35,6 +35,12 @@ namespace leptstl
         struct is_pair : leptstl::lept_false_type{};
     template<typename T1, typename T2>
         struct is_pair<leptstl::pair<T1, T2>> : leptstl::lept_true_type{};
+
+    /* is_trivially_relocatable：把对象按字节搬到新地址并且不再析构旧对象，等价于移动构造加析构
+     * 默认只有可平凡复制的类型满足，自身不持有指向自己的指针的类型（如 basic_string, vector）可以特化为真*/
+    template<typename T>
+        struct is_trivially_relocatable
+        : leptstl::lept_bool_constant<std::is_trivially_copyable<T>::value>{};
 }   /*namespace leptstl*/
 
 #endif /* LEPTSTL_TYPE_TRAITS_H__*/
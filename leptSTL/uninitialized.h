@@ -10,6 +10,8 @@
 
 /*此头文件用于对未初始化空间构造元素*/
 
+#include <cstring>
+
 #include "algobase.h"
 #include "construct.h"
 #include "iterator.h"
@@ -239,6 +241,75 @@ namespace leptstl
                                                     value_type>{});
         }
 
+    /*******************************************************************************/
+    /* uninitialized_default_construct_n 在[first, first+n)上默认初始化对象
+     * 平凡类型不做任何写入（与值初始化不同，不会清零），构造失败时析构已构造的对象并重新抛出*/
+    template<typename ForwardIter, typename Size>
+        ForwardIter 
+        unchecked_uninit_default_construct_n(ForwardIter first, Size n, std::true_type)
+        {
+            leptstl::advance(first, n);
+            return first;
+        }
+
+    template<typename ForwardIter, typename Size>
+        ForwardIter 
+        unchecked_uninit_default_construct_n(ForwardIter first, Size n, std::false_type)
+        {
+            typedef typename iterator_traits<ForwardIter>::value_type value_type;
+            auto cur = first;
+            try 
+            {
+                for(; n > 0; --n, ++cur)
+                    ::new (static_cast<void*>(&*cur)) value_type;
+            }
+            catch(...)
+            {
+                leptstl::destroy(first, cur);
+                throw;
+            }
+            return cur;
+        }
+
+    template<typename ForwardIter, typename Size>
+        ForwardIter 
+        uninitialized_default_construct_n(ForwardIter first, Size n)
+        {
+            return leptstl::unchecked_uninit_default_construct_n(first, n,
+                                                                 std::is_trivially_default_constructible<
+                                                                 typename iterator_traits<ForwardIter>::
+                                                                 value_type>{});
+        }
+
+    /*******************************************************************************/
+    /* uninitialized_relocate 把[first,last)上的对象搬到result为起点的未初始化空间，源对象随之失效
+     * 可平凡搬迁的类型一次memmove完成，不调用移动构造与析构，区间可以重叠
+     * 其余类型逐个移动构造后析构源对象，区间不能重叠*/
+    template<typename T>
+        T* unchecked_uninit_relocate(T* first, T* last, T* result, leptstl::lept_true_type)
+        {
+            const size_t n = static_cast<size_t>(last - first);
+            if(n != 0)
+                std::memmove(static_cast<void*>(result), static_cast<const void*>(first), n * sizeof(T));
+            return result + n;
+        }
+
+    template<typename T>
+        T* unchecked_uninit_relocate(T* first, T* last, T* result, leptstl::lept_false_type)
+        {
+            T* cur = leptstl::uninitialized_move(first, last, result);
+            leptstl::destroy(first, last);
+            return cur;
+        }
+
+    template<typename T>
+        T* uninitialized_relocate(T* first, T* last, T* result)
+        {
+            return leptstl::unchecked_uninit_relocate(first, last, result,
+                                                      leptstl::lept_bool_constant<
+                                                      leptstl::is_trivially_relocatable<T>::value>{});
+        }
+
 }   /* namespace leptstl */
 
 #endif  /* LEPTSTL_UNINITIALIZED_H__ */
@@ -0,0 +1,542 @@
+/*************************************************************************
+	> File Name: unordered_map.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 09:14:03 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_UNORDERED_MAP_H__
+#define LEPTSTL_UNORDERED_MAP_H__
+
+/*此头文件包含两个模板类unordered_map和unordered_multimap*/
+
+#include "hashtable.h"
+
+namespace leptstl
+{
+    /* 模板类 unordered_map，键值不允许重复*/
+    /* 参数一代表键值类型，参数二代表实值类型，参数三代表哈希函数，缺省使用 leptstl::hash，*/
+    /* 参数四代表键值比较方式，缺省使用 leptstl::equal_to*/
+    template<typename Key, typename T, typename Hash = leptstl::hash<Key>, typename KeyEqual = leptstl::equal_to<Key>>
+        class unordered_map
+        {
+            private:
+                /* 使用hashtable作为底层机制*/
+                typedef hashtable<leptstl::pair<const Key, T>, Hash, KeyEqual> base_type;
+                base_type ht_;
+
+            public:
+                typedef typename base_type::allocator_type       allocator_type;
+                typedef typename base_type::key_type             key_type;
+                typedef typename base_type::mapped_type          mapped_type;
+                typedef typename base_type::value_type           value_type;
+                typedef typename base_type::hasher               hasher;
+                typedef typename base_type::key_equal            key_equal;
+
+                typedef typename base_type::size_type            size_type;
+                typedef typename base_type::difference_type      difference_type;
+                typedef typename base_type::pointer              pointer;
+                typedef typename base_type::const_pointer        const_pointer;
+                typedef typename base_type::reference            reference;
+                typedef typename base_type::const_reference      const_reference;
+
+                typedef typename base_type::iterator             iterator;
+                typedef typename base_type::const_iterator       const_iterator;
+                typedef typename base_type::local_iterator       local_iterator;
+                typedef typename base_type::const_local_iterator const_local_iterator;
+
+                allocator_type get_allocator() const { return ht_.get_allocator(); }
+
+            public:
+                /*构造 复制 移动函数*/
+                unordered_map()
+                    :ht_(100, Hash(), KeyEqual())
+                {
+                }
+
+                explicit unordered_map(size_type bucket_count,
+                                       const Hash& hash = Hash(),
+                                       const KeyEqual& equal = KeyEqual())
+                    :ht_(bucket_count, hash, equal)
+                {
+                }
+
+                template <typename InputIterator>
+                    unordered_map(InputIterator first, InputIterator last,
+                                  const size_type bucket_count = 100,
+                                  const Hash& hash = Hash(),
+                                  const KeyEqual& equal = KeyEqual())
+                    : ht_(leptstl::max(bucket_count, static_cast<size_type>(leptstl::distance(first, last))), hash, equal)
+                {
+                    for (; first != last; ++first)
+                        ht_.insert_unique_noresize(*first);
+                }
+
+                unordered_map(std::initializer_list<value_type> ilist,
+                              const size_type bucket_count = 100,
+                              const Hash& hash = Hash(),
+                              const KeyEqual& equal = KeyEqual())
+                    :ht_(leptstl::max(bucket_count, static_cast<size_type>(ilist.size())), hash, equal)
+                {
+                    for (auto first = ilist.begin(), last = ilist.end(); first != last; ++first)
+                        ht_.insert_unique_noresize(*first);
+                }
+
+                unordered_map(const unordered_map& rhs)
+                    :ht_(rhs.ht_)
+                {
+                }
+                unordered_map(unordered_map&& rhs) noexcept
+                    : ht_(leptstl::move(rhs.ht_))
+                {
+                }
+
+                unordered_map& operator=(const unordered_map& rhs)
+                {
+                    ht_ = rhs.ht_;
+                    return *this;
+                }
+                unordered_map& operator=(unordered_map&& rhs)
+                {
+                    ht_ = leptstl::move(rhs.ht_);
+                    return *this;
+                }
+
+                unordered_map& operator=(std::initializer_list<value_type> ilist)
+                {
+                    ht_.clear();
+                    ht_.reserve(ilist.size());
+                    for (auto first = ilist.begin(), last = ilist.end(); first != last; ++first)
+                        ht_.insert_unique_noresize(*first);
+                    return *this;
+                }
+
+                ~unordered_map() = default;
+
+                /*迭代器相关*/
+                iterator       begin()        noexcept
+                { return ht_.begin(); }
+                const_iterator begin()  const noexcept
+                { return ht_.begin(); }
+                iterator       end()          noexcept
+                { return ht_.end(); }
+                const_iterator end()    const noexcept
+                { return ht_.end(); }
+
+                const_iterator cbegin() const noexcept
+                { return ht_.cbegin(); }
+                const_iterator cend()   const noexcept
+                { return ht_.cend(); }
+
+                /* 容量相关*/
+
+                bool      empty()    const noexcept { return ht_.empty(); }
+                size_type size()     const noexcept { return ht_.size(); }
+                size_type max_size() const noexcept { return ht_.max_size(); }
+
+                /* 修改容器操作*/
+
+                /* empalce / empalce_hint*/
+
+                template <typename ...Args>
+                    pair<iterator, bool> emplace(Args&& ...args)
+                { return ht_.emplace_unique(leptstl::forward<Args>(args)...); }
+
+                template <typename ...Args>
+                    iterator emplace_hint(const_iterator hint, Args&& ...args)
+                { return ht_.emplace_unique_use_hint(hint, leptstl::forward<Args>(args)...); }
+
+                /* try_emplace：键值已存在时不构造任何对象，args 也不会被移动*/
+
+                template <typename ...Args>
+                    pair<iterator, bool> try_emplace(const key_type& key, Args&& ...args)
+                { return ht_.try_emplace_unique(key, leptstl::forward<Args>(args)...); }
+                template <typename ...Args>
+                    pair<iterator, bool> try_emplace(key_type&& key, Args&& ...args)
+                { return ht_.try_emplace_unique(leptstl::move(key), leptstl::forward<Args>(args)...); }
+
+                /* insert_or_assign：键值已存在时对实值赋值，否则就地构造*/
+
+                template <typename M>
+                    pair<iterator, bool> insert_or_assign(const key_type& key, M&& obj)
+                { return ht_.insert_or_assign_unique(key, leptstl::forward<M>(obj)); }
+                template <typename M>
+                    pair<iterator, bool> insert_or_assign(key_type&& key, M&& obj)
+                { return ht_.insert_or_assign_unique(leptstl::move(key), leptstl::forward<M>(obj)); }
+
+                /* insert*/
+
+                pair<iterator, bool> insert(const value_type& value)
+                { return ht_.insert_unique(value); }
+                pair<iterator, bool> insert(value_type&& value)
+                { return ht_.emplace_unique(leptstl::move(value)); }
+
+                iterator insert(const_iterator hint, const value_type& value)
+                { return ht_.insert_unique_use_hint(hint, value); }
+                iterator insert(const_iterator hint, value_type&& value)
+                { return ht_.emplace_unique_use_hint(hint, leptstl::move(value)); }
+
+                template <typename InputIterator>
+                    void insert(InputIterator first, InputIterator last)
+                { ht_.insert_unique(first, last); }
+
+                /* erase / clear*/
+
+                void      erase(iterator it)
+                { ht_.erase(it); }
+                void      erase(iterator first, iterator last)
+                { ht_.erase(first, last); }
+
+                size_type erase(const key_type& key)
+                { return ht_.erase_unique(key); }
+
+                void      clear()
+                { ht_.clear(); }
+
+                void      swap(unordered_map& other) noexcept
+                { ht_.swap(other.ht_); }
+
+                /* 访问元素相关*/
+
+                /* 若键值不存在，at 会抛出异常*/
+                mapped_type&       at(const key_type& key)
+                {
+                    iterator it = ht_.find(key);
+                    THROW_OUT_OF_RANGE_IF(it.node == nullptr, "unordered_map<Key, T> no such element exists");
+                    return it->second;
+                }
+                const mapped_type& at(const key_type& key) const
+                {
+                    const_iterator it = ht_.find(key);
+                    THROW_OUT_OF_RANGE_IF(it.node == nullptr, "unordered_map<Key, T> no such element exists");
+                    return it->second;
+                }
+
+                /* 若键值不存在，就地构造一个默认实值，命中时不产生任何临时对象*/
+                mapped_type& operator[](const key_type& key)
+                { return ht_.try_emplace_unique(key).first->second; }
+                mapped_type& operator[](key_type&& key)
+                { return ht_.try_emplace_unique(leptstl::move(key)).first->second; }
+
+                /* 查找相关*/
+
+                size_type      count(const key_type& key) const
+                { return ht_.find(key) != ht_.cend() ? 1 : 0; }
+
+                iterator       find(const key_type& key)
+                { return ht_.find(key); }
+                const_iterator find(const key_type& key)  const
+                { return ht_.find(key); }
+
+                pair<iterator, iterator> equal_range(const key_type& key)
+                { return ht_.equal_range_unique(key); }
+                pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+                { return ht_.equal_range_unique(key); }
+
+                /* bucket interface*/
+
+                local_iterator       begin(size_type n)        noexcept
+                { return ht_.begin(n); }
+                const_local_iterator begin(size_type n)  const noexcept
+                { return ht_.begin(n); }
+                const_local_iterator cbegin(size_type n) const noexcept
+                { return ht_.cbegin(n); }
+
+                local_iterator       end(size_type n)          noexcept
+                { return ht_.end(n); }
+                const_local_iterator end(size_type n)    const noexcept
+                { return ht_.end(n); }
+                const_local_iterator cend(size_type n)   const noexcept
+                { return ht_.cend(n); }
+
+                size_type bucket_count()                 const noexcept
+                { return ht_.bucket_count(); }
+                size_type max_bucket_count()             const noexcept
+                { return ht_.max_bucket_count(); }
+
+                size_type bucket_size(size_type n)       const noexcept
+                { return ht_.bucket_size(n); }
+                size_type bucket(const key_type& key)    const
+                { return ht_.bucket(key); }
+
+                /* hash policy*/
+
+                float     load_factor()            const noexcept { return ht_.load_factor(); }
+                /* 链长分布与内存占用，见 hashtable_stats*/
+                hashtable_stats stats()            const noexcept { return ht_.stats(); }
+
+                float     max_load_factor()        const noexcept { return ht_.max_load_factor(); }
+                void      max_load_factor(float ml)               { ht_.max_load_factor(ml); }
+
+                void      rehash(size_type count)                 { ht_.rehash(count); }
+                void      reserve(size_type count)                { ht_.reserve(count); }
+
+                hasher    hash_fcn()               const          { return ht_.hash_fcn(); }
+                key_equal key_eq()                 const          { return ht_.key_eq(); }
+
+            public:
+                friend bool operator==(const unordered_map& lhs, const unordered_map& rhs)
+                {
+                    return lhs.ht_.equal_to_unique(rhs.ht_);
+                }
+                friend bool operator!=(const unordered_map& lhs, const unordered_map& rhs)
+                {
+                    return !lhs.ht_.equal_to_unique(rhs.ht_);
+                }
+
+        };  /* unordered_map */
+
+    /* 重载 leptstl 的 swap*/
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+        void swap(unordered_map<Key, T, Hash, KeyEqual>& lhs,
+                  unordered_map<Key, T, Hash, KeyEqual>& rhs)
+        {
+            lhs.swap(rhs);
+        }
+
+    /*****************************************************************************************/
+    /* 模板类 unordered_multimap，键值允许重复*/
+    /* 参数一代表键值类型，参数二代表实值类型，参数三代表哈希函数，缺省使用 leptstl::hash，*/
+    /* 参数四代表键值比较方式，缺省使用 leptstl::equal_to*/
+    template<typename Key, typename T, typename Hash = leptstl::hash<Key>, typename KeyEqual = leptstl::equal_to<Key>>
+        class unordered_multimap
+        {
+            private:
+                typedef hashtable<leptstl::pair<const Key, T>, Hash, KeyEqual> base_type;
+                base_type ht_;
+
+            public:
+                /* 使用 hashtable 的型别*/
+                typedef typename base_type::allocator_type       allocator_type;
+                typedef typename base_type::key_type             key_type;
+                typedef typename base_type::mapped_type          mapped_type;
+                typedef typename base_type::value_type           value_type;
+                typedef typename base_type::hasher               hasher;
+                typedef typename base_type::key_equal            key_equal;
+
+                typedef typename base_type::size_type            size_type;
+                typedef typename base_type::difference_type      difference_type;
+                typedef typename base_type::pointer              pointer;
+                typedef typename base_type::const_pointer        const_pointer;
+                typedef typename base_type::reference            reference;
+                typedef typename base_type::const_reference      const_reference;
+
+                typedef typename base_type::iterator             iterator;
+                typedef typename base_type::const_iterator       const_iterator;
+                typedef typename base_type::local_iterator       local_iterator;
+                typedef typename base_type::const_local_iterator const_local_iterator;
+
+                allocator_type get_allocator() const { return ht_.get_allocator(); }
+
+            public:
+                /* 构造 复制 移动*/
+                unordered_multimap()
+                    :ht_(100, Hash(), KeyEqual())
+                {
+                }
+
+                explicit unordered_multimap(size_type bucket_count,
+                                            const Hash& hash = Hash(),
+                                            const KeyEqual& equal = KeyEqual())
+                    :ht_(bucket_count, hash, equal)
+                {
+                }
+
+                template <typename InputIterator>
+                unordered_multimap(InputIterator first, InputIterator last,
+                                   const size_type bucket_count = 100,
+                                   const Hash& hash = Hash(),
+                                   const KeyEqual& equal = KeyEqual())
+                    :ht_(leptstl::max(bucket_count, static_cast<size_type>(leptstl::distance(first, last))), hash, equal)
+                {
+                    for (; first != last; ++first)
+                        ht_.insert_multi_noresize(*first);
+                }
+
+                unordered_multimap(std::initializer_list<value_type> ilist,
+                                   const size_type bucket_count = 100,
+                                   const Hash& hash = Hash(),
+                                   const KeyEqual& equal = KeyEqual())
+                    :ht_(leptstl::max(bucket_count, static_cast<size_type>(ilist.size())), hash, equal)
+                {
+                    for (auto first = ilist.begin(), last = ilist.end(); first != last; ++first)
+                        ht_.insert_multi_noresize(*first);
+                }
+
+                unordered_multimap(const unordered_multimap& rhs)
+                    :ht_(rhs.ht_)
+                {
+                }
+                unordered_multimap(unordered_multimap&& rhs) noexcept
+                    :ht_(leptstl::move(rhs.ht_))
+                {
+                }
+
+                unordered_multimap& operator=(const unordered_multimap& rhs)
+                {
+                    ht_ = rhs.ht_;
+                    return *this;
+                }
+                unordered_multimap& operator=(unordered_multimap&& rhs)
+                {
+                    ht_ = leptstl::move(rhs.ht_);
+                    return *this;
+                }
+
+                unordered_multimap& operator=(std::initializer_list<value_type> ilist)
+                {
+                    ht_.clear();
+                    ht_.reserve(ilist.size());
+                    for (auto first = ilist.begin(), last = ilist.end(); first != last; ++first)
+                        ht_.insert_multi_noresize(*first);
+                    return *this;
+                }
+
+                ~unordered_multimap() = default;
+
+                /* 迭代器相关*/
+
+                iterator       begin()        noexcept
+                { return ht_.begin(); }
+                const_iterator begin()  const noexcept
+                { return ht_.begin(); }
+                iterator       end()          noexcept
+                { return ht_.end(); }
+                const_iterator end()    const noexcept
+                { return ht_.end(); }
+
+                const_iterator cbegin() const noexcept
+                { return ht_.cbegin(); }
+                const_iterator cend()   const noexcept
+                { return ht_.cend(); }
+
+                /* 容量相关*/
+
+                bool      empty()    const noexcept { return ht_.empty(); }
+                size_type size()     const noexcept { return ht_.size(); }
+                size_type max_size() const noexcept { return ht_.max_size(); }
+
+                /* 修改容器相关*/
+
+                /* emplace / emplace_hint*/
+
+                template <typename ...Args>
+                iterator emplace(Args&& ...args)
+                { return ht_.emplace_multi(leptstl::forward<Args>(args)...); }
+
+                template <typename ...Args>
+                iterator emplace_hint(const_iterator hint, Args&& ...args)
+                { return ht_.emplace_multi_use_hint(hint, leptstl::forward<Args>(args)...); }
+
+                /* insert*/
+
+                iterator insert(const value_type& value)
+                { return ht_.insert_multi(value); }
+                iterator insert(value_type&& value)
+                { return ht_.emplace_multi(leptstl::move(value)); }
+
+                iterator insert(const_iterator hint, const value_type& value)
+                { return ht_.insert_multi_use_hint(hint, value); }
+                iterator insert(const_iterator hint, value_type&& value)
+                { return ht_.emplace_multi_use_hint(hint, leptstl::move(value)); }
+
+                template <typename InputIterator>
+                void     insert(InputIterator first, InputIterator last)
+                { ht_.insert_multi(first, last); }
+
+                /* erase / clear*/
+
+                void      erase(iterator it)
+                { ht_.erase(it); }
+                void      erase(iterator first, iterator last)
+                { ht_.erase(first, last); }
+
+                size_type erase(const key_type& key)
+                { return ht_.erase_multi(key); }
+
+                void      clear()
+                { ht_.clear(); }
+
+                void      swap(unordered_multimap& other) noexcept
+                { ht_.swap(other.ht_); }
+
+                /* 查找相关*/
+
+                size_type      count(const key_type& key) const
+                { return ht_.count(key); }
+
+                iterator       find(const key_type& key)
+                { return ht_.find(key); }
+                const_iterator find(const key_type& key)  const
+                { return ht_.find(key); }
+
+                pair<iterator, iterator> equal_range(const key_type& key)
+                { return ht_.equal_range_multi(key); }
+                pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+                { return ht_.equal_range_multi(key); }
+
+                /* bucket interface*/
+
+                local_iterator       begin(size_type n)        noexcept
+                { return ht_.begin(n); }
+                const_local_iterator begin(size_type n)  const noexcept
+                { return ht_.begin(n); }
+                const_local_iterator cbegin(size_type n) const noexcept
+                { return ht_.cbegin(n); }
+
+                local_iterator       end(size_type n)          noexcept
+                { return ht_.end(n); }
+                const_local_iterator end(size_type n)    const noexcept
+                { return ht_.end(n); }
+                const_local_iterator cend(size_type n)   const noexcept
+                { return ht_.cend(n); }
+
+                size_type bucket_count()                 const noexcept
+                { return ht_.bucket_count(); }
+                size_type max_bucket_count()             const noexcept
+                { return ht_.max_bucket_count(); }
+
+                size_type bucket_size(size_type n)       const noexcept
+                { return ht_.bucket_size(n); }
+                size_type bucket(const key_type& key)    const
+                { return ht_.bucket(key); }
+
+                /* hash policy*/
+
+                float     load_factor()            const noexcept { return ht_.load_factor(); }
+                /* 链长分布与内存占用，见 hashtable_stats*/
+                hashtable_stats stats()            const noexcept { return ht_.stats(); }
+
+                float     max_load_factor()        const noexcept { return ht_.max_load_factor(); }
+                void      max_load_factor(float ml)               { ht_.max_load_factor(ml); }
+
+                void      rehash(size_type count)                 { ht_.rehash(count); }
+                void      reserve(size_type count)                { ht_.reserve(count); }
+
+                hasher    hash_fcn()               const          { return ht_.hash_fcn(); }
+                key_equal key_eq()                 const          { return ht_.key_eq(); }
+
+            public:
+                friend bool operator==(const unordered_multimap& lhs, const unordered_multimap& rhs)
+                {
+                    return lhs.ht_.equal_to_multi(rhs.ht_);
+                }
+                friend bool operator!=(const unordered_multimap& lhs, const unordered_multimap& rhs)
+                {
+                    return !lhs.ht_.equal_to_multi(rhs.ht_);
+                }
+
+        };  /* unordered_multimap */
+
+    /* 重载 leptstl 的 swap*/
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+        void swap(unordered_multimap<Key, T, Hash, KeyEqual>& lhs,
+                  unordered_multimap<Key, T, Hash, KeyEqual>& rhs)
+        {
+            lhs.swap(rhs);
+        }
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_UNORDERED_MAP_H__ */
+
@@ -226,6 +226,8 @@ namespace leptstl
                 /* hash policy*/
 
                 float     load_factor()            const noexcept { return ht_.load_factor(); }
+                /* 链长分布与内存占用，见 hashtable_stats*/
+                hashtable_stats stats()            const noexcept { return ht_.stats(); }
 
                 float     max_load_factor()        const noexcept { return ht_.max_load_factor(); }
                 void      max_load_factor(float ml)               { ht_.max_load_factor(ml); }
@@ -239,11 +241,11 @@ namespace leptstl
             private:
                 friend bool operator==(const unordered_set& lhs, const unordered_set& rhs)
                 {
-                    return lhs.ht_.equal_range_unique(rhs.ht_);
+                    return lhs.ht_.equal_to_unique(rhs.ht_);
                 }
                 friend bool operator!=(const unordered_set& lhs, const unordered_set& rhs)
                 {
-                    return !lhs.ht_.equal_range_unique(rhs.ht_);
+                    return !lhs.ht_.equal_to_unique(rhs.ht_);
                 }
 
         }; /* unordered_set */
@@ -480,6 +482,8 @@ namespace leptstl
                 /* hash policy*/
               
                 float     load_factor()            const noexcept { return ht_.load_factor(); }
+                /* 链长分布与内存占用，见 hashtable_stats*/
+                hashtable_stats stats()            const noexcept { return ht_.stats(); }
               
                 float     max_load_factor()        const noexcept { return ht_.max_load_factor(); }
                 void      max_load_factor(float ml)               { ht_.max_load_factor(ml); }
@@ -493,11 +497,11 @@ namespace leptstl
               public:
                 friend bool operator==(const unordered_multiset& lhs, const unordered_multiset& rhs)
                 {
-                    return lhs.ht_.equal_range_multi(rhs.ht_);
+                    return lhs.ht_.equal_to_multi(rhs.ht_);
                 }
                 friend bool operator!=(const unordered_multiset& lhs, const unordered_multiset& rhs)
                 {
-                    return !lhs.ht_.equal_range_multi(rhs.ht_);
+                    return !lhs.ht_.equal_to_multi(rhs.ht_);
                 }
 
         };  /* unordered_multiset */
@@ -59,6 +59,15 @@ namespace leptstl
             leptstl::swap_range(a, a+N, b);
         }
 
+    /**********************************************************/
+    /* emplace_second 标签：pair 的 first 由第一个参数构造，second 由其余参数就地构造，
+     * 供 unordered_map::try_emplace 等只在未命中时才构造实值的接口使用*/
+    struct emplace_second_t
+    {
+        explicit emplace_second_t() = default;
+    };
+    constexpr emplace_second_t emplace_second{};
+
     /**********************************************************/
     /* pair */
     template<typename T1, typename T2>
@@ -106,6 +115,14 @@ namespace leptstl
             pair(const pair& rhs) = default;
             pair(pair&& rhs) = default;
 
+            /* first 由 a 构造，second 由 args 就地构造，不产生 T2 临时对象*/
+            template<typename Other1, typename ...Args>
+                constexpr pair(emplace_second_t, Other1&& a, Args&& ...args)
+                :first(leptstl::forward<Other1>(a)),
+                second(leptstl::forward<Args>(args)...)
+            {
+            }
+
             /* implicit constructiable for other type */
             template<typename Other1, typename Other2,
                 typename std::enable_if<
@@ -18,11 +18,13 @@
  * reserve
  * resize
  * insert
+ * vector<bool> 是按位存储的偏特化版本，每个字存 64 位，元素通过代理引用 bit_reference 访问
  */
 
 #include <initializer_list>
 
 #include "algo.h"
+#include "bit_iterator.h"
 #include "exceptdef.h"
 
 namespace leptstl 
@@ -38,13 +40,21 @@ namespace leptstl
 #undef min
 #endif // min
 
+    /* vector 默认的内存分配器：可平凡复制的元素用 realloc_allocator，扩容时可以原地延长*/
     template<typename T>
+        struct vector_default_allocator
+        {
+            typedef typename std::conditional<std::is_trivially_copyable<T>::value,
+                    leptstl::realloc_allocator<T>, leptstl::allocator<T>>::type type;
+        };
+
+    /* 模板类 vector，参数一代表元素类型，参数二代表分配器（只使用其静态成员函数）*/
+    template<typename T, typename Alloc = typename vector_default_allocator<T>::type>
         class vector 
         {
-            static_assert(!std::is_same<bool, T>::value, "vector<bool> is abandoned in leptstl");
         public:
-            typedef leptstl::allocator<T>                           allocator_type;
-            typedef leptstl::allocator<T>                           data_allocator;
+            typedef Alloc                                           allocator_type;
+            typedef Alloc                                           data_allocator;
 
             typedef typename allocator_type::value_type             value_type;
             typedef typename allocator_type::pointer                pointer;
@@ -263,6 +273,12 @@ namespace leptstl
             /* resize / reverse */
             void     resize(size_type new_size) { return resize(new_size, value_type()); }
             void     resize(size_type new_size, const value_type& value);
+            /* 新增元素只做默认初始化，平凡类型不清零，适合随后整段写入的场合*/
+            void     resize_default_init(size_type new_size);
+            /* 容量扩到至少n，调用 op(data(), n) 写入前n个元素，op 返回实际写入的个数 r（r <= n），size() 变为 r
+             * [size(), n) 上的元素在调用 op 前未初始化，只能用于平凡类型*/
+            template<typename Op>
+                void resize_and_overwrite(size_type n, Op op);
 
             void     reverse() { leptstl::reverse(begin(), end()); }
 
@@ -303,12 +319,17 @@ namespace leptstl
             /* shrink_to_fit */
             void reinsert(size_type size);
 
+            /* 把容量调整为 new_cap，保留[begin_, end_)上的元素*/
+            void realloc_storage(size_type new_cap);
+            void realloc_storage_aux(size_type new_cap, std::true_type);
+            void realloc_storage_aux(size_type new_cap, std::false_type);
+
         };  /* class vector */
 
     /*********************************************************************************/
     /* 复制赋值操作符*/
-    template<typename T>
-        vector<T>& vector<T>::operator=(const vector& rhs)
+    template<typename T, typename Alloc>
+        vector<T, Alloc>& vector<T, Alloc>::operator=(const vector& rhs)
         {
             if(this != &rhs)
             {
@@ -328,15 +349,15 @@ namespace leptstl
                 {
                     leptstl::copy(rhs.begin(), rhs.begin() + size(), begin_);
                     leptstl::uninitialized_copy(rhs.begin() + size(), rhs.end(), end_);
-                    cap_ = end_ = begin_ + len;
+                    end_ = begin_ + len;
                 }
             }
             return *this;
         }
 
     /* 移动赋值操作符*/
-    template<typename T>
-        vector<T>& vector<T>::operator=(vector&& rhs) noexcept 
+    template<typename T, typename Alloc>
+        vector<T, Alloc>& vector<T, Alloc>::operator=(vector&& rhs) noexcept 
         {
             destroy_and_recover(begin_, end_, cap_ - begin_);
             begin_ = rhs.begin_;
@@ -349,25 +370,19 @@ namespace leptstl
         }
 
     /* 预留空间大小，当原容量小于要求大小时，才会重新分配*/
-    template<typename T>
-        void vector<T>::reserve(size_type n)
+    template<typename T, typename Alloc>
+        void vector<T, Alloc>::reserve(size_type n)
         {
             if(capacity() < n)
             {
                 THROW_LENGTH_ERROR_IF(n > max_size(), "n can not larger than max_size() in vector<T>::reserve(n)");
-                const auto old_size = size();
-                auto tmp = data_allocator::allocate(n);
-                leptstl::uninitialized_move(begin_, end_, tmp);
-                data_allocator::deallocate(begin_, cap_ - begin_);
-                begin_ = tmp;
-                end_ = tmp + old_size;
-                cap_ = begin_ + n;
+                realloc_storage(n);
             }
         }
 
     /* 放弃多余容量 */
-    template<typename T>
-        void vector<T>::shrink_to_fit()
+    template<typename T, typename Alloc>
+        void vector<T, Alloc>::shrink_to_fit()
         {
             if(end_ < cap_)
             {
@@ -376,10 +391,10 @@ namespace leptstl
         }
 
     /* 在pos位置就地构造元素，避免额外复制和移动*/
-    template<typename T>
+    template<typename T, typename Alloc>
         template<typename ...Args>
-        typename vector<T>::iterator 
-        vector<T>::emplace(const_iterator pos, Args&& ...args)
+        typename vector<T, Alloc>::iterator 
+        vector<T, Alloc>::emplace(const_iterator pos, Args&& ...args)
         {
             LEPTSTL_DEBUG(pos >= begin() && pos <= end());
             iterator xpos = const_cast<iterator>(pos);
@@ -389,6 +404,16 @@ namespace leptstl
                 data_allocator::construct(leptstl::address_of(*end_), leptstl::forward<Args>(args)...);
                 ++end_;
             }
+            else if(end_ != cap_ && is_trivially_relocatable<T>::value)
+            {
+                /* 先在临时空间构造：args 可能引用容器内的元素，构造失败时容器保持原样*/
+                typename std::aligned_storage<sizeof(T), alignof(T)>::type buf;
+                pointer tmp = reinterpret_cast<pointer>(&buf);
+                data_allocator::construct(tmp, leptstl::forward<Args>(args)...);
+                leptstl::uninitialized_relocate(xpos, end_, xpos + 1);
+                leptstl::uninitialized_relocate(tmp, tmp + 1, xpos);
+                ++end_;
+            }
             else if(end_ != cap_)
             {
                 auto new_end = end_;
@@ -406,9 +431,9 @@ namespace leptstl
         }
 
     /* 在尾部就地构造元素*/
-    template<typename T>
+    template<typename T, typename Alloc>
         template<typename ...Args>
-        void vector<T>::emplace_back(Args&& ...args)
+        void vector<T, Alloc>::emplace_back(Args&& ...args)
         {
             if(end_ < cap_)
             {
@@ -420,8 +445,8 @@ namespace leptstl
         }
 
     /* 在尾部插入元素*/
-    template<typename T>
-        void vector<T>::push_back(const value_type& value)
+    template<typename T, typename Alloc>
+        void vector<T, Alloc>::push_back(const value_type& value)
         {
             if(end_ != cap_)
             {
@@ -433,8 +458,8 @@ namespace leptstl
         }
 
     /* 弹出尾部元素*/
-    template<typename T>
-        void vector<T>::pop_back()
+    template<typename T, typename Alloc>
+        void vector<T, Alloc>::pop_back()
         {
             LEPTSTL_DEBUG(!empty());
             data_allocator::destroy(end_ - 1);
@@ -442,9 +467,9 @@ namespace leptstl
         }
 
     /* 在pos处插入元素*/
-    template<typename T>
-        typename vector<T>::iterator 
-        vector<T>::insert(const_iterator pos, const value_type& value)
+    template<typename T, typename Alloc>
+        typename vector<T, Alloc>::iterator 
+        vector<T, Alloc>::insert(const_iterator pos, const value_type& value)
         {
             LEPTSTL_DEBUG(pos >= begin() && pos <= end());
             iterator xpos = const_cast<iterator>(pos);
@@ -454,6 +479,15 @@ namespace leptstl
                 data_allocator::construct(leptstl::address_of(*end_), value);
                 ++end_;
             }
+            else if(end_ != cap_ && is_trivially_relocatable<T>::value)
+            {
+                typename std::aligned_storage<sizeof(T), alignof(T)>::type buf;
+                pointer tmp = reinterpret_cast<pointer>(&buf);
+                data_allocator::construct(tmp, value);
+                leptstl::uninitialized_relocate(xpos, end_, xpos + 1);
+                leptstl::uninitialized_relocate(tmp, tmp + 1, xpos);
+                ++end_;
+            }
             else if(end_ != cap_)
             {
                 auto new_end = end_;
@@ -470,34 +504,48 @@ namespace leptstl
         }
 
     /* 删除pos位置上的元素*/
-    template<typename T>
-        typename vector<T>::iterator 
-        vector<T>::erase(const_iterator pos)
+    template<typename T, typename Alloc>
+        typename vector<T, Alloc>::iterator 
+        vector<T, Alloc>::erase(const_iterator pos)
         {
             LEPTSTL_DEBUG(pos >= begin() && pos < end());
             iterator xpos = begin_ + (pos - begin());
-            leptstl::move(xpos + 1, end_, xpos);
-            data_allocator::destroy(end_ - 1);
+            if(is_trivially_relocatable<T>::value)
+            {
+                data_allocator::destroy(xpos);
+                leptstl::uninitialized_relocate(xpos + 1, end_, xpos);
+            }
+            else 
+            {
+                leptstl::move(xpos + 1, end_, xpos);
+                data_allocator::destroy(end_ - 1);
+            }
             --end_;
             return xpos;
         }
 
     /* 删除[firt,last)上的元素*/
-    template<typename T>
-        typename vector<T>::iterator 
-        vector<T>::erase(const_iterator first, const_iterator last)
+    template<typename T, typename Alloc>
+        typename vector<T, Alloc>::iterator 
+        vector<T, Alloc>::erase(const_iterator first, const_iterator last)
         {
             LEPTSTL_DEBUG(first >= begin() && last <= end() && !(last < first));
             const auto n = first - begin();
             iterator r = begin_ + (first - begin());
-            data_allocator::destroy(leptstl::move(r + (last - first), end_, r), end_);
+            if(is_trivially_relocatable<T>::value)
+            {
+                data_allocator::destroy(r, r + (last - first));
+                leptstl::uninitialized_relocate(r + (last - first), end_, r);
+            }
+            else 
+                data_allocator::destroy(leptstl::move(r + (last - first), end_, r), end_);
             end_ = end_ - (last - first);
             return begin_ + n;
         }
 
     /* 重置容器大小*/
-    template<typename T>
-        void vector<T>::resize(size_type new_size, const value_type& value)
+    template<typename T, typename Alloc>
+        void vector<T, Alloc>::resize(size_type new_size, const value_type& value)
         {
             if(new_size < size())
                 erase(begin() + new_size, end());
@@ -505,9 +553,39 @@ namespace leptstl
                 insert(end(), new_size - size(), value);
         }
 
+    /* 默认初始化新增元素的 resize */
+    template<typename T, typename Alloc>
+        void vector<T, Alloc>::resize_default_init(size_type new_size)
+        {
+            if(new_size < size())
+                erase(begin() + new_size, end());
+            else 
+            {
+                const size_type n = new_size - size();
+                if(static_cast<size_type>(cap_ - end_) < n)
+                    realloc_storage(get_new_cap(n));
+                end_ = leptstl::uninitialized_default_construct_n(end_, n);
+            }
+        }
+
+    /* 由 op 直接写入缓冲区*/
+    template<typename T, typename Alloc>
+        template<typename Op>
+        void vector<T, Alloc>::resize_and_overwrite(size_type n, Op op)
+        {
+            static_assert(std::is_trivially_default_constructible<T>::value &&
+                          std::is_trivially_destructible<T>::value,
+                          "vector<T>::resize_and_overwrite requires a trivial type");
+            if(capacity() < n)
+                realloc_storage(get_new_cap(n - capacity()));
+            const size_type r = static_cast<size_type>(op(begin_, n));
+            LEPTSTL_DEBUG(r <= n);
+            end_ = begin_ + r;
+        }
+
     /* 与另一个vector交换*/
-    template<typename T>
-        void vector<T>::swap(vector<T>& rhs) noexcept 
+    template<typename T, typename Alloc>
+        void vector<T, Alloc>::swap(vector<T, Alloc>& rhs) noexcept 
         {
             if(this != &rhs)
             {
@@ -521,8 +599,8 @@ namespace leptstl
     /* helper function*/
 
     /* try_init 若分配失败则忽略，不抛出异常*/
-    template<typename T>
-        void vector<T>::try_init() noexcept 
+    template<typename T, typename Alloc>
+        void vector<T, Alloc>::try_init() noexcept 
         {
             try 
             {
@@ -539,8 +617,8 @@ namespace leptstl
         }
 
     /* init_space 申请空间*/
-    template<typename T>
-        void vector<T>::init_space(size_type size, size_type cap)
+    template<typename T, typename Alloc>
+        void vector<T, Alloc>::init_space(size_type size, size_type cap)
         {
             try 
             {
@@ -558,8 +636,8 @@ namespace leptstl
         }
 
     /* fill_init */
-    template<typename T>
-        void vector<T>::fill_init(size_type n, const value_type& value)
+    template<typename T, typename Alloc>
+        void vector<T, Alloc>::fill_init(size_type n, const value_type& value)
         {
             const size_type init_size = leptstl::max(static_cast<size_type>(16), n);
             init_space(n, init_size);
@@ -567,9 +645,9 @@ namespace leptstl
         }
 
     /* range_init */
-    template<typename T>
+    template<typename T, typename Alloc>
         template<typename Iter>
-        void vector<T>::range_init(Iter first, Iter last)
+        void vector<T, Alloc>::range_init(Iter first, Iter last)
         {
             const size_type init_size = leptstl::max(static_cast<size_type>(last - first),static_cast<size_type>(16));
             init_space(static_cast<size_type>(last - first), init_size);
@@ -577,16 +655,16 @@ namespace leptstl
         }
 
     /* destroy_and_recover */
-    template<typename T>
-        void vector<T>::destroy_and_recover(iterator first, iterator last, size_type n)
+    template<typename T, typename Alloc>
+        void vector<T, Alloc>::destroy_and_recover(iterator first, iterator last, size_type n)
         {
             data_allocator::destroy(first, last);
             data_allocator::deallocate(first, n);
         }
 
     /* get_new_cap  扩容1.5倍*/
-    template<typename T>
-        typename vector<T>::size_type vector<T>::get_new_cap(size_type add_size)
+    template<typename T, typename Alloc>
+        typename vector<T, Alloc>::size_type vector<T, Alloc>::get_new_cap(size_type add_size)
         {
             const auto old_size = capacity();
             THROW_LENGTH_ERROR_IF(old_size > max_size() - add_size, "vector<T>'s size too big");
@@ -602,8 +680,8 @@ namespace leptstl
         }
 
     /* fill_assign */
-    template<typename T>
-        void vector<T>::fill_assign(size_type n, const value_type& value)
+    template<typename T, typename Alloc>
+        void vector<T, Alloc>::fill_assign(size_type n, const value_type& value)
         {
             if(n > capacity())
             {
@@ -620,9 +698,9 @@ namespace leptstl
         }
 
     /* copy_assign */
-    template<typename T>
+    template<typename T, typename Alloc>
         template<typename Iter>
-        void vector<T>::copy_assign(Iter first, Iter last, input_iterator_tag)
+        void vector<T, Alloc>::copy_assign(Iter first, Iter last, input_iterator_tag)
         {
             auto cur = begin_;
             for(; first != last && cur != end_; ++ first, ++cur)
@@ -634,9 +712,9 @@ namespace leptstl
         }
 
     /* 用[firt,last)为容器赋值*/
-    template<typename T>
+    template<typename T, typename Alloc>
         template<typename Iter>
-        void vector<T>::copy_assign(Iter first, Iter last, forward_iterator_tag)
+        void vector<T, Alloc>::copy_assign(Iter first, Iter last, forward_iterator_tag)
         {
             const size_type len = leptstl::distance(first, last);
             if(len > capacity())
@@ -661,67 +739,149 @@ namespace leptstl
         }
 
     /* 重新分配空间并在pos处原地构造*/
-    template<typename T>
+    template<typename T, typename Alloc>
         template<typename ...Args>
-        void vector<T>::reallocate_emplace(iterator pos, Args&& ...args)
+        void vector<T, Alloc>::reallocate_emplace(iterator pos, Args&& ...args)
         {
             const auto new_size = get_new_cap(1);
+            if(is_realloc_allocator<Alloc>::value)
+            {
+                /* 新元素先构造在临时空间（args 可能引用旧空间中的元素），再原地扩容后放入*/
+                typename std::aligned_storage<sizeof(T), alignof(T)>::type buf;
+                pointer tmp = reinterpret_cast<pointer>(&buf);
+                data_allocator::construct(tmp, leptstl::forward<Args>(args)...);
+                const size_type n = pos - begin_;
+                realloc_storage(new_size);
+                leptstl::uninitialized_relocate(begin_ + n, end_, begin_ + n + 1);
+                leptstl::uninitialized_relocate(tmp, tmp + 1, begin_ + n);
+                ++end_;
+                return;
+            }
             auto new_begin = data_allocator::allocate(new_size);
             auto new_end = new_begin;
-            try 
+            if(is_trivially_relocatable<T>::value)
             {
-                new_end = leptstl::uninitialized_move(begin_, pos, new_begin);
-                data_allocator::construct(leptstl::address_of(*new_end), leptstl::forward<Args>(args)...);
-                ++new_end;
-                new_end = leptstl::uninitialized_move(pos, end_, new_end);
+                /* 先构造新元素，再把旧元素整段搬过去，旧空间只需释放不必析构*/
+                const size_type n = pos - begin_;
+                try 
+                {
+                    data_allocator::construct(new_begin + n, leptstl::forward<Args>(args)...);
+                }
+                catch(...)
+                {
+                    data_allocator::deallocate(new_begin, new_size);
+                    throw;
+                }
+                leptstl::uninitialized_relocate(begin_, pos, new_begin);
+                new_end = leptstl::uninitialized_relocate(pos, end_, new_begin + n + 1);
+                data_allocator::deallocate(begin_, cap_ - begin_);
             }
-            catch(...)
+            else 
             {
-                data_allocator::deallocate(new_begin, new_size);
-                throw;
+                try 
+                {
+                    new_end = leptstl::uninitialized_move(begin_, pos, new_begin);
+                    data_allocator::construct(leptstl::address_of(*new_end), leptstl::forward<Args>(args)...);
+                    ++new_end;
+                    new_end = leptstl::uninitialized_move(pos, end_, new_end);
+                }
+                catch(...)
+                {
+                    data_allocator::deallocate(new_begin, new_size);
+                    throw;
+                }
+                destroy_and_recover(begin_, end_, cap_ - begin_);
             }
-            destroy_and_recover(begin_, end_, cap_ - begin_);
             begin_ = new_begin;
             end_ = new_end;
             cap_ = new_begin + new_size;
         }
 
     /* 重新分配空间并在pos处插入元素*/
-    template<typename T>
-        void vector<T>::reallocate_insert(iterator pos, const value_type& value)
+    template<typename T, typename Alloc>
+        void vector<T, Alloc>::reallocate_insert(iterator pos, const value_type& value)
         {
             const auto new_size = get_new_cap(1);
+            if(is_realloc_allocator<Alloc>::value)
+            {
+                const value_type value_copy = value;
+                const size_type n = pos - begin_;
+                realloc_storage(new_size);
+                leptstl::uninitialized_relocate(begin_ + n, end_, begin_ + n + 1);
+                data_allocator::construct(begin_ + n, value_copy);
+                ++end_;
+                return;
+            }
             auto new_begin = data_allocator::allocate(new_size);
             auto new_end = new_begin;
             const value_type& value_copy = value;
-            try 
+            if(is_trivially_relocatable<T>::value)
             {
-                new_end = leptstl::uninitialized_move(begin_, pos, new_begin);
-                data_allocator::construct(leptstl::address_of(*new_end), value_copy);
-                ++new_end;
-                new_end = leptstl::uninitialized_move(pos, end_, new_end);
+                const size_type n = pos - begin_;
+                try 
+                {
+                    data_allocator::construct(new_begin + n, value_copy);
+                }
+                catch(...)
+                {
+                    data_allocator::deallocate(new_begin, new_size);
+                    throw;
+                }
+                leptstl::uninitialized_relocate(begin_, pos, new_begin);
+                new_end = leptstl::uninitialized_relocate(pos, end_, new_begin + n + 1);
+                data_allocator::deallocate(begin_, cap_ - begin_);
             }
-            catch(...)
+            else 
             {
-                data_allocator::deallocate(new_begin, new_size);
-                throw;
+                try 
+                {
+                    new_end = leptstl::uninitialized_move(begin_, pos, new_begin);
+                    data_allocator::construct(leptstl::address_of(*new_end), value_copy);
+                    ++new_end;
+                    new_end = leptstl::uninitialized_move(pos, end_, new_end);
+                }
+                catch(...)
+                {
+                    data_allocator::deallocate(new_begin, new_size);
+                    throw;
+                }
+                destroy_and_recover(begin_, end_, cap_ - begin_);
             }
-            destroy_and_recover(begin_, end_, cap_ - begin_);
             begin_ = new_begin;
             end_ = new_end;
-            cap_ = new_begin = new_size;
+            cap_ = new_begin + new_size;
         }
 
     /* fill_insert */
-    template<typename T>
-        typename vector<T>::iterator 
-        vector<T>::fill_insert(iterator pos, size_type n, const value_type& value)
+    template<typename T, typename Alloc>
+        typename vector<T, Alloc>::iterator 
+        vector<T, Alloc>::fill_insert(iterator pos, size_type n, const value_type& value)
         {
             if(n == 0)
                 return pos;
             const size_type xpos = pos - begin_;
             const value_type value_copy = value;/*避免被覆盖*/
-            if(static_cast<size_type>(cap_ - end_) >= n)
+            if(static_cast<size_type>(cap_ - end_) < n && is_realloc_allocator<Alloc>::value)
+            {
+                realloc_storage(get_new_cap(n));
+                pos = begin_ + xpos;
+            }
+            if(static_cast<size_type>(cap_ - end_) >= n && is_trivially_relocatable<T>::value)
+            {
+                /* 后段整体后移n个位置，空出的位置直接构造*/
+                leptstl::uninitialized_relocate(pos, end_, pos + n);
+                try 
+                {
+                    leptstl::uninitialized_fill_n(pos, n, value_copy);
+                }
+                catch(...)
+                {
+                    leptstl::uninitialized_relocate(pos + n, end_ + n, pos);
+                    throw;
+                }
+                end_ += n;
+            }
+            else if(static_cast<size_type>(cap_ - end_) >= n)
             {
                 const size_type after_elems = end_ - pos;
                 auto old_end = end_;
@@ -745,16 +905,33 @@ namespace leptstl
                 const auto new_size = get_new_cap(n);
                 auto new_begin = data_allocator::allocate(new_size);
                 auto new_end = new_begin;
-                try 
+                if(is_trivially_relocatable<T>::value)
                 {
-                    new_end = leptstl::uninitialized_move(begin_, pos, new_begin);
-                    new_end = leptstl::uninitialized_fill_n(new_end, n,value);
-                    new_end = leptstl::uninitialized_move(pos, end_, new_end);
+                    try 
+                    {
+                        leptstl::uninitialized_fill_n(new_begin + xpos, n, value_copy);
+                    }
+                    catch(...)
+                    {
+                        data_allocator::deallocate(new_begin, new_size);
+                        throw;
+                    }
+                    leptstl::uninitialized_relocate(begin_, pos, new_begin);
+                    new_end = leptstl::uninitialized_relocate(pos, end_, new_begin + xpos + n);
                 }
-                catch(...)
+                else 
                 {
-                    destroy_and_recover(new_begin, new_end, new_size);
-                    throw;
+                    try 
+                    {
+                        new_end = leptstl::uninitialized_move(begin_, pos, new_begin);
+                        new_end = leptstl::uninitialized_fill_n(new_end, n,value);
+                        new_end = leptstl::uninitialized_move(pos, end_, new_end);
+                    }
+                    catch(...)
+                    {
+                        destroy_and_recover(new_begin, new_end, new_size);
+                        throw;
+                    }
                 }
                 data_allocator::deallocate(begin_, cap_ - begin_);
                 begin_ = new_begin;
@@ -765,14 +942,28 @@ namespace leptstl
         }
 
     /* copy_insert */
-    template<typename T>
+    template<typename T, typename Alloc>
         template<typename Iter>
-        void vector<T>::copy_insert(iterator pos, Iter first, Iter last)
+        void vector<T, Alloc>::copy_insert(iterator pos, Iter first, Iter last)
         {
             if(first == last)
                 return;
             const auto n = leptstl::distance(first, last);
-            if((cap_ - end_) >= n)
+            if((cap_ - end_) >= n && is_trivially_relocatable<T>::value)
+            {
+                leptstl::uninitialized_relocate(pos, end_, pos + n);
+                try 
+                {
+                    leptstl::uninitialized_copy(first, last, pos);
+                }
+                catch(...)
+                {
+                    leptstl::uninitialized_relocate(pos + n, end_ + n, pos);
+                    throw;
+                }
+                end_ += n;
+            }
+            else if((cap_ - end_) >= n)
             {
                 const size_type after_elems = end_ - pos;
                 auto old_end = end_;
@@ -797,16 +988,34 @@ namespace leptstl
                 const auto new_size = get_new_cap(n);
                 auto new_begin = data_allocator::allocate(new_size);
                 auto new_end = new_begin;
-                try 
+                if(is_trivially_relocatable<T>::value)
                 {
-                    new_end = leptstl::uninitialized_move(begin_, pos, new_begin);
-                    new_end = leptstl::uninitialized_copy(first, last, new_end);
-                    new_end = leptstl::uninitialized_move(pos, end_, new_end);
+                    const size_type xpos = pos - begin_;
+                    try 
+                    {
+                        leptstl::uninitialized_copy(first, last, new_begin + xpos);
+                    }
+                    catch(...)
+                    {
+                        data_allocator::deallocate(new_begin, new_size);
+                        throw;
+                    }
+                    leptstl::uninitialized_relocate(begin_, pos, new_begin);
+                    new_end = leptstl::uninitialized_relocate(pos, end_, new_begin + xpos + n);
                 }
-                catch(...)
+                else 
                 {
-                    destroy_and_recover(new_begin, new_end, new_size);
-                    throw;
+                    try 
+                    {
+                        new_end = leptstl::uninitialized_move(begin_, pos, new_begin);
+                        new_end = leptstl::uninitialized_copy(first, last, new_end);
+                        new_end = leptstl::uninitialized_move(pos, end_, new_end);
+                    }
+                    catch(...)
+                    {
+                        destroy_and_recover(new_begin, new_end, new_size);
+                        throw;
+                    }
                 }
                 data_allocator::deallocate(begin_, cap_ - begin_);
                 begin_ = new_begin;
@@ -816,70 +1025,422 @@ namespace leptstl
         }
 
     /* reinsert */
-    template<typename T>
-        void vector<T>::reinsert(size_type size)
+    template<typename T, typename Alloc>
+        void vector<T, Alloc>::reinsert(size_type size)
+        {
+            realloc_storage(size);
+        }
+
+    /* realloc_storage */
+    template<typename T, typename Alloc>
+        void vector<T, Alloc>::realloc_storage(size_type new_cap)
+        {
+            realloc_storage_aux(new_cap, is_realloc_allocator<Alloc>{});
+        }
+
+    /* 可平凡复制：交给 realloc_allocator 原地调整*/
+    template<typename T, typename Alloc>
+        void vector<T, Alloc>::realloc_storage_aux(size_type new_cap, std::true_type)
+        {
+            const size_type old_size = size();
+            begin_ = data_allocator::reallocate(begin_, capacity(), new_cap);
+            end_ = begin_ + old_size;
+            cap_ = begin_ + new_cap;
+        }
+
+    /* 否则申请新空间，把元素搬过去后释放旧空间*/
+    template<typename T, typename Alloc>
+        void vector<T, Alloc>::realloc_storage_aux(size_type new_cap, std::false_type)
         {
-            auto new_begin = data_allocator::allocate(size);
+            const size_type old_size = size();
+            auto new_begin = data_allocator::allocate(new_cap);
             try 
             {
-                leptstl::uninitialized_move(begin_, end_, new_begin);
+                leptstl::uninitialized_relocate(begin_, end_, new_begin);
             }
             catch(...)
             {
-                data_allocator::deallocate(new_begin, size);
+                data_allocator::deallocate(new_begin, new_cap);
                 throw;
             }
             data_allocator::deallocate(begin_, cap_ - begin_);
             begin_ = new_begin;
-            end_ = begin_ + size;
-            cap_ = begin_ + size;
+            end_ = begin_ + old_size;
+            cap_ = begin_ + new_cap;
         }
     
     /*************************************************************************/
     /* 重载比较操作符*/
-    template<typename T>
-        bool operator==(const vector<T>& lhs, const vector<T>& rhs)
+    template<typename T, typename Alloc>
+        bool operator==(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs)
         {
             return lhs.size() == rhs.size() && leptstl::equal(lhs.begin(),lhs.end(), rhs.begin());
         }
 
-    template<typename T>
-        bool operator<(const vector<T>& lhs, const vector<T>& rhs)
+    template<typename T, typename Alloc>
+        bool operator<(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs)
         {
-            return leptstl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin());
+            return leptstl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
         }
 
-    template<typename T>
-        bool operator!=(const vector<T>& lhs, const vector<T>& rhs)
+    template<typename T, typename Alloc>
+        bool operator!=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs)
         {
             return !(lhs == rhs);
         }
 
-    template<typename T>
-        bool operator>(const vector<T>& lhs, const vector<T>& rhs)
+    template<typename T, typename Alloc>
+        bool operator>(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs)
         {
             return rhs < lhs;
         }
 
-    template<typename T>
-        bool operator<=(const vector<T>& lhs, const vector<T>& rhs)
+    template<typename T, typename Alloc>
+        bool operator<=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs)
         {
             return !(rhs < lhs);
         }
 
-    template<typename T>
-        bool operator>=(const vector<T>& lhs, const vector<T>& rhs)
+    template<typename T, typename Alloc>
+        bool operator>=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs)
         {
             return !(lhs < rhs);
         }
 
     /*重载leptstl::swap*/
-    template<typename T>
-        void swap(vector<T>& lhs, vector<T>& rhs)
+    template<typename T, typename Alloc>
+        void swap(vector<T, Alloc>& lhs, vector<T, Alloc>& rhs)
         {
             lhs.swap(rhs);
         }
 
+    /*************************************************************************/
+    /* vector<bool>：按位存储，字数组交给同类分配器的 vector<bit_word> 管理
+     * 不变式：最后一个字中超出 size() 的位始终为0，比较与 flip 可以整字进行*/
+    template<typename Alloc>
+        class vector<bool, Alloc>
+        {
+        public:
+            typedef Alloc                                           allocator_type;
+            typedef bool                                            value_type;
+            typedef size_t                                          size_type;
+            typedef ptrdiff_t                                       difference_type;
+            typedef leptstl::bit_reference                          reference;
+            typedef bool                                            const_reference;
+            typedef leptstl::bit_reference*                         pointer;
+            typedef const bool*                                     const_pointer;
+
+            typedef leptstl::bit_iterator                           iterator;
+            typedef leptstl::bit_const_iterator                     const_iterator;
+            typedef leptstl::reverse_iterator<iterator>             reverse_iterator;
+            typedef leptstl::reverse_iterator<const_iterator>       const_reverse_iterator;
+
+            allocator_type get_allocator() { return allocator_type(); }
+
+        private:
+            typedef leptstl::vector<bit_word,
+                    typename allocator_rebind<Alloc, bit_word>::type> word_vector;
+
+            word_vector words_;  /* 存放各位的字*/
+            size_type   size_;   /* 位数*/
+
+        public:
+            /*构造 复制 移动 析构*/
+            vector() noexcept 
+                : size_(0) {}
+
+            explicit vector(size_type n)
+                : words_(bit_words_for(n), bit_word(0)), size_(n) {}
+
+            vector(size_type n, const value_type& value)
+                : words_(bit_words_for(n), value ? ~bit_word(0) : bit_word(0)), size_(n)
+            { clear_tail(); }
+
+            template<typename Iter, typename std::enable_if<
+                    leptstl::is_input_iterator<Iter>::value, int>::type = 0>
+                vector(Iter first, Iter last)
+                : size_(0)
+                {
+                    insert(end(), first, last);
+                }
+
+            vector(const vector& rhs)
+                : words_(rhs.words_), size_(rhs.size_) {}
+
+            vector(vector&& rhs) noexcept 
+                : words_(leptstl::move(rhs.words_)), size_(rhs.size_)
+            {
+                rhs.size_ = 0;
+            }
+
+            vector(std::initializer_list<value_type> ilist)
+                : size_(0)
+            {
+                insert(end(), ilist.begin(), ilist.end());
+            }
+
+            vector& operator=(const vector& rhs)
+            {
+                if (this != &rhs)
+                {
+                    words_ = rhs.words_;
+                    size_ = rhs.size_;
+                }
+                return *this;
+            }
+            vector& operator=(vector&& rhs) noexcept
+            {
+                words_ = leptstl::move(rhs.words_);
+                size_ = rhs.size_;
+                rhs.size_ = 0;
+                return *this;
+            }
+            vector& operator=(std::initializer_list<value_type> ilist)
+            {
+                vector tmp(ilist.begin(), ilist.end());
+                swap(tmp);
+                return *this;
+            }
+
+        public:
+            /* 迭代器相关操作*/
+            iterator                begin()           noexcept 
+            { return iterator(words_.data(), 0); }
+            const_iterator          begin()     const noexcept 
+            { return const_iterator(words_.data(), 0); }
+            iterator                end()             noexcept 
+            { return begin() + size_; }
+            const_iterator          end()       const noexcept 
+            { return begin() + size_; }
+
+            reverse_iterator        rbegin()          noexcept 
+            { return reverse_iterator(end()); }
+            const_reverse_iterator  rbegin()    const noexcept 
+            { return const_reverse_iterator(end()); }
+            reverse_iterator        rend()            noexcept 
+            { return reverse_iterator(begin()); }
+            const_reverse_iterator  rend()      const noexcept 
+            { return const_reverse_iterator(begin()); }
+
+            const_iterator          cbegin()    const noexcept 
+            { return begin(); }
+            const_iterator          cend()      const noexcept 
+            { return end(); }
+            const_reverse_iterator  crbegin()   const noexcept 
+            { return rbegin(); }
+            const_reverse_iterator  crend()     const noexcept 
+            { return rend(); }
+
+            /* 容量相关操作*/
+            bool        empty()     const noexcept 
+            { return size_ == 0; }
+            size_type   size()      const noexcept 
+            { return size_; }
+            size_type   max_size()  const noexcept 
+            { return words_.max_size() / 8 * bit_word_bits; }
+            size_type   capacity()  const noexcept 
+            { return words_.capacity() * bit_word_bits; }
+            void        reserve(size_type n)
+            { words_.reserve(bit_words_for(n)); }
+            void        shrink_to_fit()
+            { words_.shrink_to_fit(); }
+
+            /* 访问元素相关操作*/
+            reference operator[](size_type n)
+            {
+                LEPTSTL_DEBUG(n < size());
+                return *(begin() + n);
+            }
+            const_reference operator[](size_type n) const
+            {
+                LEPTSTL_DEBUG(n < size());
+                return *(begin() + n);
+            }
+            reference at(size_type n)
+            {
+                THROW_OUT_OF_RANGE_IF(!(n < size()), "vector<bool>::at() subscript out of range");
+                return (*this)[n];
+            }
+            const_reference at(size_type n) const
+            {
+                THROW_OUT_OF_RANGE_IF(!(n < size()), "vector<bool>::at() subscript out of range");
+                return (*this)[n];
+            }
+            reference front()
+            {
+                LEPTSTL_DEBUG(!empty());
+                return *begin();
+            }
+            const_reference front() const
+            {
+                LEPTSTL_DEBUG(!empty());
+                return *begin();
+            }
+            reference back()
+            {
+                LEPTSTL_DEBUG(!empty());
+                return *(end() - 1);
+            }
+            const_reference back() const
+            {
+                LEPTSTL_DEBUG(!empty());
+                return *(end() - 1);
+            }
+
+            /* 修改容器相关操作*/
+            void assign(size_type n, const value_type& value)
+            {
+                words_.assign(bit_words_for(n), value ? ~bit_word(0) : bit_word(0));
+                size_ = n;
+                clear_tail();
+            }
+            template<typename Iter, typename std::enable_if<
+                    leptstl::is_input_iterator<Iter>::value, int>::type = 0>
+                void assign(Iter first, Iter last)
+                {
+                    clear();
+                    insert(end(), first, last);
+                }
+            void assign(std::initializer_list<value_type> ilist)
+            { assign(ilist.begin(), ilist.end()); }
+
+            void push_back(const value_type& value)
+            {
+                if (size_ % bit_word_bits == 0)
+                    words_.push_back(bit_word(0));
+                if (value)
+                    words_.back() |= bit_word(1) << (size_ % bit_word_bits);
+                ++size_;
+            }
+            void emplace_back(const value_type& value)
+            { push_back(value); }
+
+            void pop_back()
+            {
+                LEPTSTL_DEBUG(!empty());
+                resize(size_ - 1);
+            }
+
+            iterator insert(const_iterator pos, const value_type& value)
+            {
+                iterator p = open_gap(pos, 1);
+                *p = value;
+                return p;
+            }
+            iterator insert(const_iterator pos, size_type n, const value_type& value)
+            {
+                iterator p = open_gap(pos, n);
+                leptstl::bit_fill(p, p + n, value);
+                return p;
+            }
+            template<typename Iter, typename std::enable_if<
+                    leptstl::is_input_iterator<Iter>::value, int>::type = 0>
+                iterator insert(const_iterator pos, Iter first, Iter last)
+                {
+                    return range_insert(pos, first, last, iterator_category(first));
+                }
+            iterator insert(const_iterator pos, std::initializer_list<value_type> ilist)
+            { return insert(pos, ilist.begin(), ilist.end()); }
+
+            iterator erase(const_iterator pos)
+            { return erase(pos, pos + 1); }
+            iterator erase(const_iterator first, const_iterator last)
+            {
+                LEPTSTL_DEBUG(first >= begin() && last <= end() && !(last < first));
+                const size_type xpos = first - cbegin();
+                leptstl::copy(last, cend(), begin() + xpos);
+                resize(size_ - (last - first));
+                return begin() + xpos;
+            }
+            void clear() noexcept
+            {
+                words_.clear();
+                size_ = 0;
+            }
+
+            void resize(size_type new_size, const value_type& value = false)
+            {
+                const size_type old_size = size_;
+                words_.resize(bit_words_for(new_size), bit_word(0));
+                size_ = new_size;
+                if (new_size < old_size)
+                    clear_tail();
+                else if (value)
+                    leptstl::bit_fill(begin() + old_size, end(), true);
+            }
+
+            /* 翻转所有位*/
+            void flip() noexcept
+            {
+                for (auto& w : words_)
+                    w = ~w;
+                clear_tail();
+            }
+
+            void swap(vector& rhs) noexcept
+            {
+                words_.swap(rhs.words_);
+                leptstl::swap(size_, rhs.size_);
+            }
+
+            /* 按字比较，供 operator== 使用*/
+            bool word_equal(const vector& rhs) const noexcept
+            {
+                return size_ == rhs.size_ && leptstl::equal(words_.begin(), words_.end(), rhs.words_.begin());
+            }
+
+        private:
+            /* 把最后一个字中超出 size() 的位清零*/
+            void clear_tail() noexcept
+            {
+                if (size_ % bit_word_bits != 0)
+                    words_.back() &= (bit_word(1) << (size_ % bit_word_bits)) - 1;
+            }
+
+            /* 在 pos 处空出 n 位，返回空位的起始位置*/
+            iterator open_gap(const_iterator pos, size_type n)
+            {
+                LEPTSTL_DEBUG(pos >= begin() && pos <= end());
+                const size_type xpos = pos - cbegin();
+                const size_type old_size = size_;
+                if (bit_words_for(old_size + n) > words_.capacity())
+                    words_.reserve(leptstl::max(bit_words_for(old_size + n), words_.capacity() * 2));
+                words_.resize(bit_words_for(old_size + n), bit_word(0));
+                size_ = old_size + n;
+                leptstl::copy_backward(begin() + xpos, begin() + old_size, end());
+                return begin() + xpos;
+            }
+
+            template<typename IIter>
+                iterator range_insert(const_iterator pos, IIter first, IIter last, input_iterator_tag)
+                {
+                    const size_type xpos = pos - cbegin();
+                    const size_type old_size = size_;
+                    for (; first != last; ++first)
+                        push_back(*first);
+                    leptstl::rotate(begin() + xpos, begin() + old_size, end());
+                    return begin() + xpos;
+                }
+            template<typename FIter>
+                iterator range_insert(const_iterator pos, FIter first, FIter last, forward_iterator_tag)
+                {
+                    const size_type n = leptstl::distance(first, last);
+                    iterator p = open_gap(pos, n);
+                    leptstl::copy(first, last, p);
+                    return p;
+                }
+        };
+
+    template<typename Alloc>
+        bool operator==(const vector<bool, Alloc>& lhs, const vector<bool, Alloc>& rhs)
+        {
+            return lhs.word_equal(rhs);
+        }
+
+    /* vector 只保存三个指向堆空间的指针，可以按字节搬迁*/
+    template<typename T, typename Alloc>
+        struct is_trivially_relocatable<vector<T, Alloc>> : leptstl::lept_true_type{};
+
 }   /* namespace leptstl */
 
 #endif  /* LEPTSTL_VECTOR_H__ */
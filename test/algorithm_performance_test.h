@@ -21,6 +21,7 @@ namespace leptstl
         namespace algorithm_performance_test 
         {
             /*函数性能测试宏定义 */
+            /* 只运行一次、按毫秒计时，仅用于粗略对比；需要可靠的数字时使用 leptstl_bench（bench/algorithm_bench.h）*/
 #define FUN_TEST1(mode, fun, count) do {                        \
     std::string fun_name = #fun;                                \
     srand((int)time(0));                                        \
@@ -1028,6 +1028,38 @@ namespace  leptstl
                 std::rotate(arr1, arr1 + 9, arr1 + 9);
                 leptstl::rotate(arr2, arr2 + 9, arr2 + 9);
                 EXPECT_CON_EQ(arr1, arr2);
+                /* 前后两段等长*/
+                int arr3[] = { 1,2,3,4,5,6,7,8 };
+                int arr4[] = { 1,2,3,4,5,6,7,8 };
+                std::rotate(arr3, arr3 + 4, arr3 + 8);
+                EXPECT_EQ(leptstl::rotate(arr4, arr4 + 4, arr4 + 8), arr4 + 4);
+                EXPECT_CON_EQ(arr3, arr4);
+                /* gcd(n, k) > 1，有多个环*/
+                int arr5[] = { 1,2,3,4,5,6,7,8,9,10,11,12 };
+                int arr6[] = { 1,2,3,4,5,6,7,8,9,10,11,12 };
+                std::rotate(arr5, arr5 + 4, arr5 + 12);
+                EXPECT_EQ(leptstl::rotate(arr6, arr6 + 4, arr6 + 12), arr6 + 8);
+                EXPECT_CON_EQ(arr5, arr6);
+                std::rotate(arr5, arr5 + 9, arr5 + 12);
+                EXPECT_EQ(leptstl::rotate(arr6, arr6 + 9, arr6 + 12), arr6 + 3);
+                EXPECT_CON_EQ(arr5, arr6);
+                /* 所有长度不超过 24 的区间与所有分割点，结果与返回值都与 std::rotate 一致*/
+                bool all_same = true;
+                for (int n = 1; n <= 24; ++n)
+                {
+                    for (int k = 0; k <= n; ++k)
+                    {
+                        std::vector<int> exp(n);
+                        leptstl::vector<int> act(n);
+                        for (int i = 0; i < n; ++i)
+                            exp[i] = act[i] = i;
+                        auto exp_mid = std::rotate(exp.begin(), exp.begin() + k, exp.end());
+                        auto act_mid = leptstl::rotate(act.begin(), act.begin() + k, act.end());
+                        all_same = all_same && exp_mid - exp.begin() == act_mid - act.begin()
+                            && std::equal(exp.begin(), exp.end(), act.begin());
+                    }
+                }
+                EXPECT_TRUE(all_same);
             }
             
             TEST(rotate_copy_test)
@@ -1090,9 +1122,16 @@ namespace  leptstl
                 leptstl::sort(arr4, arr4 + 20);
                 std::sort(arr5, arr5 + 9, std::greater<int>());
                 leptstl::sort(arr6, arr6 + 9, std::greater<int>());
+                /* 超过插入排序的区间长度，走 intro_sort 与 unchecked_insertion_sort*/
+                int arr7[1000], arr8[1000];
+                for (int i = 0; i < 1000; ++i)
+                    arr7[i] = arr8[i] = (i * 7919) % 1009;
+                std::sort(arr7, arr7 + 1000, std::greater<int>());
+                leptstl::sort(arr8, arr8 + 1000, std::greater<int>());
                 EXPECT_CON_EQ(arr1, arr2);
                 EXPECT_CON_EQ(arr3, arr4);
                 EXPECT_CON_EQ(arr5, arr6);
+                EXPECT_CON_EQ(arr7, arr8);
             }
 
             TEST(swap_ranges_test)
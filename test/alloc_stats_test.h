@@ -0,0 +1,83 @@
+/*************************************************************************
+	> File Name: alloc_stats_test.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 12:10:37 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_ALLOC_STATS_TEST_H__
+#define LEPTSTL_ALLOC_STATS_TEST_H__
+
+/* leptstl_test 默认不定义 LEPTSTL_ALLOC_STATS，这里直接调用记录函数检查统计本身，
+ * 并检查未启用时分配器不做任何记录；启用后的完整输出见 leptstl_bench（-DLEPTSTL_ALLOC_STATS=ON）*/
+
+#include <sstream>
+
+#include "../leptSTL/alloc_stats.h"
+#include "../leptSTL/deque.h"
+#include "../leptSTL/vector.h"
+#include "lept_test.h"
+
+namespace leptstl
+{
+    namespace test
+    {
+        namespace alloc_stats_test
+        {
+            struct tracked {};
+
+            void alloc_stats_test()
+            {
+                cout << "[===============================================================]" << std::endl;
+                cout << "[---------------- Run container test : alloc_stats --------------]" << std::endl;
+                cout << "[-------------------------- API test ---------------------------]" << std::endl;
+                alloc_type_stats& s = alloc_stats::of<tracked>();
+                alloc_stats::record_allocate<tracked>(24);
+                alloc_stats::record_allocate<tracked>(4096);
+                alloc_stats::record_deallocate<tracked>(24);
+                alloc_stats::record_allocate<tracked>(100);
+                alloc_counters c = s.snapshot();
+                FUN_VALUE(s.name());
+                FUN_VALUE(c.allocations);
+                FUN_VALUE(c.deallocations);
+                FUN_VALUE(c.bytes_allocated);
+                FUN_VALUE(c.live_bytes);
+                FUN_VALUE(c.peak_live_bytes);
+                FUN_VALUE(c.histogram[alloc_type_stats::bucket(24)]);
+                FUN_VALUE(alloc_type_stats::bucket(4096));
+                FUN_VALUE(alloc_type_stats::bucket(static_cast<size_t>(-1)));
+                std::ostringstream json;
+                alloc_stats::dump_json(json);
+                cout << " dump_json : " << json.str().substr(json.str().find("\"types\"")) << "\n";
+                alloc_stats::record_deallocate<tracked>(4096);
+                alloc_stats::record_deallocate<tracked>(100);
+                s.reset();
+                c = s.snapshot();
+                FUN_VALUE(c.allocations);
+                FUN_VALUE(c.live_bytes);
+                FUN_VALUE(c.peak_live_bytes);
+
+                /* 启用时分配器的每次分配都计入合计，未启用时分配器不经过统计*/
+                const uint64_t before = alloc_stats::total().allocations;
+                {
+                    leptstl::vector<int> v(1000, 1);
+                    leptstl::deque<int> d(1000, 1);
+                    v.push_back(2);
+                    d.push_front(2);
+                }
+                cout << std::boolalpha;
+                FUN_VALUE(alloc_stats::enabled());
+                const uint64_t after = alloc_stats::total().allocations;
+                FUN_VALUE((alloc_stats::enabled() ? after > before : after == before));
+                cout << std::noboolalpha;
+                PASSED;
+                cout << "[---------------- End container test : alloc_stats --------------]" << std::endl;
+            }
+
+        }   /* namespace alloc_stats_test */
+
+    }   /* namespace test */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_ALLOC_STATS_TEST_H__ */
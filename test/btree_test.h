@@ -0,0 +1,217 @@
+/*************************************************************************
+	> File Name: btree_test.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Mon 19 Oct 2026 06:12:25 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_BTREE_TEST_H__
+#define LEPTSTL_BTREE_TEST_H__
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../leptSTL/btree_map.h"
+#include "../leptSTL/btree_set.h"
+#include "lept_test.h"
+
+namespace leptstl
+{
+    namespace test
+    {
+        namespace btree_test
+        {
+            /* 随机插入 / 删除，与 std::multiset / std::set 对照，检查内容以及 lower_bound / upper_bound*/
+            bool btree_check(size_t ops)
+            {
+                leptstl::btree_multiset<int> bm;
+                leptstl::btree_set<int> bs;
+                std::multiset<int> sm;
+                std::set<int> ss;
+                bool ok = true;
+                srand(12345);
+                for (size_t i = 0; i < ops && ok; ++i)
+                {
+                    const int key = rand() % 2000;
+                    if (rand() % 3 == 0)
+                    {
+                        ok = ok && bm.erase(key) == sm.erase(key);
+                        ok = ok && bs.erase(key) == ss.erase(key);
+                    }
+                    else
+                    {
+                        bm.insert(key);
+                        sm.insert(key);
+                        ok = ok && bs.insert(key).second == ss.insert(key).second;
+                    }
+                    if ((i & 1023) == 0)
+                    {
+                        ok = ok && bm.size() == sm.size() && bs.size() == ss.size()
+                            && std::equal(bm.begin(), bm.end(), sm.begin())
+                            && std::equal(bs.rbegin(), bs.rend(), ss.rbegin());
+                        const int probe = rand() % 2000;
+                        ok = ok && leptstl::distance(bm.begin(), bm.lower_bound(probe))
+                                   == std::distance(sm.begin(), sm.lower_bound(probe))
+                                && leptstl::distance(bm.begin(), bm.upper_bound(probe))
+                                   == std::distance(sm.begin(), sm.upper_bound(probe))
+                                && bm.count(probe) == sm.count(probe);
+                    }
+                }
+                /* 区间删除会跨越多个叶子*/
+                bm.erase(bm.lower_bound(500), bm.upper_bound(1500));
+                sm.erase(sm.lower_bound(500), sm.upper_bound(1500));
+                ok = ok && bm.size() == sm.size() && std::equal(bm.begin(), bm.end(), sm.begin());
+                return ok;
+            }
+
+            /* 打乱顺序插入 n 个键（多重集合中每个键两份），再打乱顺序逐个删除，与 std::set / std::multiset 对照
+             * 随机删除会让内部节点只剩一个孩子，检查合并、借用以及根的降低*/
+            bool btree_erase_check(size_t n, unsigned seed)
+            {
+                std::mt19937 gen(seed);
+                std::vector<int> keys;
+                for (size_t i = 0; i < n; ++i)
+                    keys.push_back(static_cast<int>(i));
+                std::shuffle(keys.begin(), keys.end(), gen);
+                leptstl::btree_set<int> bs;
+                leptstl::btree_multiset<int> bm;
+                std::set<int> ss;
+                std::multiset<int> sm;
+                for (size_t i = 0; i < n; ++i)
+                {
+                    bs.insert(keys[i]);
+                    ss.insert(keys[i]);
+                    bm.insert(keys[i]);
+                    bm.insert(keys[n - 1 - i]);
+                    sm.insert(keys[i]);
+                    sm.insert(keys[n - 1 - i]);
+                }
+                bool ok = true;
+                for (int round = 0; round < 2 && ok; ++round)
+                {
+                    std::shuffle(keys.begin(), keys.end(), gen);
+                    for (size_t i = 0; i < n && ok; ++i)
+                    {
+                        ok = bs.erase(keys[i]) == ss.erase(keys[i]);
+                        bm.erase(bm.find(keys[i]));
+                        sm.erase(sm.find(keys[i]));
+                        if (ok && (i % 64 == 0 || i + 1 == n))
+                        {
+                            ok = bs.size() == ss.size() && bm.size() == sm.size()
+                                && std::equal(bs.begin(), bs.end(), ss.begin())
+                                && std::equal(bm.rbegin(), bm.rend(), sm.rbegin());
+                        }
+                    }
+                }
+                ok = ok && bs.empty() && bm.empty();
+                /* 删空后仍可继续使用*/
+                for (size_t i = 0; i < n && ok; ++i)
+                    ok = bs.insert(keys[i]).second;
+                int expect = 0;
+                for (auto it = bs.begin(); ok && it != bs.end(); ++it)
+                    ok = *it == expect++;
+                return ok && bs.size() == n;
+            }
+
+            void btree_test()
+            {
+                cout << "[===============================================================]" << std::endl;
+                cout << "[---------------- Run container test : btree_set ----------------]" << std::endl;
+                cout << "[-------------------------- API test ---------------------------]" << std::endl;
+                int a[] = { 5,4,3,2,1 };
+                leptstl::btree_set<int> s1;
+                leptstl::btree_set<int> s2(a, a + 5);
+                leptstl::btree_set<int> s3{ 9,7,5,3,1 };
+                leptstl::btree_set<int, leptstl::greater<int>> s4(a, a + 5);
+                leptstl::btree_set<int> s5(s2);
+                leptstl::btree_set<int> s6(std::move(s5));
+                leptstl::btree_set<int> s7;
+                s7 = s3;
+
+                FUN_AFTER(s1, s1.insert(3));
+                FUN_AFTER(s1, s1.emplace(1));
+                FUN_AFTER(s1, s1.insert(a, a + 5));
+                FUN_AFTER(s1, s1.erase(s1.begin()));
+                FUN_AFTER(s1, s1.erase(4));
+                FUN_AFTER(s1, s1.erase(s1.find(3), s1.end()));
+                COUT(s4);
+                cout << std::boolalpha;
+                FUN_VALUE(s1.insert(2).second);
+                FUN_VALUE((s2 == s6));
+                FUN_VALUE((s3 < s2));
+                FUN_VALUE(s1.empty());
+                cout << std::noboolalpha;
+                FUN_VALUE(s1.size());
+                FUN_VALUE(s3.count(5));
+                FUN_VALUE(*s3.lower_bound(4));
+                FUN_VALUE(*s3.upper_bound(5));
+                FUN_VALUE(*s3.equal_range(7).first);
+                FUN_VALUE(*s3.rbegin());
+                for (int i = 0; i < 10000; ++i)
+                    s1.insert(i);
+                FUN_VALUE(s1.size());
+                FUN_VALUE(s1.height());
+                FUN_AFTER(s7, s7.swap(s3));
+                FUN_AFTER(s7, s7.clear());
+
+                leptstl::btree_multiset<int> ms{ 3,1,3,2,3 };
+                COUT(ms);
+                FUN_VALUE(ms.count(3));
+                FUN_AFTER(ms, ms.insert(2));
+                FUN_AFTER(ms, ms.erase(3));
+                FUN_VALUE((ms.equal_range(2).second == ms.end()));
+
+                leptstl::btree_map<std::string, int> m1;
+                m1["two"] = 2;
+                m1["one"] = 1;
+                m1.emplace("three", 3);
+                m1.insert(leptstl::make_pair(std::string("four"), 4));
+                cout << " m1 :";
+                for (auto& kv : m1)
+                    cout << " <" << kv.first << "," << kv.second << ">";
+                cout << "\n";
+                FUN_VALUE(m1.at("one"));
+                FUN_VALUE(m1["five"]);
+                FUN_VALUE(m1.size());
+                FUN_VALUE(m1.lower_bound("p")->first);
+                FUN_VALUE(m1.erase("five"));
+                try
+                {
+                    m1.at("six");
+                }
+                catch (std::out_of_range&)
+                {
+                    cout << " m1.at(\"six\") : out_of_range\n";
+                }
+                leptstl::btree_multimap<int, char> mm{ {1,'a'}, {2,'b'}, {1,'c'} };
+                cout << " mm :";
+                for (auto& kv : mm)
+                    cout << " <" << kv.first << "," << kv.second << ">";
+                cout << "\n";
+                FUN_VALUE(mm.count(1));
+
+                cout << "[------------------------- stress test -------------------------]" << std::endl;
+                cout << std::boolalpha;
+                FUN_VALUE(btree_check(LEN1));
+                {
+                    bool erase_ok = true;
+                    for (unsigned seed = 1; seed <= 8 && erase_ok; ++seed)
+                        erase_ok = btree_erase_check(1000, seed) && btree_erase_check(LEN1 _S, seed + 41);
+                    FUN_VALUE(erase_ok);
+                }
+                cout << std::noboolalpha;
+                PASSED;
+                cout << "[---------------- End container test : btree_set ----------------]" << std::endl;
+            }
+
+        }   /* namespace btree_test */
+
+    }   /* namespace test */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_BTREE_TEST_H__ */
+
@@ -0,0 +1,123 @@
+/*************************************************************************
+	> File Name: circular_buffer_test.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Mon 19 Oct 2026 09:40:02 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_CIRCULAR_BUFFER_TEST_H__
+#define LEPTSTL_CIRCULAR_BUFFER_TEST_H__
+
+#include <string>
+
+#include "../leptSTL/algorithm.h"
+#include "../leptSTL/circular_buffer.h"
+#include "lept_test.h"
+
+namespace leptstl
+{
+    namespace test
+    {
+        namespace circular_buffer_test
+        {
+            void circular_buffer_test()
+            {
+                cout << "[===============================================================]" << std::endl;
+                cout << "[------------- Run container test : circular_buffer -------------]" << std::endl;
+                cout << "[-------------------------- API test ---------------------------]" << std::endl;
+                leptstl::circular_buffer<int> c1(5);
+                leptstl::circular_buffer<int> c2{ 1,2,3,4,5 };
+                leptstl::circular_buffer<int> c3(c2);
+                leptstl::circular_buffer<int> c4(std::move(c3));
+                leptstl::circular_buffer<int> c5(3, false);
+                c5 = c2;
+
+                FUN_VALUE(c1.capacity());
+                FUN_AFTER(c1, c1.push_back(1));
+                FUN_AFTER(c1, c1.push_back(2));
+                FUN_AFTER(c1, c1.push_front(0));
+                FUN_AFTER(c1, c1.emplace_back(3));
+                FUN_AFTER(c1, c1.emplace_front(-1));
+                FUN_AFTER(c1, c1.push_back(4));
+                FUN_AFTER(c1, c1.push_back(5));
+                FUN_AFTER(c1, c1.push_back(6));
+                FUN_AFTER(c1, c1.push_back(7));
+                FUN_AFTER(c1, c1.push_back(8));
+                FUN_AFTER(c1, c1.push_front(-2));
+                FUN_AFTER(c1, c1.pop_front());
+                FUN_AFTER(c1, c1.pop_back());
+                FUN_VALUE(c1.front());
+                FUN_VALUE(c1.back());
+                FUN_VALUE(c1[2]);
+                FUN_VALUE(c1.at(3));
+                FUN_VALUE(*(c1.begin() + 1));
+                FUN_VALUE(*(c1.end() - 1));
+                FUN_VALUE(*c1.rbegin());
+                FUN_VALUE((c1.end() - c1.begin()));
+                FUN_VALUE(c1.array_one().second);
+                FUN_VALUE(c1.array_two().second);
+                int out[8] = { 0 };
+                FUN_VALUE(c1.pop_front_n(out, 3));
+                cout << " out :";
+                for (int i = 0; i < 3; ++i)
+                    cout << " " << out[i];
+                cout << "\n";
+                COUT(c1);
+                cout << std::boolalpha;
+                FUN_VALUE(c1.empty());
+                FUN_VALUE(c1.full());
+                FUN_VALUE(c2.full());
+                FUN_VALUE((c4 == c2));
+                FUN_VALUE(c5.overwrite());
+                cout << std::noboolalpha;
+                FUN_VALUE(c1.size());
+                FUN_AFTER(c1, c1.swap(c4));
+                FUN_AFTER(c1, leptstl::sort(c1.begin(), c1.end(), leptstl::greater<int>()));
+                FUN_AFTER(c1, c1.clear());
+                /* 被移动后容量为0，插入时重新申请空间*/
+                FUN_VALUE(c3.capacity());
+                FUN_AFTER(c3, c3.push_back(1));
+                FUN_AFTER(c3, c3.push_front(0));
+                FUN_VALUE(c3.capacity());
+                FUN_AFTER(c5, c5.overwrite(false));
+                try
+                {
+                    c5.push_back(9);
+                    c5.push_back(10);
+                    c5.push_back(11);
+                    c5.push_back(12);
+                }
+                catch (std::length_error&)
+                {
+                    cout << " c5.push_back() on full buffer : length_error\n";
+                }
+                COUT(c5);
+                {
+                    /* 满时覆盖：参数引用将被覆盖的元素；pop_front_n 写入已构造的对象*/
+                    leptstl::circular_buffer<std::string> cs(2);
+                    cs.push_back("first element, long enough to live on the heap");
+                    cs.push_back("second element, long enough to live on the heap");
+                    cs.push_back(cs.front());
+                    bool self_ok = cs.size() == 2 && cs.back() == "first element, long enough to live on the heap";
+                    cs.push_front(cs.back());
+                    self_ok &= cs.front() == "first element, long enough to live on the heap"
+                        && cs.back() == "second element, long enough to live on the heap";
+                    std::string outs[2] = { "old value, long enough to live on the heap", "x" };
+                    self_ok &= cs.pop_front_n(outs, 2) == 2 && cs.empty()
+                        && outs[1] == "second element, long enough to live on the heap";
+                    cout << std::boolalpha;
+                    FUN_VALUE(self_ok);
+                    cout << std::noboolalpha;
+                }
+                PASSED;
+                cout << "[------------- End container test : circular_buffer -------------]" << std::endl;
+            }
+
+        }   /* namespace circular_buffer_test */
+
+    }   /* namespace test */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_CIRCULAR_BUFFER_TEST_H__ */
+
@@ -0,0 +1,93 @@
+/*************************************************************************
+	> File Name: concurrent_unordered_set_test.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Mon 19 Oct 2026 03:05:12 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_CONCURRENT_UNORDERED_SET_TEST_H__
+#define LEPTSTL_CONCURRENT_UNORDERED_SET_TEST_H__
+
+#include <thread>
+#include <vector>
+
+#include "../leptSTL/concurrent_unordered_set.h"
+#include "lept_test.h"
+
+namespace leptstl
+{
+    namespace test
+    {
+        namespace concurrent_unordered_set_test
+        {
+            /* 多线程并发插入互不重叠的区间，最后检查元素数量与内容*/
+            bool concurrent_insert_check(size_t threads, int per_thread)
+            {
+                leptstl::concurrent_unordered_set<int> s(16);
+                std::vector<std::thread> pool;
+                for (size_t t = 0; t < threads; ++t)
+                {
+                    pool.emplace_back([&s, t, per_thread]() {
+                        const int base = static_cast<int>(t) * per_thread;
+                        for (int i = 0; i < per_thread; ++i)
+                            s.insert(base + i);
+                        for (int i = 0; i < per_thread; i += 2)
+                            s.erase(base + i);
+                    });
+                }
+                for (auto& th : pool)
+                    th.join();
+                bool ok = s.size() == threads * static_cast<size_t>(per_thread / 2);
+                for (int i = 0; i < static_cast<int>(threads) * per_thread; ++i)
+                    ok = ok && (s.contains(i) == ((i & 1) == 1));
+                return ok;
+            }
+
+            void concurrent_unordered_set_test()
+            {
+                cout << "[===============================================================]" << std::endl;
+                cout << "[-------- Run container test : concurrent_unordered_set ---------]" << std::endl;
+                cout << "[-------------------------- API test ---------------------------]" << std::endl;
+                leptstl::concurrent_unordered_set<int> s1;
+                leptstl::concurrent_unordered_set<int> s2(5, 1000);
+                cout << std::boolalpha;
+                FUN_VALUE(s1.shard_count());
+                FUN_VALUE(s2.shard_count());
+                FUN_VALUE(s1.insert(1));
+                FUN_VALUE(s1.insert(1));
+                FUN_VALUE(s1.emplace(2));
+                FUN_VALUE(s1.insert(3));
+                FUN_VALUE(s1.contains(2));
+                FUN_VALUE(s1.count(4));
+                FUN_VALUE(s1.erase(2));
+                FUN_VALUE(s1.erase(2));
+                FUN_VALUE(s1.size());
+                FUN_VALUE(s1.empty());
+                int sum = 0;
+                s1.for_each([&sum](int v) { sum += v; });
+                FUN_VALUE(sum);
+                size_t used = 0;
+                for (int i = 0; i < 1000; ++i)
+                    s2.insert(i);
+                s2.for_each_shard([&used](size_t, const leptstl::concurrent_unordered_set<int>::shard_type& ht) {
+                    used += ht.empty() ? 0 : 1;
+                });
+                FUN_VALUE(used);
+                FUN_VALUE(s2.size());
+                s2.clear();
+                FUN_VALUE(s2.empty());
+                cout << "[------------------------- stress test -------------------------]" << std::endl;
+                FUN_VALUE(concurrent_insert_check(4, LEN1 _S));
+                cout << std::noboolalpha;
+                PASSED;
+                cout << "[-------- End container test : concurrent_unordered_set ---------]" << std::endl;
+            }
+
+        }   /* namespace concurrent_unordered_set_test */
+
+    }   /* namespace test */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_CONCURRENT_UNORDERED_SET_TEST_H__ */
+
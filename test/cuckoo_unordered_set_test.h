@@ -0,0 +1,203 @@
+/*************************************************************************
+	> File Name: cuckoo_unordered_set_test.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 09:47:20 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_CUCKOO_UNORDERED_SET_TEST_H__
+#define LEPTSTL_CUCKOO_UNORDERED_SET_TEST_H__
+
+/* cuckoo_unordered_set 的测试*/
+
+#include <string>
+#include <unordered_set>
+
+#include "../leptSTL/cuckoo_unordered_set.h"
+#include "../leptSTL/leptstring.h"
+#include "lept_test.h"
+
+namespace leptstl
+{
+    namespace test
+    {
+        namespace cuckoo_unordered_set_test
+        {
+            /* 只有 16 个不同哈希值的哈希函数，同一哈希值的键远多于 8 个，只能进溢出区*/
+            struct few_values_hash
+            {
+                size_t operator()(int x) const noexcept { return static_cast<size_t>(x & 15); }
+            };
+
+            /* 记录存活对象数，检查重建与踢出过程中没有泄漏或重复析构*/
+            struct tracked
+            {
+                static int alive;
+                int v;
+                tracked(int x) :v(x) { ++alive; }
+                tracked(const tracked& rhs) :v(rhs.v) { ++alive; }
+                tracked(tracked&& rhs) noexcept :v(rhs.v) { ++alive; }
+                tracked& operator=(const tracked& rhs) { v = rhs.v; return *this; }
+                ~tracked() { --alive; }
+                bool operator==(const tracked& rhs) const { return v == rhs.v; }
+            };
+            int tracked::alive = 0;
+
+            struct tracked_hash
+            {
+                size_t operator()(const tracked& t) const noexcept { return static_cast<size_t>(t.v); }
+            };
+
+            /* 随机插入与删除，与 std::unordered_set 比较*/
+            template <typename Set>
+                bool same_as_std(int rounds, int range)
+                {
+                    Set s;
+                    std::unordered_set<int> ref;
+                    uint32_t x = 2463534242u;
+                    for (int i = 0; i < rounds; ++i)
+                    {
+                        x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+                        const int k = static_cast<int>(x % static_cast<uint32_t>(range));
+                        if ((x >> 28) < 11)
+                        {
+                            if (s.insert(k).second != ref.insert(k).second)
+                                return false;
+                        }
+                        else if (s.erase(k) != ref.erase(k))
+                        {
+                            return false;
+                        }
+                    }
+                    if (s.size() != ref.size())
+                        return false;
+                    size_t visited = 0;
+                    for (auto it = s.begin(); it != s.end(); ++it, ++visited)
+                        if (ref.count(*it) != 1)
+                            return false;
+                    for (int k = 0; k < range; ++k)
+                        if (s.count(k) != ref.count(k))
+                            return false;
+                    return visited == ref.size();
+                }
+
+            void cuckoo_unordered_set_test()
+            {
+                cout << "[===============================================================]" << std::endl;
+                cout << "[---------- Run container test : cuckoo_unordered_set ----------]" << std::endl;
+                cout << "[-------------------------- API test ---------------------------]" << std::endl;
+                int a[] = { 5,4,3,2,1 };
+                leptstl::cuckoo_unordered_set<int> us1;
+                leptstl::cuckoo_unordered_set<int> us2(520);
+                leptstl::cuckoo_unordered_set<int> us3(520, leptstl::hash<int>());
+                leptstl::cuckoo_unordered_set<int> us4(520, leptstl::hash<int>(), leptstl::equal_to<int>());
+                leptstl::cuckoo_unordered_set<int> us5(a, a + 5);
+                leptstl::cuckoo_unordered_set<int> us6(a, a + 5, 100);
+                leptstl::cuckoo_unordered_set<int> us7(a, a + 5, 100, leptstl::hash<int>());
+                leptstl::cuckoo_unordered_set<int> us9(us5);
+                leptstl::cuckoo_unordered_set<int> us10(std::move(us5));
+                leptstl::cuckoo_unordered_set<int> us11;
+                us11 = us6;
+                leptstl::cuckoo_unordered_set<int> us12;
+                us12 = std::move(us6);
+                leptstl::cuckoo_unordered_set<int> us13{ 1,2,3,4,5 };
+                leptstl::cuckoo_unordered_set<int> us14;
+                us14 = { 1,2,3,4,5 };
+                cout << std::boolalpha;
+                FUN_VALUE((us9 == us10 && us11 == us12 && us13 == us14 && us9 == us13));
+                FUN_VALUE((us1 != us13));
+                cout << std::noboolalpha;
+
+                FUN_AFTER(us1, us1.emplace(1));
+                FUN_AFTER(us1, us1.emplace_hint(us1.end(), 2));
+                FUN_AFTER(us1, us1.insert(5));
+                FUN_AFTER(us1, us1.insert(us1.begin(), 5));
+                FUN_AFTER(us1, us1.insert(a, a + 5));
+                FUN_AFTER(us1, us1.erase(us1.find(4)));
+                FUN_AFTER(us1, us1.erase(1));
+                FUN_VALUE(us1.size());
+                FUN_VALUE(us1.bucket_count());
+                FUN_VALUE(us1.bucket_size(us1.bucket(5)));
+                FUN_VALUE(us1.count(1));
+                FUN_VALUE(*us1.find(3));
+                FUN_VALUE((us1.equal_range(3).second == ++us1.find(3)));
+                FUN_AFTER(us1, us1.clear());
+                FUN_AFTER(us1, us1.swap(us7));
+                FUN_VALUE(us1.size());
+                FUN_AFTER(us1, us1.reserve(1000));
+                FUN_VALUE(us1.bucket_count());
+                FUN_AFTER(us1, us1.rehash(4));
+                FUN_VALUE(us1.bucket_count());
+                FUN_VALUE(us1.load_factor());
+                FUN_VALUE(us1.max_load_factor());
+                FUN_AFTER(us1, us1.max_load_factor(0.5f));
+                FUN_VALUE(us1.max_load_factor());
+                FUN_AFTER(us1, us1.erase(us1.begin(), us1.end()));
+                FUN_VALUE(us1.size());
+
+                cout << std::boolalpha;
+                /* 大量随机插入删除，与 std::unordered_set 一致*/
+                FUN_VALUE((same_as_std<leptstl::cuckoo_unordered_set<int>>(400000, 100000)));
+                /* 哈希值只有 16 种：元素大多在溢出区，结果仍然正确*/
+                FUN_VALUE((same_as_std<leptstl::cuckoo_unordered_set<int, few_values_hash>>(20000, 1000)));
+
+                /* 装满到上限前不应依赖溢出区*/
+                leptstl::cuckoo_unordered_set<int> big;
+                for (int i = 0; i < 1000000; ++i)
+                    big.insert(static_cast<int>(static_cast<unsigned>(i) * 7919u));
+                FUN_VALUE(big.size());
+                FUN_VALUE(big.bucket_count());
+                FUN_VALUE((big.load_factor() > 0.45f));
+                FUN_VALUE((big.stash_size() <= 4));
+
+                /* 字符串*/
+                leptstl::cuckoo_unordered_set<leptstl::string> words;
+                bool strings_ok = true;
+                for (int i = 0; i < 5000; ++i)
+                    strings_ok &= words.insert(leptstl::string(("key_" + std::to_string(i)).c_str())).second;
+                for (int i = 0; i < 5000; ++i)
+                    strings_ok &= words.count(leptstl::string(("key_" + std::to_string(i)).c_str())) == 1;
+                strings_ok &= words.count(leptstl::string("key_5000")) == 0;
+                FUN_VALUE(strings_ok);
+
+                /* 踢出、重建、复制与删除后对象数平衡*/
+                {
+                    leptstl::cuckoo_unordered_set<tracked, tracked_hash> ts;
+                    for (int i = 0; i < 20000; ++i)
+                        ts.emplace(i);
+                    leptstl::cuckoo_unordered_set<tracked, tracked_hash> copy(ts);
+                    for (int i = 0; i < 20000; i += 3)
+                        copy.erase(tracked(i));
+                    FUN_VALUE(copy.size());
+                    FUN_VALUE((tracked::alive == static_cast<int>(ts.size() + copy.size())));
+                }
+                FUN_VALUE((tracked::alive == 0));
+
+                /* 被移走的表仍可查找、遍历、复制与插入*/
+                {
+                    leptstl::cuckoo_unordered_set<int> a;
+                    a.insert(1);
+                    leptstl::cuckoo_unordered_set<int> b = leptstl::move(a);
+                    bool moved_ok = a.empty() && a.begin() == a.end() && a.find(1) == a.end();
+                    leptstl::cuckoo_unordered_set<int> c(a);
+                    moved_ok &= c.empty() && c.bucket_size(0) == 0;
+                    a.insert(2);
+                    moved_ok &= a.size() == 1 && a.count(2) == 1 && b.count(1) == 1 && b.count(2) == 0;
+                    c = leptstl::move(b);
+                    for (int i = 0; i < 1000; ++i)
+                        b.insert(i);
+                    moved_ok &= b.size() == 1000 && b.count(999) == 1 && c.size() == 1;
+                    FUN_VALUE(moved_ok);
+                }
+                cout << std::noboolalpha;
+                PASSED;
+                cout << "[---------- End container test : cuckoo_unordered_set ----------]" << std::endl;
+            }
+
+        }   /* namespace cuckoo_unordered_set_test */
+
+    }   /* namespace test */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_CUCKOO_UNORDERED_SET_TEST_H__ */
@@ -0,0 +1,192 @@
+/*************************************************************************
+	> File Name: dynamic_bitset_test.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Mon 19 Oct 2026 11:58:40 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_DYNAMIC_BITSET_TEST_H__
+#define LEPTSTL_DYNAMIC_BITSET_TEST_H__
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "../leptSTL/dynamic_bitset.h"
+#include "../leptSTL/vector.h"
+#include "lept_test.h"
+
+namespace leptstl
+{
+    namespace test
+    {
+        namespace dynamic_bitset_test
+        {
+            /* 对 std::vector<bool> 做随机操作，检查 vector<bool> 与 dynamic_bitset 的结果一致*/
+            inline bool bitset_check(size_t ops)
+            {
+                leptstl::vector<bool> v;
+                leptstl::dynamic_bitset b;
+                std::vector<bool> r;
+                srand(11);
+                bool ok = true;
+                for (size_t i = 0; i < ops && ok; ++i)
+                {
+                    const int dice = rand() % 8;
+                    const bool value = rand() & 1;
+                    if (dice < 3 || r.empty())
+                    {
+                        v.push_back(value);
+                        b.push_back(value);
+                        r.push_back(value);
+                    }
+                    else if (dice < 4)
+                    {
+                        const size_t p = rand() % (r.size() + 1);
+                        const size_t n = rand() % 130;
+                        v.insert(v.begin() + p, n, value);
+                        r.insert(r.begin() + p, n, value);
+                        /* dynamic_bitset 没有中间插入，按参照重建*/
+                        b = leptstl::dynamic_bitset(r.size());
+                        for (size_t j = 0; j < r.size(); ++j)
+                            b.set(j, r[j]);
+                    }
+                    else if (dice < 5)
+                    {
+                        const size_t p = rand() % r.size();
+                        const size_t q = leptstl::min(r.size(), p + rand() % 100);
+                        v.erase(v.begin() + p, v.begin() + q);
+                        r.erase(r.begin() + p, r.begin() + q);
+                        b = leptstl::dynamic_bitset(r.size());
+                        for (size_t j = 0; j < r.size(); ++j)
+                            b.set(j, r[j]);
+                    }
+                    else if (dice < 6)
+                    {
+                        const size_t n = r.size() + rand() % 300 - 150;
+                        if (n <= r.size() + 150)
+                        {
+                            v.resize(n, value);
+                            b.resize(n, value);
+                            r.resize(n, value);
+                        }
+                    }
+                    else if (dice < 7)
+                    {
+                        const size_t p = rand() % r.size();
+                        v[p].flip();
+                        b.flip(p);
+                        r[p].flip();
+                        v.flip();
+                        b.flip();
+                        r.flip();
+                    }
+                    else
+                    {
+                        const uint64_t w = (static_cast<uint64_t>(rand()) << 32) ^ rand();
+                        b.append(w);
+                        for (size_t j = 0; j < 64; ++j)
+                        {
+                            v.push_back((w >> j) & 1);
+                            r.push_back((w >> j) & 1);
+                        }
+                    }
+                    ok = v.size() == r.size() && b.size() == r.size();
+                    /* 逐位对照代价与长度成正比，每 16 次操作以及最后一次才做*/
+                    if (!ok || (i % 16 != 0 && i + 1 != ops))
+                        continue;
+                    ok = b.count() == static_cast<size_t>(std::count(r.begin(), r.end(), true));
+                    size_t next = b.find_first();
+                    for (size_t j = 0; ok && j < r.size(); ++j)
+                    {
+                        ok = v[j] == r[j] && b[j] == r[j];
+                        if (ok && r[j])
+                        {
+                            ok = next == j;
+                            next = b.find_next(next);
+                        }
+                    }
+                    ok = ok && next == leptstl::dynamic_bitset::npos;
+                }
+                return ok;
+            }
+
+            void dynamic_bitset_test()
+            {
+                cout << "[===============================================================]" << std::endl;
+                cout << "[------------- Run container test : dynamic_bitset -------------]" << std::endl;
+                cout << "[-------------------------- API test ---------------------------]" << std::endl;
+                leptstl::dynamic_bitset b1(10);
+                leptstl::dynamic_bitset b2(10, true);
+                leptstl::dynamic_bitset b3(b2);
+                leptstl::dynamic_bitset b4(std::move(b3));
+                FUN_VALUE(b1.to_string());
+                FUN_VALUE(b2.to_string());
+                FUN_VALUE(b4.to_string());
+                FUN_VALUE(b1.set(1).set(4).set(8).to_string());
+                FUN_VALUE(b1.count());
+                FUN_VALUE(b1.find_first());
+                FUN_VALUE(b1.find_next(1));
+                FUN_VALUE(b1.find_next(4));
+                FUN_VALUE((b1.find_next(8) == leptstl::dynamic_bitset::npos));
+                FUN_VALUE(b2.reset(0).flip(9).to_string());
+                FUN_VALUE((b1 & b2).to_string());
+                FUN_VALUE((b1 | b2).to_string());
+                FUN_VALUE((b1 ^ b2).to_string());
+                FUN_VALUE((b2 - b1).to_string());
+                FUN_VALUE((~b1).to_string());
+                b1.resize(70, true);
+                b1.append(0x5);
+                FUN_VALUE(b1.size());
+                FUN_VALUE(b1.count());
+                FUN_VALUE(b1.find_next(69));
+                cout << std::boolalpha;
+                FUN_VALUE(b1.test(8));
+                FUN_VALUE(b1.any());
+                FUN_VALUE(b1.all());
+                FUN_VALUE((b1 == b4));
+                {
+                    /* 容量足够时复制赋值不改变 words_ 的容量*/
+                    leptstl::dynamic_bitset big(1 << 24);
+                    big.resize(64);
+                    leptstl::dynamic_bitset other(6400, true);
+                    big = other;
+                    FUN_VALUE((big == other && big.count() == 6400));
+                }
+                cout << std::noboolalpha;
+                cout << "[------------------------ vector<bool> -------------------------]" << std::endl;
+                leptstl::vector<bool> v1;
+                leptstl::vector<bool> v2(5, true);
+                leptstl::vector<bool> v3{ true, false, true };
+                leptstl::vector<bool> v4(v3.begin(), v3.end());
+                FUN_AFTER(v1, v1.push_back(true));
+                FUN_AFTER(v1, v1.insert(v1.begin(), 3, false));
+                FUN_AFTER(v1, v1.insert(v1.begin() + 1, v3.begin(), v3.end()));
+                FUN_AFTER(v1, v1.erase(v1.begin()));
+                FUN_AFTER(v1, v1[0].flip());
+                FUN_AFTER(v1, v1.flip());
+                FUN_AFTER(v1, v1.resize(8, true));
+                FUN_AFTER(v1, v1.pop_back());
+                FUN_AFTER(v2, v2.swap(v1));
+                FUN_VALUE(v1.size());
+                FUN_VALUE(v1.capacity());
+                FUN_VALUE(sizeof(v1));
+                cout << std::boolalpha;
+                FUN_VALUE(v2.front());
+                FUN_VALUE(v2.back());
+                FUN_VALUE((v3 == v4));
+                FUN_VALUE((v1 < v2));
+                cout << "[------------------------- stress test -------------------------]" << std::endl;
+                FUN_VALUE(bitset_check(LEN1 _SS));
+                cout << std::noboolalpha;
+                PASSED;
+                cout << "[------------- End container test : dynamic_bitset -------------]" << std::endl;
+            }
+
+        }   /* namespace dynamic_bitset_test */
+
+    }   /* namespace test */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_DYNAMIC_BITSET_TEST_H__ */
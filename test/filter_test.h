@@ -0,0 +1,194 @@
+/*************************************************************************
+	> File Name: filter_test.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 07:25:48 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_FILTER_TEST_H__
+#define LEPTSTL_FILTER_TEST_H__
+
+/* bloom_filter、cuckoo_filter 与 filtered_unordered_set 的测试*/
+
+#include "../leptSTL/bloom_filter.h"
+#include "../leptSTL/cuckoo_filter.h"
+#include "../leptSTL/filtered_unordered_set.h"
+#include "lept_test.h"
+
+namespace leptstl
+{
+    namespace test
+    {
+        namespace filter_test
+        {
+            /* [0, n) 插入过滤器后，不应有漏报；[n, n + probes) 中被判为可能存在的比例即误报率*/
+            template <typename Filter>
+                bool no_false_negative(const Filter& f, int n)
+                {
+                    for (int i = 0; i < n; ++i)
+                        if (!f.may_contain(i))
+                            return false;
+                    return true;
+                }
+
+            template <typename Filter>
+                double false_positive_rate(const Filter& f, int n, int probes)
+                {
+                    int positive = 0;
+                    for (int i = n; i < n + probes; ++i)
+                        positive += f.may_contain(i);
+                    return static_cast<double>(positive) / probes;
+                }
+
+            void filter_test()
+            {
+                cout << "[===============================================================]" << std::endl;
+                cout << "[---------------- Run container test : filters -----------------]" << std::endl;
+                cout << "[-------------------------- API test ---------------------------]" << std::endl;
+                const int n = 100000;
+                const int probes = 1000000;
+                cout << std::boolalpha;
+
+                /* 每个键 10 位约 1% 的误报，16 位约 0.1%*/
+                leptstl::bloom_filter<int> bloom(n);
+                for (int i = 0; i < n; ++i)
+                    bloom.insert(i);
+                FUN_VALUE(bloom.size());
+                FUN_VALUE(bloom.block_count());
+                FUN_VALUE(no_false_negative(bloom, n));
+                const double bloom_fpr = false_positive_rate(bloom, n, probes);
+                FUN_VALUE(bloom_fpr);
+                FUN_VALUE((bloom_fpr < 0.02));
+                leptstl::bloom_filter<int> bloom16(n, 16);
+                for (int i = 0; i < n; ++i)
+                    bloom16.insert(i);
+                FUN_VALUE((false_positive_rate(bloom16, n, probes) < 0.003));
+
+                /* 复制后块的对齐位置可能不同，内容不变*/
+                leptstl::bloom_filter<int> bloom_copy(bloom);
+                FUN_VALUE(no_false_negative(bloom_copy, n));
+                FUN_VALUE((false_positive_rate(bloom_copy, n, probes) == bloom_fpr));
+                bloom_copy.clear();
+                FUN_VALUE(bloom_copy.may_contain(1));
+
+                /* 16 位指纹，误报率约 8 / 65536*/
+                leptstl::cuckoo_filter<int> cuckoo(n);
+                bool all_inserted = true;
+                for (int i = 0; i < n; ++i)
+                    all_inserted &= cuckoo.insert(i);
+                FUN_VALUE(all_inserted);
+                FUN_VALUE(cuckoo.size());
+                FUN_VALUE(cuckoo.bucket_count());
+                FUN_VALUE(no_false_negative(cuckoo, n));
+                FUN_VALUE((false_positive_rate(cuckoo, n, probes) < 0.0005));
+
+                /* 删除偶数，奇数仍然都在，偶数大多不在*/
+                bool erased = true;
+                for (int i = 0; i < n; i += 2)
+                    erased &= cuckoo.erase(i);
+                FUN_VALUE(erased);
+                FUN_VALUE(cuckoo.size());
+                bool odd_kept = true;
+                int even_left = 0;
+                for (int i = 0; i < n; ++i)
+                {
+                    if (i & 1)
+                        odd_kept &= cuckoo.may_contain(i);
+                    else
+                        even_left += cuckoo.may_contain(i);
+                }
+                FUN_VALUE(odd_kept);
+                FUN_VALUE((even_left < n / 1000));
+
+                /* 装满：插入失败前的装载率应超过 90%，已插入的键不会丢失*/
+                leptstl::cuckoo_filter<int> small(4000);
+                int inserted = 0;
+                while (small.insert(inserted))
+                    ++inserted;
+                FUN_VALUE(small.capacity());
+                FUN_VALUE((small.load_factor() > 0.9));
+                FUN_VALUE(no_false_negative(small, static_cast<int>(small.size())));
+
+                /* filtered_unordered_set：过滤器随元素增长重建，删除后查找不到*/
+                leptstl::filtered_unordered_set<int> fb(16);
+                leptstl::filtered_unordered_set<int, leptstl::hash<int>, leptstl::equal_to<int>,
+                    leptstl::cuckoo_filter<int>> fc(16);
+                for (int i = 0; i < 10000; ++i)
+                {
+                    fb.insert(i);
+                    fc.insert(i);
+                }
+                FUN_VALUE(fb.insert(5).second);
+                FUN_VALUE(fb.size());
+                FUN_VALUE(fc.size());
+                bool found = true;
+                for (int i = 0; i < 10000; ++i)
+                    found &= fb.count(i) == 1 && fc.find(i) != fc.end();
+                FUN_VALUE(found);
+                FUN_VALUE(fb.count(10000));
+                FUN_VALUE(fc.contains(-1));
+                for (int i = 0; i < 10000; i += 2)
+                {
+                    fb.erase(i);
+                    fc.erase(i);
+                }
+                FUN_VALUE(fb.size());
+                FUN_VALUE(fc.filter().size());
+                bool consistent = true;
+                for (int i = 0; i < 10000; ++i)
+                    consistent &= fb.contains(i) == (i % 2 == 1) && fc.count(i) == static_cast<size_t>(i % 2);
+                FUN_VALUE(consistent);
+                /* 删除多于一半后 bloom_filter 已按剩余的键重建*/
+                FUN_VALUE((fb.filter().size() < 10000));
+                fb.clear();
+                FUN_VALUE(fb.contains(1));
+
+                /* 被移走的过滤器与集合仍可插入、查询与删除*/
+                {
+                    leptstl::bloom_filter<int> b1(n);
+                    b1.insert(1);
+                    leptstl::bloom_filter<int> b2(leptstl::move(b1));
+                    bool moved_ok = !b1.may_contain(1) && b1.block_count() == 1 && b2.may_contain(1);
+                    for (int i = 0; i < 100; ++i)
+                        b1.insert(i);
+                    moved_ok &= no_false_negative(b1, 100);
+                    b2 = leptstl::move(b1);
+                    b1.insert(7);
+                    moved_ok &= b1.may_contain(7) && no_false_negative(b2, 100);
+
+                    leptstl::cuckoo_filter<int> c1(n);
+                    c1.insert(1);
+                    leptstl::cuckoo_filter<int> c2(leptstl::move(c1));
+                    moved_ok &= !c1.may_contain(1) && c1.bucket_count() == 1 && c2.may_contain(1);
+                    moved_ok &= c1.insert(2) && c1.may_contain(2) && c1.erase(2) && c1.size() == 0;
+                    c2 = leptstl::move(c1);
+                    moved_ok &= c1.insert(3) && c1.may_contain(3) && c2.size() == 0;
+
+                    leptstl::filtered_unordered_set<int> fm1(fb);
+                    fm1.insert(1);
+                    leptstl::filtered_unordered_set<int> fm2(leptstl::move(fm1));
+                    leptstl::filtered_unordered_set<int, leptstl::hash<int>, leptstl::equal_to<int>,
+                        leptstl::cuckoo_filter<int>> fc2(leptstl::move(fc));
+                    for (int i = 0; i < 1000; ++i)
+                    {
+                        fm1.insert(i);
+                        fc.insert(i);
+                    }
+                    moved_ok &= fm2.contains(1) && fm2.size() == 1 && fc2.size() == 5000;
+                    for (int i = 0; i < 1000; ++i)
+                        moved_ok &= fm1.contains(i) && fc.contains(i);
+                    moved_ok &= fm1.filter().block_count() > 1 && fc.filter().bucket_count() > 1;
+                    FUN_VALUE(moved_ok);
+                }
+                cout << std::noboolalpha;
+                PASSED;
+                cout << "[---------------- End container test : filters -----------------]" << std::endl;
+            }
+
+        }   /* namespace filter_test */
+
+    }   /* namespace test */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_FILTER_TEST_H__ */
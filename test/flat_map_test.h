@@ -0,0 +1,198 @@
+/*************************************************************************
+	> File Name: flat_map_test.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 05:41:16 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_FLAT_MAP_TEST_H__
+#define LEPTSTL_FLAT_MAP_TEST_H__
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../leptSTL/flat_map.h"
+#include "../leptSTL/flat_set.h"
+#include "lept_test.h"
+
+namespace leptstl
+{
+    namespace test
+    {
+        namespace flat_map_test
+        {
+            /* 单个插入、批量插入（含重复键值，实值各不相同，应保留先出现的一个）与删除，与 std::set / std::map 对照*/
+            bool flat_check(size_t ops)
+            {
+                leptstl::flat_set<int> fs;
+                leptstl::flat_map<int, int> fm;
+                std::set<int> ss;
+                std::map<int, int> sm;
+                bool ok = true;
+                srand(40);
+                for (size_t i = 0; i < ops && ok; ++i)
+                {
+                    const int key = rand() % 3000;
+                    const int dice = rand() % 10;
+                    if (dice < 4)
+                    {
+                        ok = ok && fs.insert(key).second == ss.insert(key).second;
+                        ok = ok && fm.emplace(key, static_cast<int>(i)).second
+                                   == sm.emplace(key, static_cast<int>(i)).second;
+                    }
+                    else if (dice < 7)
+                    {
+                        ok = ok && fs.erase(key) == ss.erase(key);
+                        ok = ok && fm.erase(key) == sm.erase(key);
+                    }
+                    else if (dice < 8)
+                    {
+                        std::vector<int> batch;
+                        std::vector<leptstl::pair<int, int>> pairs;
+                        const int n = rand() % 64;
+                        for (int k = 0; k < n; ++k)
+                        {
+                            batch.push_back(rand() % 3000);
+                            pairs.push_back(leptstl::make_pair(batch.back(), static_cast<int>(i) * 64 + k));
+                        }
+                        fs.insert(batch.begin(), batch.end());
+                        ss.insert(batch.begin(), batch.end());
+                        fm.insert(pairs.begin(), pairs.end());
+                        for (size_t k = 0; k < pairs.size(); ++k)
+                            sm.emplace(pairs[k].first, pairs[k].second);
+                    }
+                    else
+                    {
+                        ok = ok && fs.count(key) == ss.count(key) && fm.count(key) == sm.count(key);
+                        ok = ok && (fm.lower_bound(key) - fm.begin())
+                                   == std::distance(sm.begin(), sm.lower_bound(key));
+                    }
+                    if ((i & 255) == 0)
+                    {
+                        ok = ok && fs.size() == ss.size() && fm.size() == sm.size()
+                            && std::equal(fs.begin(), fs.end(), ss.begin());
+                        auto it = sm.begin();
+                        for (auto kv : fm)
+                        {
+                            ok = ok && kv.first == it->first && kv.second == it->second;
+                            ++it;
+                        }
+                    }
+                }
+                return ok;
+            }
+
+            /* 批量插入的新元素较多、重复键值很多时，leptstl::sort 不再只用插入排序，仍应保留每个键先出现的实值*/
+            bool range_insert_first_wins(int n, int keys)
+            {
+                std::vector<leptstl::pair<int, int>> pairs;
+                srand(41);
+                for (int i = 0; i < n; ++i)
+                    pairs.push_back(leptstl::make_pair(rand() % keys, i));
+                leptstl::flat_map<int, int> fm{ {keys, -1} };
+                fm.insert(pairs.begin(), pairs.end());
+                std::map<int, int> sm{ {keys, -1} };
+                for (size_t k = 0; k < pairs.size(); ++k)
+                    sm.emplace(pairs[k].first, pairs[k].second);
+                bool ok = fm.size() == sm.size();
+                auto it = sm.begin();
+                for (auto kv : fm)
+                {
+                    ok = ok && kv.first == it->first && kv.second == it->second;
+                    ++it;
+                }
+                return ok;
+            }
+
+            void flat_map_test()
+            {
+                cout << "[===============================================================]" << std::endl;
+                cout << "[------------- Run container test : flat_set/flat_map -----------]" << std::endl;
+                cout << "[-------------------------- API test ---------------------------]" << std::endl;
+                int a[] = { 5, 1, 4, 1, 3 };
+                leptstl::flat_set<int> s1;
+                leptstl::flat_set<int> s2(a, a + 5);
+                leptstl::flat_set<int> s3{ 9, 7, 8 };
+                leptstl::flat_set<int> s4(s2);
+                leptstl::flat_set<int> s5(std::move(s4));
+                leptstl::flat_set<int, leptstl::greater<int>> s6(a, a + 5);
+                s1 = s3;
+                COUT(s2);
+                COUT(s5);
+                COUT(s6);
+                cout << std::boolalpha;
+                FUN_VALUE(s2.insert(2).second);
+                FUN_VALUE(s2.insert(2).second);
+                FUN_VALUE(s2.contains(4));
+                FUN_VALUE((s1 == s3));
+                FUN_VALUE((s2 < s3));
+                cout << std::noboolalpha;
+                FUN_VALUE(*s2.lower_bound(0));
+                FUN_VALUE(*s2.upper_bound(3));
+                FUN_AFTER(s2, s2.insert(a, a + 5));
+                FUN_AFTER(s2, s2.insert(s3.begin(), s3.end()));
+                FUN_AFTER(s2, s2.emplace(6));
+                FUN_AFTER(s2, s2.erase(4));
+                FUN_AFTER(s2, s2.erase(s2.begin()));
+                FUN_AFTER(s2, s2.erase(s2.find(7), s2.end()));
+                FUN_AFTER(s1, s1.swap(s2));
+                FUN_AFTER(s1, s1.clear());
+
+                leptstl::flat_map<std::string, int> m1{ {"two", 2}, {"one", 1} };
+                m1["three"] = 3;
+                m1.emplace("four", 4);
+                m1.insert(leptstl::make_pair(std::string("five"), 5));
+                m1.try_emplace("one", 100);
+                cout << " m1 :";
+                for (auto kv : m1)
+                    cout << " <" << kv.first << "," << kv.second << ">";
+                cout << "\n";
+                FUN_VALUE(m1.at("one"));
+                FUN_VALUE(m1["six"]);
+                FUN_VALUE(m1.size());
+                FUN_VALUE(m1.lower_bound("p")->first);
+                FUN_VALUE(m1.find("two")->second);
+                FUN_VALUE(m1.erase("six"));
+                FUN_VALUE(m1.keys().size());
+                try
+                {
+                    m1.at("seven");
+                }
+                catch (std::out_of_range&)
+                {
+                    cout << " m1.at(\"seven\") : out_of_range\n";
+                }
+                std::vector<leptstl::pair<std::string, int>> more{ {"zero", 0}, {"two", 22}, {"ten", 10},
+                                                                   {"zero", 100}, {"ten", 100} };
+                m1.insert(more.begin(), more.end());
+                for (auto it = m1.begin(); it != m1.end(); ++it)
+                    it->second *= 10;
+                cout << " m1 :";
+                for (auto it = m1.rbegin(); it != m1.rend(); ++it)
+                    cout << " <" << (*it).first << "," << (*it).second << ">";
+                cout << "\n";
+                leptstl::flat_map<std::string, int> m2(m1);
+                cout << std::boolalpha;
+                FUN_VALUE((m1 == m2));
+                FUN_VALUE((m2.erase(m2.begin() + 1, m2.end() - 1) - m2.begin()));
+                FUN_VALUE((m2 < m1));
+                cout << std::noboolalpha;
+                FUN_VALUE(m2.size());
+                cout << "[------------------------- stress test -------------------------]" << std::endl;
+                cout << std::boolalpha;
+                FUN_VALUE(flat_check(LEN1));
+                FUN_VALUE(range_insert_first_wins(LEN1, 50));
+                cout << std::noboolalpha;
+                PASSED;
+                cout << "[------------- End container test : flat_set/flat_map -----------]" << std::endl;
+            }
+
+        }   /* namespace flat_map_test */
+
+    }   /* namespace test */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_FLAT_MAP_TEST_H__ */
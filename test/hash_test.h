@@ -0,0 +1,204 @@
+/*************************************************************************
+	> File Name: hash_test.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 03:40:19 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_HASH_TEST_H__
+#define LEPTSTL_HASH_TEST_H__
+
+/* hash_bytes、hash_mix 与 mixed_hash 的测试，并比较 hash_bytes 与逐字节 FNV-1a（bitwise_hash）的分布质量：
+ *   collisions  不同输入得到相同 64 位哈希的个数
+ *   max bucket  按低位放进 2^12 个桶（2 的幂取桶）后最满的桶，均匀时约为 n/4096 的 2 倍以内
+ *   high bucket 按高位放进 2^12 个桶后最满的桶，bloom 过滤器等按高位取下标的结构依赖这一项
+ *   avalanche   翻转输入的一位时输出各位翻转的概率，理想值 0.5，列出偏离 0.5 最远的输出位*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "../leptSTL/functional.h"
+#include "../leptSTL/leptstring.h"
+#include "../leptSTL/unordered_set.h"
+#include "lept_test.h"
+
+namespace leptstl
+{
+    namespace test
+    {
+        namespace hash_test
+        {
+            inline uint64_t fnv1a(const std::string& s)
+            {
+                return bitwise_hash(reinterpret_cast<const unsigned char*>(s.data()), s.size());
+            }
+
+            inline uint64_t wy(const std::string& s)
+            {
+                return hash_bytes(s.data(), s.size());
+            }
+
+            /* 低位或高位取 12 位作为桶号，返回最满的桶中的元素个数*/
+            inline size_t max_bucket(const std::vector<uint64_t>& hashes, bool high)
+            {
+                std::vector<size_t> buckets(4096);
+                size_t most = 0;
+                for (size_t i = 0; i < hashes.size(); ++i)
+                {
+                    const size_t b = high ? static_cast<size_t>(hashes[i] >> 52) : static_cast<size_t>(hashes[i] & 4095);
+                    most = std::max(most, ++buckets[b]);
+                }
+                return most;
+            }
+
+            /* 每个输入的每一位翻转一次，统计输出每一位翻转的比例，返回偏离 0.5 最大的那一位的比例*/
+            template <typename Hash>
+                double worst_avalanche(const std::vector<std::string>& keys, Hash hash)
+                {
+                    std::vector<size_t> flips(64);
+                    size_t trials = 0;
+                    for (size_t i = 0; i < keys.size(); ++i)
+                    {
+                        const uint64_t h = hash(keys[i]);
+                        std::string k = keys[i];
+                        for (size_t bit = 0; bit < k.size() * 8; ++bit)
+                        {
+                            k[bit / 8] ^= static_cast<char>(1 << (bit % 8));
+                            const uint64_t d = h ^ hash(k);
+                            k[bit / 8] ^= static_cast<char>(1 << (bit % 8));
+                            for (int o = 0; o < 64; ++o)
+                                flips[o] += (d >> o) & 1;
+                            ++trials;
+                        }
+                    }
+                    double worst = 0.5;
+                    for (int o = 0; o < 64; ++o)
+                    {
+                        const double p = static_cast<double>(flips[o]) / trials;
+                        if (std::fabs(p - 0.5) > std::fabs(worst - 0.5))
+                            worst = p;
+                    }
+                    return worst;
+                }
+
+            /* 输出一行质量统计；hash_bytes 的结果不合格时计数*/
+            template <typename Hash>
+                void quality(const char* name, const char* pattern, const std::vector<std::string>& keys,
+                             Hash hash, bool checked, size_t& flagged)
+                {
+                    std::vector<uint64_t> hashes;
+                    for (size_t i = 0; i < keys.size(); ++i)
+                        hashes.push_back(hash(keys[i]));
+                    std::vector<uint64_t> sorted(hashes);
+                    std::sort(sorted.begin(), sorted.end());
+                    const size_t collisions = sorted.size() - (std::unique(sorted.begin(), sorted.end()) - sorted.begin());
+                    const size_t low = max_bucket(hashes, false);
+                    const size_t high = max_bucket(hashes, true);
+                    std::vector<std::string> sample(keys.begin(), keys.begin() + std::min<size_t>(keys.size(), 256));
+                    const double avalanche = worst_avalanche(sample, hash);
+                    /* 均匀时 n/4096 个元素每桶，最满的桶不应超过其 2 倍再加上泊松分布的尾部余量*/
+                    const size_t limit = 2 * keys.size() / 4096 + 12;
+                    const bool bad = collisions > 0 || low > limit || high > limit || std::fabs(avalanche - 0.5) > 0.1;
+                    if (checked)
+                        flagged += bad;
+                    char line[160];
+                    std::snprintf(line, sizeof(line), "| %-11s| %-18s|%7zu |%6zu |%6zu |%6zu |%7.3f | %-5s|",
+                                  name, pattern, keys.size(), collisions, low, high, avalanche, bad ? "poor" : "ok");
+                    cout << line << "\n";
+                }
+
+            void hash_test()
+            {
+                cout << "[===============================================================]" << std::endl;
+                cout << "[------------------ Run container test : hash ------------------]" << std::endl;
+                cout << "[-------------------------- API test ---------------------------]" << std::endl;
+                char buf[128];
+                for (size_t i = 0; i < sizeof(buf); ++i)
+                    buf[i] = static_cast<char>(i * 37 + 11);
+                cout << std::boolalpha;
+                /* 结果只取决于内容与长度，与地址是否对齐无关*/
+                bool aligned_same = true;
+                char moved[128 + 8];
+                for (size_t len = 0; len <= 100; ++len)
+                    for (size_t off = 1; off < 8; ++off)
+                    {
+                        std::memcpy(moved + off, buf, len);
+                        aligned_same &= hash_bytes(buf, len) == hash_bytes(moved + off, len);
+                    }
+                FUN_VALUE(aligned_same);
+                /* 同一段内容的各个前缀（覆盖每条长度分支）哈希互不相同*/
+                std::vector<uint64_t> prefixes;
+                for (size_t len = 0; len <= sizeof(buf); ++len)
+                    prefixes.push_back(hash_bytes(buf, len));
+                std::sort(prefixes.begin(), prefixes.end());
+                FUN_VALUE((std::unique(prefixes.begin(), prefixes.end()) == prefixes.end()));
+                FUN_VALUE((hash_bytes(buf, 32, 1) != hash_bytes(buf, 32, 2)));
+                FUN_VALUE((hash_bytes("", 0) != hash_bytes("", 0, 1)));
+
+                leptstl::string s("hello, leptstl");
+                FUN_VALUE((leptstl::hash<leptstl::string>()(s) == static_cast<size_t>(hash_bytes(s.data(), s.size()))));
+                FUN_VALUE((hash_mix(1) != hash_mix(2)));
+                FUN_VALUE(hash_mix(0));
+                FUN_VALUE((mixed_hash<int>()(42) == static_cast<size_t>(hash_mix(42))));
+
+                leptstl::unordered_set<int, leptstl::mixed_hash<int>> us;
+                for (int i = 0; i < 1000; ++i)
+                    us.insert(i << 12);
+                FUN_VALUE(us.size());
+                FUN_VALUE(us.count(4096));
+                FUN_VALUE(us.count(4095));
+                FUN_VALUE(us.stats().max_chain_length);
+                cout << std::noboolalpha;
+
+                cout << "[---------------------- hash quality ---------------------------]" << std::endl;
+                cout << "| hash       | keys              |      n | coll. |   low |  high |  aval. | stat |\n";
+                const size_t n = 1 << 16;
+                std::vector<std::string> seq, words, tail, ints, zeros;
+                for (size_t i = 0; i < n; ++i)
+                {
+                    char key[64];
+                    std::snprintf(key, sizeof(key), "%zu", i);
+                    seq.push_back(key);
+                    std::snprintf(key, sizeof(key), "user:%08zu:session", i);
+                    words.push_back(key);
+                    /* 只有末尾两个字节不同的长字符串*/
+                    std::string t(200, 'x');
+                    t[198] = static_cast<char>(i >> 8);
+                    t[199] = static_cast<char>(i);
+                    tail.push_back(t);
+                    /* 8 字节整数，步长 2^20，低位全为0*/
+                    const uint64_t v = static_cast<uint64_t>(i) << 20;
+                    ints.push_back(std::string(reinterpret_cast<const char*>(&v), sizeof(v)));
+                }
+                for (size_t i = 0; i < 256; ++i)
+                    zeros.push_back(std::string(i, '\0'));
+
+                size_t flagged = 0;
+                const struct
+                {
+                    const char* name;
+                    const std::vector<std::string>* keys;
+                } patterns[] = {
+                    { "0..n", &seq }, { "user:%08d:session", &words }, { "200B, last 2B", &tail },
+                    { "u64 i<<20", &ints }, { "zeros, len 0..255", &zeros }
+                };
+                for (size_t p = 0; p < sizeof(patterns) / sizeof(patterns[0]); ++p)
+                {
+                    quality("fnv1a", patterns[p].name, *patterns[p].keys, fnv1a, false, flagged);
+                    quality("hash_bytes", patterns[p].name, *patterns[p].keys, wy, true, flagged);
+                }
+                FUN_VALUE(flagged);
+                PASSED;
+                cout << "[------------------ End container test : hash ------------------]" << std::endl;
+            }
+
+        }   /* namespace hash_test */
+
+    }   /* namespace test */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_HASH_TEST_H__ */
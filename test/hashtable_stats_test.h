@@ -0,0 +1,209 @@
+/*************************************************************************
+	> File Name: hashtable_stats_test.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 01:26:44 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_HASHTABLE_STATS_TEST_H__
+#define LEPTSTL_HASHTABLE_STATS_TEST_H__
+
+/* hashtable::stats() 的测试，以及用 stats() 检查各个 leptstl::hash 特化在常见键值模式下是否退化：
+ * 成功查找的平均比较次数超过均匀哈希（1 + load/2）的两倍，或失败查找超过（1 + load）的两倍时标记为 DEGENERATE
+ * 浮点数另外检查相等的值（包括 0.0 与 -0.0、填充字节不同的 long double）是否得到相同的哈希值*/
+
+#include <cstring>
+#include <new>
+#include <vector>
+
+#include "../leptSTL/leptstring.h"
+#include "../leptSTL/unordered_set.h"
+#include "lept_test.h"
+
+namespace leptstl
+{
+    namespace test
+    {
+        namespace hashtable_stats_test
+        {
+            struct line64
+            {
+                char bytes[64];
+            };
+
+            inline bool is_degenerate(const hashtable_stats& s)
+            {
+                return s.probes_hit > 2 * (1 + s.load_factor / 2) || s.probes_miss > 2 * (1 + s.load_factor);
+            }
+
+            /* 用 leptstl::hash<K> 建表，输出一行统计，退化时计数*/
+            template <typename K>
+                void check(const char* type, const char* pattern, const std::vector<K>& keys, size_t& flagged)
+                {
+                    leptstl::unordered_set<K> s;
+                    for (size_t i = 0; i < keys.size(); ++i)
+                        s.insert(keys[i]);
+                    const hashtable_stats st = s.stats();
+                    const bool bad = is_degenerate(st);
+                    flagged += bad;
+                    char line[160];
+                    std::snprintf(line, sizeof(line), "| %-12s| %-16s|%6zu |%6.2f |%5zu |%7.2f |%7.2f |%6.1f%% | %-11s|",
+                                  type, pattern, st.size, st.load_factor, st.max_chain_length,
+                                  st.probes_hit, st.probes_miss, st.empty_bucket_fraction * 100,
+                                  bad ? "DEGENERATE" : "ok");
+                    cout << line << "\n";
+                }
+
+            /* 相等的浮点数必须得到相同的哈希值：分别在全 0 与全 1 的内存上构造同一个值，填充字节不同*/
+            template <typename F>
+                bool same_value_same_hash(F value)
+                {
+                    alignas(F) unsigned char a[sizeof(F)], b[sizeof(F)];
+                    std::memset(a, 0x00, sizeof(F));
+                    std::memset(b, 0xff, sizeof(F));
+                    F* x = new (a) F(value);
+                    F* y = new (b) F(value);
+                    leptstl::hash<F> h;
+                    return h(*x) == h(*y) && h(F(0)) == h(-F(0));
+                }
+
+            void hashtable_stats_test()
+            {
+                cout << "[===============================================================]" << std::endl;
+                cout << "[------------ Run container test : hashtable_stats -------------]" << std::endl;
+                cout << "[-------------------------- API test ---------------------------]" << std::endl;
+                leptstl::unordered_set<int> us;
+                for (int i = 0; i < 1000; ++i)
+                    us.insert(i * 7);
+                hashtable_stats st = us.stats();
+                FUN_VALUE(st.size);
+                FUN_VALUE(st.bucket_count);
+                FUN_VALUE(st.used_buckets);
+                FUN_VALUE(st.max_chain_length);
+                FUN_VALUE(st.mean_chain_length);
+                FUN_VALUE(st.probes_hit);
+                FUN_VALUE(st.probes_miss);
+                FUN_VALUE(st.chain_histogram[0]);
+                FUN_VALUE(st.chain_histogram[1]);
+                FUN_VALUE((st.memory_bytes >= st.bucket_bytes + st.node_bytes));
+
+                /* 所有键都落在同一个桶：链长等于元素个数*/
+                leptstl::unordered_multiset<int> ms;
+                for (int i = 0; i < 100; ++i)
+                    ms.insert(42);
+                st = ms.stats();
+                FUN_VALUE(st.max_chain_length);
+                FUN_VALUE(st.probes_hit);
+                FUN_VALUE(st.probes_miss);
+                FUN_VALUE(st.chain_histogram[hashtable_stats::histogram_size - 1]);
+                cout << std::boolalpha;
+                FUN_VALUE(is_degenerate(st));
+                cout << std::noboolalpha;
+
+                cout << "[--------------------- hash specializations --------------------]" << std::endl;
+                cout << "| type        | keys            |  size |  load |  max |    hit |   miss |  empty | status     |\n";
+                const size_t n = 4096;
+                size_t flagged = 0;
+                {
+                    std::vector<char> all;
+                    for (int i = 0; i < 256; ++i)
+                        all.push_back(static_cast<char>(i));
+                    check("char", "all values", all, flagged);
+                }
+                {
+                    std::vector<unsigned short> seq, stride;
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        seq.push_back(static_cast<unsigned short>(i));
+                        stride.push_back(static_cast<unsigned short>(i << 4));
+                    }
+                    check("ushort", "0..n", seq, flagged);
+                    check("ushort", "i*16", stride, flagged);
+                }
+                {
+                    std::vector<int> seq, s64, s4k, neg;
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        seq.push_back(static_cast<int>(i));
+                        s64.push_back(static_cast<int>(i * 64));
+                        s4k.push_back(static_cast<int>(i * 4096));
+                        neg.push_back(-static_cast<int>(i) - 1);
+                    }
+                    check("int", "0..n", seq, flagged);
+                    check("int", "i*64", s64, flagged);
+                    check("int", "i*4096", s4k, flagged);
+                    check("int", "-1..-n", neg, flagged);
+                }
+                {
+                    std::vector<unsigned long long> high, s1m;
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        high.push_back(static_cast<unsigned long long>(i) << 32);
+                        s1m.push_back(static_cast<unsigned long long>(i) << 20);
+                    }
+                    check("ull", "i<<32", high, flagged);
+                    check("ull", "i<<20", s1m, flagged);
+                }
+                {
+                    std::vector<int> ints(n);
+                    std::vector<line64> lines(n);
+                    std::vector<int*> int_ptrs;
+                    std::vector<line64*> line_ptrs;
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        int_ptrs.push_back(&ints[i]);
+                        line_ptrs.push_back(&lines[i]);
+                    }
+                    check("int*", "array", int_ptrs, flagged);
+                    check("line64*", "array", line_ptrs, flagged);
+                }
+                {
+                    std::vector<float> halves, recip;
+                    std::vector<double> dhalves, big;
+                    std::vector<long double> lhalves, lrecip;
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        halves.push_back(i * 0.5f);
+                        recip.push_back(1.0f / (i + 1));
+                        dhalves.push_back(i * 0.5);
+                        big.push_back(static_cast<double>(i) * 1048576.0);
+                        lhalves.push_back(i * 0.5L);
+                        lrecip.push_back(1.0L / (i + 1));
+                    }
+                    check("float", "i*0.5", halves, flagged);
+                    check("float", "1/(i+1)", recip, flagged);
+                    check("double", "i*0.5", dhalves, flagged);
+                    check("double", "i*2^20", big, flagged);
+                    check("long double", "i*0.5", lhalves, flagged);
+                    check("long double", "1/(i+1)", lrecip, flagged);
+                }
+                {
+                    std::vector<leptstl::string> keys, digits;
+                    char buf[32];
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        std::snprintf(buf, sizeof(buf), "key%zu", i);
+                        keys.push_back(leptstl::string(buf));
+                        std::snprintf(buf, sizeof(buf), "%08zu", i);
+                        digits.push_back(leptstl::string(buf));
+                    }
+                    check("string", "key0..keyn", keys, flagged);
+                    check("string", "%08d", digits, flagged);
+                }
+                FUN_VALUE(flagged);
+                cout << std::boolalpha;
+                FUN_VALUE(same_value_same_hash(1.25f));
+                FUN_VALUE(same_value_same_hash(1.25));
+                FUN_VALUE(same_value_same_hash(1.25L));
+                cout << std::noboolalpha;
+                PASSED;
+                cout << "[------------ End container test : hashtable_stats -------------]" << std::endl;
+            }
+
+        }   /* namespace hashtable_stats_test */
+
+    }   /* namespace test */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_HASHTABLE_STATS_TEST_H__ */
@@ -0,0 +1,117 @@
+/*************************************************************************
+	> File Name: hive_test.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 02:36:14 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_HIVE_TEST_H__
+#define LEPTSTL_HIVE_TEST_H__
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../leptSTL/hive.h"
+#include "lept_test.h"
+
+namespace leptstl
+{
+    namespace test
+    {
+        namespace hive_test
+        {
+            /* 随机插入删除，检查存活元素的地址不变、遍历得到的元素与记录一致*/
+            inline bool hive_check(size_t ops)
+            {
+                leptstl::hive<std::string> h;
+                std::vector<std::pair<const std::string*, std::string>> live;
+                srand(5);
+                bool ok = true;
+                for (size_t i = 0; i < ops && ok; ++i)
+                {
+                    const int dice = rand() % 10;
+                    if (dice < 5 || live.empty())
+                    {
+                        const std::string s = std::to_string(i);
+                        auto it = h.insert(s);
+                        live.push_back(std::make_pair(&*it, s));
+                    }
+                    else if (dice < 9)
+                    {
+                        const size_t k = rand() % live.size();
+                        h.erase(h.get_iterator(live[k].first));
+                        live[k] = live.back();
+                        live.pop_back();
+                    }
+                    else if (dice == 9 && rand() % 50 == 0)
+                    {
+                        h.clear();
+                        live.clear();
+                    }
+                    ok = h.size() == live.size();
+                    for (size_t k = 0; ok && k < live.size(); ++k)
+                        ok = *live[k].first == live[k].second;
+                    if (ok && i % 64 == 0)
+                    {
+                        size_t forward = 0, backward = 0;
+                        for (auto it = h.begin(); it != h.end(); ++it)
+                            ++forward;
+                        for (auto it = h.rbegin(); it != h.rend(); ++it)
+                            ++backward;
+                        ok = forward == live.size() && backward == live.size();
+                    }
+                }
+                return ok;
+            }
+
+            void hive_test()
+            {
+                cout << "[===============================================================]" << std::endl;
+                cout << "[------------------ Run container test : hive ------------------]" << std::endl;
+                cout << "[-------------------------- API test ---------------------------]" << std::endl;
+                int a[] = { 1, 2, 3, 4, 5 };
+                leptstl::hive<int> h1;
+                leptstl::hive<int> h2(3, 7);
+                leptstl::hive<int> h3(a, a + 5);
+                leptstl::hive<int> h4(h3);
+                leptstl::hive<int> h5(std::move(h2));
+                leptstl::hive<int> h6{ 9, 8, 7 };
+                h1 = h6;
+                COUT(h3);
+                COUT(h5);
+                FUN_VALUE(h3.size());
+                FUN_VALUE(h3.capacity());
+                cout << std::boolalpha;
+                FUN_VALUE((h3 == h4));
+                FUN_VALUE(h2.empty());
+                cout << std::noboolalpha;
+                FUN_AFTER(h1, h1.insert(6));
+                FUN_AFTER(h1, h1.emplace(5));
+                int* p = &*h3.begin();
+                FUN_AFTER(h3, h3.erase(h3.get_iterator(p + 1)));
+                FUN_AFTER(h3, h3.erase(h3.begin()));
+                FUN_AFTER(h3, h3.insert(10));
+                FUN_AFTER(h3, h3.insert(2, 11));
+                FUN_AFTER(h3, h3.erase(++h3.begin(), h3.end()));
+                FUN_VALUE(*h3.rbegin());
+                FUN_AFTER(h3, h3.reserve(1000));
+                FUN_VALUE(h3.capacity());
+                FUN_AFTER(h1, h1.swap(h3));
+                FUN_AFTER(h1, h1.clear());
+                FUN_VALUE(h1.size());
+                cout << "[------------------------- stress test -------------------------]" << std::endl;
+                cout << std::boolalpha;
+                FUN_VALUE(hive_check(LEN1));
+                cout << std::noboolalpha;
+                PASSED;
+                cout << "[------------------ End container test : hive ------------------]" << std::endl;
+            }
+
+        }   /* namespace hive_test */
+
+    }   /* namespace test */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_HIVE_TEST_H__ */
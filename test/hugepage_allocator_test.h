@@ -0,0 +1,72 @@
+/*************************************************************************
+	> File Name: hugepage_allocator_test.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Mon 19 Oct 2026 10:41:05 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_HUGEPAGE_ALLOCATOR_TEST_H__
+#define LEPTSTL_HUGEPAGE_ALLOCATOR_TEST_H__
+
+#include <cstdint>
+
+#include "../leptSTL/hugepage_allocator.h"
+#include "../leptSTL/vector.h"
+#include "../leptSTL/deque.h"
+#include "lept_test.h"
+
+namespace leptstl
+{
+    namespace test
+    {
+        namespace hugepage_allocator_test
+        {
+            void hugepage_allocator_test()
+            {
+                cout << "[===============================================================]" << std::endl;
+                cout << "[----------- Run allocator test : hugepage_allocator -----------]" << std::endl;
+                cout << "[-------------------------- API test ---------------------------]" << std::endl;
+                typedef leptstl::hugepage_allocator<int> huge_int;
+                leptstl::vector<int, huge_int> v1(5, 1);
+                leptstl::deque<int, huge_int> d1(3, 2);
+                /* 缓冲区取一个大页，才会真正由 hugepage_allocator 映射*/
+                leptstl::deque<int, huge_int, LEPTSTL_HUGEPAGE_SIZE / sizeof(int)> d2;
+                FUN_AFTER(v1, v1.push_back(6));
+                FUN_AFTER(v1, v1.insert(v1.begin() + 2, 2, 7));
+                FUN_AFTER(v1, v1.erase(v1.begin()));
+                FUN_AFTER(d1, d1.push_front(1));
+                FUN_AFTER(d1, d1.push_back(3));
+                leptstl::vector<int, huge_int> v2;
+                v2.reserve(LEN3);
+                for (size_t i = 0; i < LEN3; ++i)
+                    v2.push_back(static_cast<int>(i));
+                leptstl::vector<int, leptstl::hugepage_allocator<int, 0>> v3(v2.begin(), v2.end());
+                cout << std::boolalpha;
+                FUN_VALUE((reinterpret_cast<uintptr_t>(v2.data()) % LEPTSTL_HUGEPAGE_SIZE == 0));
+                FUN_VALUE((v2.size() == LEN3 && v2[LEN3 - 1] == static_cast<int>(LEN3 - 1)));
+                FUN_VALUE((v3.size() == v2.size() && v3[LEN3 / 2] == v2[LEN3 / 2]));
+                {
+                    /* 赋值后保留原来的大页映射与容量，析构时按原大小 munmap*/
+                    leptstl::vector<int, huge_int> v4(v2.begin(), v2.end());
+                    const size_t cap = v4.capacity();
+                    v4.resize(10);
+                    leptstl::vector<int, huge_int> v5(1000, 4);
+                    v4 = v5;
+                    FUN_VALUE((v4.capacity() == cap && v4.size() == 1000 && v4[999] == 4));
+                }
+                for (size_t i = 0; i < LEN3 / 5; ++i)
+                    d2.push_front(static_cast<int>(i));
+                FUN_VALUE((reinterpret_cast<uintptr_t>(d2.begin().first) % LEPTSTL_HUGEPAGE_SIZE == 0));
+                FUN_VALUE((d2.size() == LEN3 / 5 && d2.front() == static_cast<int>(LEN3 / 5 - 1) && d2.back() == 0));
+                cout << std::noboolalpha;
+                PASSED;
+                cout << "[----------- End allocator test : hugepage_allocator -----------]" << std::endl;
+            }
+
+        }   /* namespace hugepage_allocator_test */
+
+    }   /* namespace test */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_HUGEPAGE_ALLOCATOR_TEST_H__ */
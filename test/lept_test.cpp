@@ -17,6 +17,24 @@ using std::cout;
 #include "deque_test.h"
 #include "string_test.h"
 #include "unordered_set_test.h"
+#include "circular_buffer_test.h"
+#include "lockfree_queue_test.h"
+#include "concurrent_unordered_set_test.h"
+#include "btree_test.h"
+#include "unordered_map_test.h"
+#include "small_vector_test.h"
+#include "hugepage_allocator_test.h"
+#include "dynamic_bitset_test.h"
+#include "mmap_vector_test.h"
+#include "hive_test.h"
+#include "slot_map_test.h"
+#include "flat_map_test.h"
+#include "alloc_stats_test.h"
+#include "hashtable_stats_test.h"
+#include "hash_test.h"
+#include "static_perfect_set_test.h"
+#include "filter_test.h"
+#include "cuckoo_unordered_set_test.h"
 
 int main()
 {
@@ -31,6 +49,24 @@ int main()
     string_test::string_test();
     unordered_set_test::unordered_set_test();
     unordered_set_test::unordered_multiset_test();
+    circular_buffer_test::circular_buffer_test();
+    lockfree_queue_test::lockfree_queue_test();
+    concurrent_unordered_set_test::concurrent_unordered_set_test();
+    btree_test::btree_test();
+    unordered_map_test::unordered_map_test();
+    small_vector_test::small_vector_test();
+    hugepage_allocator_test::hugepage_allocator_test();
+    dynamic_bitset_test::dynamic_bitset_test();
+    mmap_vector_test::mmap_vector_test();
+    hive_test::hive_test();
+    slot_map_test::slot_map_test();
+    flat_map_test::flat_map_test();
+    alloc_stats_test::alloc_stats_test();
+    hashtable_stats_test::hashtable_stats_test();
+    hash_test::hash_test();
+    static_perfect_set_test::static_perfect_set_test();
+    filter_test::filter_test();
+    cuckoo_unordered_set_test::cuckoo_unordered_set_test();
 
     return 0;
 }
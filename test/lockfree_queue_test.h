@@ -0,0 +1,181 @@
+/*************************************************************************
+	> File Name: lockfree_queue_test.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Mon 19 Oct 2026 11:48:30 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_LOCKFREE_QUEUE_TEST_H__
+#define LEPTSTL_LOCKFREE_QUEUE_TEST_H__
+
+#include <thread>
+#include <vector>
+
+#include "../leptSTL/lockfree_queue.h"
+#include "lept_test.h"
+
+namespace leptstl
+{
+    namespace test
+    {
+        namespace lockfree_queue_test
+        {
+            typedef unsigned long long u64;
+
+            /* spsc 压力测试：生产者交替使用单个与批量写入，消费者交替使用单个与批量读取，检查顺序*/
+            bool spsc_stress(size_t count)
+            {
+                leptstl::spsc_queue<u64> q(1024);
+                bool ordered = true;
+                std::thread producer([&q, count]() {
+                    u64 batch[64];
+                    size_t i = 0;
+                    while (i < count)
+                    {
+                        if ((i / 64) & 1)
+                        {
+                            size_t n = 0;
+                            for (; n < 64 && i + n < count; ++n)
+                                batch[n] = i + n;
+                            size_t done = 0;
+                            while (done < n)
+                            {
+                                done += q.try_push_n(batch + done, n - done);
+                                if (done < n)
+                                    std::this_thread::yield();
+                            }
+                            i += n;
+                        }
+                        else
+                        {
+                            q.push(i++);
+                        }
+                    }
+                });
+                u64 expect = 0, out[32];
+                while (expect < count)
+                {
+                    if (expect & 1)
+                    {
+                        u64 v;
+                        q.pop(v);
+                        ordered = ordered && v == expect;
+                        ++expect;
+                    }
+                    else
+                    {
+                        const size_t n = q.try_pop_n(out, 32);
+                        if (n == 0)
+                            std::this_thread::yield();
+                        for (size_t k = 0; k < n; ++k, ++expect)
+                            ordered = ordered && out[k] == expect;
+                    }
+                }
+                producer.join();
+                return ordered && q.empty_approx();
+            }
+
+            /* mpmc 压力测试：每个元素高位为生产者编号、低位为序号，
+             * 检查总和，并检查同一消费者看到的同一生产者的序号单调递增*/
+            bool mpmc_stress(size_t producers, size_t consumers, size_t per_producer)
+            {
+                leptstl::mpmc_queue<u64> q(256);
+                std::atomic<u64> sum(0);
+                std::atomic<size_t> popped(0);
+                std::atomic<bool> ordered(true);
+                const size_t total = producers * per_producer;
+                std::vector<std::thread> threads;
+                for (size_t p = 0; p < producers; ++p)
+                {
+                    threads.emplace_back([&q, p, per_producer]() {
+                        for (size_t i = 0; i < per_producer; ++i)
+                            q.push((static_cast<u64>(p) << 32) | i);
+                    });
+                }
+                for (size_t c = 0; c < consumers; ++c)
+                {
+                    threads.emplace_back([&, producers]() {
+                        std::vector<long long> last(producers, -1);
+                        u64 local = 0, v;
+                        while (popped.load() < total)
+                        {
+                            if (!q.try_pop(v))
+                            {
+                                std::this_thread::yield();
+                                continue;
+                            }
+                            popped.fetch_add(1);
+                            const size_t p = static_cast<size_t>(v >> 32);
+                            const long long i = static_cast<long long>(v & 0xffffffffull);
+                            if (i <= last[p])
+                                ordered.store(false);
+                            last[p] = i;
+                            local += v;
+                        }
+                        sum.fetch_add(local);
+                    });
+                }
+                for (auto& t : threads)
+                    t.join();
+                u64 expect = 0;
+                for (size_t p = 0; p < producers; ++p)
+                    for (size_t i = 0; i < per_producer; ++i)
+                        expect += (static_cast<u64>(p) << 32) | i;
+                return ordered.load() && sum.load() == expect && q.empty_approx();
+            }
+
+            void lockfree_queue_test()
+            {
+                cout << "[===============================================================]" << std::endl;
+                cout << "[------------- Run container test : lockfree_queue --------------]" << std::endl;
+                cout << "[-------------------------- API test ---------------------------]" << std::endl;
+                leptstl::spsc_queue<int> sq(5);
+                int x = 0;
+                int arr[] = { 1,2,3,4,5,6,7,8,9,10 };
+                int out[10] = { 0 };
+                cout << std::boolalpha;
+                FUN_VALUE(sq.capacity());
+                FUN_VALUE(sq.try_push(1));
+                FUN_VALUE(sq.try_emplace(2));
+                FUN_VALUE(sq.try_push_n(arr + 2, 8));
+                FUN_VALUE(sq.size_approx());
+                FUN_VALUE(sq.try_push(100));
+                FUN_VALUE(sq.try_pop(x));
+                FUN_VALUE(x);
+                FUN_VALUE(sq.try_pop_n(out, 10));
+                FUN_VALUE(out[6]);
+                FUN_VALUE(sq.try_pop(x));
+                FUN_VALUE(sq.empty_approx());
+
+                leptstl::mpmc_queue<int> mq(3);
+                FUN_VALUE(mq.capacity());
+                FUN_VALUE(mq.try_push(1));
+                FUN_VALUE(mq.try_emplace(2));
+                FUN_VALUE(mq.try_push(3));
+                FUN_VALUE(mq.try_push(4));
+                FUN_VALUE(mq.try_push(5));
+                FUN_VALUE(mq.size_approx());
+                FUN_VALUE(mq.try_pop(x));
+                FUN_VALUE(x);
+                FUN_VALUE(mq.try_push(5));
+                FUN_VALUE(mq.try_pop(x));
+                FUN_VALUE(x);
+
+                cout << "[------------------------- stress test -------------------------]" << std::endl;
+                FUN_VALUE(spsc_stress(LEN1));
+                FUN_VALUE(mpmc_stress(1, 1, LEN1 _S));
+                FUN_VALUE(mpmc_stress(2, 2, LEN1 _S));
+                FUN_VALUE(mpmc_stress(4, 2, LEN1 _S));
+                cout << std::noboolalpha;
+                PASSED;
+                cout << "[------------- End container test : lockfree_queue --------------]" << std::endl;
+            }
+
+        }   /* namespace lockfree_queue_test */
+
+    }   /* namespace test */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_LOCKFREE_QUEUE_TEST_H__ */
+
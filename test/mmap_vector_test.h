@@ -0,0 +1,112 @@
+/*************************************************************************
+	> File Name: mmap_vector_test.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 01:04:27 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_MMAP_VECTOR_TEST_H__
+#define LEPTSTL_MMAP_VECTOR_TEST_H__
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../leptSTL/mmap_vector.h"
+#include "../leptSTL/algo.h"
+#include "lept_test.h"
+
+namespace leptstl
+{
+    namespace test
+    {
+        namespace mmap_vector_test
+        {
+            inline std::string temp_path(const char* name)
+            {
+                return std::string("/tmp/leptstl_") + name + "_" + std::to_string(::getpid()) + ".bin";
+            }
+
+            inline size_t file_size(const std::string& path)
+            {
+                struct stat st;
+                return ::stat(path.c_str(), &st) == 0 ? static_cast<size_t>(st.st_size) : 0;
+            }
+
+            inline bool push_to_read_only(leptstl::mmap_vector<int>& m)
+            {
+                try
+                {
+                    m.push_back(0);
+                }
+                catch (const std::runtime_error&)
+                {
+                    return true;
+                }
+                return false;
+            }
+
+            void mmap_vector_test()
+            {
+                cout << "[===============================================================]" << std::endl;
+                cout << "[--------------- Run container test : mmap_vector ---------------]" << std::endl;
+                cout << "[-------------------------- API test ---------------------------]" << std::endl;
+                const std::string path = temp_path("mmap_vector");
+                {
+                    leptstl::mmap_vector<int> m1(path, leptstl::mmap_mode::truncate);
+                    for (int i = 9; i >= 0; --i)
+                        m1.push_back(i * 2);
+                    FUN_VALUE(m1.size());
+                    COUT(m1);
+                    FUN_AFTER(m1, leptstl::sort(m1.begin(), m1.end()));
+                    FUN_VALUE(*leptstl::lower_bound(m1.begin(), m1.end(), 7));
+                    FUN_AFTER(m1, m1.emplace_back(100));
+                    FUN_AFTER(m1, m1.pop_back());
+                    FUN_AFTER(m1, m1.resize(12, 1));
+                    FUN_VALUE(m1.back());
+                    FUN_VALUE(m1.at(3));
+                    leptstl::mmap_vector<int> m2(std::move(m1));
+                    FUN_AFTER(m2, m2.flush());
+                    FUN_VALUE(file_size(path));
+                }
+                {
+                    leptstl::mmap_vector<int> m3(path, leptstl::mmap_mode::read_only);
+                    COUT(m3);
+                    cout << std::boolalpha;
+                    FUN_VALUE(m3.read_only());
+                    FUN_VALUE(push_to_read_only(m3));
+                    cout << std::noboolalpha;
+                    FUN_VALUE(m3.size());
+                }
+                {
+                    leptstl::mmap_vector<int> m4(path);
+                    FUN_AFTER(m4, m4.push_back(7));
+                    FUN_AFTER(m4, m4.close());
+                    FUN_VALUE(file_size(path));
+                }
+                {
+                    /* 没有 close() 直接析构，文件也截断到 size()*/
+                    {
+                        leptstl::mmap_vector<int> m5(path, leptstl::mmap_mode::truncate);
+                        for (int i = 0; i < 3; ++i)
+                            m5.push_back(i);
+                    }
+                    leptstl::mmap_vector<int> m6(path, leptstl::mmap_mode::read_only);
+                    FUN_VALUE(m6.size());
+                    FUN_VALUE(file_size(path));
+                }
+                ::unlink(path.c_str());
+                PASSED;
+                cout << "[--------------- End container test : mmap_vector ---------------]" << std::endl;
+            }
+
+        }   /* namespace mmap_vector_test */
+
+    }   /* namespace test */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_MMAP_VECTOR_TEST_H__ */
@@ -0,0 +1,120 @@
+/*************************************************************************
+	> File Name: slot_map_test.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 03:52:30 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_SLOT_MAP_TEST_H__
+#define LEPTSTL_SLOT_MAP_TEST_H__
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../leptSTL/slot_map.h"
+#include "lept_test.h"
+
+namespace leptstl
+{
+    namespace test
+    {
+        namespace slot_map_test
+        {
+            /* 随机插入删除，检查有效句柄都能找到正确的值、失效句柄都找不到*/
+            inline bool slot_map_check(size_t ops)
+            {
+                leptstl::slot_map<std::string> m;
+                std::vector<std::pair<uint64_t, std::string>> live;
+                std::vector<uint64_t> dead;
+                srand(9);
+                bool ok = true;
+                for (size_t i = 0; i < ops && ok; ++i)
+                {
+                    const int dice = rand() % 10;
+                    if (dice < 6 || live.empty())
+                    {
+                        const std::string s = std::to_string(i);
+                        live.push_back(std::make_pair(m.insert(s), s));
+                    }
+                    else if (dice < 9)
+                    {
+                        const size_t k = rand() % live.size();
+                        ok = m.erase(live[k].first);
+                        dead.push_back(live[k].first);
+                        live[k] = live.back();
+                        live.pop_back();
+                    }
+                    else
+                    {
+                        const size_t k = rand() % m.size();
+                        const uint64_t h = m.handle_at(k);
+                        m.erase(m.begin() + k);
+                        dead.push_back(h);
+                        for (size_t j = 0; j < live.size(); ++j)
+                        {
+                            if (live[j].first == h)
+                            {
+                                live[j] = live.back();
+                                live.pop_back();
+                                break;
+                            }
+                        }
+                    }
+                    ok = ok && m.size() == live.size();
+                    for (size_t k = 0; ok && k < live.size(); ++k)
+                        ok = m.find(live[k].first) != nullptr && *m.find(live[k].first) == live[k].second;
+                    for (size_t k = 0; ok && k < dead.size(); ++k)
+                        ok = !m.contains(dead[k]);
+                    if (dead.size() > 256)
+                        dead.erase(dead.begin(), dead.begin() + 128);
+                }
+                return ok;
+            }
+
+            void slot_map_test()
+            {
+                cout << "[===============================================================]" << std::endl;
+                cout << "[---------------- Run container test : slot_map ----------------]" << std::endl;
+                cout << "[-------------------------- API test ---------------------------]" << std::endl;
+                leptstl::slot_map<int> m1;
+                const uint64_t h1 = m1.insert(10);
+                const uint64_t h2 = m1.insert(20);
+                const uint64_t h3 = m1.emplace(30);
+                COUT(m1);
+                FUN_VALUE(m1.size());
+                FUN_VALUE(m1[h2]);
+                FUN_VALUE(m1.at(h3));
+                cout << std::boolalpha;
+                FUN_VALUE(m1.erase(h1));
+                FUN_VALUE(m1.erase(h1));
+                FUN_VALUE(m1.contains(h1));
+                FUN_VALUE((m1.find(h1) == nullptr));
+                FUN_VALUE(m1.contains(leptstl::slot_map<int>::null_handle));
+                COUT(m1);
+                const uint64_t h4 = m1.insert(40);
+                FUN_VALUE(((h4 & 0xffffffffu) == (h1 & 0xffffffffu)));
+                FUN_VALUE((h4 >> 32));
+                COUT(m1);
+                FUN_VALUE((m1.handle_at(0) == h3));
+                FUN_AFTER(m1, m1.erase(m1.begin()));
+                leptstl::slot_map<int> m2(m1);
+                FUN_AFTER(m2, m2.clear());
+                FUN_VALUE(m2.contains(h2));
+                cout << std::noboolalpha;
+                FUN_AFTER(m1, m1.swap(m2));
+                cout << "[------------------------- stress test -------------------------]" << std::endl;
+                cout << std::boolalpha;
+                FUN_VALUE(slot_map_check(LEN1 _SS));
+                cout << std::noboolalpha;
+                PASSED;
+                cout << "[---------------- End container test : slot_map ----------------]" << std::endl;
+            }
+
+        }   /* namespace slot_map_test */
+
+    }   /* namespace test */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_SLOT_MAP_TEST_H__ */
@@ -0,0 +1,142 @@
+/*************************************************************************
+	> File Name: small_vector_test.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Mon 19 Oct 2026 08:52:10 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_SMALL_VECTOR_TEST_H__
+#define LEPTSTL_SMALL_VECTOR_TEST_H__
+
+#include <string>
+#include <vector>
+
+#include "../leptSTL/small_vector.h"
+#include "lept_test.h"
+
+namespace leptstl
+{
+    namespace test
+    {
+        namespace small_vector_test
+        {
+            /* 对 std::vector 做随机的插入删除与移动、交换，检查结果一致*/
+            template <size_t N>
+                bool small_vector_check(size_t ops)
+                {
+                    leptstl::small_vector<std::string, N> a, b;
+                    std::vector<std::string> ra, rb;
+                    srand(7);
+                    bool ok = true;
+                    for (size_t i = 0; i < ops && ok; ++i)
+                    {
+                        const std::string s = std::to_string(i);
+                        const int dice = rand() % 10;
+                        if (dice < 4)
+                        {
+                            a.push_back(s);
+                            ra.push_back(s);
+                        }
+                        else if (dice < 5)
+                        {
+                            const size_t p = ra.empty() ? 0 : rand() % (ra.size() + 1);
+                            a.insert(a.begin() + p, 2, s);
+                            ra.insert(ra.begin() + p, 2, s);
+                        }
+                        else if (dice < 6 && !ra.empty())
+                        {
+                            const size_t p = rand() % ra.size();
+                            a.emplace(a.begin() + p, a[ra.size() - 1]);
+                            ra.emplace(ra.begin() + p, ra[ra.size() - 1]);
+                        }
+                        else if (dice < 8 && !ra.empty())
+                        {
+                            const size_t p = rand() % ra.size();
+                            const size_t q = leptstl::min(ra.size(), p + 1 + rand() % 3);
+                            a.erase(a.begin() + p, a.begin() + q);
+                            ra.erase(ra.begin() + p, ra.begin() + q);
+                        }
+                        else if (dice < 9)
+                        {
+                            a.swap(b);
+                            ra.swap(rb);
+                        }
+                        else
+                        {
+                            leptstl::small_vector<std::string, N> t(std::move(a));
+                            a = std::move(b);
+                            b = t;
+                            a.shrink_to_fit();
+                            std::vector<std::string> rt(std::move(ra));
+                            ra = std::move(rb);
+                            rb = rt;
+                        }
+                        ok = a.size() == ra.size() && b.size() == rb.size();
+                        for (size_t j = 0; ok && j < ra.size(); ++j)
+                            ok = a[j] == ra[j];
+                        for (size_t j = 0; ok && j < rb.size(); ++j)
+                            ok = b[j] == rb[j];
+                    }
+                    return ok;
+                }
+
+            void small_vector_test()
+            {
+                cout << "[===============================================================]" << std::endl;
+                cout << "[--------------- Run container test : small_vector --------------]" << std::endl;
+                cout << "[-------------------------- API test ---------------------------]" << std::endl;
+                int a[] = { 1, 2, 3, 4, 5 };
+                leptstl::small_vector<int, 4> v1;
+                leptstl::small_vector<int, 4> v2(3, 7);
+                leptstl::small_vector<int, 4> v3(a, a + 5);
+                leptstl::small_vector<int, 4> v4(v3);
+                leptstl::small_vector<int, 4> v5(std::move(v2));
+                leptstl::small_vector<int, 4> v6{ 9, 8, 7 };
+                v1 = v6;
+
+                cout << std::boolalpha;
+                FUN_VALUE(v1.capacity());
+                FUN_VALUE(v1.is_inline());
+                FUN_VALUE(v3.is_inline());
+                FUN_VALUE((v3 == v4));
+                FUN_VALUE((v5 < v6));
+                cout << std::noboolalpha;
+                FUN_AFTER(v1, v1.push_back(6));
+                FUN_AFTER(v1, v1.emplace_back(5));
+                FUN_VALUE(v1.capacity());
+                FUN_AFTER(v1, v1.emplace(v1.begin(), 0));
+                FUN_AFTER(v1, v1.insert(v1.begin() + 2, 2, 3));
+                FUN_AFTER(v1, v1.insert(v1.end(), a, a + 3));
+                FUN_AFTER(v1, v1.erase(v1.begin()));
+                FUN_AFTER(v1, v1.erase(v1.begin(), v1.begin() + 3));
+                FUN_AFTER(v1, v1.pop_back());
+                FUN_AFTER(v1, v1.reverse());
+                FUN_VALUE(v1.front());
+                FUN_VALUE(v1.back());
+                FUN_VALUE(v1[1]);
+                FUN_VALUE(v1.at(2));
+                FUN_VALUE(*v1.rbegin());
+                FUN_AFTER(v1, v1.resize(3));
+                FUN_AFTER(v1, v1.shrink_to_fit());
+                FUN_VALUE(v1.capacity());
+                FUN_AFTER(v1, v1.resize(6, 1));
+                FUN_AFTER(v1, v1.swap(v5));
+                FUN_AFTER(v5, v5.assign(2, 4));
+                FUN_AFTER(v5, v5.clear());
+                FUN_VALUE(v5.size());
+                cout << "[------------------------- stress test -------------------------]" << std::endl;
+                cout << std::boolalpha;
+                FUN_VALUE(small_vector_check<1>(LEN1 _SS));
+                FUN_VALUE(small_vector_check<8>(LEN1 _SS));
+                cout << std::noboolalpha;
+                PASSED;
+                cout << "[--------------- End container test : small_vector --------------]" << std::endl;
+            }
+
+        }   /* namespace small_vector_test */
+
+    }   /* namespace test */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_SMALL_VECTOR_TEST_H__ */
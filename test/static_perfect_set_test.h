@@ -0,0 +1,105 @@
+/*************************************************************************
+	> File Name: static_perfect_set_test.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 05:02:36 PM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_STATIC_PERFECT_SET_TEST_H__
+#define LEPTSTL_STATIC_PERFECT_SET_TEST_H__
+
+/* static_perfect_set 的测试*/
+
+#include <stdexcept>
+
+#include "../leptSTL/leptstring.h"
+#include "../leptSTL/static_perfect_set.h"
+#include "lept_test.h"
+
+namespace leptstl
+{
+    namespace test
+    {
+        namespace static_perfect_set_test
+        {
+            constexpr auto methods = leptstl::make_static_perfect_set(
+                "GET", "HEAD", "POST", "PUT", "DELETE", "CONNECT", "OPTIONS", "TRACE", "PATCH");
+
+            /* 编译期即可确定的属性*/
+            static_assert(methods.size() == 9, "static_perfect_set size");
+            static_assert(decltype(methods)::table_size == 32, "static_perfect_set table size");
+
+            void static_perfect_set_test()
+            {
+                cout << "[===============================================================]" << std::endl;
+                cout << "[------------ Run container test : static_perfect_set ----------]" << std::endl;
+                cout << "[-------------------------- API test ---------------------------]" << std::endl;
+                FUN_VALUE(methods.size());
+                FUN_VALUE(methods.table_size);
+                FUN_VALUE(sizeof(methods));
+                size_t found = 0;
+                for (size_t i = 0; i < methods.size(); ++i)
+                    found += methods.find(methods.key(i)) == i;
+                FUN_VALUE(found);
+                FUN_VALUE(methods.find("POST"));
+                FUN_VALUE(methods.find("PATCH"));
+                FUN_VALUE(methods.count("GET"));
+                /* 前缀、加长、大小写不同与空串都不应命中*/
+                FUN_VALUE(methods.count("GE"));
+                FUN_VALUE(methods.count("GETS"));
+                FUN_VALUE(methods.count("get"));
+                FUN_VALUE(methods.count(""));
+                FUN_VALUE(methods.contains("DELETEX", 6));
+                FUN_VALUE(methods.key_size(5));
+
+                leptstl::string s("OPTIONS");
+                FUN_VALUE(methods.find(s));
+                s.push_back('!');
+                FUN_VALUE(methods.count(s));
+
+                /* 编译期与运行期的哈希在各个长度上一致（覆盖不足 8 字节、整 8 字节与重叠读取的尾部）*/
+                const char text[] = "abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJ";
+                bool same_hash = true;
+                for (size_t len = 0; len + 1 < sizeof(text); ++len)
+                    same_hash &= static_string_hash(text, len, 7) == runtime_string_hash(text, len, 7);
+                cout << std::boolalpha;
+                FUN_VALUE(same_hash);
+                cout << std::noboolalpha;
+
+                /* 运行期构造，单个键与含空串的表*/
+                const char* const single_keys[] = { "only" };
+                leptstl::static_perfect_set<1> single(single_keys);
+                FUN_VALUE(single.count("only"));
+                FUN_VALUE(single.count("onl"));
+                const char* const with_empty[] = { "", "a", "ab", "abc" };
+                leptstl::static_perfect_set<4> prefixes(with_empty);
+                FUN_VALUE(prefixes.find(""));
+                FUN_VALUE(prefixes.find("abc"));
+                FUN_VALUE(prefixes.count("abcd"));
+
+                /* 重复的键找不到无冲突的种子，运行期构造抛出异常*/
+                const char* const dup_keys[] = { "GET", "POST", "GET" };
+                bool thrown = false;
+                try
+                {
+                    leptstl::static_perfect_set<3> dup(dup_keys);
+                    (void)dup;
+                }
+                catch (const std::invalid_argument&)
+                {
+                    thrown = true;
+                }
+                cout << std::boolalpha;
+                FUN_VALUE(thrown);
+                cout << std::noboolalpha;
+                PASSED;
+                cout << "[------------ End container test : static_perfect_set ----------]" << std::endl;
+            }
+
+        }   /* namespace static_perfect_set_test */
+
+    }   /* namespace test */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_STATIC_PERFECT_SET_TEST_H__ */
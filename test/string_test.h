@@ -85,6 +85,14 @@ namespace leptstl
                 FUN_VALUE(str.size());
                 STR_FUN_AFTER(str, str.resize(20, 'x'));
                 FUN_VALUE(str.size());
+                STR_FUN_AFTER(str, str.resize_default_init(5));
+                auto overwrite_tail = [](char* p, size_t n) {
+                    p[5] = 'y';
+                    p[6] = 'z';
+                    return n - 1;
+                };
+                STR_FUN_AFTER(str, str.resize_and_overwrite(8, overwrite_tail));
+                FUN_VALUE(str.size());
                 STR_FUN_AFTER(str, str.clear());
               
                 STR_FUN_AFTER(str, str = "string");
@@ -196,6 +204,7 @@ namespace leptstl
                 cout << " str3 + \" success\" : " << str3 + " success" << std::endl;
                 cout << " \"My \" + str3 : " << "My " + str3 << std::endl;
                 cout << " str3 + str4 : " << str3 + str4 << std::endl;
+                PASSED;
                 /*PASSED;
               #ifPERFORMANCE_TEST_ON
                 cout << "[--------------------- Performance Testing ---------------------]" << std::endl;
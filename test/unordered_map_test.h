@@ -0,0 +1,113 @@
+/*************************************************************************
+	> File Name: unordered_map_test.h
+	> Author: YWH
+	> Mail: 925957192@qq.com
+	> Created Time: Tue 20 Oct 2026 10:02:51 AM EDT
+ ************************************************************************/
+
+#ifndef LEPTSTL_UNORDERED_MAP_TEST_H__
+#define LEPTSTL_UNORDERED_MAP_TEST_H__
+
+#include "../leptSTL/unordered_map.h"
+#include "lept_test.h"
+
+namespace leptstl
+{
+    namespace test
+    {
+        namespace unordered_map_test
+        {
+            /* 统计构造次数的实值类型，用来检查 try_emplace / operator[] 命中时不构造对象*/
+            struct counted
+            {
+                static int constructed;
+                int v;
+                counted() : v(0) { ++constructed; }
+                explicit counted(int x) : v(x) { ++constructed; }
+                counted(const counted& rhs) : v(rhs.v) { ++constructed; }
+                counted(counted&& rhs) : v(rhs.v) { ++constructed; }
+                counted& operator=(const counted& rhs) { v = rhs.v; return *this; }
+                bool operator==(const counted& rhs) const { return v == rhs.v; }
+            };
+            int counted::constructed = 0;
+
+            void unordered_map_test()
+            {
+                cout << "[===============================================================]" << std::endl;
+                cout << "[-------------- Run container test : unordered_map -------------]" << std::endl;
+                cout << "[-------------------------- API test ---------------------------]" << std::endl;
+                leptstl::unordered_map<int, int> um1;
+                leptstl::unordered_map<int, int> um2(520);
+                leptstl::unordered_map<int, int> um3{ {1,1}, {2,4}, {3,9} };
+                leptstl::unordered_map<int, int> um4(um3.begin(), um3.end());
+                leptstl::unordered_map<int, int> um5(um3);
+                leptstl::unordered_map<int, int> um6(std::move(um5));
+                leptstl::unordered_map<int, int> um7;
+                um7 = um3;
+
+                um1[1] = 10;
+                um1[2] += 20;
+                cout << std::boolalpha;
+                FUN_VALUE(um1[1]);
+                FUN_VALUE(um1.at(2));
+                FUN_VALUE(um1.emplace(3, 30).second);
+                FUN_VALUE(um1.insert(leptstl::make_pair(3, 33)).second);
+                FUN_VALUE(um1.try_emplace(3, 333).second);
+                FUN_VALUE(um1[3]);
+                FUN_VALUE(um1.insert_or_assign(3, 3333).second);
+                FUN_VALUE(um1[3]);
+                FUN_VALUE(um1.insert_or_assign(4, 40).second);
+                FUN_VALUE(um1.size());
+                FUN_VALUE(um1.count(4));
+                FUN_VALUE(um1.erase(4));
+                FUN_VALUE((um1.find(4) == um1.end()));
+                FUN_VALUE((um3 == um4));
+                FUN_VALUE((um3 == um6));
+                FUN_VALUE((um1 != um7));
+                try
+                {
+                    um1.at(100);
+                }
+                catch (std::out_of_range&)
+                {
+                    cout << " um1.at(100) : out_of_range\n";
+                }
+                int sum = 0;
+                for (auto& kv : um1)
+                    sum += kv.second;
+                FUN_VALUE(sum);
+                um7.clear();
+                FUN_VALUE(um7.empty());
+
+                /* 命中时 try_emplace / operator[] 不构造任何实值对象*/
+                leptstl::unordered_map<int, counted> cm;
+                cm.try_emplace(1, 100);
+                counted::constructed = 0;
+                cm.try_emplace(1, 200);
+                cm[1];
+                FUN_VALUE(counted::constructed);
+                cm[2];
+                cm.try_emplace(3, 300);
+                FUN_VALUE(counted::constructed);
+                FUN_VALUE(cm[1].v);
+
+                leptstl::unordered_multimap<int, int> umm{ {1,1}, {1,2}, {2,3} };
+                FUN_VALUE(umm.count(1));
+                FUN_VALUE(umm.insert(leptstl::make_pair(1, 3))->second);
+                FUN_VALUE(umm.erase(1));
+                FUN_VALUE(umm.size());
+                leptstl::unordered_multimap<int, int> umm2{ {2,3} };
+                FUN_VALUE((umm == umm2));
+                cout << std::noboolalpha;
+                PASSED;
+                cout << "[-------------- End container test : unordered_map -------------]" << std::endl;
+            }
+
+        }   /* namespace unordered_map_test */
+
+    }   /* namespace test */
+
+}   /* namespace leptstl */
+
+#endif  /* LEPTSTL_UNORDERED_MAP_TEST_H__ */
+
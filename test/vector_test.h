@@ -10,6 +10,7 @@
 
 #include <vector>
 #include "../leptSTL/vector.h"
+#include "../leptSTL/leptstring.h"
 #include "lept_test.h"
 
 namespace leptstl 
@@ -18,6 +19,69 @@ namespace leptstl
     {
         namespace vector_test 
         {
+            /* 包一层但不特化 is_trivially_relocatable，扩容时仍逐个移动构造再析构*/
+            struct plain_string
+            {
+                leptstl::string s;
+                plain_string(const char* p) :s(p) {}
+            };
+
+            /* 按可平凡搬迁处理的 string 在 vector 中增删时应与逐个移动的结果一致*/
+            bool relocate_check()
+            {
+                leptstl::vector<leptstl::string> v;
+                std::vector<std::string> ref;
+                char buf[16];
+                for (int i = 0; i < 1000; ++i)
+                {
+                    std::snprintf(buf, sizeof(buf), "str%d", i);
+                    if (i % 7 == 3)
+                    {
+                        v.insert(v.begin() + v.size() / 2, leptstl::string(buf));
+                        ref.insert(ref.begin() + ref.size() / 2, buf);
+                    }
+                    else if (i % 11 == 5)
+                    {
+                        v.insert(v.begin() + 1, 2, leptstl::string(buf));
+                        ref.insert(ref.begin() + 1, 2, buf);
+                    }
+                    else if (i % 13 == 0 && !v.empty())
+                    {
+                        v.erase(v.begin());
+                        ref.erase(ref.begin());
+                    }
+                    else
+                    {
+                        v.emplace_back(buf);
+                        ref.emplace_back(buf);
+                    }
+                }
+                v.erase(v.begin() + 10, v.begin() + 100);
+                ref.erase(ref.begin() + 10, ref.begin() + 100);
+                v.shrink_to_fit();
+                bool ok = v.size() == ref.size();
+                for (size_t i = 0; ok && i < v.size(); ++i)
+                    ok = std::string(v[i].c_str()) == ref[i];
+                return ok;
+            }
+
+            /* 复制赋值时 rhs 比当前元素多但不超过容量：容量必须保持不变，
+             * realloc_allocator 按分配时的个数选择 free 或 munmap，记录的容量变小会在析构时出错*/
+            template <typename Vec>
+                bool assign_keeps_capacity()
+                {
+                    Vec a;
+                    a.reserve(1 << 20);
+                    a.push_back(1);
+                    const size_t cap = a.capacity();
+                    Vec b(100, 7);
+                    a = b;
+                    bool ok = a.capacity() == cap && a.size() == 100 && a[99] == 7;
+                    a.resize(cap + 1, 3);   /* 按原容量扩容*/
+                    ok = ok && a.size() == cap + 1 && a[99] == 7 && a[cap] == 3;
+                    return ok;
+                }
+
             void vector_test()
             {
                 cout << "[============================================================]\n";
@@ -108,6 +172,26 @@ namespace leptstl
   PASSED;
 #endif
   std::cout << "[----------------- End container test : vector -----------------]\n";*/
+                cout << std::boolalpha;
+                FUN_VALUE(leptstl::is_trivially_relocatable<int>::value);
+                FUN_VALUE(leptstl::is_trivially_relocatable<leptstl::string>::value);
+                FUN_VALUE(leptstl::is_trivially_relocatable<leptstl::vector<int>>::value);
+                FUN_VALUE(leptstl::is_trivially_relocatable<plain_string>::value);
+                FUN_VALUE(relocate_check());
+                FUN_VALUE(assign_keeps_capacity<leptstl::vector<int>>());
+                cout << std::noboolalpha;
+                leptstl::vector<int> v11(3, 1);
+                auto fill_tail = [](int* p, size_t n) {
+                    for (size_t i = 3; i < n; ++i)
+                        p[i] = static_cast<int>(i);
+                    return n - 1;
+                };
+                FUN_AFTER(v11, v11.resize_and_overwrite(6, fill_tail));
+                FUN_AFTER(v11, v11.resize_default_init(2));
+                FUN_VALUE(v11.size());
+                FUN_AFTER(v11, v11.resize_default_init(4));
+                FUN_VALUE(v11.size());
+                PASSED;
 
             } /* void vector_test */
 